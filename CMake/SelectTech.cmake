@@ -107,6 +107,9 @@ if(CYME_FMA_FOUND)
     endif(CYME_SSE_FOUND)
 endif(CYME_FMA_FOUND)
 
+#micro-architecture of the cost model of the FMA contraction
+set(CYME_CPU "generic" CACHE STRING "Micro-architecture for the FMA contraction: generic, haswell, skylake, zen")
+
 #generate the define file
 configure_file(${CMAKE_CURRENT_LIST_DIR}/configuration.h.in ${PROJECT_BINARY_DIR}/include/${PROJECT_INCLUDE_NAME}/configuration.h @ONLY)
 list(APPEND COMMON_INCLUDES ${PROJECT_BINARY_DIR}/include/${PROJECT_INCLUDE_NAME}/configuration.h)
@@ -40,6 +40,7 @@
 #define CYME_EXPR_VEC_HPP
 
 #include <iostream>
+#include <type_traits>
 
 namespace cyme {
 /** \cond */
@@ -51,11 +52,67 @@ class vec_scalar;
 template <class T, cyme::simd O, int N>
 struct vec_simd;
 
+// forward declarations
+template <class T, cyme::simd O, int N>
+class vec_field;
+
 // forward declarations
 template <class T, cyme::simd O, int N, int M>
 forceinline vec_simd<T, O, N> pow(const vec_simd<T, O, N> &lhs);
+
+// forward declarations
+template <class T, cyme::simd O, int N, class OP1, int M>
+class vec_pow;
+
+// forward declarations
+template <int K, class T, cyme::simd O, int N>
+forceinline vec_simd<T, O, N> rcp(vec_simd<T, O, N> const &rhs);
+
+// forward declarations
+template <int K, class T, cyme::simd O, int N>
+forceinline vec_simd<T, O, N> rsqrt(vec_simd<T, O, N> const &rhs);
+
+// forward declarations
+template <int K, class T, cyme::simd O, int N>
+forceinline vec_simd<T, O, N> fast_div(vec_simd<T, O, N> const &lhs, vec_simd<T, O, N> const &rhs);
+
+// forward declarations
+template <class T, cyme::simd O, int N, class OP1, class C, cyme::poly_scheme S>
+class vec_polyval;
+
+// forward declarations
+template <class T, cyme::simd O, int N, class OP1, class P, class Q, cyme::poly_scheme S>
+class vec_ratval;
 /** \endcond */
 
+/** read access to the operands of the vertices, friend of all of them (simplifications, tie) */
+struct vertex_access {
+    template <class V>
+    static forceinline auto op1(V const &v) -> decltype((v.op1)) {
+        return v.op1;
+    }
+
+    template <class V>
+    static forceinline auto op2(V const &v) -> decltype((v.op2)) {
+        return v.op2;
+    }
+
+    template <class V>
+    static forceinline auto op3(V const &v) -> decltype((v.op3)) {
+        return v.op3;
+    }
+
+    template <class V>
+    static forceinline auto op4(V const &v) -> decltype((v.op4)) {
+        return v.op4;
+    }
+
+    template <class V>
+    static forceinline auto op5(V const &v) -> decltype((v.op5)) {
+        return v.op5;
+    }
+};
+
 /** Primary vertex */
 template <class T, cyme::simd O, int N>
 struct vec_traits {
@@ -68,9 +125,132 @@ struct vec_traits<vec_scalar<T, O, N>, O, N> {
     typedef vec_scalar<T, O, N> value_type;
 };
 
+/** Sethi-Ullman number of a vertex: the registers needed to evaluate its subtree without spill.
+ *  A leaf needs one register, a vertex with two subtrees of the same number needs one more (the result of the
+ *  first waits into a register), else the number of the larger one. The number is per vec_simd, multiply by
+ *  the unroll factor for the hardware registers.
+ */
+template <class V>
+struct vertex_registers;
+
+/** \cond */
+template <int L1, int L2>
+struct sethi_ullman {
+    static const int value = (L1 == L2) ? L1 + 1 : ((L1 > L2) ? L1 : L2);
+};
+
+template <class T, cyme::simd O, int N>
+struct vertex_registers<vec_simd<T, O, N>> {
+    static const int value = 1;
+};
+
+template <class T, cyme::simd O, int N>
+struct vertex_registers<vec_scalar<T, O, N>> {
+    static const int value = 1;
+};
+
+template <class T, cyme::simd O, int N>
+struct vertex_registers<vec_field<T, O, N>> {
+    static const int value = 1;
+};
+
+template <template <class, cyme::simd, int, class> class V, class T, cyme::simd O, int N, class OP1>
+struct vertex_registers<V<T, O, N, OP1>> {
+    static const int value = vertex_registers<OP1>::value;
+};
+
+template <template <class, cyme::simd, int, class, int> class V, class T, cyme::simd O, int N, class OP1, int M>
+struct vertex_registers<V<T, O, N, OP1, M>> {
+    static const int value = vertex_registers<OP1>::value;
+};
+
+template <class T, cyme::simd O, int N, class OP1, class C, cyme::poly_scheme S>
+struct vertex_registers<vec_polyval<T, O, N, OP1, C, S>> {
+    static const int value = vertex_registers<OP1>::value;
+};
+
+template <class T, cyme::simd O, int N, class OP1, class P, class Q, cyme::poly_scheme S>
+struct vertex_registers<vec_ratval<T, O, N, OP1, P, Q, S>> {
+    static const int value = vertex_registers<OP1>::value;
+};
+
+template <template <class, cyme::simd, int, class, class, int> class V, class T, cyme::simd O, int N, class OP1,
+          class OP2, int M>
+struct vertex_registers<V<T, O, N, OP1, OP2, M>> {
+    static const int value = sethi_ullman<vertex_registers<OP1>::value, vertex_registers<OP2>::value>::value;
+};
+
+template <template <class, cyme::simd, int, class, class> class V, class T, cyme::simd O, int N, class OP1,
+          class OP2>
+struct vertex_registers<V<T, O, N, OP1, OP2>> {
+    static const int value = sethi_ullman<vertex_registers<OP1>::value, vertex_registers<OP2>::value>::value;
+};
+
+template <template <class, cyme::simd, int, class, class, class> class V, class T, cyme::simd O, int N, class OP1,
+          class OP2, class OP3>
+struct vertex_registers<V<T, O, N, OP1, OP2, OP3>> {
+    static const int value =
+        sethi_ullman<sethi_ullman<vertex_registers<OP1>::value, vertex_registers<OP2>::value>::value,
+                     vertex_registers<OP3>::value>::value;
+};
+
+template <template <class, cyme::simd, int, class, class, class, class> class V, class T, cyme::simd O, int N,
+          class OP1, class OP2, class OP3, class OP4>
+struct vertex_registers<V<T, O, N, OP1, OP2, OP3, OP4>> {
+    static const int value =
+        sethi_ullman<sethi_ullman<vertex_registers<OP1>::value, vertex_registers<OP2>::value>::value,
+                     sethi_ullman<vertex_registers<OP3>::value, vertex_registers<OP4>::value>::value>::value;
+};
+
+template <template <class, cyme::simd, int, class, class, class, class, class> class V, class T, cyme::simd O,
+          int N, class OP1, class OP2, class OP3, class OP4, class OP5>
+struct vertex_registers<V<T, O, N, OP1, OP2, OP3, OP4, OP5>> {
+    static const int value = sethi_ullman<
+        sethi_ullman<sethi_ullman<vertex_registers<OP1>::value, vertex_registers<OP2>::value>::value,
+                     sethi_ullman<vertex_registers<OP3>::value, vertex_registers<OP4>::value>::value>::value,
+        vertex_registers<OP5>::value>::value;
+};
+/** \endcond */
+
+/** Order of the two operands of a binary vertex. The right operand is evaluated first only if it needs more
+ *  registers than the left one, the left one is not a leaf (a leaf is loaded with the vec, its register is held
+ *  whatever the order), and the left to right order needs more registers than the target has. Elsewhere the
+ *  compiler schedules the two orders the same, the order of the source is kept.
+ */
+template <class T, cyme::simd O, int N, class OP1, class OP2>
+struct vertex_order {
+    static const int left = vertex_registers<OP1>::value;
+    static const int right = vertex_registers<OP2>::value;
+    static const bool swap = left > 1 && right > left && (right + 1) * N > trait_register<T, O>::count;
+};
+
+/** Evaluation of the two operands of a binary vertex in the order of vertex_order. The order is the order of the
+ *  members, the results are always a and b.
+ */
+template <class T, cyme::simd O, int N, class OP1, class OP2, bool = vertex_order<T, O, N, OP1, OP2>::swap>
+struct vertex_operands {
+    template <class A, class B>
+    forceinline vertex_operands(A const &op1, B const &op2) : a(op1()), b(op2()) {}
+
+    const vec_simd<T, O, N> a;
+    const vec_simd<T, O, N> b;
+};
+
+/** \cond */
+template <class T, cyme::simd O, int N, class OP1, class OP2>
+struct vertex_operands<T, O, N, OP1, OP2, true> {
+    template <class A, class B>
+    forceinline vertex_operands(A const &op1, B const &op2) : b(op2()), a(op1()) {}
+
+    const vec_simd<T, O, N> b;
+    const vec_simd<T, O, N> a;
+};
+/** \endcond */
+
 /** abs vertex in the DAG from abs(a) */
 template <class T, cyme::simd O, int N, class OP1>
 class vec_fabs {
+    friend struct vertex_access;
     typename vec_traits<OP1, O, N>::value_type op1;
 
   public:
@@ -79,9 +259,94 @@ class vec_fabs {
     forceinline vec_simd<T, O, N> operator()() const { return fabs(op1()); }
 };
 
+/** floor vertex in the DAG from floor(a), the result stays a floating point number */
+template <class T, cyme::simd O, int N, class OP1>
+class vec_floor {
+    friend struct vertex_access;
+    typename vec_traits<OP1, O, N>::value_type op1;
+
+  public:
+    forceinline vec_floor(OP1 const &a) : op1(a) {}
+
+    forceinline vec_simd<T, O, N> operator()() const { return rounding<cyme::round_down>(op1()); }
+};
+
+/** ceil vertex in the DAG from ceil(a) */
+template <class T, cyme::simd O, int N, class OP1>
+class vec_ceil {
+    friend struct vertex_access;
+    typename vec_traits<OP1, O, N>::value_type op1;
+
+  public:
+    forceinline vec_ceil(OP1 const &a) : op1(a) {}
+
+    forceinline vec_simd<T, O, N> operator()() const { return rounding<cyme::round_up>(op1()); }
+};
+
+/** trunc vertex in the DAG from trunc(a) */
+template <class T, cyme::simd O, int N, class OP1>
+class vec_trunc {
+    friend struct vertex_access;
+    typename vec_traits<OP1, O, N>::value_type op1;
+
+  public:
+    forceinline vec_trunc(OP1 const &a) : op1(a) {}
+
+    forceinline vec_simd<T, O, N> operator()() const { return rounding<cyme::round_zero>(op1()); }
+};
+
+/** rint vertex in the DAG from rint(a), the halfway cases to the even integer */
+template <class T, cyme::simd O, int N, class OP1>
+class vec_rint {
+    friend struct vertex_access;
+    typename vec_traits<OP1, O, N>::value_type op1;
+
+  public:
+    forceinline vec_rint(OP1 const &a) : op1(a) {}
+
+    forceinline vec_simd<T, O, N> operator()() const { return rounding<cyme::round_even>(op1()); }
+};
+
+/** round vertex in the DAG from round(a), the halfway cases away from zero */
+template <class T, cyme::simd O, int N, class OP1>
+class vec_round {
+    friend struct vertex_access;
+    typename vec_traits<OP1, O, N>::value_type op1;
+
+  public:
+    forceinline vec_round(OP1 const &a) : op1(a) {}
+
+    forceinline vec_simd<T, O, N> operator()() const { return round(op1()); }
+};
+
+/** frexp vertex in the DAG from frexp(a), the fraction in [0.5,1) */
+template <class T, cyme::simd O, int N, class OP1>
+class vec_frexp {
+    friend struct vertex_access;
+    typename vec_traits<OP1, O, N>::value_type op1;
+
+  public:
+    forceinline vec_frexp(OP1 const &a) : op1(a) {}
+
+    forceinline vec_simd<T, O, N> operator()() const { return frexp(op1()); }
+};
+
+/** logb vertex in the DAG from logb(a), the exponent of frexp minus one */
+template <class T, cyme::simd O, int N, class OP1>
+class vec_logb {
+    friend struct vertex_access;
+    typename vec_traits<OP1, O, N>::value_type op1;
+
+  public:
+    forceinline vec_logb(OP1 const &a) : op1(a) {}
+
+    forceinline vec_simd<T, O, N> operator()() const { return logb(op1()); }
+};
+
 /** sin vertex in the DAG from sin(a) */
 template <class T, cyme::simd O, int N, class OP1>
 class vec_sin {
+    friend struct vertex_access;
     typename vec_traits<OP1, O, N>::value_type op1;
 
   public:
@@ -93,6 +358,7 @@ class vec_sin {
 /** cos vertex in the DAG from cos(a) */
 template <class T, cyme::simd O, int N, class OP1>
 class vec_cos {
+    friend struct vertex_access;
     typename vec_traits<OP1, O, N>::value_type op1;
 
   public:
@@ -104,6 +370,7 @@ class vec_cos {
 /** tan vertex in the DAG from tan(a) */
 template <class T, cyme::simd O, int N, class OP1>
 class vec_tan {
+    friend struct vertex_access;
     typename vec_traits<OP1, O, N>::value_type op1;
 
   public:
@@ -115,6 +382,7 @@ class vec_tan {
 /** sqrt vertex in the DAG from sqrt(a) */
 template <class T, cyme::simd O, int N, class OP1>
 class vec_sqrt {
+    friend struct vertex_access;
     typename vec_traits<OP1, O, N>::value_type op1;
 
   public:
@@ -123,9 +391,58 @@ class vec_sqrt {
     forceinline vec_simd<T, O, N> operator()() const { return sqrt(op1()); }
 };
 
+/** reciprocal vertex in the DAG from rcp<K>(a), K Newton-Raphson steps */
+template <class T, cyme::simd O, int N, class OP1, int K>
+class vec_rcp {
+    friend struct vertex_access;
+    typename vec_traits<OP1, O, N>::value_type op1;
+
+  public:
+    forceinline vec_rcp(OP1 const &a) : op1(a) {}
+
+    forceinline vec_simd<T, O, N> operator()() const { return rcp<K>(op1()); }
+};
+
+/** reciprocal square root vertex in the DAG from rsqrt<K>(a), K Newton-Raphson steps */
+template <class T, cyme::simd O, int N, class OP1, int K>
+class vec_rsqrt {
+    friend struct vertex_access;
+    typename vec_traits<OP1, O, N>::value_type op1;
+
+  public:
+    forceinline vec_rsqrt(OP1 const &a) : op1(a) {}
+
+    forceinline vec_simd<T, O, N> operator()() const { return rsqrt<K>(op1()); }
+};
+
+/** polynomial vertex in the DAG from polyval<C, S>(a), the coefficient table C */
+template <class T, cyme::simd O, int N, class OP1, class C, cyme::poly_scheme S>
+class vec_polyval {
+    friend struct vertex_access;
+    typename vec_traits<OP1, O, N>::value_type op1;
+
+  public:
+    forceinline vec_polyval(OP1 const &a) : op1(a) {}
+
+    forceinline vec_simd<T, O, N> operator()() const { return polyval<C, S>(op1()); }
+};
+
+/** rational function vertex in the DAG from ratval<P, Q, S>(a), the coefficient tables P and Q */
+template <class T, cyme::simd O, int N, class OP1, class P, class Q, cyme::poly_scheme S>
+class vec_ratval {
+    friend struct vertex_access;
+    typename vec_traits<OP1, O, N>::value_type op1;
+
+  public:
+    forceinline vec_ratval(OP1 const &a) : op1(a) {}
+
+    forceinline vec_simd<T, O, N> operator()() const { return ratval<P, Q, S>(op1()); }
+};
+
 /** exp vertex in the DAG from exp(a) */
 template <class T, cyme::simd O, int N, class OP1>
 class vec_exp {
+    friend struct vertex_access;
     typename vec_traits<OP1, O, N>::value_type op1;
 
   public:
@@ -134,9 +451,26 @@ class vec_exp {
     forceinline vec_simd<T, O, N> operator()() const { return exp(op1()); }
 };
 
+/** exp vertex in the DAG from exp(a)*exp(b), computed as exp(a+b) */
+template <class T, cyme::simd O, int N, class OP1, class OP2>
+class vec_exp_add {
+    friend struct vertex_access;
+    typename vec_traits<OP1, O, N>::value_type op1;
+    typename vec_traits<OP2, O, N>::value_type op2;
+
+  public:
+    forceinline vec_exp_add(vec_exp<T, O, N, OP1> const &a, vec_exp<T, O, N, OP2> const &b)
+        : op1(vertex_access::op1(a)), op2(vertex_access::op1(b)) {}
+
+    forceinline vec_exp_add(OP1 const &a, OP2 const &b) : op1(a), op2(b) {}
+
+    forceinline vec_simd<T, O, N> operator()() const { return exp(op1() + op2()); }
+};
+
 /** exp2 vertex in the DAG from exp2(a) */
 template <class T, cyme::simd O, int N, class OP1>
 class vec_exp2 {
+    friend struct vertex_access;
     typename vec_traits<OP1, O, N>::value_type op1;
 
   public:
@@ -148,6 +482,7 @@ class vec_exp2 {
 /** exp10 vertex in the DAG from exp10(a) */
 template <class T, cyme::simd O, int N, class OP1>
 class vec_exp10 {
+    friend struct vertex_access;
     typename vec_traits<OP1, O, N>::value_type op1;
 
   public:
@@ -159,6 +494,7 @@ class vec_exp10 {
 /** log vertex in the DAG from log(a) */
 template <class T, cyme::simd O, int N, class OP1>
 class vec_log {
+    friend struct vertex_access;
     typename vec_traits<OP1, O, N>::value_type op1;
 
   public:
@@ -170,6 +506,7 @@ class vec_log {
 /** log2 vertex in the DAG from log2(a) */
 template <class T, cyme::simd O, int N, class OP1>
 class vec_log2 {
+    friend struct vertex_access;
     typename vec_traits<OP1, O, N>::value_type op1;
 
   public:
@@ -181,6 +518,7 @@ class vec_log2 {
 /** log10 vertex in the DAG from log10(a) */
 template <class T, cyme::simd O, int N, class OP1>
 class vec_log10 {
+    friend struct vertex_access;
     typename vec_traits<OP1, O, N>::value_type op1;
 
   public:
@@ -192,6 +530,7 @@ class vec_log10 {
 /** pow vertex in the DAG from pow(a,n), integer exponent only */
 template <class T, cyme::simd O, int N, class OP1, int M>
 class vec_pow {
+    friend struct vertex_access;
     typename vec_traits<OP1, O, N>::value_type op1;
 
   public:
@@ -203,13 +542,17 @@ class vec_pow {
 /** pow vertex in the DAG from pow(x,y), float exponent */
 template <class T, cyme::simd O, int N, class OP1, class OP2>
 class vec_powf {
+    friend struct vertex_access;
     typename vec_traits<OP1, O, N>::value_type op1;
     typename vec_traits<OP2, O, N>::value_type op2;
 
   public:
     forceinline vec_powf(OP1 const &a, OP2 const &b) : op1(a), op2(b) {}
 
-    forceinline vec_simd<T, O, N> operator()() const { return pow<T, O, N>(op1(), op2()); }
+    forceinline vec_simd<T, O, N> operator()() const {
+        const vertex_operands<T, O, N, OP1, OP2> r(op1, op2);
+        return pow<T, O, N>(r.a, r.b);
+    }
 };
 
 /** not vertex in the DAG from ~a
@@ -217,6 +560,7 @@ class vec_powf {
  */
 template <class T, cyme::simd O, int N, class OP1>
 class vec_not {
+    friend struct vertex_access;
     typename vec_traits<OP1, O, N>::value_type op1;
 
   public:
@@ -231,6 +575,7 @@ class vec_not {
  */
 template <class T, cyme::simd O, int N, class OP1, class OP2>
 class vec_and {
+    friend struct vertex_access;
     typename vec_traits<OP1, O, N>::value_type op1;
     typename vec_traits<OP2, O, N>::value_type op2;
 
@@ -246,6 +591,7 @@ class vec_and {
  */
 template <class T, cyme::simd O, int N, class OP1, class OP2>
 class vec_or {
+    friend struct vertex_access;
     typename vec_traits<OP1, O, N>::value_type op1;
     typename vec_traits<OP2, O, N>::value_type op2;
 
@@ -261,6 +607,7 @@ class vec_or {
  */
 template <class T, cyme::simd O, int N, class OP1, class OP2>
 class vec_xor {
+    friend struct vertex_access;
     typename vec_traits<OP1, O, N>::value_type op1;
     typename vec_traits<OP2, O, N>::value_type op2;
 
@@ -282,6 +629,7 @@ class vec_xor {
 */
 template <class T, cyme::simd O, int N, class OP1, class OP2>
 class vec_lt {
+    friend struct vertex_access;
     typename vec_traits<OP1, O, N>::value_type op1;
     typename vec_traits<OP2, O, N>::value_type op2;
 
@@ -296,6 +644,7 @@ class vec_lt {
  */
 template <class T, cyme::simd O, int N, class OP1, class OP2>
 class vec_rshift {
+    friend struct vertex_access;
     typename vec_traits<OP1, O, N>::value_type op1;
     typename vec_traits<OP2, O, N>::value_type op2;
 
@@ -310,6 +659,7 @@ class vec_rshift {
  */
 template <class T, cyme::simd O, int N, class OP1, class OP2>
 class vec_eq {
+    friend struct vertex_access;
     typename vec_traits<OP1, O, N>::value_type op1;
     typename vec_traits<OP2, O, N>::value_type op2;
 
@@ -319,40 +669,181 @@ class vec_eq {
     forceinline vec_simd<T, O, N> operator()() const { return op1() == op2(); }
 };
 
+/** not equal vertex in the DAG from a != b
+ /note the inequality in SIMD are like usual operation it return a register 0 false -1 true
+ */
+template <class T, cyme::simd O, int N, class OP1, class OP2>
+class vec_ne {
+    friend struct vertex_access;
+    typename vec_traits<OP1, O, N>::value_type op1;
+    typename vec_traits<OP2, O, N>::value_type op2;
+
+  public:
+    forceinline vec_ne(OP1 const &a, OP2 const &b) : op1(a), op2(b) {}
+
+    forceinline vec_simd<T, O, N> operator()() const {
+        const vertex_operands<T, O, N, OP1, OP2> r(op1, op2);
+        return r.a != r.b;
+    }
+};
+
+/** less or equal vertex in the DAG from a <= b, and b >= a, a single comparison instead of ~(b < a)
+ /note the inequality in SIMD are like usual operation it return a register 0 false -1 true
+ */
+template <class T, cyme::simd O, int N, class OP1, class OP2>
+class vec_le {
+    friend struct vertex_access;
+    typename vec_traits<OP1, O, N>::value_type op1;
+    typename vec_traits<OP2, O, N>::value_type op2;
+
+  public:
+    forceinline vec_le(OP1 const &a, OP2 const &b) : op1(a), op2(b) {}
+
+    forceinline vec_simd<T, O, N> operator()() const {
+        const vertex_operands<T, O, N, OP1, OP2> r(op1, op2);
+        return r.a <= r.b;
+    }
+};
+
 /** add vertex in the DAG from a+b */
 template <class T, cyme::simd O, int N, class OP1, class OP2>
 class vec_add {
+    friend struct vertex_access;
     typename vec_traits<OP1, O, N>::value_type op1;
     typename vec_traits<OP2, O, N>::value_type op2;
 
   public:
     forceinline vec_add(OP1 const &a, OP2 const &b) : op1(a), op2(b) {}
 
-    forceinline vec_simd<T, O, N> operator()() const { return op1() + op2(); }
+    forceinline vec_simd<T, O, N> operator()() const {
+        const vertex_operands<T, O, N, OP1, OP2> r(op1, op2);
+        return r.a + r.b;
+    }
 };
 
 /** sub vertex in the DAG from a-b */
 template <class T, cyme::simd O, int N, class OP1, class OP2>
 class vec_sub {
+    friend struct vertex_access;
     typename vec_traits<OP1, O, N>::value_type op1;
     typename vec_traits<OP2, O, N>::value_type op2;
 
   public:
     forceinline vec_sub(OP1 const &a, OP2 const &b) : op1(a), op2(b) {}
 
-    forceinline vec_simd<T, O, N> operator()() const { return op1() - op2(); }
+    forceinline vec_simd<T, O, N> operator()() const {
+        const vertex_operands<T, O, N, OP1, OP2> r(op1, op2);
+        return r.a - r.b;
+    }
 };
 
 /** minimu vertex in the DAG from min(a,b) */
 template <class T, cyme::simd O, int N, class OP1, class OP2>
 class vec_min {
+    friend struct vertex_access;
     typename vec_traits<OP1, O, N>::value_type op1;
     typename vec_traits<OP2, O, N>::value_type op2;
 
   public:
     forceinline vec_min(OP1 const &a, OP2 const &b) : op1(a), op2(b) {}
 
-    forceinline vec_simd<T, O, N> operator()() const { return min(op1(), op2()); }
+    forceinline vec_simd<T, O, N> operator()() const {
+        const vertex_operands<T, O, N, OP1, OP2> r(op1, op2);
+        return min(r.a, r.b);
+    }
+};
+
+/** maximum vertex in the DAG from max(a,b) */
+template <class T, cyme::simd O, int N, class OP1, class OP2>
+class vec_max {
+    friend struct vertex_access;
+    typename vec_traits<OP1, O, N>::value_type op1;
+    typename vec_traits<OP2, O, N>::value_type op2;
+
+  public:
+    forceinline vec_max(OP1 const &a, OP2 const &b) : op1(a), op2(b) {}
+
+    forceinline vec_simd<T, O, N> operator()() const {
+        const vertex_operands<T, O, N, OP1, OP2> r(op1, op2);
+        return max(r.a, r.b);
+    }
+};
+
+/** copysign vertex in the DAG from copysign(a,b) */
+template <class T, cyme::simd O, int N, class OP1, class OP2>
+class vec_copysign {
+    friend struct vertex_access;
+    typename vec_traits<OP1, O, N>::value_type op1;
+    typename vec_traits<OP2, O, N>::value_type op2;
+
+  public:
+    forceinline vec_copysign(OP1 const &a, OP2 const &b) : op1(a), op2(b) {}
+
+    forceinline vec_simd<T, O, N> operator()() const {
+        const vertex_operands<T, O, N, OP1, OP2> r(op1, op2);
+        return copysign(r.a, r.b);
+    }
+};
+
+/** ldexp vertex in the DAG from ldexp(a,b), a*2^b */
+template <class T, cyme::simd O, int N, class OP1, class OP2>
+class vec_ldexp {
+    friend struct vertex_access;
+    typename vec_traits<OP1, O, N>::value_type op1;
+    typename vec_traits<OP2, O, N>::value_type op2;
+
+  public:
+    forceinline vec_ldexp(OP1 const &a, OP2 const &b) : op1(a), op2(b) {}
+
+    forceinline vec_simd<T, O, N> operator()() const {
+        const vertex_operands<T, O, N, OP1, OP2> r(op1, op2);
+        return ldexp(r.a, r.b);
+    }
+};
+
+/** fmod vertex in the DAG from fmod(a,b) */
+template <class T, cyme::simd O, int N, class OP1, class OP2>
+class vec_fmod {
+    friend struct vertex_access;
+    typename vec_traits<OP1, O, N>::value_type op1;
+    typename vec_traits<OP2, O, N>::value_type op2;
+
+  public:
+    forceinline vec_fmod(OP1 const &a, OP2 const &b) : op1(a), op2(b) {}
+
+    forceinline vec_simd<T, O, N> operator()() const {
+        const vertex_operands<T, O, N, OP1, OP2> r(op1, op2);
+        return fmod(r.a, r.b);
+    }
+};
+
+/** select vertex in the DAG from where(mask,a,b), a where the mask is true else b, a blend on x86.
+ *  The mask is a comparison: where(v == 0, 1, v / (1 - exp(-v))) */
+template <class T, cyme::simd O, int N, class OP1, class OP2, class OP3>
+class vec_where {
+    friend struct vertex_access;
+    typename vec_traits<OP1, O, N>::value_type op1;
+    typename vec_traits<OP2, O, N>::value_type op2;
+    typename vec_traits<OP3, O, N>::value_type op3;
+
+  public:
+    forceinline vec_where(OP1 const &m, OP2 const &a, OP3 const &b) : op1(m), op2(a), op3(b) {}
+
+    forceinline vec_simd<T, O, N> operator()() const { return where(op1(), op2(), op3()); }
+};
+
+/** clamp vertex in the DAG from clamp(a,lo,hi), min(max(a,lo),hi) */
+template <class T, cyme::simd O, int N, class OP1, class OP2, class OP3>
+class vec_clamp {
+    friend struct vertex_access;
+    typename vec_traits<OP1, O, N>::value_type op1;
+    typename vec_traits<OP2, O, N>::value_type op2;
+    typename vec_traits<OP3, O, N>::value_type op3;
+
+  public:
+    forceinline vec_clamp(OP1 const &a, OP2 const &lo, OP3 const &hi) : op1(a), op2(lo), op3(hi) {}
+
+    forceinline vec_simd<T, O, N> operator()() const { return min(max(op1(), op2()), op3()); }
 };
 
 /** negate vertex in the DAG from -a
@@ -363,6 +854,7 @@ For this I need to get the original operator (op1)
 */
 template <class T, cyme::simd O, int N, class OP1>
 struct vec_neg {
+    friend struct vertex_access;
     typename vec_traits<OP1, O, N>::value_type op1;
 
   public:
@@ -374,11 +866,15 @@ struct vec_neg {
 /** mul vertex in the DAG from a*b */
 template <class T, cyme::simd O, int N, class OP1, class OP2>
 class vec_mul {
+    friend struct vertex_access;
     typename vec_traits<OP1, O, N>::value_type op1;
     typename vec_traits<OP2, O, N>::value_type op2;
 
   public:
-    forceinline vec_simd<T, O, N> operator()() const { return op1() * op2(); }
+    forceinline vec_simd<T, O, N> operator()() const {
+        const vertex_operands<T, O, N, OP1, OP2> r(op1, op2);
+        return r.a * r.b;
+    }
 
     forceinline vec_mul(OP1 const &a, OP2 const &b) : op1(a), op2(b) {}
 
@@ -390,27 +886,31 @@ class vec_mul {
 };
 
 /** fma vertex in the DAG from a*b+c
-\warning Experimental, I may not catch all FMA
+\warning Experimental, I may not catch all FMA, the cost model (cyme::fma_contract) may keep mul and add
 */
 template <class T, cyme::simd O, int N, class OP1, class OP2, class OP3>
 class vec_muladd {
+    friend struct vertex_access;
     typename vec_traits<OP1, O, N>::value_type op1;
     typename vec_traits<OP2, O, N>::value_type op2;
     typename vec_traits<OP3, O, N>::value_type op3;
 
   public:
-    forceinline vec_simd<T, O, N> operator()() const { return muladd(op1(), op2(), op3()); }
+    forceinline vec_simd<T, O, N> operator()() const {
+        return fma_contract<>::muladd ? muladd(op1(), op2(), op3()) : op1() * op2() + op3();
+    }
 
     forceinline vec_muladd(vec_mul<T, O, N, OP1, OP2> const &a, OP3 const &b)
         : op1(a.getop1()), op2(a.getop2()), op3(b) {}
 };
 
 /** fma vertex in the DAG from a*b+c*d
-\warning Althoug the following version requests less operation (one FMA and one mul), it is slower of 2 cycles,
-because the two multiplications are done in parallel
+\remark The FMA version requests less operation (one FMA and one mul), but the two multiplications are no more
+done in parallel, the cost model of the target (cyme::fma_contract) chooses
 */
 template <class T, cyme::simd O, int N, class OP1, class OP2, class OP3, class OP4>
 class vec_mul_add_mul {
+    friend struct vertex_access;
     typename vec_traits<OP1, O, N>::value_type op1;
     typename vec_traits<OP2, O, N>::value_type op2;
     typename vec_traits<OP3, O, N>::value_type op3;
@@ -418,8 +918,7 @@ class vec_mul_add_mul {
 
   public:
     forceinline vec_simd<T, O, N> operator()() const {
-        // return muladd(op1(),op2(),op3()*op4()); // FMA version to replug when FMA ops become faster
-        return op1() * op2() + op3() * op4();
+        return fma_contract<>::mul_add_mul ? muladd(op1(), op2(), op3() * op4()) : op1() * op2() + op3() * op4();
     }
 
     forceinline vec_mul_add_mul(vec_mul<T, O, N, OP1, OP2> const &a, vec_mul<T, O, N, OP3, OP4> const &b)
@@ -427,11 +926,11 @@ class vec_mul_add_mul {
 };
 
 /** fms vertex in the DAG from a*b-c*d
-\warning Althoug the following version requests less operation (one FMA and one mul), it is slower of 2 cycles,
-because the two multiplications are done in parallel
+\remark see vec_mul_add_mul, the cost model of the target (cyme::fma_contract) chooses
 */
 template <class T, cyme::simd O, int N, class OP1, class OP2, class OP3, class OP4>
 class vec_mul_sub_mul {
+    friend struct vertex_access;
     typename vec_traits<OP1, O, N>::value_type op1;
     typename vec_traits<OP2, O, N>::value_type op2;
     typename vec_traits<OP3, O, N>::value_type op3;
@@ -439,25 +938,55 @@ class vec_mul_sub_mul {
 
   public:
     forceinline vec_simd<T, O, N> operator()() const {
-        // return mulsub(op1(),op2(),op3()*op4()); // FMA version to replug when FMA ops become faster
-        return op1() * op2() - op3() * op4();
+        return fma_contract<>::mul_add_mul ? mulsub(op1(), op2(), op3() * op4()) : op1() * op2() - op3() * op4();
     }
 
     forceinline vec_mul_sub_mul(vec_mul<T, O, N, OP1, OP2> const &a, vec_mul<T, O, N, OP3, OP4> const &b)
         : op1(a.getop1()), op2(a.getop2()), op3(b.getop1()), op4(b.getop2()) {}
 };
 
+/** fma vertex in the DAG from a*b+c*d+e
+\remark fma(a,b,fma(c,d,e)) is a chain of two FMA, fma(c,d,e)+a*b has an add more but the FMA and the mul are
+done in parallel, the cost model of the target (cyme::fma_contract) chooses. Without a model (generic), the tree
+is (a*b+c*d)+e as before the cost model
+*/
+template <class T, cyme::simd O, int N, class OP1, class OP2, class OP3, class OP4, class OP5>
+class vec_mul_add_mul_add {
+    friend struct vertex_access;
+    typename vec_traits<OP1, O, N>::value_type op1;
+    typename vec_traits<OP2, O, N>::value_type op2;
+    typename vec_traits<OP3, O, N>::value_type op3;
+    typename vec_traits<OP4, O, N>::value_type op4;
+    typename vec_traits<OP5, O, N>::value_type op5;
+
+  public:
+    forceinline vec_simd<T, O, N> operator()() const {
+        if (!fma_contract<>::model)
+            return (fma_contract<>::mul_add_mul ? muladd(op1(), op2(), op3() * op4()) : op1() * op2() + op3() * op4()) +
+                   op5();
+        return fma_contract<>::mul_add_mul_add ? muladd(op1(), op2(), muladd(op3(), op4(), op5()))
+                                               : muladd(op3(), op4(), op5()) + op1() * op2();
+    }
+
+    forceinline vec_mul_add_mul_add(vec_mul_add_mul<T, O, N, OP1, OP2, OP3, OP4> const &a, OP5 const &b)
+        : op1(vertex_access::op1(a)), op2(vertex_access::op2(a)), op3(vertex_access::op3(a)),
+          op4(vertex_access::op4(a)), op5(b) {}
+};
+
 /** fms vertex in the DAG from a*b-c
 \warning it is experimental, I may not capture all FMA
 */
 template <class T, cyme::simd O, int N, class OP1, class OP2, class OP3>
 class vec_mulsub {
+    friend struct vertex_access;
     typename vec_traits<OP1, O, N>::value_type op1;
     typename vec_traits<OP2, O, N>::value_type op2;
     typename vec_traits<OP3, O, N>::value_type op3;
 
   public:
-    forceinline vec_simd<T, O, N> operator()() const { return mulsub(op1(), op2(), op3()); }
+    forceinline vec_simd<T, O, N> operator()() const {
+        return fma_contract<>::muladd ? mulsub(op1(), op2(), op3()) : op1() * op2() - op3();
+    }
 
     forceinline vec_mulsub(vec_mul<T, O, N, OP1, OP2> const &a, OP3 const &b)
         : op1(a.getop1()), op2(a.getop2()), op3(b) {}
@@ -468,13 +997,15 @@ class vec_mulsub {
 */
 template <class T, cyme::simd O, int N, class OP1, class OP2, class OP3>
 class vec_negate_muladd {
+    friend struct vertex_access;
     typename vec_traits<OP1, O, N>::value_type op1;
     typename vec_traits<OP2, O, N>::value_type op2;
     typename vec_traits<OP3, O, N>::value_type op3;
 
   public:
     forceinline vec_simd<T, O, N> operator()() const {
-        return negatemuladd(op1(), op2(), op3()); // -a*b+c <=> c - a*b
+        // -a*b+c <=> c - a*b
+        return fma_contract<>::muladd ? negatemuladd(op1(), op2(), op3()) : op3() - op1() * op2();
     }
 
     forceinline vec_negate_muladd(vec_mul<T, O, N, OP1, OP2> const &a, OP3 const &b)
@@ -487,25 +1018,63 @@ I made a distinction between operands specially if b is scalar
 */
 template <class T, cyme::simd O, int N, class OP1, class OP2>
 class vec_div {
+    friend struct vertex_access;
     typename vec_traits<OP1, O, N>::value_type op1;
     typename vec_traits<OP2, O, N>::value_type op2;
 
   public:
-    forceinline vec_simd<T, O, N> operator()() const { return op1() / op2(); }
+    forceinline vec_simd<T, O, N> operator()() const {
+        const vertex_operands<T, O, N, OP1, OP2> r(op1, op2);
+        return r.a / r.b;
+    }
 
     forceinline vec_div(OP1 const &a, OP2 const &b) : op1(a), op2(b) {}
 };
 
+/** division vertex in the DAG from fast_div<K>(a,b), a*rcp<K>(b) */
+template <class T, cyme::simd O, int N, class OP1, class OP2, int K>
+class vec_fast_div {
+    friend struct vertex_access;
+    typename vec_traits<OP1, O, N>::value_type op1;
+    typename vec_traits<OP2, O, N>::value_type op2;
+
+  public:
+    forceinline vec_simd<T, O, N> operator()() const {
+        const vertex_operands<T, O, N, OP1, OP2> r(op1, op2);
+        return fast_div<K>(r.a, r.b);
+    }
+
+    forceinline vec_fast_div(OP1 const &a, OP2 const &b) : op1(a), op2(b) {}
+};
+
 /** scalar vertex */
 template <class T, cyme::simd O, int N>
 class vec_scalar {
   public:
-    explicit forceinline vec_scalar(T const &a) : s(a) {}
+    explicit forceinline vec_scalar(T const &a) : s(a), v(a) {}
 
     forceinline vec_simd<T, O, N> operator()() const { return s; }
 
+    /** value of the scalar, for the simplifications of the tree and the comparison of vertices */
+    forceinline T value() const { return v; }
+
   private:
     vec_simd<T, O, N> const s; // value of the scalar
+    T const v;                 // value of the scalar
+};
+
+/** field vertex, R[x] of a storage: the register and the address of the field. A vec_simd for every vertex, the
+    address is for cyme::tie only: two leaves of the same address are the same field, their subtrees are shared */
+template <class T, cyme::simd O, int N>
+class vec_field : public vec_simd<T, O, N> {
+  public:
+    explicit forceinline vec_field(T const *a) : vec_simd<T, O, N>(a), p(a) {}
+
+    /** address of the field */
+    forceinline T const *source() const { return p; }
+
+  private:
+    T const *p;
 };
 
 /** vector used during the construction of the DA
@@ -528,6 +1097,14 @@ class vec {
     typedef value_type const *const_pointer;
     typedef Rep base_type;
 
+  private:
+    struct no_field {};
+
+    /** the field vertex converts to the register vec only */
+    typedef typename std::conditional<std::is_same<Rep, vec_simd<T, O, N>>::value,
+                                      vec<T, O, N, vec_field<T, O, N>>, no_field>::type field_type;
+
+  public:
     /** Constructor lhs of the operator=, pointer lhs because non const I save it for saving at the end */
     forceinline explicit vec(pointer rb) : data_pointer(rb), expr_rep(rb) {}
 
@@ -540,6 +1117,15 @@ class vec {
     /*** Constructor with constant, I do not care about the pointer */
     explicit forceinline vec(value_type b = value_type()) : data_pointer(NULL), expr_rep(b) {}
 
+    /** Constructor from an expression, the tree is evaluated now. E.g. the return of a lambda, the tree must not
+        outlive the temporaries of the lambda */
+    template <class Rep2>
+    forceinline explicit vec(vec<T, O, N, Rep2> const &rhs) : data_pointer(NULL), expr_rep(rhs.rep()()) {}
+
+    /** Constructor from a field R[x] of a storage, implicit: the read-only operator[] of the AoSoA storage returns
+        a field vertex (its address identifies the field in cyme::tie), it is still usable as a register vec */
+    forceinline vec(field_type const &rhs) : data_pointer(NULL), expr_rep(rhs.rep()()) {}
+
     /**
      operator= initializes the vec to a given value. The full vector has
      the same value.
@@ -593,6 +1179,32 @@ class vec {
         return *this;
     }
 
+#ifdef __FMA__
+    /**
+    operator+= of a product, W[x] += a*b, a fma if the cost model of the target (cyme::fma_contract) says so
+    */
+    template <class R1, class R2>
+    forceinline vec &operator+=(vec<T, O, N, vec_mul<T, O, N, R1, R2>> const &rhs) {
+        expr_rep() = fma_contract<>::muladd ? muladd(rhs.rep().getop1()(), rhs.rep().getop2()(), expr_rep())
+                                            : expr_rep() + rhs.rep()();
+        if (data() != NULL)               // compilation time evaluation
+            expr_rep.store(data_pointer); // store the SIMD register into main cyme
+        return *this;
+    }
+
+    /**
+    operator-= of a product, W[x] -= a*b, a fms if the cost model of the target (cyme::fma_contract) says so
+    */
+    template <class R1, class R2>
+    forceinline vec &operator-=(vec<T, O, N, vec_mul<T, O, N, R1, R2>> const &rhs) {
+        expr_rep() = fma_contract<>::muladd ? negatemuladd(rhs.rep().getop1()(), rhs.rep().getop2()(), expr_rep())
+                                            : expr_rep() - rhs.rep()();
+        if (data() != NULL)               // compilation time evaluation
+            expr_rep.store(data_pointer); // store the SIMD register into main cyme
+        return *this;
+    }
+#endif
+
     /**
     operator*= creates the tree and execute in normal condition
     The tree is built at the compilation, the full tree is stored in rhs argument.
@@ -656,7 +1268,7 @@ class vec {
 };
 
 /**
-convert the value, half of the register can be lost (e.g. 8xuint32 -> 4xdouble)
+convert the value, half of the register can be lost (e.g. 8xuint32 -> 4xdouble), see widen and narrow
 \warning does not copy the pointer to save the data, to do
 */
 template <class T2, class T1, cyme::simd O = cyme::__CYME_SIMD_VALUE__, int N = cyme::unroll_factor::N> // from T1 to T2
@@ -665,12 +1277,39 @@ forceinline vec<T2, O, N> cyme_cast(vec<T1, O, N> &v1) {
     v.rep() = cast<T2>(v1.rep());
     return v;
 };
+
+/**
+widen the lanes of a float or int expression to two vec of double, the first half of the lanes then the second,
+no lane lost: float storage and double computation. The expression is evaluated now, as cyme::dual
+\code{.cpp}
+std::pair<cyme::vec<double>, cyme::vec<double>> v = cyme::widen(R[x] * 2.f);
+acc_lo += v.first * v.first;
+acc_hi += v.second * v.second;
+\endcode
+*/
+template <class T, cyme::simd O, int N, class R1>
+forceinline std::pair<vec<double, O, N>, vec<double, O, N>> widen(vec<T, O, N, R1> const &a) {
+    const std::pair<vec_simd<double, O, N>, vec_simd<double, O, N>> w = widen(a.rep()());
+    return std::make_pair(vec<double, O, N>(w.first), vec<double, O, N>(w.second));
+}
+
+/**
+narrow two expressions of double to one vec of float (rounded to the nearest) or int (truncated), the lanes of lo
+then the lanes of hi: W[x] = cyme::narrow<float>(acc_lo, acc_hi)
+*/
+template <class T2, cyme::simd O, int N, class R1, class R2>
+forceinline vec<T2, O, N> narrow(vec<double, O, N, R1> const &lo, vec<double, O, N, R2> const &hi) {
+    return vec<T2, O, N>(narrow<T2>(lo.rep()(), hi.rep()()));
+}
 } // namespace cyme
 
 #include "cyme/core/expression/expr_vec_ops.ipp"
 #ifdef __FMA__
 #include "cyme/core/expression/expr_vec_fma.ipp"
 #endif
+#include "cyme/core/expression/expr_vec_tie.ipp"
+#include "cyme/core/expression/expr_vec_while.ipp"
+#include "cyme/core/expression/expr_vec_info.ipp"
 
 /** Ostream operators for vec */
 /**vec*/
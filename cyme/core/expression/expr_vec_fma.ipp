@@ -76,6 +76,82 @@ operator+(vec<T, O, N, vec_mul<T, O, N, R1, R2>> const &a, vec<T, O, N, vec_mul<
         vec_mul_add_mul<T, O, N, R1, R2, R3, R4>(a.rep(), b.rep()));
 }
 
+/**
+ * FMA from operator a*b+c*d+e, the cost model of the target chooses the chain of two FMA or the FMA and the mul in
+ * parallel
+ */
+template <class T, cyme::simd O, int N, class R1, class R2, class R3, class R4, class R5>
+vec<T, O, N, vec_mul_add_mul_add<T, O, N, R1, R2, R3, R4, R5>> forceinline
+operator+(vec<T, O, N, vec_mul_add_mul<T, O, N, R1, R2, R3, R4>> const &a, vec<T, O, N, R5> const &b) {
+    return vec<T, O, N, vec_mul_add_mul_add<T, O, N, R1, R2, R3, R4, R5>>(
+        vec_mul_add_mul_add<T, O, N, R1, R2, R3, R4, R5>(a.rep(), b.rep()));
+}
+
+/**
+ * FMA from operator a*b+c*d+e where e is a scalar
+ */
+template <class T, cyme::simd O, int N, class R1, class R2, class R3, class R4>
+vec<T, O, N, vec_mul_add_mul_add<T, O, N, R1, R2, R3, R4, vec_scalar<T, O, N>>> forceinline
+operator+(vec<T, O, N, vec_mul_add_mul<T, O, N, R1, R2, R3, R4>> const &a, typename identity<T>::value_type const &b) {
+    return vec<T, O, N, vec_mul_add_mul_add<T, O, N, R1, R2, R3, R4, vec_scalar<T, O, N>>>(
+        vec_mul_add_mul_add<T, O, N, R1, R2, R3, R4, vec_scalar<T, O, N>>(a.rep(),
+                                                                          vec_scalar<T, O, N>(static_cast<T>(b))));
+}
+
+/**
+ * FMA from operator e+(a*b+c*d)
+ */
+template <class T, cyme::simd O, int N, class R1, class R2, class R3, class R4, class R5>
+vec<T, O, N, vec_mul_add_mul_add<T, O, N, R1, R2, R3, R4, R5>> forceinline
+operator+(vec<T, O, N, R5> const &b, vec<T, O, N, vec_mul_add_mul<T, O, N, R1, R2, R3, R4>> const &a) {
+    return operator+(a, b);
+}
+
+/**
+ * FMA from operator e+(a*b+c*d) where e is a scalar
+ */
+template <class T, cyme::simd O, int N, class R1, class R2, class R3, class R4>
+vec<T, O, N, vec_mul_add_mul_add<T, O, N, R1, R2, R3, R4, vec_scalar<T, O, N>>> forceinline
+operator+(typename identity<T>::value_type const &b, vec<T, O, N, vec_mul_add_mul<T, O, N, R1, R2, R3, R4>> const &a) {
+    return operator+(a, b);
+}
+
+/**
+ * FMA from operator a*b+c*d+e*f, fma(e,f,a*b+c*d) as before, I introduce this new case, because the compiler
+ * can't distinguish it with the two previous wrappers
+ */
+template <class T, cyme::simd O, int N, class R1, class R2, class R3, class R4, class R5, class R6>
+vec<T, O, N, vec_muladd<T, O, N, R5, R6, vec_mul_add_mul<T, O, N, R1, R2, R3, R4>>> forceinline
+operator+(vec<T, O, N, vec_mul_add_mul<T, O, N, R1, R2, R3, R4>> const &a,
+          vec<T, O, N, vec_mul<T, O, N, R5, R6>> const &b) {
+    return vec<T, O, N, vec_muladd<T, O, N, R5, R6, vec_mul_add_mul<T, O, N, R1, R2, R3, R4>>>(
+        vec_muladd<T, O, N, R5, R6, vec_mul_add_mul<T, O, N, R1, R2, R3, R4>>(b.rep(), a.rep()));
+}
+
+/**
+ * FMA from operator e*f+(a*b+c*d), see the previous one
+ */
+template <class T, cyme::simd O, int N, class R1, class R2, class R3, class R4, class R5, class R6>
+vec<T, O, N, vec_muladd<T, O, N, R5, R6, vec_mul_add_mul<T, O, N, R1, R2, R3, R4>>> forceinline
+operator+(vec<T, O, N, vec_mul<T, O, N, R5, R6>> const &b,
+          vec<T, O, N, vec_mul_add_mul<T, O, N, R1, R2, R3, R4>> const &a) {
+    return operator+(a, b);
+}
+
+/**
+ * Operator (a*b+c*d)+(e*f+g*h), simple addition, the compiler can't distinguish it with the previous wrappers
+ */
+template <class T, cyme::simd O, int N, class R1, class R2, class R3, class R4, class R5, class R6, class R7,
+          class R8>
+vec<T, O, N, vec_add<T, O, N, vec_mul_add_mul<T, O, N, R1, R2, R3, R4>, vec_mul_add_mul<T, O, N, R5, R6, R7, R8>>>
+    forceinline operator+(vec<T, O, N, vec_mul_add_mul<T, O, N, R1, R2, R3, R4>> const &a,
+                          vec<T, O, N, vec_mul_add_mul<T, O, N, R5, R6, R7, R8>> const &b) {
+    return vec<T, O, N,
+               vec_add<T, O, N, vec_mul_add_mul<T, O, N, R1, R2, R3, R4>, vec_mul_add_mul<T, O, N, R5, R6, R7, R8>>>(
+        vec_add<T, O, N, vec_mul_add_mul<T, O, N, R1, R2, R3, R4>, vec_mul_add_mul<T, O, N, R5, R6, R7, R8>>(
+            a.rep(), b.rep()));
+}
+
 /**
  * FMS from operator a*b-c
  */
@@ -0,0 +1,341 @@
+/*
+ * Cyme - expr_vec_info.ipp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ * This file is part of Cyme <https://github.com/BlueBrain/cyme>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+
+/**
+ * @file cyme/core/expression/expr_vec_info.ipp
+ * Defines expression_info, the operations of an expression tree counted at compile time
+ *
+ * The tree is the type of the expression, the counts are per vec_simd. The
+ * FMA vertices are counted as the cost model (cyme::fma_contract) evaluates
+ * them, a fma or a mul and an add.
+ */
+
+#ifndef CYME_EXPR_VEC_INFO_IPP
+#define CYME_EXPR_VEC_INFO_IPP
+
+#include <ostream>
+
+namespace cyme {
+/** \cond */
+namespace detail {
+/** operations of a vertex, without its subtrees */
+template <int Add, int Mul, int Fma, int Div, int Sqrt, int Exp, int Log, int Pow, int Other, int Loads = 0,
+          int Scalars = 0>
+struct vertex_count {
+    static const int add = Add;
+    static const int mul = Mul;
+    static const int fma = Fma;
+    static const int div = Div;
+    static const int sqrt = Sqrt;
+    static const int exp = Exp;
+    static const int log = Log;
+    static const int pow = Pow;
+    static const int other = Other; // comparisons, logic, min, max, where, neg, fabs, sin, cos ...
+    static const int loads = Loads;
+    static const int scalars = Scalars;
+    static const int depth = 0;
+};
+
+/** a vertex not listed below is an "other" operation */
+template <class V>
+struct vertex_op : vertex_count<0, 0, 0, 0, 0, 0, 0, 0, 1> {};
+
+template <class T, cyme::simd O, int N>
+struct vertex_op<vec_simd<T, O, N>> : vertex_count<0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0> {};
+
+template <class T, cyme::simd O, int N>
+struct vertex_op<vec_scalar<T, O, N>> : vertex_count<0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1> {};
+
+template <class T, cyme::simd O, int N>
+struct vertex_op<vec_field<T, O, N>> : vertex_op<vec_simd<T, O, N>> {};
+
+template <class T, cyme::simd O, int N, class OP1, class OP2>
+struct vertex_op<vec_add<T, O, N, OP1, OP2>> : vertex_count<1, 0, 0, 0, 0, 0, 0, 0, 0> {};
+
+template <class T, cyme::simd O, int N, class OP1, class OP2>
+struct vertex_op<vec_sub<T, O, N, OP1, OP2>> : vertex_count<1, 0, 0, 0, 0, 0, 0, 0, 0> {};
+
+template <class T, cyme::simd O, int N, class OP1, class OP2>
+struct vertex_op<vec_mul<T, O, N, OP1, OP2>> : vertex_count<0, 1, 0, 0, 0, 0, 0, 0, 0> {};
+
+template <class T, cyme::simd O, int N, class OP1, class OP2>
+struct vertex_op<vec_div<T, O, N, OP1, OP2>> : vertex_count<0, 0, 0, 1, 0, 0, 0, 0, 0> {};
+
+template <class T, cyme::simd O, int N, class OP1>
+struct vertex_op<vec_sqrt<T, O, N, OP1>> : vertex_count<0, 0, 0, 0, 1, 0, 0, 0, 0> {};
+
+template <class T, cyme::simd O, int N, class OP1>
+struct vertex_op<vec_exp<T, O, N, OP1>> : vertex_count<0, 0, 0, 0, 0, 1, 0, 0, 0> {};
+
+template <class T, cyme::simd O, int N, class OP1>
+struct vertex_op<vec_exp2<T, O, N, OP1>> : vertex_count<0, 0, 0, 0, 0, 1, 0, 0, 0> {};
+
+template <class T, cyme::simd O, int N, class OP1>
+struct vertex_op<vec_exp10<T, O, N, OP1>> : vertex_count<0, 0, 0, 0, 0, 1, 0, 0, 0> {};
+
+template <class T, cyme::simd O, int N, class OP1, class OP2>
+struct vertex_op<vec_exp_add<T, O, N, OP1, OP2>> : vertex_count<1, 0, 0, 0, 0, 1, 0, 0, 0> {};
+
+template <class T, cyme::simd O, int N, class OP1>
+struct vertex_op<vec_log<T, O, N, OP1>> : vertex_count<0, 0, 0, 0, 0, 0, 1, 0, 0> {};
+
+template <class T, cyme::simd O, int N, class OP1>
+struct vertex_op<vec_log2<T, O, N, OP1>> : vertex_count<0, 0, 0, 0, 0, 0, 1, 0, 0> {};
+
+template <class T, cyme::simd O, int N, class OP1>
+struct vertex_op<vec_log10<T, O, N, OP1>> : vertex_count<0, 0, 0, 0, 0, 0, 1, 0, 0> {};
+
+template <class T, cyme::simd O, int N, class OP1, int M>
+struct vertex_op<vec_pow<T, O, N, OP1, M>> : vertex_count<0, 0, 0, 0, 0, 0, 0, 1, 0> {};
+
+template <class T, cyme::simd O, int N, class OP1, class OP2>
+struct vertex_op<vec_powf<T, O, N, OP1, OP2>> : vertex_count<0, 0, 0, 0, 0, 0, 0, 1, 0> {};
+
+/** the approximations are counted as the operations they replace */
+template <class T, cyme::simd O, int N, class OP1, int K>
+struct vertex_op<vec_rcp<T, O, N, OP1, K>> : vertex_count<0, 0, 0, 1, 0, 0, 0, 0, 0> {};
+
+template <class T, cyme::simd O, int N, class OP1, int K>
+struct vertex_op<vec_rsqrt<T, O, N, OP1, K>> : vertex_count<0, 0, 0, 1, 1, 0, 0, 0, 0> {};
+
+template <class T, cyme::simd O, int N, class OP1, class OP2, int K>
+struct vertex_op<vec_fast_div<T, O, N, OP1, OP2, K>> : vertex_count<0, 0, 0, 1, 0, 0, 0, 0, 0> {};
+
+/** polyval: a multiply-add per coefficient, the squares of x for Estrin and second order Horner */
+template <class C, cyme::poly_scheme S>
+struct vertex_poly {
+#ifdef __FMA__
+    static const bool fused = true;
+#else
+    static const bool fused = false;
+#endif
+    static const int steps = C::order;
+    static const int squares = detail::poly_eval<C, S>::powers - 1;
+    static const int add = fused ? 0 : steps;
+    static const int mul = (fused ? 0 : steps) + squares;
+    static const int fma = fused ? steps : 0;
+};
+
+template <class T, cyme::simd O, int N, class OP1, class C, cyme::poly_scheme S>
+struct vertex_op<vec_polyval<T, O, N, OP1, C, S>>
+    : vertex_count<vertex_poly<C, S>::add, vertex_poly<C, S>::mul, vertex_poly<C, S>::fma, 0, 0, 0, 0, 0, 0> {};
+
+template <class T, cyme::simd O, int N, class OP1, class P, class Q, cyme::poly_scheme S>
+struct vertex_op<vec_ratval<T, O, N, OP1, P, Q, S>>
+    : vertex_count<vertex_poly<P, S>::add + vertex_poly<Q, S>::add, vertex_poly<P, S>::mul + vertex_poly<Q, S>::mul,
+                   vertex_poly<P, S>::fma + vertex_poly<Q, S>::fma, 1, 0, 0, 0, 0, 0> {};
+
+/** a*b+c, a*b-c and c-a*b: a fma, or a mul and an add */
+struct vertex_muladd
+    : vertex_count<fma_contract<>::muladd ? 0 : 1, fma_contract<>::muladd ? 0 : 1, fma_contract<>::muladd ? 1 : 0,
+                   0, 0, 0, 0, 0, 0> {};
+
+template <class T, cyme::simd O, int N, class OP1, class OP2, class OP3>
+struct vertex_op<vec_muladd<T, O, N, OP1, OP2, OP3>> : vertex_muladd {};
+
+template <class T, cyme::simd O, int N, class OP1, class OP2, class OP3>
+struct vertex_op<vec_mulsub<T, O, N, OP1, OP2, OP3>> : vertex_muladd {};
+
+template <class T, cyme::simd O, int N, class OP1, class OP2, class OP3>
+struct vertex_op<vec_negate_muladd<T, O, N, OP1, OP2, OP3>> : vertex_muladd {};
+
+/** a*b+c*d and a*b-c*d: a fma and a mul, or two mul and an add */
+struct vertex_mul_add_mul : vertex_count<fma_contract<>::mul_add_mul ? 0 : 1, fma_contract<>::mul_add_mul ? 1 : 2,
+                                         fma_contract<>::mul_add_mul ? 1 : 0, 0, 0, 0, 0, 0, 0> {};
+
+template <class T, cyme::simd O, int N, class OP1, class OP2, class OP3, class OP4>
+struct vertex_op<vec_mul_add_mul<T, O, N, OP1, OP2, OP3, OP4>> : vertex_mul_add_mul {};
+
+template <class T, cyme::simd O, int N, class OP1, class OP2, class OP3, class OP4>
+struct vertex_op<vec_mul_sub_mul<T, O, N, OP1, OP2, OP3, OP4>> : vertex_mul_add_mul {};
+
+/** a*b+c*d+e: two fma, or a fma, a mul and an add, (a*b+c*d)+e without the cost model */
+template <class T, cyme::simd O, int N, class OP1, class OP2, class OP3, class OP4, class OP5>
+struct vertex_op<vec_mul_add_mul_add<T, O, N, OP1, OP2, OP3, OP4, OP5>>
+    : std::conditional<fma_contract<>::model,
+                       vertex_count<fma_contract<>::mul_add_mul_add ? 0 : 1, fma_contract<>::mul_add_mul_add ? 0 : 1,
+                                    fma_contract<>::mul_add_mul_add ? 2 : 1, 0, 0, 0, 0, 0, 0>,
+                       vertex_count<vertex_mul_add_mul::add + 1, vertex_mul_add_mul::mul, vertex_mul_add_mul::fma, 0, 0,
+                                    0, 0, 0, 0>>::type {};
+
+/** sum of the counts, the depth is the deepest */
+template <class... C>
+struct vertex_sum;
+
+template <>
+struct vertex_sum<> : vertex_count<0, 0, 0, 0, 0, 0, 0, 0, 0> {};
+
+template <class H, class... C>
+struct vertex_sum<H, C...> {
+    typedef vertex_sum<C...> rest;
+    static const int add = H::add + rest::add;
+    static const int mul = H::mul + rest::mul;
+    static const int fma = H::fma + rest::fma;
+    static const int div = H::div + rest::div;
+    static const int sqrt = H::sqrt + rest::sqrt;
+    static const int exp = H::exp + rest::exp;
+    static const int log = H::log + rest::log;
+    static const int pow = H::pow + rest::pow;
+    static const int other = H::other + rest::other;
+    static const int loads = H::loads + rest::loads;
+    static const int scalars = H::scalars + rest::scalars;
+    static const int depth = (H::depth > rest::depth) ? H::depth : rest::depth;
+};
+
+/** a vertex and its subtrees, the depth counts the vertices of the longest path, the leaves excluded */
+template <class V, class... OP>
+struct vertex_tree : vertex_sum<vertex_op<V>, OP...> {
+    static const int depth = vertex_sum<OP...>::depth + 1;
+};
+
+/** counts of a subtree, vertices grouped by number of operands as vertex_registers */
+template <class V>
+struct vertex_info;
+
+template <class T, cyme::simd O, int N>
+struct vertex_info<vec_simd<T, O, N>> : vertex_op<vec_simd<T, O, N>> {};
+
+template <class T, cyme::simd O, int N>
+struct vertex_info<vec_scalar<T, O, N>> : vertex_op<vec_scalar<T, O, N>> {};
+
+template <class T, cyme::simd O, int N>
+struct vertex_info<vec_field<T, O, N>> : vertex_op<vec_field<T, O, N>> {};
+
+template <template <class, cyme::simd, int, class> class V, class T, cyme::simd O, int N, class OP1>
+struct vertex_info<V<T, O, N, OP1>> : vertex_tree<V<T, O, N, OP1>, vertex_info<OP1>> {};
+
+template <template <class, cyme::simd, int, class, int> class V, class T, cyme::simd O, int N, class OP1, int M>
+struct vertex_info<V<T, O, N, OP1, M>> : vertex_tree<V<T, O, N, OP1, M>, vertex_info<OP1>> {};
+
+template <class T, cyme::simd O, int N, class OP1, class C, cyme::poly_scheme S>
+struct vertex_info<vec_polyval<T, O, N, OP1, C, S>> : vertex_tree<vec_polyval<T, O, N, OP1, C, S>, vertex_info<OP1>> {};
+
+template <class T, cyme::simd O, int N, class OP1, class P, class Q, cyme::poly_scheme S>
+struct vertex_info<vec_ratval<T, O, N, OP1, P, Q, S>>
+    : vertex_tree<vec_ratval<T, O, N, OP1, P, Q, S>, vertex_info<OP1>> {};
+
+template <template <class, cyme::simd, int, class, class> class V, class T, cyme::simd O, int N, class OP1,
+          class OP2>
+struct vertex_info<V<T, O, N, OP1, OP2>> : vertex_tree<V<T, O, N, OP1, OP2>, vertex_info<OP1>, vertex_info<OP2>> {};
+
+template <template <class, cyme::simd, int, class, class, int> class V, class T, cyme::simd O, int N, class OP1,
+          class OP2, int M>
+struct vertex_info<V<T, O, N, OP1, OP2, M>>
+    : vertex_tree<V<T, O, N, OP1, OP2, M>, vertex_info<OP1>, vertex_info<OP2>> {};
+
+template <template <class, cyme::simd, int, class, class, class> class V, class T, cyme::simd O, int N, class OP1,
+          class OP2, class OP3>
+struct vertex_info<V<T, O, N, OP1, OP2, OP3>>
+    : vertex_tree<V<T, O, N, OP1, OP2, OP3>, vertex_info<OP1>, vertex_info<OP2>, vertex_info<OP3>> {};
+
+template <template <class, cyme::simd, int, class, class, class, class> class V, class T, cyme::simd O, int N,
+          class OP1, class OP2, class OP3, class OP4>
+struct vertex_info<V<T, O, N, OP1, OP2, OP3, OP4>>
+    : vertex_tree<V<T, O, N, OP1, OP2, OP3, OP4>, vertex_info<OP1>, vertex_info<OP2>, vertex_info<OP3>,
+                  vertex_info<OP4>> {};
+
+template <template <class, cyme::simd, int, class, class, class, class, class> class V, class T, cyme::simd O,
+          int N, class OP1, class OP2, class OP3, class OP4, class OP5>
+struct vertex_info<V<T, O, N, OP1, OP2, OP3, OP4, OP5>>
+    : vertex_tree<V<T, O, N, OP1, OP2, OP3, OP4, OP5>, vertex_info<OP1>, vertex_info<OP2>, vertex_info<OP3>,
+                  vertex_info<OP4>, vertex_info<OP5>> {};
+
+/** the warning of check_spill, a deprecated function is the portable compile time warning */
+template <bool Spill>
+struct spill_warning {
+    static forceinline void check() {}
+};
+
+template <>
+struct spill_warning<true> {
+    __attribute__((deprecated("cyme: the expression needs more registers than the target, it will spill")))
+    static forceinline void check() {}
+};
+} // namespace detail
+/** \endcond */
+
+/** Operations of the expression E = vec<T, O, N, Rep>, known at compile time.
+ *
+ *  The counts are per vec_simd (multiply by elems_helper<T, N>::size for the
+ *  elements), the expression is assigned to a field: a store. The loads are
+ *  the leaves (a field read twice is two leaves), the scalars are
+ *  broadcast. The registers are the Sethi-Ullman estimate of the tree
+ *  (vertex_registers), times the unroll factor, the peak if the compiler
+ *  follows the order of the tree. The arithmetic intensity, for a roofline,
+ *  counts add, mul, div and sqrt as a flop and a fma as two, the
+ *  transcendental functions are apart.
+ *  \code{.cpp}
+ *  typedef cyme::expression_info<decltype(R[v] * R[m] + exp(R[h]))> info;
+ *  static_assert(!info::spill, "the kernel spills");
+ *  info::print(std::cout);
+ *  \endcode
+ */
+template <class E>
+struct expression_info;
+
+template <class T, cyme::simd O, int N, class Rep>
+struct expression_info<vec<T, O, N, Rep>> {
+    typedef detail::vertex_info<Rep> info;
+    static const int add = info::add;
+    static const int mul = info::mul;
+    static const int fma = info::fma;
+    static const int div = info::div;
+    static const int sqrt = info::sqrt;
+    static const int exp = info::exp;
+    static const int log = info::log;
+    static const int pow = info::pow;
+    static const int other = info::other;
+    static const int loads = info::loads;
+    static const int scalars = info::scalars;
+    static const int stores = 1;
+    static const int depth = info::depth;
+    static const int registers = vertex_registers<Rep>::value * N;
+    static const int available = trait_register<T, O>::count;
+    static const bool spill = registers > available;
+    static const int flops = add + mul + 2 * fma + div + sqrt;
+    static const int bytes = (loads + stores) * static_cast<int>(sizeof(T));
+
+    /** flops per byte of memory traffic */
+    static constexpr double intensity() { return static_cast<double>(flops) / bytes; }
+
+    static void print(std::ostream &out) {
+        out << "add " << add << ", mul " << mul << ", fma " << fma << ", div " << div << ", sqrt " << sqrt
+            << ", exp " << exp << ", log " << log << ", pow " << pow << ", other " << other << "\n"
+            << "loads " << loads << ", scalars " << scalars << ", stores " << stores << ", depth " << depth
+            << ", registers " << registers << " / " << available << (spill ? " (spill)" : "") << "\n"
+            << "flops " << flops << ", bytes " << bytes << ", intensity " << intensity() << " flop/byte\n";
+    }
+};
+
+/** print the operations of an expression, see expression_info */
+template <class T, cyme::simd O, int N, class Rep>
+void print_info(vec<T, O, N, Rep> const &, std::ostream &out) {
+    expression_info<vec<T, O, N, Rep>>::print(out);
+}
+
+/** compile time warning if the expression needs more registers than the target, see expression_info */
+template <class T, cyme::simd O, int N, class Rep>
+forceinline void check_spill(vec<T, O, N, Rep> const &) {
+    detail::spill_warning<expression_info<vec<T, O, N, Rep>>::spill>::check();
+}
+} // namespace cyme
+
+#endif
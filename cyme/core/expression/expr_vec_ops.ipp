@@ -49,6 +49,14 @@ struct identity {
     typedef T value_type;
 };
 
+/** compile time constants of the trees, a*cyme::one and a+cyme::zero are a: no vertex, no instruction.
+    The value of a scalar (1., 0.) is known at run time only, a*1. stays a multiplication */
+struct one_type {};
+struct zero_type {};
+
+constexpr one_type one = one_type();
+constexpr zero_type zero = zero_type();
+
 /**
  * free function for gather specific to coreneuron, load only
  * it is not a part of Template Expression
@@ -78,6 +86,62 @@ forceinline vec<T, O, N, vec_fabs<T, O, N, R1>> fabs(vec<T, O, N, R1> const &a)
     return vec<T, O, N, vec_fabs<T, O, N, R1>>(vec_fabs<T, O, N, R1>(a.rep()));
 }
 
+/**
+ * floor(a) function, the result stays a floating point number
+ */
+template <class T, cyme::simd O, int N, class R1>
+forceinline vec<T, O, N, vec_floor<T, O, N, R1>> floor(vec<T, O, N, R1> const &a) {
+    return vec<T, O, N, vec_floor<T, O, N, R1>>(vec_floor<T, O, N, R1>(a.rep()));
+}
+
+/**
+ * ceil(a) function
+ */
+template <class T, cyme::simd O, int N, class R1>
+forceinline vec<T, O, N, vec_ceil<T, O, N, R1>> ceil(vec<T, O, N, R1> const &a) {
+    return vec<T, O, N, vec_ceil<T, O, N, R1>>(vec_ceil<T, O, N, R1>(a.rep()));
+}
+
+/**
+ * trunc(a) function
+ */
+template <class T, cyme::simd O, int N, class R1>
+forceinline vec<T, O, N, vec_trunc<T, O, N, R1>> trunc(vec<T, O, N, R1> const &a) {
+    return vec<T, O, N, vec_trunc<T, O, N, R1>>(vec_trunc<T, O, N, R1>(a.rep()));
+}
+
+/**
+ * rint(a) function, the halfway cases to the even integer
+ */
+template <class T, cyme::simd O, int N, class R1>
+forceinline vec<T, O, N, vec_rint<T, O, N, R1>> rint(vec<T, O, N, R1> const &a) {
+    return vec<T, O, N, vec_rint<T, O, N, R1>>(vec_rint<T, O, N, R1>(a.rep()));
+}
+
+/**
+ * round(a) function, the halfway cases away from zero
+ */
+template <class T, cyme::simd O, int N, class R1>
+forceinline vec<T, O, N, vec_round<T, O, N, R1>> round(vec<T, O, N, R1> const &a) {
+    return vec<T, O, N, vec_round<T, O, N, R1>>(vec_round<T, O, N, R1>(a.rep()));
+}
+
+/**
+ * frexp(a) function, the fraction of std::frexp, its exponent is logb(a) + 1
+ */
+template <class T, cyme::simd O, int N, class R1>
+forceinline vec<T, O, N, vec_frexp<T, O, N, R1>> frexp(vec<T, O, N, R1> const &a) {
+    return vec<T, O, N, vec_frexp<T, O, N, R1>>(vec_frexp<T, O, N, R1>(a.rep()));
+}
+
+/**
+ * logb(a) function
+ */
+template <class T, cyme::simd O, int N, class R1>
+forceinline vec<T, O, N, vec_logb<T, O, N, R1>> logb(vec<T, O, N, R1> const &a) {
+    return vec<T, O, N, vec_logb<T, O, N, R1>>(vec_logb<T, O, N, R1>(a.rep()));
+}
+
 /**
  * sin(a) function
  */
@@ -158,6 +222,57 @@ forceinline vec<T, O, N, vec_log10<T, O, N, R1>> log10(vec<T, O, N, R1> const &a
     return vec<T, O, N, vec_log10<T, O, N, R1>>(vec_log10<T, O, N, R1>(a.rep()));
 }
 
+/**
+ * rcp<K>(a) function, approximation of 1/a refined by K Newton-Raphson steps
+ */
+template <int K, class T, cyme::simd O, int N, class R1>
+forceinline vec<T, O, N, vec_rcp<T, O, N, R1, K>> rcp(vec<T, O, N, R1> const &a) {
+    return vec<T, O, N, vec_rcp<T, O, N, R1, K>>(vec_rcp<T, O, N, R1, K>(a.rep()));
+}
+
+/**
+ * rsqrt<K>(a) function, approximation of 1/sqrt(a) refined by K Newton-Raphson steps
+ */
+template <int K, class T, cyme::simd O, int N, class R1>
+forceinline vec<T, O, N, vec_rsqrt<T, O, N, R1, K>> rsqrt(vec<T, O, N, R1> const &a) {
+    return vec<T, O, N, vec_rsqrt<T, O, N, R1, K>>(vec_rsqrt<T, O, N, R1, K>(a.rep()));
+}
+
+/**
+ * polyval<C, S>(a) function, the polynomial of the coefficient table C evaluated by the scheme S
+ */
+template <class C, cyme::poly_scheme S = cyme::poly_horner, class T, cyme::simd O, int N, class R1>
+forceinline vec<T, O, N, vec_polyval<T, O, N, R1, C, S>> polyval(vec<T, O, N, R1> const &a) {
+    return vec<T, O, N, vec_polyval<T, O, N, R1, C, S>>(vec_polyval<T, O, N, R1, C, S>(a.rep()));
+}
+
+/**
+ * ratval<P, Q, S>(a) function, the rational function P(a)/Q(a) of the coefficient tables P and Q
+ */
+template <class P, class Q, cyme::poly_scheme S = cyme::poly_horner, class T, cyme::simd O, int N, class R1>
+forceinline vec<T, O, N, vec_ratval<T, O, N, R1, P, Q, S>> ratval(vec<T, O, N, R1> const &a) {
+    return vec<T, O, N, vec_ratval<T, O, N, R1, P, Q, S>>(vec_ratval<T, O, N, R1, P, Q, S>(a.rep()));
+}
+
+/**
+ * fast_div<K>(a,b) function, a*rcp<K>(b): the division with the precision of the caller
+ */
+template <int K, class T, cyme::simd O, int N, class R1, class R2>
+forceinline vec<T, O, N, vec_fast_div<T, O, N, R1, R2, K>> fast_div(vec<T, O, N, R1> const &a,
+                                                                    vec<T, O, N, R2> const &b) {
+    return vec<T, O, N, vec_fast_div<T, O, N, R1, R2, K>>(vec_fast_div<T, O, N, R1, R2, K>(a.rep(), b.rep()));
+}
+
+/**
+ * fast_div<K>(s,b) function where s is a scalar
+ */
+template <int K, class T, cyme::simd O, int N, class R2>
+forceinline vec<T, O, N, vec_fast_div<T, O, N, vec_scalar<T, O, N>, R2, K>>
+fast_div(typename identity<T>::value_type const &s, vec<T, O, N, R2> const &b) {
+    return vec<T, O, N, vec_fast_div<T, O, N, vec_scalar<T, O, N>, R2, K>>(
+        vec_fast_div<T, O, N, vec_scalar<T, O, N>, R2, K>(vec_scalar<T, O, N>(static_cast<T>(s)), b.rep()));
+}
+
 /**
  * pow(a,e) function, integer only
  */
@@ -180,7 +295,7 @@ forceinline vec<T, O, N, vec_powf<T, O, N, R1, R2>> pow(vec<T, O, N, R1> const &
  */
 template <class T, cyme::simd O, int N, class R1>
 forceinline vec<T, O, N, R1> operator-(vec<T, O, N, vec_neg<T, O, N, R1>> const &a) {
-    return vec<T, O, N, R1>(a.rep().op1());
+    return vec<T, O, N, R1>(vertex_access::op1(a.rep()));
 }
 
 /**
@@ -273,58 +388,56 @@ forceinline vec<T, O, N, vec_lt<T, O, N, vec_scalar<T, O, N>, R1>> operator<(typ
  * less equal than operator  a <= b
  */
 template <class T, cyme::simd O, int N, class R1, class R2>
-forceinline vec<T, O, N, vec_not<T, O, N, vec_lt<T, O, N, R2, R1>>> operator<=(vec<T, O, N, R1> const &a,
-                                                                               vec<T, O, N, R2> const &b) {
-    return ~vec<T, O, N, vec_lt<T, O, N, R2, R1>>(vec_lt<T, O, N, R2, R1>(b.rep(), a.rep())); // due to SIMD ! becomes ~
+forceinline vec<T, O, N, vec_le<T, O, N, R1, R2>> operator<=(vec<T, O, N, R1> const &a, vec<T, O, N, R2> const &b) {
+    return vec<T, O, N, vec_le<T, O, N, R1, R2>>(vec_le<T, O, N, R1, R2>(a.rep(), b.rep()));
 }
 
 /**
  * less equal than operator  a <= s where s is a scalar
  */
 template <class T, cyme::simd O, int N, class R1>
-forceinline vec<T, O, N, vec_not<T, O, N, vec_lt<T, O, N, vec_scalar<T, O, N>, R1>>>
+forceinline vec<T, O, N, vec_le<T, O, N, R1, vec_scalar<T, O, N>>>
 operator<=(vec<T, O, N, R1> const &a, typename identity<T>::value_type const &s) {
-    return ~vec<T, O, N, vec_lt<T, O, N, vec_scalar<T, O, N>, R1>>( // due to SIMD ! becomes ~
-        vec_lt<T, O, N, vec_scalar<T, O, N>, R1>(vec_scalar<T, O, N>(static_cast<T>(s)), a.rep()));
+    return vec<T, O, N, vec_le<T, O, N, R1, vec_scalar<T, O, N>>>(
+        vec_le<T, O, N, R1, vec_scalar<T, O, N>>(a.rep(), vec_scalar<T, O, N>(static_cast<T>(s))));
 }
 
 /**
  * less  equal than operator  s <= a where s is a scalar
  */
 template <class T, cyme::simd O, int N, class R1>
-forceinline vec<T, O, N, vec_not<T, O, N, vec_lt<T, O, N, R1, vec_scalar<T, O, N>>>>
+forceinline vec<T, O, N, vec_le<T, O, N, vec_scalar<T, O, N>, R1>>
 operator<=(typename identity<T>::value_type const &s, vec<T, O, N, R1> const &a) {
-    return ~vec<T, O, N, vec_lt<T, O, N, R1, vec_scalar<T, O, N>>>( // due to SIMD ! becomes ~
-        vec_lt<T, O, N, R1, vec_scalar<T, O, N>>(a.rep(), vec_scalar<T, O, N>(static_cast<T>(s))));
+    return vec<T, O, N, vec_le<T, O, N, vec_scalar<T, O, N>, R1>>(
+        vec_le<T, O, N, vec_scalar<T, O, N>, R1>(vec_scalar<T, O, N>(static_cast<T>(s)), a.rep()));
 }
 
 /**
- * greater equal than operator  a >= b
+ * greater equal than operator  a >= b, b <= a
  */
 template <class T, cyme::simd O, int N, class R1, class R2>
-forceinline vec<T, O, N, vec_not<T, O, N, vec_lt<T, O, N, R1, R2>>> operator>=(vec<T, O, N, R1> const &a,
-                                                                               vec<T, O, N, R2> const &b) {
-    return ~vec<T, O, N, vec_lt<T, O, N, R1, R2>>(vec_lt<T, O, N, R1, R2>(a.rep(), b.rep())); // due to SIMD ! becomes ~
+forceinline vec<T, O, N, vec_le<T, O, N, R2, R1>> operator>=(vec<T, O, N, R1> const &a, vec<T, O, N, R2> const &b) {
+    return vec<T, O, N, vec_le<T, O, N, R2, R1>>(vec_le<T, O, N, R2, R1>(b.rep(), a.rep()));
 }
 
 /**
  * greater equal than operator  a >= s where s is a scalar
  */
 template <class T, cyme::simd O, int N, class R1>
-forceinline vec<T, O, N, vec_not<T, O, N, vec_lt<T, O, N, R1, vec_scalar<T, O, N>>>>
+forceinline vec<T, O, N, vec_le<T, O, N, vec_scalar<T, O, N>, R1>>
 operator>=(vec<T, O, N, R1> const &a, typename identity<T>::value_type const &s) {
-    return ~vec<T, O, N, vec_lt<T, O, N, R1, vec_scalar<T, O, N>>>( // due to SIMD ! becomes ~
-        vec_lt<T, O, N, R1, vec_scalar<T, O, N>>(a.rep(), vec_scalar<T, O, N>(static_cast<T>(s))));
+    return vec<T, O, N, vec_le<T, O, N, vec_scalar<T, O, N>, R1>>(
+        vec_le<T, O, N, vec_scalar<T, O, N>, R1>(vec_scalar<T, O, N>(static_cast<T>(s)), a.rep()));
 }
 
 /**
  * greater equal than operator  s >= a where s is a scalar
  */
 template <class T, cyme::simd O, int N, class R1>
-forceinline vec<T, O, N, vec_not<T, O, N, vec_lt<T, O, N, vec_scalar<T, O, N>, R1>>>
+forceinline vec<T, O, N, vec_le<T, O, N, R1, vec_scalar<T, O, N>>>
 operator>=(typename identity<T>::value_type const &s, vec<T, O, N, R1> const &a) {
-    return ~vec<T, O, N, vec_lt<T, O, N, vec_scalar<T, O, N>, R1>>( // due to SIMD ! becomes ~
-        vec_lt<T, O, N, vec_scalar<T, O, N>, R1>(vec_scalar<T, O, N>(static_cast<T>(s)), a.rep()));
+    return vec<T, O, N, vec_le<T, O, N, R1, vec_scalar<T, O, N>>>(
+        vec_le<T, O, N, R1, vec_scalar<T, O, N>>(a.rep(), vec_scalar<T, O, N>(static_cast<T>(s))));
 }
 
 /**
@@ -373,6 +486,24 @@ operator==(vec<T, O, N, R1> const &a, typename identity<T>::value_type const &s)
         vec_eq<T, O, N, R1, vec_scalar<T, O, N>>(a.rep(), vec_scalar<T, O, N>(static_cast<T>(s))));
 }
 
+/**
+ * not equal operator  a != b
+ */
+template <class T, cyme::simd O, int N, class R1, class R2>
+forceinline vec<T, O, N, vec_ne<T, O, N, R1, R2>> operator!=(vec<T, O, N, R1> const &a, vec<T, O, N, R2> const &b) {
+    return vec<T, O, N, vec_ne<T, O, N, R1, R2>>(vec_ne<T, O, N, R1, R2>(a.rep(), b.rep()));
+}
+
+/**
+ * not equal operator  a != s where s is a scalar
+ */
+template <class T, cyme::simd O, int N, class R1>
+forceinline vec<T, O, N, vec_ne<T, O, N, R1, vec_scalar<T, O, N>>>
+operator!=(vec<T, O, N, R1> const &a, typename identity<T>::value_type const &s) {
+    return vec<T, O, N, vec_ne<T, O, N, R1, vec_scalar<T, O, N>>>(
+        vec_ne<T, O, N, R1, vec_scalar<T, O, N>>(a.rep(), vec_scalar<T, O, N>(static_cast<T>(s))));
+}
+
 /**
  * addition operator a+b
  */
@@ -435,13 +566,14 @@ forceinline vec<T, O, N, vec_sub<T, O, N, vec_scalar<T, O, N>, R2>> operator-(ty
 }
 
 /**
- * substraction operator a-s where s is a scalar
+ * substraction operator a-s where s is a scalar, the operation is transformed to (-s)+a
+ * so it follows the simplifications of the addition
  */
 template <class T, cyme::simd O, int N, class R2>
-forceinline vec<T, O, N, vec_sub<T, O, N, R2, vec_scalar<T, O, N>>>
+forceinline vec<T, O, N, vec_add<T, O, N, vec_scalar<T, O, N>, R2>>
 operator-(vec<T, O, N, R2> const &b, typename identity<T>::value_type const &s) {
-    return vec<T, O, N, vec_sub<T, O, N, R2, vec_scalar<T, O, N>>>(
-        vec_sub<T, O, N, R2, vec_scalar<T, O, N>>(b.rep(), vec_scalar<T, O, N>(static_cast<T>(s))));
+    return vec<T, O, N, vec_add<T, O, N, vec_scalar<T, O, N>, R2>>(
+        vec_add<T, O, N, vec_scalar<T, O, N>, R2>(vec_scalar<T, O, N>(-static_cast<T>(s)), b.rep()));
 }
 
 /**
@@ -474,14 +606,178 @@ forceinline vec<T, O, N, vec_div<T, O, N, vec_scalar<T, O, N>, R2>> operator/(ty
 }
 
 /**
- * division operator b/s where s is a scalar, the operation is transformed to b*1/s
- * where 1/s is computed at compile time
+ * division operator b/s where s is a scalar, the operation is transformed to (1/s)*b
+ * where 1/s is computed at compile time, it follows the simplifications of the multiplication
  */
 template <class T, cyme::simd O, int N, class R2>
-forceinline vec<T, O, N, vec_mul<T, O, N, R2, vec_scalar<T, O, N>>>
+forceinline vec<T, O, N, vec_mul<T, O, N, vec_scalar<T, O, N>, R2>>
 operator/(vec<T, O, N, R2> const &b, typename identity<T>::value_type const &s) {
-    return vec<T, O, N, vec_mul<T, O, N, R2, vec_scalar<T, O, N>>>(
-        vec_mul<T, O, N, R2, vec_scalar<T, O, N>>(b.rep(), vec_scalar<T, O, N>(1. / static_cast<T>(s))));
+    return operator*(static_cast<T>(1. / static_cast<T>(s)), b);
+}
+
+/**
+ * simplification s1*(s2*b) = (s1*s2)*b, chain of scalars folded at compile time
+ */
+template <class T, cyme::simd O, int N, class R2>
+forceinline vec<T, O, N, vec_mul<T, O, N, vec_scalar<T, O, N>, R2>>
+operator*(typename identity<T>::value_type const &s, vec<T, O, N, vec_mul<T, O, N, vec_scalar<T, O, N>, R2>> const &b) {
+    return vec<T, O, N, vec_mul<T, O, N, vec_scalar<T, O, N>, R2>>(vec_mul<T, O, N, vec_scalar<T, O, N>, R2>(
+        vec_scalar<T, O, N>(static_cast<T>(s) * b.rep().getop1().value()), b.rep().getop2()));
+}
+
+/**
+ * simplification (s2*b)*s1 = (s1*s2)*b
+ */
+template <class T, cyme::simd O, int N, class R2>
+forceinline vec<T, O, N, vec_mul<T, O, N, vec_scalar<T, O, N>, R2>>
+operator*(vec<T, O, N, vec_mul<T, O, N, vec_scalar<T, O, N>, R2>> const &b, typename identity<T>::value_type const &s) {
+    return operator*(s, b);
+}
+
+/**
+ * simplification (s2*b)/s1 = (s2/s1)*b
+ */
+template <class T, cyme::simd O, int N, class R2>
+forceinline vec<T, O, N, vec_mul<T, O, N, vec_scalar<T, O, N>, R2>>
+operator/(vec<T, O, N, vec_mul<T, O, N, vec_scalar<T, O, N>, R2>> const &b, typename identity<T>::value_type const &s) {
+    return operator*(static_cast<T>(1. / static_cast<T>(s)), b);
+}
+
+/**
+ * simplification s1+(s2+b) = (s1+s2)+b, chain of scalars folded at compile time
+ */
+template <class T, cyme::simd O, int N, class R2>
+forceinline vec<T, O, N, vec_add<T, O, N, vec_scalar<T, O, N>, R2>>
+operator+(typename identity<T>::value_type const &s, vec<T, O, N, vec_add<T, O, N, vec_scalar<T, O, N>, R2>> const &b) {
+    return vec<T, O, N, vec_add<T, O, N, vec_scalar<T, O, N>, R2>>(vec_add<T, O, N, vec_scalar<T, O, N>, R2>(
+        vec_scalar<T, O, N>(static_cast<T>(s) + vertex_access::op1(b.rep()).value()), vertex_access::op2(b.rep())));
+}
+
+/**
+ * simplification (s2+b)+s1 = (s1+s2)+b
+ */
+template <class T, cyme::simd O, int N, class R2>
+forceinline vec<T, O, N, vec_add<T, O, N, vec_scalar<T, O, N>, R2>>
+operator+(vec<T, O, N, vec_add<T, O, N, vec_scalar<T, O, N>, R2>> const &b, typename identity<T>::value_type const &s) {
+    return operator+(s, b);
+}
+
+/**
+ * simplification (s2+b)-s1 = (s2-s1)+b
+ */
+template <class T, cyme::simd O, int N, class R2>
+forceinline vec<T, O, N, vec_add<T, O, N, vec_scalar<T, O, N>, R2>>
+operator-(vec<T, O, N, vec_add<T, O, N, vec_scalar<T, O, N>, R2>> const &b, typename identity<T>::value_type const &s) {
+    return operator+(-static_cast<T>(s), b);
+}
+
+/**
+ * simplification s1-(s2+b) = (s1-s2)-b
+ */
+template <class T, cyme::simd O, int N, class R2>
+forceinline vec<T, O, N, vec_sub<T, O, N, vec_scalar<T, O, N>, R2>>
+operator-(typename identity<T>::value_type const &s, vec<T, O, N, vec_add<T, O, N, vec_scalar<T, O, N>, R2>> const &b) {
+    return vec<T, O, N, vec_sub<T, O, N, vec_scalar<T, O, N>, R2>>(vec_sub<T, O, N, vec_scalar<T, O, N>, R2>(
+        vec_scalar<T, O, N>(static_cast<T>(s) - vertex_access::op1(b.rep()).value()), vertex_access::op2(b.rep())));
+}
+
+/**
+ * simplification -(s*b) = (-s)*b, the negation goes into the scalar
+ */
+template <class T, cyme::simd O, int N, class R2>
+forceinline vec<T, O, N, vec_mul<T, O, N, vec_scalar<T, O, N>, R2>>
+operator-(vec<T, O, N, vec_mul<T, O, N, vec_scalar<T, O, N>, R2>> const &b) {
+    return operator*(static_cast<T>(-1), b);
+}
+
+/**
+ * simplification a*1 = a
+ */
+template <class T, cyme::simd O, int N, class R1>
+forceinline vec<T, O, N, R1> operator*(vec<T, O, N, R1> const &a, one_type) {
+    return a;
+}
+
+/**
+ * simplification 1*a = a
+ */
+template <class T, cyme::simd O, int N, class R1>
+forceinline vec<T, O, N, R1> operator*(one_type, vec<T, O, N, R1> const &a) {
+    return a;
+}
+
+/**
+ * simplification a/1 = a
+ */
+template <class T, cyme::simd O, int N, class R1>
+forceinline vec<T, O, N, R1> operator/(vec<T, O, N, R1> const &a, one_type) {
+    return a;
+}
+
+/**
+ * simplification a+0 = a
+ */
+template <class T, cyme::simd O, int N, class R1>
+forceinline vec<T, O, N, R1> operator+(vec<T, O, N, R1> const &a, zero_type) {
+    return a;
+}
+
+/**
+ * simplification 0+a = a
+ */
+template <class T, cyme::simd O, int N, class R1>
+forceinline vec<T, O, N, R1> operator+(zero_type, vec<T, O, N, R1> const &a) {
+    return a;
+}
+
+/**
+ * simplification a-0 = a
+ */
+template <class T, cyme::simd O, int N, class R1>
+forceinline vec<T, O, N, R1> operator-(vec<T, O, N, R1> const &a, zero_type) {
+    return a;
+}
+
+/**
+ * a*1, 1*a, a/1, a+0, 0+a, a-0 = a for a scalar, R[x] of the AoS storage, a kernel is the same for both layouts
+ */
+template <class T>
+forceinline typename std::enable_if<std::is_arithmetic<T>::value, T>::type operator*(T const &a, one_type) {
+    return a;
+}
+
+template <class T>
+forceinline typename std::enable_if<std::is_arithmetic<T>::value, T>::type operator*(one_type, T const &a) {
+    return a;
+}
+
+template <class T>
+forceinline typename std::enable_if<std::is_arithmetic<T>::value, T>::type operator/(T const &a, one_type) {
+    return a;
+}
+
+template <class T>
+forceinline typename std::enable_if<std::is_arithmetic<T>::value, T>::type operator+(T const &a, zero_type) {
+    return a;
+}
+
+template <class T>
+forceinline typename std::enable_if<std::is_arithmetic<T>::value, T>::type operator+(zero_type, T const &a) {
+    return a;
+}
+
+template <class T>
+forceinline typename std::enable_if<std::is_arithmetic<T>::value, T>::type operator-(T const &a, zero_type) {
+    return a;
+}
+
+/**
+ * simplification exp(a)*exp(b) = exp(a+b), one exponential less
+ */
+template <class T, cyme::simd O, int N, class R1, class R2>
+forceinline vec<T, O, N, vec_exp_add<T, O, N, R1, R2>> operator*(vec<T, O, N, vec_exp<T, O, N, R1>> const &a,
+                                                                 vec<T, O, N, vec_exp<T, O, N, R2>> const &b) {
+    return vec<T, O, N, vec_exp_add<T, O, N, R1, R2>>(vec_exp_add<T, O, N, R1, R2>(a.rep(), b.rep()));
 }
 
 /**
@@ -491,6 +787,246 @@ template <class T, cyme::simd O, int N, class R1, class R2>
 forceinline vec<T, O, N, vec_min<T, O, N, R1, R2>> min(vec<T, O, N, R1> const &a, vec<T, O, N, R2> const &b) {
     return vec<T, O, N, vec_min<T, O, N, R1, R2>>(vec_min<T, O, N, R1, R2>(a.rep(), b.rep()));
 }
+
+/**
+ * minimum operator a,s where s is a scalar
+ */
+template <class T, cyme::simd O, int N, class R1>
+forceinline vec<T, O, N, vec_min<T, O, N, R1, vec_scalar<T, O, N>>> min(vec<T, O, N, R1> const &a,
+                                                                        typename identity<T>::value_type const &s) {
+    return vec<T, O, N, vec_min<T, O, N, R1, vec_scalar<T, O, N>>>(
+        vec_min<T, O, N, R1, vec_scalar<T, O, N>>(a.rep(), vec_scalar<T, O, N>(static_cast<T>(s))));
+}
+
+/**
+ * minimum operator s,a where s is a scalar
+ */
+template <class T, cyme::simd O, int N, class R1>
+forceinline vec<T, O, N, vec_min<T, O, N, R1, vec_scalar<T, O, N>>> min(typename identity<T>::value_type const &s,
+                                                                        vec<T, O, N, R1> const &a) {
+    return min(a, s);
+}
+
+/**
+ * maximum operator a,b
+ */
+template <class T, cyme::simd O, int N, class R1, class R2>
+forceinline vec<T, O, N, vec_max<T, O, N, R1, R2>> max(vec<T, O, N, R1> const &a, vec<T, O, N, R2> const &b) {
+    return vec<T, O, N, vec_max<T, O, N, R1, R2>>(vec_max<T, O, N, R1, R2>(a.rep(), b.rep()));
+}
+
+/**
+ * maximum operator a,s where s is a scalar
+ */
+template <class T, cyme::simd O, int N, class R1>
+forceinline vec<T, O, N, vec_max<T, O, N, R1, vec_scalar<T, O, N>>> max(vec<T, O, N, R1> const &a,
+                                                                        typename identity<T>::value_type const &s) {
+    return vec<T, O, N, vec_max<T, O, N, R1, vec_scalar<T, O, N>>>(
+        vec_max<T, O, N, R1, vec_scalar<T, O, N>>(a.rep(), vec_scalar<T, O, N>(static_cast<T>(s))));
+}
+
+/**
+ * maximum operator s,a where s is a scalar
+ */
+template <class T, cyme::simd O, int N, class R1>
+forceinline vec<T, O, N, vec_max<T, O, N, R1, vec_scalar<T, O, N>>> max(typename identity<T>::value_type const &s,
+                                                                        vec<T, O, N, R1> const &a) {
+    return max(a, s);
+}
+
+/**
+ * copysign operator a,b, the magnitude of a and the sign of b
+ */
+template <class T, cyme::simd O, int N, class R1, class R2>
+forceinline vec<T, O, N, vec_copysign<T, O, N, R1, R2>> copysign(vec<T, O, N, R1> const &a, vec<T, O, N, R2> const &b) {
+    return vec<T, O, N, vec_copysign<T, O, N, R1, R2>>(vec_copysign<T, O, N, R1, R2>(a.rep(), b.rep()));
+}
+
+/**
+ * copysign operator a,s where s is a scalar
+ */
+template <class T, cyme::simd O, int N, class R1>
+forceinline vec<T, O, N, vec_copysign<T, O, N, R1, vec_scalar<T, O, N>>>
+copysign(vec<T, O, N, R1> const &a, typename identity<T>::value_type const &s) {
+    return vec<T, O, N, vec_copysign<T, O, N, R1, vec_scalar<T, O, N>>>(
+        vec_copysign<T, O, N, R1, vec_scalar<T, O, N>>(a.rep(), vec_scalar<T, O, N>(static_cast<T>(s))));
+}
+
+/**
+ * copysign operator s,a where s is a scalar
+ */
+template <class T, cyme::simd O, int N, class R1>
+forceinline vec<T, O, N, vec_copysign<T, O, N, vec_scalar<T, O, N>, R1>>
+copysign(typename identity<T>::value_type const &s, vec<T, O, N, R1> const &a) {
+    return vec<T, O, N, vec_copysign<T, O, N, vec_scalar<T, O, N>, R1>>(
+        vec_copysign<T, O, N, vec_scalar<T, O, N>, R1>(vec_scalar<T, O, N>(static_cast<T>(s)), a.rep()));
+}
+
+/**
+ * ldexp operator a,b, a*2^b where b holds integral values
+ */
+template <class T, cyme::simd O, int N, class R1, class R2>
+forceinline vec<T, O, N, vec_ldexp<T, O, N, R1, R2>> ldexp(vec<T, O, N, R1> const &a, vec<T, O, N, R2> const &b) {
+    return vec<T, O, N, vec_ldexp<T, O, N, R1, R2>>(vec_ldexp<T, O, N, R1, R2>(a.rep(), b.rep()));
+}
+
+/**
+ * ldexp operator a,s where s is a scalar
+ */
+template <class T, cyme::simd O, int N, class R1>
+forceinline vec<T, O, N, vec_ldexp<T, O, N, R1, vec_scalar<T, O, N>>> ldexp(vec<T, O, N, R1> const &a,
+                                                                            typename identity<T>::value_type const &s) {
+    return vec<T, O, N, vec_ldexp<T, O, N, R1, vec_scalar<T, O, N>>>(
+        vec_ldexp<T, O, N, R1, vec_scalar<T, O, N>>(a.rep(), vec_scalar<T, O, N>(static_cast<T>(s))));
+}
+
+/**
+ * ldexp operator s,a where s is a scalar
+ */
+template <class T, cyme::simd O, int N, class R1>
+forceinline vec<T, O, N, vec_ldexp<T, O, N, vec_scalar<T, O, N>, R1>> ldexp(typename identity<T>::value_type const &s,
+                                                                            vec<T, O, N, R1> const &a) {
+    return vec<T, O, N, vec_ldexp<T, O, N, vec_scalar<T, O, N>, R1>>(
+        vec_ldexp<T, O, N, vec_scalar<T, O, N>, R1>(vec_scalar<T, O, N>(static_cast<T>(s)), a.rep()));
+}
+
+/**
+ * fmod operator a,b, the remainder of a/b with the sign of a
+ */
+template <class T, cyme::simd O, int N, class R1, class R2>
+forceinline vec<T, O, N, vec_fmod<T, O, N, R1, R2>> fmod(vec<T, O, N, R1> const &a, vec<T, O, N, R2> const &b) {
+    return vec<T, O, N, vec_fmod<T, O, N, R1, R2>>(vec_fmod<T, O, N, R1, R2>(a.rep(), b.rep()));
+}
+
+/**
+ * fmod operator a,s where s is a scalar
+ */
+template <class T, cyme::simd O, int N, class R1>
+forceinline vec<T, O, N, vec_fmod<T, O, N, R1, vec_scalar<T, O, N>>> fmod(vec<T, O, N, R1> const &a,
+                                                                          typename identity<T>::value_type const &s) {
+    return vec<T, O, N, vec_fmod<T, O, N, R1, vec_scalar<T, O, N>>>(
+        vec_fmod<T, O, N, R1, vec_scalar<T, O, N>>(a.rep(), vec_scalar<T, O, N>(static_cast<T>(s))));
+}
+
+/**
+ * fmod operator s,a where s is a scalar
+ */
+template <class T, cyme::simd O, int N, class R1>
+forceinline vec<T, O, N, vec_fmod<T, O, N, vec_scalar<T, O, N>, R1>> fmod(typename identity<T>::value_type const &s,
+                                                                          vec<T, O, N, R1> const &a) {
+    return vec<T, O, N, vec_fmod<T, O, N, vec_scalar<T, O, N>, R1>>(
+        vec_fmod<T, O, N, vec_scalar<T, O, N>, R1>(vec_scalar<T, O, N>(static_cast<T>(s)), a.rep()));
+}
+
+/**
+ * select operator where(m,a,b), a where the mask m (a comparison) is true else b
+ */
+template <class T, cyme::simd O, int N, class R1, class R2, class R3>
+forceinline vec<T, O, N, vec_where<T, O, N, R1, R2, R3>> where(vec<T, O, N, R1> const &m, vec<T, O, N, R2> const &a,
+                                                               vec<T, O, N, R3> const &b) {
+    return vec<T, O, N, vec_where<T, O, N, R1, R2, R3>>(vec_where<T, O, N, R1, R2, R3>(m.rep(), a.rep(), b.rep()));
+}
+
+/**
+ * select operator where(m,a,s) where s is a scalar
+ */
+template <class T, cyme::simd O, int N, class R1, class R2>
+forceinline vec<T, O, N, vec_where<T, O, N, R1, R2, vec_scalar<T, O, N>>>
+where(vec<T, O, N, R1> const &m, vec<T, O, N, R2> const &a, typename identity<T>::value_type const &s) {
+    return vec<T, O, N, vec_where<T, O, N, R1, R2, vec_scalar<T, O, N>>>(
+        vec_where<T, O, N, R1, R2, vec_scalar<T, O, N>>(m.rep(), a.rep(), vec_scalar<T, O, N>(static_cast<T>(s))));
+}
+
+/**
+ * select operator where(m,s,b) where s is a scalar
+ */
+template <class T, cyme::simd O, int N, class R1, class R3>
+forceinline vec<T, O, N, vec_where<T, O, N, R1, vec_scalar<T, O, N>, R3>>
+where(vec<T, O, N, R1> const &m, typename identity<T>::value_type const &s, vec<T, O, N, R3> const &b) {
+    return vec<T, O, N, vec_where<T, O, N, R1, vec_scalar<T, O, N>, R3>>(
+        vec_where<T, O, N, R1, vec_scalar<T, O, N>, R3>(m.rep(), vec_scalar<T, O, N>(static_cast<T>(s)), b.rep()));
+}
+
+/**
+ * select operator where(m,s1,s2) where s1 and s2 are scalars
+ */
+template <class T, cyme::simd O, int N, class R1>
+forceinline vec<T, O, N, vec_where<T, O, N, R1, vec_scalar<T, O, N>, vec_scalar<T, O, N>>>
+where(vec<T, O, N, R1> const &m, typename identity<T>::value_type const &s1,
+      typename identity<T>::value_type const &s2) {
+    return vec<T, O, N, vec_where<T, O, N, R1, vec_scalar<T, O, N>, vec_scalar<T, O, N>>>(
+        vec_where<T, O, N, R1, vec_scalar<T, O, N>, vec_scalar<T, O, N>>(
+            m.rep(), vec_scalar<T, O, N>(static_cast<T>(s1)), vec_scalar<T, O, N>(static_cast<T>(s2))));
+}
+
+/**
+ * clamp operator clamp(a,lo,hi), min(max(a,lo),hi)
+ */
+template <class T, cyme::simd O, int N, class R1, class R2, class R3>
+forceinline vec<T, O, N, vec_clamp<T, O, N, R1, R2, R3>> clamp(vec<T, O, N, R1> const &a, vec<T, O, N, R2> const &lo,
+                                                               vec<T, O, N, R3> const &hi) {
+    return vec<T, O, N, vec_clamp<T, O, N, R1, R2, R3>>(vec_clamp<T, O, N, R1, R2, R3>(a.rep(), lo.rep(), hi.rep()));
+}
+
+/**
+ * clamp operator clamp(a,lo,hi) where lo and hi are scalars
+ */
+template <class T, cyme::simd O, int N, class R1>
+forceinline vec<T, O, N, vec_clamp<T, O, N, R1, vec_scalar<T, O, N>, vec_scalar<T, O, N>>>
+clamp(vec<T, O, N, R1> const &a, typename identity<T>::value_type const &lo,
+      typename identity<T>::value_type const &hi) {
+    return vec<T, O, N, vec_clamp<T, O, N, R1, vec_scalar<T, O, N>, vec_scalar<T, O, N>>>(
+        vec_clamp<T, O, N, R1, vec_scalar<T, O, N>, vec_scalar<T, O, N>>(
+            a.rep(), vec_scalar<T, O, N>(static_cast<T>(lo)), vec_scalar<T, O, N>(static_cast<T>(hi))));
+}
+
+/**
+ * horizontal sum of the lanes, the expression is evaluated then reduced into the registers
+ */
+template <class T, cyme::simd O, int N, class R1>
+forceinline T hsum(vec<T, O, N, R1> const &a) {
+    return hsum(a.rep()());
+}
+
+/**
+ * horizontal minimum of the lanes
+ */
+template <class T, cyme::simd O, int N, class R1>
+forceinline T hmin(vec<T, O, N, R1> const &a) {
+    return hmin(a.rep()());
+}
+
+/**
+ * horizontal maximum of the lanes
+ */
+template <class T, cyme::simd O, int N, class R1>
+forceinline T hmax(vec<T, O, N, R1> const &a) {
+    return hmax(a.rep()());
+}
+
+/**
+ * true if a lane of the mask is true, e.g. any(a < b)
+ */
+template <class T, cyme::simd O, int N, class R1>
+forceinline bool any(vec<T, O, N, R1> const &m) {
+    return any(m.rep()());
+}
+
+/**
+ * true if all the lanes of the mask are true
+ */
+template <class T, cyme::simd O, int N, class R1>
+forceinline bool all(vec<T, O, N, R1> const &m) {
+    return all(m.rep()());
+}
+
+/**
+ * number of true lanes of the mask
+ */
+template <class T, cyme::simd O, int N, class R1>
+forceinline int popcount(vec<T, O, N, R1> const &m) {
+    return popcount(m.rep()());
+}
 } // namespace cyme
 
 #endif
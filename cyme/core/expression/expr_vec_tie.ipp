@@ -0,0 +1,557 @@
+/*
+ * Cyme - expr_vec_tie.ipp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ * This file is part of Cyme <https://github.com/BlueBrain/cyme>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+
+/**
+ * @file cyme/core/expression/expr_vec_tie.ipp
+ * Defines the multi-output assignment tie(W[a], W[b]) = make_tuple(e1, e2)
+ *
+ * The trees of all the right-hand sides are parsed together at compile time,
+ * a vertex type present more than once is a candidate for sharing: its first
+ * evaluation is saved, a later vertex of the same type with the same leaves
+ * (same registers, same fields of a storage, same scalars) reuses it. All the
+ * right-hand sides are evaluated before the first store.
+ */
+
+#ifndef CYME_EXPR_VEC_TIE_IPP
+#define CYME_EXPR_VEC_TIE_IPP
+
+#include <tuple>
+#include <type_traits>
+
+namespace cyme {
+/** \cond */
+namespace detail {
+/** compile time list of vertex types */
+template <class... V>
+struct type_list {};
+
+template <class L1, class L2>
+struct type_list_concat;
+
+template <class... V1, class... V2>
+struct type_list_concat<type_list<V1...>, type_list<V2...>> {
+    typedef type_list<V1..., V2...> type;
+};
+
+/** number of occurrences of X in L */
+template <class X, class L>
+struct type_list_count;
+
+template <class X>
+struct type_list_count<X, type_list<>> {
+    static const int value = 0;
+};
+
+template <class X, class H, class... V>
+struct type_list_count<X, type_list<H, V...>> {
+    static const int value = std::is_same<X, H>::value + type_list_count<X, type_list<V...>>::value;
+};
+
+/** position of X in L, X must be in L */
+template <class X, class L>
+struct type_list_index;
+
+template <class X, class... V>
+struct type_list_index<X, type_list<X, V...>> {
+    static const std::size_t value = 0;
+};
+
+template <class X, class H, class... V>
+struct type_list_index<X, type_list<H, V...>> {
+    static const std::size_t value = 1 + type_list_index<X, type_list<V...>>::value;
+};
+
+/** the types present at least twice in All, once */
+template <class L, class All>
+struct type_list_shared;
+
+template <class All>
+struct type_list_shared<type_list<>, All> {
+    typedef type_list<> type;
+};
+
+template <class H, class... V, class All>
+struct type_list_shared<type_list<H, V...>, All> {
+    typedef typename type_list_shared<type_list<V...>, All>::type rest;
+    static const bool keep = type_list_count<H, All>::value > 1 && type_list_count<H, type_list<V...>>::value == 0;
+    typedef typename std::conditional<keep, typename type_list_concat<type_list<H>, rest>::type, rest>::type type;
+};
+
+/** Shape of a vertex: the list of its subtrees (leaves excluded, post-order), its
+ *  evaluation from the evaluated operands, and the structural comparison of two
+ *  vertices of the same type. Vertices are grouped by number of operands.
+ */
+template <class V>
+struct vertex_shape;
+
+template <class V, class Cache>
+forceinline typename vertex_shape<V>::simd_type tie_eval(V const &v, Cache &c);
+
+/** leaf: register, the same register only */
+template <class T, cyme::simd O, int N>
+struct vertex_shape<vec_simd<T, O, N>> {
+    typedef vec_simd<T, O, N> simd_type;
+    typedef type_list<> subtrees;
+
+    template <class Cache>
+    static forceinline simd_type eval(vec_simd<T, O, N> const &v, Cache &) {
+        return v;
+    }
+
+    static forceinline bool same(vec_simd<T, O, N> const &a, vec_simd<T, O, N> const &b) { return &a == &b; }
+};
+
+/** leaf: field of a storage, the same address (compile time once inlined, R[x] twice) */
+template <class T, cyme::simd O, int N>
+struct vertex_shape<vec_field<T, O, N>> {
+    typedef vec_simd<T, O, N> simd_type;
+    typedef type_list<> subtrees;
+
+    template <class Cache>
+    static forceinline simd_type eval(vec_field<T, O, N> const &v, Cache &) {
+        return v;
+    }
+
+    static forceinline bool same(vec_field<T, O, N> const &a, vec_field<T, O, N> const &b) {
+        return a.source() == b.source();
+    }
+};
+
+/** leaf: scalar, the same value */
+template <class T, cyme::simd O, int N>
+struct vertex_shape<vec_scalar<T, O, N>> {
+    typedef vec_simd<T, O, N> simd_type;
+    typedef type_list<> subtrees;
+
+    template <class Cache>
+    static forceinline simd_type eval(vec_scalar<T, O, N> const &v, Cache &) {
+        return v();
+    }
+
+    static forceinline bool same(vec_scalar<T, O, N> const &a, vec_scalar<T, O, N> const &b) {
+        return a.value() == b.value();
+    }
+};
+
+/** unary vertex: exp, log, sqrt, neg, ... */
+template <template <class, cyme::simd, int, class> class V, class T, cyme::simd O, int N, class OP1>
+struct vertex_shape<V<T, O, N, OP1>> {
+    typedef vec_simd<T, O, N> simd_type;
+    typedef
+        typename type_list_concat<typename vertex_shape<OP1>::subtrees, type_list<V<T, O, N, OP1>>>::type subtrees;
+
+    template <class Cache>
+    static forceinline simd_type eval(V<T, O, N, OP1> const &v, Cache &c) {
+        const simd_type a = tie_eval(vertex_access::op1(v), c);
+        return V<T, O, N, simd_type>(a)();
+    }
+
+    static forceinline bool same(V<T, O, N, OP1> const &a, V<T, O, N, OP1> const &b) {
+        return vertex_shape<OP1>::same(vertex_access::op1(a), vertex_access::op1(b));
+    }
+};
+
+/** unary vertex with an integer parameter: pow (exponent), rcp and rsqrt (Newton-Raphson steps) */
+template <template <class, cyme::simd, int, class, int> class V, class T, cyme::simd O, int N, class OP1, int M>
+struct vertex_shape<V<T, O, N, OP1, M>> {
+    typedef vec_simd<T, O, N> simd_type;
+    typedef typename type_list_concat<typename vertex_shape<OP1>::subtrees, type_list<V<T, O, N, OP1, M>>>::type
+        subtrees;
+
+    template <class Cache>
+    static forceinline simd_type eval(V<T, O, N, OP1, M> const &v, Cache &c) {
+        const simd_type a = tie_eval(vertex_access::op1(v), c);
+        return V<T, O, N, simd_type, M>(a)();
+    }
+
+    static forceinline bool same(V<T, O, N, OP1, M> const &a, V<T, O, N, OP1, M> const &b) {
+        return vertex_shape<OP1>::same(vertex_access::op1(a), vertex_access::op1(b));
+    }
+};
+
+/** unary vertex with a coefficient table: polyval */
+template <class T, cyme::simd O, int N, class OP1, class C, cyme::poly_scheme S>
+struct vertex_shape<vec_polyval<T, O, N, OP1, C, S>> {
+    typedef vec_simd<T, O, N> simd_type;
+    typedef typename type_list_concat<typename vertex_shape<OP1>::subtrees,
+                                      type_list<vec_polyval<T, O, N, OP1, C, S>>>::type subtrees;
+
+    template <class Cache>
+    static forceinline simd_type eval(vec_polyval<T, O, N, OP1, C, S> const &v, Cache &c) {
+        const simd_type a = tie_eval(vertex_access::op1(v), c);
+        return vec_polyval<T, O, N, simd_type, C, S>(a)();
+    }
+
+    static forceinline bool same(vec_polyval<T, O, N, OP1, C, S> const &a, vec_polyval<T, O, N, OP1, C, S> const &b) {
+        return vertex_shape<OP1>::same(vertex_access::op1(a), vertex_access::op1(b));
+    }
+};
+
+/** unary vertex with two coefficient tables: ratval */
+template <class T, cyme::simd O, int N, class OP1, class P, class Q, cyme::poly_scheme S>
+struct vertex_shape<vec_ratval<T, O, N, OP1, P, Q, S>> {
+    typedef vec_simd<T, O, N> simd_type;
+    typedef typename type_list_concat<typename vertex_shape<OP1>::subtrees,
+                                      type_list<vec_ratval<T, O, N, OP1, P, Q, S>>>::type subtrees;
+
+    template <class Cache>
+    static forceinline simd_type eval(vec_ratval<T, O, N, OP1, P, Q, S> const &v, Cache &c) {
+        const simd_type a = tie_eval(vertex_access::op1(v), c);
+        return vec_ratval<T, O, N, simd_type, P, Q, S>(a)();
+    }
+
+    static forceinline bool same(vec_ratval<T, O, N, OP1, P, Q, S> const &a,
+                                 vec_ratval<T, O, N, OP1, P, Q, S> const &b) {
+        return vertex_shape<OP1>::same(vertex_access::op1(a), vertex_access::op1(b));
+    }
+};
+
+/** binary vertex: +, -, *, /, min, ... */
+template <template <class, cyme::simd, int, class, class> class V, class T, cyme::simd O, int N, class OP1,
+          class OP2>
+struct vertex_shape<V<T, O, N, OP1, OP2>> {
+    typedef vec_simd<T, O, N> simd_type;
+    typedef typename type_list_concat<
+        typename type_list_concat<typename vertex_shape<OP1>::subtrees, typename vertex_shape<OP2>::subtrees>::type,
+        type_list<V<T, O, N, OP1, OP2>>>::type subtrees;
+
+    template <class Cache>
+    static forceinline simd_type eval(V<T, O, N, OP1, OP2> const &v, Cache &c) {
+        const simd_type a = tie_eval(vertex_access::op1(v), c);
+        const simd_type b = tie_eval(vertex_access::op2(v), c);
+        return V<T, O, N, simd_type, simd_type>(a, b)();
+    }
+
+    static forceinline bool same(V<T, O, N, OP1, OP2> const &a, V<T, O, N, OP1, OP2> const &b) {
+        return vertex_shape<OP1>::same(vertex_access::op1(a), vertex_access::op1(b)) &&
+               vertex_shape<OP2>::same(vertex_access::op2(a), vertex_access::op2(b));
+    }
+};
+
+/** binary vertex with an integer parameter: fast_div (Newton-Raphson steps) */
+template <template <class, cyme::simd, int, class, class, int> class V, class T, cyme::simd O, int N, class OP1,
+          class OP2, int M>
+struct vertex_shape<V<T, O, N, OP1, OP2, M>> {
+    typedef vec_simd<T, O, N> simd_type;
+    typedef typename type_list_concat<
+        typename type_list_concat<typename vertex_shape<OP1>::subtrees, typename vertex_shape<OP2>::subtrees>::type,
+        type_list<V<T, O, N, OP1, OP2, M>>>::type subtrees;
+
+    template <class Cache>
+    static forceinline simd_type eval(V<T, O, N, OP1, OP2, M> const &v, Cache &c) {
+        const simd_type a = tie_eval(vertex_access::op1(v), c);
+        const simd_type b = tie_eval(vertex_access::op2(v), c);
+        return V<T, O, N, simd_type, simd_type, M>(a, b)();
+    }
+
+    static forceinline bool same(V<T, O, N, OP1, OP2, M> const &a, V<T, O, N, OP1, OP2, M> const &b) {
+        return vertex_shape<OP1>::same(vertex_access::op1(a), vertex_access::op1(b)) &&
+               vertex_shape<OP2>::same(vertex_access::op2(a), vertex_access::op2(b));
+    }
+};
+
+/** ternary vertex built from its three operands: where, clamp */
+template <template <class, cyme::simd, int, class, class, class> class V, class T, cyme::simd O, int N, class OP1,
+          class OP2, class OP3>
+struct vertex_shape_ternary {
+    typedef vec_simd<T, O, N> simd_type;
+    typedef typename type_list_concat<
+        typename type_list_concat<
+            typename type_list_concat<typename vertex_shape<OP1>::subtrees,
+                                      typename vertex_shape<OP2>::subtrees>::type,
+            typename vertex_shape<OP3>::subtrees>::type,
+        type_list<V<T, O, N, OP1, OP2, OP3>>>::type subtrees;
+
+    template <class Cache>
+    static forceinline simd_type eval(V<T, O, N, OP1, OP2, OP3> const &v, Cache &c) {
+        const simd_type a = tie_eval(vertex_access::op1(v), c);
+        const simd_type b = tie_eval(vertex_access::op2(v), c);
+        const simd_type d = tie_eval(vertex_access::op3(v), c);
+        return V<T, O, N, simd_type, simd_type, simd_type>(a, b, d)();
+    }
+
+    static forceinline bool same(V<T, O, N, OP1, OP2, OP3> const &a, V<T, O, N, OP1, OP2, OP3> const &b) {
+        return vertex_shape<OP1>::same(vertex_access::op1(a), vertex_access::op1(b)) &&
+               vertex_shape<OP2>::same(vertex_access::op2(a), vertex_access::op2(b)) &&
+               vertex_shape<OP3>::same(vertex_access::op3(a), vertex_access::op3(b));
+    }
+};
+
+template <class T, cyme::simd O, int N, class OP1, class OP2, class OP3>
+struct vertex_shape<vec_where<T, O, N, OP1, OP2, OP3>> : vertex_shape_ternary<vec_where, T, O, N, OP1, OP2, OP3> {};
+
+template <class T, cyme::simd O, int N, class OP1, class OP2, class OP3>
+struct vertex_shape<vec_clamp<T, O, N, OP1, OP2, OP3>> : vertex_shape_ternary<vec_clamp, T, O, N, OP1, OP2, OP3> {};
+
+/** fma vertex a*b+c: muladd, mulsub, negate_muladd, built from a mul vertex */
+template <template <class, cyme::simd, int, class, class, class> class V, class T, cyme::simd O, int N, class OP1,
+          class OP2, class OP3>
+struct vertex_shape<V<T, O, N, OP1, OP2, OP3>> {
+    typedef vec_simd<T, O, N> simd_type;
+    typedef typename type_list_concat<
+        typename type_list_concat<
+            typename type_list_concat<typename vertex_shape<OP1>::subtrees,
+                                      typename vertex_shape<OP2>::subtrees>::type,
+            typename vertex_shape<OP3>::subtrees>::type,
+        type_list<V<T, O, N, OP1, OP2, OP3>>>::type subtrees;
+
+    template <class Cache>
+    static forceinline simd_type eval(V<T, O, N, OP1, OP2, OP3> const &v, Cache &c) {
+        const simd_type a = tie_eval(vertex_access::op1(v), c);
+        const simd_type b = tie_eval(vertex_access::op2(v), c);
+        const simd_type d = tie_eval(vertex_access::op3(v), c);
+        return V<T, O, N, simd_type, simd_type, simd_type>(vec_mul<T, O, N, simd_type, simd_type>(a, b), d)();
+    }
+
+    static forceinline bool same(V<T, O, N, OP1, OP2, OP3> const &a, V<T, O, N, OP1, OP2, OP3> const &b) {
+        return vertex_shape<OP1>::same(vertex_access::op1(a), vertex_access::op1(b)) &&
+               vertex_shape<OP2>::same(vertex_access::op2(a), vertex_access::op2(b)) &&
+               vertex_shape<OP3>::same(vertex_access::op3(a), vertex_access::op3(b));
+    }
+};
+
+/** fma vertex a*b+c*d: mul_add_mul, mul_sub_mul, built from two mul vertices */
+template <template <class, cyme::simd, int, class, class, class, class> class V, class T, cyme::simd O, int N,
+          class OP1, class OP2, class OP3, class OP4>
+struct vertex_shape<V<T, O, N, OP1, OP2, OP3, OP4>> {
+    typedef vec_simd<T, O, N> simd_type;
+    typedef typename type_list_concat<
+        typename type_list_concat<
+            typename type_list_concat<typename vertex_shape<OP1>::subtrees,
+                                      typename vertex_shape<OP2>::subtrees>::type,
+            typename type_list_concat<typename vertex_shape<OP3>::subtrees,
+                                      typename vertex_shape<OP4>::subtrees>::type>::type,
+        type_list<V<T, O, N, OP1, OP2, OP3, OP4>>>::type subtrees;
+
+    template <class Cache>
+    static forceinline simd_type eval(V<T, O, N, OP1, OP2, OP3, OP4> const &v, Cache &c) {
+        const simd_type a = tie_eval(vertex_access::op1(v), c);
+        const simd_type b = tie_eval(vertex_access::op2(v), c);
+        const simd_type d = tie_eval(vertex_access::op3(v), c);
+        const simd_type e = tie_eval(vertex_access::op4(v), c);
+        return V<T, O, N, simd_type, simd_type, simd_type, simd_type>(vec_mul<T, O, N, simd_type, simd_type>(a, b),
+                                                                     vec_mul<T, O, N, simd_type, simd_type>(d, e))();
+    }
+
+    static forceinline bool same(V<T, O, N, OP1, OP2, OP3, OP4> const &a, V<T, O, N, OP1, OP2, OP3, OP4> const &b) {
+        return vertex_shape<OP1>::same(vertex_access::op1(a), vertex_access::op1(b)) &&
+               vertex_shape<OP2>::same(vertex_access::op2(a), vertex_access::op2(b)) &&
+               vertex_shape<OP3>::same(vertex_access::op3(a), vertex_access::op3(b)) &&
+               vertex_shape<OP4>::same(vertex_access::op4(a), vertex_access::op4(b));
+    }
+};
+
+/** fma vertex a*b+c*d+e: mul_add_mul_add, built from a mul_add_mul vertex */
+template <class T, cyme::simd O, int N, class OP1, class OP2, class OP3, class OP4, class OP5>
+struct vertex_shape<vec_mul_add_mul_add<T, O, N, OP1, OP2, OP3, OP4, OP5>> {
+    typedef vec_simd<T, O, N> simd_type;
+    typedef vec_mul<T, O, N, simd_type, simd_type> mul_type;
+    typedef typename type_list_concat<
+        typename type_list_concat<
+            typename type_list_concat<typename vertex_shape<OP1>::subtrees,
+                                      typename vertex_shape<OP2>::subtrees>::type,
+            typename type_list_concat<typename vertex_shape<OP3>::subtrees,
+                                      typename vertex_shape<OP4>::subtrees>::type>::type,
+        typename type_list_concat<typename vertex_shape<OP5>::subtrees,
+                                  type_list<vec_mul_add_mul_add<T, O, N, OP1, OP2, OP3, OP4, OP5>>>::type>::type
+        subtrees;
+
+    template <class Cache>
+    static forceinline simd_type eval(vec_mul_add_mul_add<T, O, N, OP1, OP2, OP3, OP4, OP5> const &v, Cache &c) {
+        const simd_type a = tie_eval(vertex_access::op1(v), c);
+        const simd_type b = tie_eval(vertex_access::op2(v), c);
+        const simd_type d = tie_eval(vertex_access::op3(v), c);
+        const simd_type e = tie_eval(vertex_access::op4(v), c);
+        const simd_type f = tie_eval(vertex_access::op5(v), c);
+        return vec_mul_add_mul_add<T, O, N, simd_type, simd_type, simd_type, simd_type, simd_type>(
+            vec_mul_add_mul<T, O, N, simd_type, simd_type, simd_type, simd_type>(mul_type(a, b), mul_type(d, e)),
+            f)();
+    }
+
+    static forceinline bool same(vec_mul_add_mul_add<T, O, N, OP1, OP2, OP3, OP4, OP5> const &a,
+                                 vec_mul_add_mul_add<T, O, N, OP1, OP2, OP3, OP4, OP5> const &b) {
+        return vertex_shape<OP1>::same(vertex_access::op1(a), vertex_access::op1(b)) &&
+               vertex_shape<OP2>::same(vertex_access::op2(a), vertex_access::op2(b)) &&
+               vertex_shape<OP3>::same(vertex_access::op3(a), vertex_access::op3(b)) &&
+               vertex_shape<OP4>::same(vertex_access::op4(a), vertex_access::op4(b)) &&
+               vertex_shape<OP5>::same(vertex_access::op5(a), vertex_access::op5(b));
+    }
+};
+
+/** the saved evaluation of a shared vertex type, the first vertex of this type */
+template <class V>
+struct tie_slot {
+    forceinline tie_slot() : vertex(NULL), value() {}
+
+    V const *vertex;
+    typename vertex_shape<V>::simd_type value;
+};
+
+template <class L>
+struct tie_cache;
+
+template <class... V>
+struct tie_cache<type_list<V...>> {
+    typedef type_list<V...> shared;
+    std::tuple<tie_slot<V>...> slots;
+};
+
+/** evaluation of a vertex, through the cache if its type is shared */
+template <class V, class Cache, bool Shared = (type_list_count<V, typename Cache::shared>::value > 0)>
+struct tie_cached {
+    static forceinline typename vertex_shape<V>::simd_type eval(V const &v, Cache &c) {
+        return vertex_shape<V>::eval(v, c);
+    }
+};
+
+template <class V, class Cache>
+struct tie_cached<V, Cache, true> {
+    static forceinline typename vertex_shape<V>::simd_type eval(V const &v, Cache &c) {
+        tie_slot<V> &slot = std::get<type_list_index<V, typename Cache::shared>::value>(c.slots);
+        if (slot.vertex != NULL && vertex_shape<V>::same(*slot.vertex, v))
+            return slot.value;
+        const typename vertex_shape<V>::simd_type r = vertex_shape<V>::eval(v, c);
+        if (slot.vertex == NULL) {
+            slot.vertex = &v;
+            slot.value = r;
+        }
+        return r;
+    }
+};
+
+template <class V, class Cache>
+forceinline typename vertex_shape<V>::simd_type tie_eval(V const &v, Cache &c) {
+    return tie_cached<V, Cache>::eval(v, c);
+}
+
+/** right-hand side: a tree is evaluated into a vec, a scalar (AoS) is copied */
+template <class R>
+struct tie_rhs {
+    typedef R value_type;
+    typedef type_list<> subtrees;
+
+    template <class Cache>
+    static forceinline void eval(value_type &v, R const &r, Cache &) {
+        v = r;
+    }
+};
+
+template <class T, cyme::simd O, int N, class Rep>
+struct tie_rhs<vec<T, O, N, Rep>> {
+    typedef vec<T, O, N> value_type;
+    typedef typename vertex_shape<Rep>::subtrees subtrees;
+
+    template <class Cache>
+    static forceinline void eval(value_type &v, vec<T, O, N, Rep> const &r, Cache &c) {
+        v.rep() = tie_eval(r.rep(), c);
+    }
+};
+
+template <class... R>
+struct tie_rhs_subtrees;
+
+template <>
+struct tie_rhs_subtrees<> {
+    typedef type_list<> type;
+};
+
+template <class R, class... Rs>
+struct tie_rhs_subtrees<R, Rs...> {
+    typedef typename type_list_concat<typename tie_rhs<R>::subtrees, typename tie_rhs_subtrees<Rs...>::type>::type
+        type;
+};
+
+/** loop over the elements of the tuples, evaluation then assignment */
+template <std::size_t I, std::size_t M>
+struct tie_helper {
+    template <class Values, class Rhs, class Cache>
+    static forceinline void eval(Values &v, Rhs const &r, Cache &c) {
+        tie_rhs<typename std::tuple_element<I, Rhs>::type>::eval(std::get<I>(v), std::get<I>(r), c);
+        tie_helper<I + 1, M>::eval(v, r, c);
+    }
+
+    template <class Lhs, class Values>
+    static forceinline void assign(Lhs &l, Values const &v) {
+        std::get<I>(l) = std::get<I>(v);
+        tie_helper<I + 1, M>::assign(l, v);
+    }
+};
+
+template <std::size_t M>
+struct tie_helper<M, M> {
+    template <class Values, class Rhs, class Cache>
+    static forceinline void eval(Values &, Rhs const &, Cache &) {}
+
+    template <class Lhs, class Values>
+    static forceinline void assign(Lhs &, Values const &) {}
+};
+} // namespace detail
+
+/** left-hand side of the multi-output assignment, see cyme::tie */
+template <class... L>
+class tie_tuple {
+  public:
+    forceinline explicit tie_tuple(L &&... l) : lhs(std::forward<L>(l)...) {}
+
+    /** evaluate all the right-hand sides with the shared subtrees once, then store */
+    template <class... R>
+    forceinline tie_tuple &operator=(std::tuple<R...> const &rhs) {
+        static_assert(sizeof...(L) == sizeof...(R), "cyme::tie: the tuples must have the same size");
+        typedef typename detail::type_list_shared<typename detail::tie_rhs_subtrees<R...>::type,
+                                                  typename detail::tie_rhs_subtrees<R...>::type>::type shared;
+        detail::tie_cache<shared> cache;
+        std::tuple<typename detail::tie_rhs<R>::value_type...> values;
+        detail::tie_helper<0, sizeof...(R)>::eval(values, rhs, cache);
+        detail::tie_helper<0, sizeof...(R)>::assign(lhs, values);
+        return *this;
+    }
+
+  private:
+    std::tuple<L...> lhs;
+};
+/** \endcond */
+
+/** Multi-output assignment, tie(W[a], W[b]) = make_tuple(e1, e2).
+ *
+ *  e.g. the Na channel, R[mAlpha] + R[mBeta] is computed once:
+ *  \code{.cpp}
+ *  cyme::tie(W[mInf], W[mTau]) = cyme::make_tuple(R[mAlpha] / (R[mAlpha] + R[mBeta]),
+ *                                                 1. / (R[mAlpha] + R[mBeta]));
+ *  \endcode
+ *  Two subtrees are shared if they have the same type (compile time) and the
+ *  same leaves: the same fields R[x] of a storage (read only, S const &R), the
+ *  same cyme::register_block fields or named vec, and the same scalars. Once
+ *  inlined the addresses of the fields are constants, the comparison is done
+ *  by the compiler. All the right-hand sides are evaluated before the first
+ *  store, like std::tie. AoS scalars are assigned directly.
+ */
+template <class... L>
+forceinline tie_tuple<L...> tie(L &&... l) {
+    return tie_tuple<L...>(std::forward<L>(l)...);
+}
+
+/** right-hand side of cyme::tie, the trees are copied, their operands are alive until the end of the statement */
+template <class... R>
+forceinline std::tuple<typename std::decay<R>::type...> make_tuple(R &&... r) {
+    return std::tuple<typename std::decay<R>::type...>(std::forward<R>(r)...);
+}
+} // namespace cyme
+#endif
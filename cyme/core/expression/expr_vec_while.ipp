@@ -0,0 +1,109 @@
+/*
+ * Cyme - expr_vec_while.ipp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ * This file is part of Cyme <https://github.com/BlueBrain/cyme>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+
+/**
+ * @file cyme/core/expression/expr_vec_while.ipp
+ * Defines simd_while, a while loop where every lane has its own condition
+ *
+ * The loop runs under a mask of the active lanes, the body updates the
+ * active lanes only, with where(active, new, old). The loop stops when no
+ * lane is active. With a refill function, a finished lane takes the next
+ * work item at once, the lanes stay busy until the queue is empty.
+ */
+
+#ifndef CYME_EXPR_VEC_WHILE_IPP
+#define CYME_EXPR_VEC_WHILE_IPP
+
+namespace cyme {
+/** \cond */
+namespace detail {
+/** the mask of the loop, the evaluated type of the condition */
+template <class V>
+struct while_mask;
+
+template <class T, cyme::simd O, int N, class Rep>
+struct while_mask<vec<T, O, N, Rep>> {
+    typedef vec<T, O, N> type;
+    static const int lanes = elems_helper<T, N>::size;
+    static const unsigned int all = 0xffffffffu >> (32 - lanes); // a bit per lane, up to 32 lanes
+};
+} // namespace detail
+/** \endcond */
+
+/** while loop, lane by lane.
+ *
+ *  cond() returns the condition of every lane, as a comparison, body(active)
+ *  does an iteration. A lane that becomes false stays inactive, the loop
+ *  stops when the mask is empty. The escape time of the mandelbrot set:
+ *  \code{.cpp}
+ *  cyme::vec<float> x(0.f), y(0.f), n(0.f), t;
+ *  cyme::simd_while([&] { return cyme::vec<float>((x * x + y * y < 4.f) & (n < 255.f)); },
+ *                   [&](cyme::vec<float> const &active) {
+ *                       t = x * x - y * y + x0;
+ *                       y = where(active, 2.f * x * y + y0, y);
+ *                       x = where(active, t, x);
+ *                       n = where(active, n + 1.f, n);
+ *                   });
+ *  \endcode
+ *  \warning cond returns an evaluated vec, the tree of a lambda keeps references to its temporaries
+ */
+template <class Cond, class Body>
+forceinline void simd_while(Cond cond, Body body) {
+    typedef typename detail::while_mask<decltype(cond())>::type mask_type;
+    mask_type active(cond());
+    while (!active.is_empty()) {
+        body(active);
+        active = active & cond();
+    }
+}
+
+/** while loop, lane by lane, with a work queue.
+ *
+ *  As simd_while(cond, body), but refill(lane) is called for every lane that
+ *  finished: it saves the result of the lane and loads the next item into the
+ *  lane (the state is in memory, e.g. an aligned array per variable), it
+ *  returns false if the queue is empty, the lane is then retired. A new item
+ *  that is finished at once is refilled again. The state of an inactive lane
+ *  must not change, the body updates with where(active, new, old) only.
+ */
+template <class Cond, class Body, class Refill>
+forceinline void simd_while(Cond cond, Body body, Refill refill) {
+    typedef detail::while_mask<decltype(cond())> helper;
+    typedef typename helper::type mask_type;
+    unsigned int live = helper::all;
+    mask_type active(cond());
+    for (;;) {
+        unsigned int done;
+        while ((done = live & ~movemask(active.rep())) != 0) {
+            for (int l = 0; l < helper::lanes; ++l)
+                if (((done >> l) & 1u) && !refill(l))
+                    live &= ~(1u << l);
+            active = cond();
+        }
+        if (live == 0)
+            return;
+        body(active);
+        active = cond();
+    }
+}
+} // namespace cyme
+
+#endif
@@ -513,6 +513,125 @@ forceinline bool _mm_is_empty<double, cyme::avx, 4>(simd_trait<double, cyme::avx
             _mm256_testz_si256(_mm256_castpd_si256(xmm0.r3), mask));
 }
 
+/**
+ Horizontal sum of the register, the lanes are added with a pairwise tree, return a scalar.
+ specialisation double,cyme::avx,1 regs
+ */
+template <>
+forceinline double _mm_hsum<double, cyme::avx, 1>(simd_trait<double, cyme::avx, 1>::register_type xmm0) {
+    simd_trait<double, cyme::sse, 1>::register_type xmm1 = _mm_add_pd(_mm256_castpd256_pd128(xmm0),
+                                                                      _mm256_extractf128_pd(xmm0, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(xmm1, _mm_unpackhi_pd(xmm1, xmm1)));
+}
+
+/**
+ Horizontal sum of the register, the lanes are added with a pairwise tree, return a scalar.
+ specialisation double,cyme::avx,2 regs
+ */
+template <>
+forceinline double _mm_hsum<double, cyme::avx, 2>(simd_trait<double, cyme::avx, 2>::register_type xmm0) {
+    return _mm_hsum<double, cyme::avx, 1>(_mm256_add_pd(xmm0.r0, xmm0.r1));
+}
+
+/**
+ Horizontal sum of the register, the lanes are added with a pairwise tree, return a scalar.
+ specialisation double,cyme::avx,4 regs
+ */
+template <>
+forceinline double _mm_hsum<double, cyme::avx, 4>(simd_trait<double, cyme::avx, 4>::register_type xmm0) {
+    return _mm_hsum<double, cyme::avx, 1>(
+        _mm256_add_pd(_mm256_add_pd(xmm0.r0, xmm0.r2), _mm256_add_pd(xmm0.r1, xmm0.r3)));
+}
+
+/**
+ Horizontal minimum of the register, the lanes are compared with a pairwise tree, return a scalar.
+ specialisation double,cyme::avx,1 regs
+ */
+template <>
+forceinline double _mm_hmin<double, cyme::avx, 1>(simd_trait<double, cyme::avx, 1>::register_type xmm0) {
+    simd_trait<double, cyme::sse, 1>::register_type xmm1 = _mm_min_pd(_mm256_castpd256_pd128(xmm0),
+                                                                      _mm256_extractf128_pd(xmm0, 1));
+    return _mm_cvtsd_f64(_mm_min_sd(xmm1, _mm_unpackhi_pd(xmm1, xmm1)));
+}
+
+/**
+ Horizontal minimum of the register, the lanes are compared with a pairwise tree, return a scalar.
+ specialisation double,cyme::avx,2 regs
+ */
+template <>
+forceinline double _mm_hmin<double, cyme::avx, 2>(simd_trait<double, cyme::avx, 2>::register_type xmm0) {
+    return _mm_hmin<double, cyme::avx, 1>(_mm256_min_pd(xmm0.r0, xmm0.r1));
+}
+
+/**
+ Horizontal minimum of the register, the lanes are compared with a pairwise tree, return a scalar.
+ specialisation double,cyme::avx,4 regs
+ */
+template <>
+forceinline double _mm_hmin<double, cyme::avx, 4>(simd_trait<double, cyme::avx, 4>::register_type xmm0) {
+    return _mm_hmin<double, cyme::avx, 1>(
+        _mm256_min_pd(_mm256_min_pd(xmm0.r0, xmm0.r2), _mm256_min_pd(xmm0.r1, xmm0.r3)));
+}
+
+/**
+ Horizontal maximum of the register, the lanes are compared with a pairwise tree, return a scalar.
+ specialisation double,cyme::avx,1 regs
+ */
+template <>
+forceinline double _mm_hmax<double, cyme::avx, 1>(simd_trait<double, cyme::avx, 1>::register_type xmm0) {
+    simd_trait<double, cyme::sse, 1>::register_type xmm1 = _mm_max_pd(_mm256_castpd256_pd128(xmm0),
+                                                                      _mm256_extractf128_pd(xmm0, 1));
+    return _mm_cvtsd_f64(_mm_max_sd(xmm1, _mm_unpackhi_pd(xmm1, xmm1)));
+}
+
+/**
+ Horizontal maximum of the register, the lanes are compared with a pairwise tree, return a scalar.
+ specialisation double,cyme::avx,2 regs
+ */
+template <>
+forceinline double _mm_hmax<double, cyme::avx, 2>(simd_trait<double, cyme::avx, 2>::register_type xmm0) {
+    return _mm_hmax<double, cyme::avx, 1>(_mm256_max_pd(xmm0.r0, xmm0.r1));
+}
+
+/**
+ Horizontal maximum of the register, the lanes are compared with a pairwise tree, return a scalar.
+ specialisation double,cyme::avx,4 regs
+ */
+template <>
+forceinline double _mm_hmax<double, cyme::avx, 4>(simd_trait<double, cyme::avx, 4>::register_type xmm0) {
+    return _mm_hmax<double, cyme::avx, 1>(
+        _mm256_max_pd(_mm256_max_pd(xmm0.r0, xmm0.r2), _mm256_max_pd(xmm0.r1, xmm0.r3)));
+}
+
+/**
+ Gather the sign bits of the lanes of a mask into an integer, a bit per lane.
+ specialisation double,cyme::avx,1 regs
+ */
+template <>
+forceinline unsigned int _mm_movemask<double, cyme::avx, 1>(simd_trait<double, cyme::avx, 1>::register_type xmm0) {
+    return _mm256_movemask_pd(xmm0);
+}
+
+/**
+ Gather the sign bits of the lanes of a mask into an integer, a bit per lane.
+ specialisation double,cyme::avx,2 regs
+ */
+template <>
+forceinline unsigned int _mm_movemask<double, cyme::avx, 2>(simd_trait<double, cyme::avx, 2>::register_type xmm0) {
+    return _mm256_movemask_pd(xmm0.r0) | (static_cast<unsigned int>(_mm256_movemask_pd(xmm0.r1)) << 4);
+}
+
+/**
+ Gather the sign bits of the lanes of a mask into an integer, a bit per lane.
+ specialisation double,cyme::avx,4 regs
+ */
+template <>
+forceinline unsigned int _mm_movemask<double, cyme::avx, 4>(simd_trait<double, cyme::avx, 4>::register_type xmm0) {
+    return _mm256_movemask_pd(xmm0.r0) | (static_cast<unsigned int>(_mm256_movemask_pd(xmm0.r1)) << 4) |
+           (static_cast<unsigned int>(_mm256_movemask_pd(xmm0.r2)) << 8) |
+           (static_cast<unsigned int>(_mm256_movemask_pd(xmm0.r3)) << 12);
+}
+
 /**
   Round the packed double-precision (64-bit) floating-point elements in xmm0 down to an integer value,
  and store the results as packed single-precision integer-point elements in dst.
@@ -1931,6 +2050,157 @@ _mm_min<double, cyme::avx, 4>(simd_trait<double, cyme::avx, 4>::register_type xm
         _mm256_min_pd(xmm0.r3, xmm1.r3));
 }
 
+/**
+ Evaluate the <= operator, return if true return 0xffffffffffffffff (true) else 0 (false)
+ specialisation double,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::avx, 1>::register_type
+_mm_le<double, cyme::avx, 1>(simd_trait<double, cyme::avx, 1>::register_type xmm0,
+                             simd_trait<double, cyme::avx, 1>::register_type xmm1) {
+    return _mm256_cmp_pd(xmm0, xmm1, _CMP_LE_OS);
+}
+
+/**
+ Evaluate the <= operator, return if true return 0xffffffffffffffff (true) else 0 (false)
+ specialisation double,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::avx, 2>::register_type
+_mm_le<double, cyme::avx, 2>(simd_trait<double, cyme::avx, 2>::register_type xmm0,
+                             simd_trait<double, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<double, cyme::avx, 2>::register_type(_mm256_cmp_pd(xmm0.r0, xmm1.r0, _CMP_LE_OS),
+                                                           _mm256_cmp_pd(xmm0.r1, xmm1.r1, _CMP_LE_OS));
+}
+
+/**
+ Evaluate the <= operator, return if true return 0xffffffffffffffff (true) else 0 (false)
+ specialisation double,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::avx, 4>::register_type
+_mm_le<double, cyme::avx, 4>(simd_trait<double, cyme::avx, 4>::register_type xmm0,
+                             simd_trait<double, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<double, cyme::avx, 4>::register_type(_mm256_cmp_pd(xmm0.r0, xmm1.r0, _CMP_LE_OS),
+                                                           _mm256_cmp_pd(xmm0.r1, xmm1.r1, _CMP_LE_OS),
+                                                           _mm256_cmp_pd(xmm0.r2, xmm1.r2, _CMP_LE_OS),
+                                                           _mm256_cmp_pd(xmm0.r3, xmm1.r3, _CMP_LE_OS));
+}
+
+/**
+ Evaluate the != operator, return if true return 0xffffffffffffffff (true) else 0 (false)
+ specialisation double,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::avx, 1>::register_type
+_mm_ne<double, cyme::avx, 1>(simd_trait<double, cyme::avx, 1>::register_type xmm0,
+                             simd_trait<double, cyme::avx, 1>::register_type xmm1) {
+    return _mm256_cmp_pd(xmm0, xmm1, _CMP_NEQ_UQ);
+}
+
+/**
+ Evaluate the != operator, return if true return 0xffffffffffffffff (true) else 0 (false)
+ specialisation double,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::avx, 2>::register_type
+_mm_ne<double, cyme::avx, 2>(simd_trait<double, cyme::avx, 2>::register_type xmm0,
+                             simd_trait<double, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<double, cyme::avx, 2>::register_type(_mm256_cmp_pd(xmm0.r0, xmm1.r0, _CMP_NEQ_UQ),
+                                                           _mm256_cmp_pd(xmm0.r1, xmm1.r1, _CMP_NEQ_UQ));
+}
+
+/**
+ Evaluate the != operator, return if true return 0xffffffffffffffff (true) else 0 (false)
+ specialisation double,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::avx, 4>::register_type
+_mm_ne<double, cyme::avx, 4>(simd_trait<double, cyme::avx, 4>::register_type xmm0,
+                             simd_trait<double, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<double, cyme::avx, 4>::register_type(_mm256_cmp_pd(xmm0.r0, xmm1.r0, _CMP_NEQ_UQ),
+                                                           _mm256_cmp_pd(xmm0.r1, xmm1.r1, _CMP_NEQ_UQ),
+                                                           _mm256_cmp_pd(xmm0.r2, xmm1.r2, _CMP_NEQ_UQ),
+                                                           _mm256_cmp_pd(xmm0.r3, xmm1.r3, _CMP_NEQ_UQ));
+}
+
+/**
+ Evaluate the  max operator between two registers
+ specialisation double,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::avx, 1>::register_type
+_mm_max<double, cyme::avx, 1>(simd_trait<double, cyme::avx, 1>::register_type xmm0,
+                              simd_trait<double, cyme::avx, 1>::register_type xmm1) {
+    return _mm256_max_pd(xmm0, xmm1);
+}
+
+/**
+ Evaluate the  max operator between two registers
+ specialisation double,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::avx, 2>::register_type
+_mm_max<double, cyme::avx, 2>(simd_trait<double, cyme::avx, 2>::register_type xmm0,
+                              simd_trait<double, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<double, cyme::avx, 2>::register_type(_mm256_max_pd(xmm0.r0, xmm1.r0),
+                                                           _mm256_max_pd(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the  max operator between two registers
+ specialisation double,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::avx, 4>::register_type
+_mm_max<double, cyme::avx, 4>(simd_trait<double, cyme::avx, 4>::register_type xmm0,
+                              simd_trait<double, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<double, cyme::avx, 4>::register_type(_mm256_max_pd(xmm0.r0, xmm1.r0),
+                                                           _mm256_max_pd(xmm0.r1, xmm1.r1),
+                                                           _mm256_max_pd(xmm0.r2, xmm1.r2),
+                                                           _mm256_max_pd(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Select xmm1 where the mask xmm0 is true else xmm2, a single blendv
+ specialisation double,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::avx, 1>::register_type
+_mm_select<double, cyme::avx, 1>(simd_trait<double, cyme::avx, 1>::register_type xmm0,
+                                 simd_trait<double, cyme::avx, 1>::register_type xmm1,
+                                 simd_trait<double, cyme::avx, 1>::register_type xmm2) {
+    return _mm256_blendv_pd(xmm2, xmm1, xmm0);
+}
+
+/**
+ Select xmm1 where the mask xmm0 is true else xmm2, a single blendv
+ specialisation double,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::avx, 2>::register_type
+_mm_select<double, cyme::avx, 2>(simd_trait<double, cyme::avx, 2>::register_type xmm0,
+                                 simd_trait<double, cyme::avx, 2>::register_type xmm1,
+                                 simd_trait<double, cyme::avx, 2>::register_type xmm2) {
+    return simd_trait<double, cyme::avx, 2>::register_type(_mm256_blendv_pd(xmm2.r0, xmm1.r0, xmm0.r0),
+                                                           _mm256_blendv_pd(xmm2.r1, xmm1.r1, xmm0.r1));
+}
+
+/**
+ Select xmm1 where the mask xmm0 is true else xmm2, a single blendv
+ specialisation double,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::avx, 4>::register_type
+_mm_select<double, cyme::avx, 4>(simd_trait<double, cyme::avx, 4>::register_type xmm0,
+                                 simd_trait<double, cyme::avx, 4>::register_type xmm1,
+                                 simd_trait<double, cyme::avx, 4>::register_type xmm2) {
+    return simd_trait<double, cyme::avx, 4>::register_type(_mm256_blendv_pd(xmm2.r0, xmm1.r0, xmm0.r0),
+                                                           _mm256_blendv_pd(xmm2.r1, xmm1.r1, xmm0.r1),
+                                                           _mm256_blendv_pd(xmm2.r2, xmm1.r2, xmm0.r2),
+                                                           _mm256_blendv_pd(xmm2.r3, xmm1.r3, xmm0.r3));
+}
+
 #ifdef __INTEL_COMPILER
 /**
   Compute the exponential value of e raised to the power of packed double-precision (64-bit)
@@ -2603,6 +2873,128 @@ forceinline bool _mm_is_empty<float, cyme::avx, 4>(simd_trait<float, cyme::avx,
             _mm256_testz_si256(_mm256_castps_si256(xmm0.r3), mask));
 }
 
+/**
+ Horizontal sum of the register, the lanes are added with a pairwise tree, return a scalar.
+ specialisation float,cyme::avx,1 regs
+ */
+template <>
+forceinline float _mm_hsum<float, cyme::avx, 1>(simd_trait<float, cyme::avx, 1>::register_type xmm0) {
+    simd_trait<float, cyme::sse, 1>::register_type xmm1 = _mm_add_ps(_mm256_castps256_ps128(xmm0),
+                                                                     _mm256_extractf128_ps(xmm0, 1));
+    xmm1 = _mm_add_ps(xmm1, _mm_movehl_ps(xmm1, xmm1));
+    return _mm_cvtss_f32(_mm_add_ss(xmm1, _mm_shuffle_ps(xmm1, xmm1, 1)));
+}
+
+/**
+ Horizontal sum of the register, the lanes are added with a pairwise tree, return a scalar.
+ specialisation float,cyme::avx,2 regs
+ */
+template <>
+forceinline float _mm_hsum<float, cyme::avx, 2>(simd_trait<float, cyme::avx, 2>::register_type xmm0) {
+    return _mm_hsum<float, cyme::avx, 1>(_mm256_add_ps(xmm0.r0, xmm0.r1));
+}
+
+/**
+ Horizontal sum of the register, the lanes are added with a pairwise tree, return a scalar.
+ specialisation float,cyme::avx,4 regs
+ */
+template <>
+forceinline float _mm_hsum<float, cyme::avx, 4>(simd_trait<float, cyme::avx, 4>::register_type xmm0) {
+    return _mm_hsum<float, cyme::avx, 1>(
+        _mm256_add_ps(_mm256_add_ps(xmm0.r0, xmm0.r2), _mm256_add_ps(xmm0.r1, xmm0.r3)));
+}
+
+/**
+ Horizontal minimum of the register, the lanes are compared with a pairwise tree, return a scalar.
+ specialisation float,cyme::avx,1 regs
+ */
+template <>
+forceinline float _mm_hmin<float, cyme::avx, 1>(simd_trait<float, cyme::avx, 1>::register_type xmm0) {
+    simd_trait<float, cyme::sse, 1>::register_type xmm1 = _mm_min_ps(_mm256_castps256_ps128(xmm0),
+                                                                     _mm256_extractf128_ps(xmm0, 1));
+    xmm1 = _mm_min_ps(xmm1, _mm_movehl_ps(xmm1, xmm1));
+    return _mm_cvtss_f32(_mm_min_ss(xmm1, _mm_shuffle_ps(xmm1, xmm1, 1)));
+}
+
+/**
+ Horizontal minimum of the register, the lanes are compared with a pairwise tree, return a scalar.
+ specialisation float,cyme::avx,2 regs
+ */
+template <>
+forceinline float _mm_hmin<float, cyme::avx, 2>(simd_trait<float, cyme::avx, 2>::register_type xmm0) {
+    return _mm_hmin<float, cyme::avx, 1>(_mm256_min_ps(xmm0.r0, xmm0.r1));
+}
+
+/**
+ Horizontal minimum of the register, the lanes are compared with a pairwise tree, return a scalar.
+ specialisation float,cyme::avx,4 regs
+ */
+template <>
+forceinline float _mm_hmin<float, cyme::avx, 4>(simd_trait<float, cyme::avx, 4>::register_type xmm0) {
+    return _mm_hmin<float, cyme::avx, 1>(
+        _mm256_min_ps(_mm256_min_ps(xmm0.r0, xmm0.r2), _mm256_min_ps(xmm0.r1, xmm0.r3)));
+}
+
+/**
+ Horizontal maximum of the register, the lanes are compared with a pairwise tree, return a scalar.
+ specialisation float,cyme::avx,1 regs
+ */
+template <>
+forceinline float _mm_hmax<float, cyme::avx, 1>(simd_trait<float, cyme::avx, 1>::register_type xmm0) {
+    simd_trait<float, cyme::sse, 1>::register_type xmm1 = _mm_max_ps(_mm256_castps256_ps128(xmm0),
+                                                                     _mm256_extractf128_ps(xmm0, 1));
+    xmm1 = _mm_max_ps(xmm1, _mm_movehl_ps(xmm1, xmm1));
+    return _mm_cvtss_f32(_mm_max_ss(xmm1, _mm_shuffle_ps(xmm1, xmm1, 1)));
+}
+
+/**
+ Horizontal maximum of the register, the lanes are compared with a pairwise tree, return a scalar.
+ specialisation float,cyme::avx,2 regs
+ */
+template <>
+forceinline float _mm_hmax<float, cyme::avx, 2>(simd_trait<float, cyme::avx, 2>::register_type xmm0) {
+    return _mm_hmax<float, cyme::avx, 1>(_mm256_max_ps(xmm0.r0, xmm0.r1));
+}
+
+/**
+ Horizontal maximum of the register, the lanes are compared with a pairwise tree, return a scalar.
+ specialisation float,cyme::avx,4 regs
+ */
+template <>
+forceinline float _mm_hmax<float, cyme::avx, 4>(simd_trait<float, cyme::avx, 4>::register_type xmm0) {
+    return _mm_hmax<float, cyme::avx, 1>(
+        _mm256_max_ps(_mm256_max_ps(xmm0.r0, xmm0.r2), _mm256_max_ps(xmm0.r1, xmm0.r3)));
+}
+
+/**
+ Gather the sign bits of the lanes of a mask into an integer, a bit per lane.
+ specialisation float,cyme::avx,1 regs
+ */
+template <>
+forceinline unsigned int _mm_movemask<float, cyme::avx, 1>(simd_trait<float, cyme::avx, 1>::register_type xmm0) {
+    return _mm256_movemask_ps(xmm0);
+}
+
+/**
+ Gather the sign bits of the lanes of a mask into an integer, a bit per lane.
+ specialisation float,cyme::avx,2 regs
+ */
+template <>
+forceinline unsigned int _mm_movemask<float, cyme::avx, 2>(simd_trait<float, cyme::avx, 2>::register_type xmm0) {
+    return _mm256_movemask_ps(xmm0.r0) | (static_cast<unsigned int>(_mm256_movemask_ps(xmm0.r1)) << 8);
+}
+
+/**
+ Gather the sign bits of the lanes of a mask into an integer, a bit per lane.
+ specialisation float,cyme::avx,4 regs
+ */
+template <>
+forceinline unsigned int _mm_movemask<float, cyme::avx, 4>(simd_trait<float, cyme::avx, 4>::register_type xmm0) {
+    return _mm256_movemask_ps(xmm0.r0) | (static_cast<unsigned int>(_mm256_movemask_ps(xmm0.r1)) << 8) |
+           (static_cast<unsigned int>(_mm256_movemask_ps(xmm0.r2)) << 16) |
+           (static_cast<unsigned int>(_mm256_movemask_ps(xmm0.r3)) << 24);
+}
+
 /**
   Negate packed single-precision (32-bit) floating-point elements in xmm0 to packed double-precision (64-bit)
   floating-point elements, and store the results in dst.
@@ -3774,33 +4166,184 @@ _mm_min<float, cyme::avx, 4>(simd_trait<float, cyme::avx, 4>::register_type xmm0
         _mm256_min_ps(xmm0.r3, xmm1.r3));
 }
 
-#ifdef __INTEL_COMPILER
 /**
-  Compute the exponential value of e raised to the power of packed single-precision (32-bit)
- floating-point elements in xmm0, and store the results in dst.
-  specialisation float,cyme::avx, 1 regs
+ Evaluate the <= operator, return if true return 0xffffffffffffffff (true) else 0 (false)
+ specialisation float,cyme::avx,1 regs
  */
 template <>
 forceinline simd_trait<float, cyme::avx, 1>::register_type
-_mm_exp<float, cyme::avx, 1>(simd_trait<float, cyme::avx, 1>::register_type xmm0) {
-    return __svml_expf8(xmm0);
+_mm_le<float, cyme::avx, 1>(simd_trait<float, cyme::avx, 1>::register_type xmm0,
+                            simd_trait<float, cyme::avx, 1>::register_type xmm1) {
+    return _mm256_cmp_ps(xmm0, xmm1, _CMP_LE_OS);
 }
 
 /**
-  Compute the exponential value of e raised to the power of packed single-precision (32-bit)
- floating-point elements in xmm0, and store the results in dst.
-  specialisation float,cyme::avx, 2 regs
+ Evaluate the <= operator, return if true return 0xffffffffffffffff (true) else 0 (false)
+ specialisation float,cyme::avx,2 regs
  */
 template <>
 forceinline simd_trait<float, cyme::avx, 2>::register_type
-_mm_exp<float, cyme::avx, 2>(simd_trait<float, cyme::avx, 2>::register_type xmm0) {
-    return simd_trait<float, cyme::avx, 2>::register_type(__svml_expf8(xmm0.r0), __svml_expf8(xmm0.r1));
+_mm_le<float, cyme::avx, 2>(simd_trait<float, cyme::avx, 2>::register_type xmm0,
+                            simd_trait<float, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<float, cyme::avx, 2>::register_type(_mm256_cmp_ps(xmm0.r0, xmm1.r0, _CMP_LE_OS),
+                                                          _mm256_cmp_ps(xmm0.r1, xmm1.r1, _CMP_LE_OS));
 }
 
 /**
-  Compute the exponential value of e raised to the power of packed single-precision (32-bit)
- floating-point elements in xmm0, and store the results in dst.
-  specialisation float,cyme::avx, 4 regs
+ Evaluate the <= operator, return if true return 0xffffffffffffffff (true) else 0 (false)
+ specialisation float,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<float, cyme::avx, 4>::register_type
+_mm_le<float, cyme::avx, 4>(simd_trait<float, cyme::avx, 4>::register_type xmm0,
+                            simd_trait<float, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<float, cyme::avx, 4>::register_type(_mm256_cmp_ps(xmm0.r0, xmm1.r0, _CMP_LE_OS),
+                                                          _mm256_cmp_ps(xmm0.r1, xmm1.r1, _CMP_LE_OS),
+                                                          _mm256_cmp_ps(xmm0.r2, xmm1.r2, _CMP_LE_OS),
+                                                          _mm256_cmp_ps(xmm0.r3, xmm1.r3, _CMP_LE_OS));
+}
+
+/**
+ Evaluate the != operator, return if true return 0xffffffffffffffff (true) else 0 (false)
+ specialisation float,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<float, cyme::avx, 1>::register_type
+_mm_ne<float, cyme::avx, 1>(simd_trait<float, cyme::avx, 1>::register_type xmm0,
+                            simd_trait<float, cyme::avx, 1>::register_type xmm1) {
+    return _mm256_cmp_ps(xmm0, xmm1, _CMP_NEQ_UQ);
+}
+
+/**
+ Evaluate the != operator, return if true return 0xffffffffffffffff (true) else 0 (false)
+ specialisation float,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<float, cyme::avx, 2>::register_type
+_mm_ne<float, cyme::avx, 2>(simd_trait<float, cyme::avx, 2>::register_type xmm0,
+                            simd_trait<float, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<float, cyme::avx, 2>::register_type(_mm256_cmp_ps(xmm0.r0, xmm1.r0, _CMP_NEQ_UQ),
+                                                          _mm256_cmp_ps(xmm0.r1, xmm1.r1, _CMP_NEQ_UQ));
+}
+
+/**
+ Evaluate the != operator, return if true return 0xffffffffffffffff (true) else 0 (false)
+ specialisation float,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<float, cyme::avx, 4>::register_type
+_mm_ne<float, cyme::avx, 4>(simd_trait<float, cyme::avx, 4>::register_type xmm0,
+                            simd_trait<float, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<float, cyme::avx, 4>::register_type(_mm256_cmp_ps(xmm0.r0, xmm1.r0, _CMP_NEQ_UQ),
+                                                          _mm256_cmp_ps(xmm0.r1, xmm1.r1, _CMP_NEQ_UQ),
+                                                          _mm256_cmp_ps(xmm0.r2, xmm1.r2, _CMP_NEQ_UQ),
+                                                          _mm256_cmp_ps(xmm0.r3, xmm1.r3, _CMP_NEQ_UQ));
+}
+
+/**
+ Evaluate the  max operator between two registers
+ specialisation float,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<float, cyme::avx, 1>::register_type
+_mm_max<float, cyme::avx, 1>(simd_trait<float, cyme::avx, 1>::register_type xmm0,
+                             simd_trait<float, cyme::avx, 1>::register_type xmm1) {
+    return _mm256_max_ps(xmm0, xmm1);
+}
+
+/**
+ Evaluate the  max operator between two registers
+ specialisation float,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<float, cyme::avx, 2>::register_type
+_mm_max<float, cyme::avx, 2>(simd_trait<float, cyme::avx, 2>::register_type xmm0,
+                             simd_trait<float, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<float, cyme::avx, 2>::register_type(_mm256_max_ps(xmm0.r0, xmm1.r0),
+                                                          _mm256_max_ps(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the  max operator between two registers
+ specialisation float,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<float, cyme::avx, 4>::register_type
+_mm_max<float, cyme::avx, 4>(simd_trait<float, cyme::avx, 4>::register_type xmm0,
+                             simd_trait<float, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<float, cyme::avx, 4>::register_type(_mm256_max_ps(xmm0.r0, xmm1.r0),
+                                                          _mm256_max_ps(xmm0.r1, xmm1.r1),
+                                                          _mm256_max_ps(xmm0.r2, xmm1.r2),
+                                                          _mm256_max_ps(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Select xmm1 where the mask xmm0 is true else xmm2, a single blendv
+ specialisation float,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<float, cyme::avx, 1>::register_type
+_mm_select<float, cyme::avx, 1>(simd_trait<float, cyme::avx, 1>::register_type xmm0,
+                                simd_trait<float, cyme::avx, 1>::register_type xmm1,
+                                simd_trait<float, cyme::avx, 1>::register_type xmm2) {
+    return _mm256_blendv_ps(xmm2, xmm1, xmm0);
+}
+
+/**
+ Select xmm1 where the mask xmm0 is true else xmm2, a single blendv
+ specialisation float,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<float, cyme::avx, 2>::register_type
+_mm_select<float, cyme::avx, 2>(simd_trait<float, cyme::avx, 2>::register_type xmm0,
+                                simd_trait<float, cyme::avx, 2>::register_type xmm1,
+                                simd_trait<float, cyme::avx, 2>::register_type xmm2) {
+    return simd_trait<float, cyme::avx, 2>::register_type(_mm256_blendv_ps(xmm2.r0, xmm1.r0, xmm0.r0),
+                                                          _mm256_blendv_ps(xmm2.r1, xmm1.r1, xmm0.r1));
+}
+
+/**
+ Select xmm1 where the mask xmm0 is true else xmm2, a single blendv
+ specialisation float,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<float, cyme::avx, 4>::register_type
+_mm_select<float, cyme::avx, 4>(simd_trait<float, cyme::avx, 4>::register_type xmm0,
+                                simd_trait<float, cyme::avx, 4>::register_type xmm1,
+                                simd_trait<float, cyme::avx, 4>::register_type xmm2) {
+    return simd_trait<float, cyme::avx, 4>::register_type(_mm256_blendv_ps(xmm2.r0, xmm1.r0, xmm0.r0),
+                                                          _mm256_blendv_ps(xmm2.r1, xmm1.r1, xmm0.r1),
+                                                          _mm256_blendv_ps(xmm2.r2, xmm1.r2, xmm0.r2),
+                                                          _mm256_blendv_ps(xmm2.r3, xmm1.r3, xmm0.r3));
+}
+
+#ifdef __INTEL_COMPILER
+/**
+  Compute the exponential value of e raised to the power of packed single-precision (32-bit)
+ floating-point elements in xmm0, and store the results in dst.
+  specialisation float,cyme::avx, 1 regs
+ */
+template <>
+forceinline simd_trait<float, cyme::avx, 1>::register_type
+_mm_exp<float, cyme::avx, 1>(simd_trait<float, cyme::avx, 1>::register_type xmm0) {
+    return __svml_expf8(xmm0);
+}
+
+/**
+  Compute the exponential value of e raised to the power of packed single-precision (32-bit)
+ floating-point elements in xmm0, and store the results in dst.
+  specialisation float,cyme::avx, 2 regs
+ */
+template <>
+forceinline simd_trait<float, cyme::avx, 2>::register_type
+_mm_exp<float, cyme::avx, 2>(simd_trait<float, cyme::avx, 2>::register_type xmm0) {
+    return simd_trait<float, cyme::avx, 2>::register_type(__svml_expf8(xmm0.r0), __svml_expf8(xmm0.r1));
+}
+
+/**
+  Compute the exponential value of e raised to the power of packed single-precision (32-bit)
+ floating-point elements in xmm0, and store the results in dst.
+  specialisation float,cyme::avx, 4 regs
  */
 template <>
 forceinline simd_trait<float, cyme::avx, 4>::register_type
@@ -4670,6 +5213,2564 @@ _mm_cast<int, cyme::avx, 4, float>(simd_trait<int, cyme::avx, 4>::register_type
                                                           _mm256_castsi256_ps(xmm0.r2), _mm256_castsi256_ps(xmm0.r3));
 }
 
+/** \cond */
+namespace detail {
+#ifdef __AVX2__
+/** high part of the signed products of the 32 bits integers, the even lanes then the odd lanes */
+forceinline __m256i _mm256_mulhi_epi32(__m256i xmm0, __m256i xmm1) {
+    const __m256i even = _mm256_srli_epi64(_mm256_mul_epi32(xmm0, xmm1), 32);
+    const __m256i odd = _mm256_mul_epi32(_mm256_srli_epi64(xmm0, 32), _mm256_srli_epi64(xmm1, 32));
+    return _mm256_blend_epi32(even, odd, 0xaa);
+}
+#endif
+
+/** division by an invariant divisor, libdivide s32 algorithm, two SSE halves without AVX2 */
+forceinline __m256i _mm256_div_invariant_epi32(__m256i xmm0, int_divisor const &d) {
+#ifdef __AVX2__
+    const __m256i sign = _mm256_set1_epi32(d.sign);
+    const __m128i shift = _mm_cvtsi32_si128(d.shift);
+    if (d.magic == 0) { // power of two, the negative numerators are rounded to zero
+        const __m256i mask = _mm256_set1_epi32(static_cast<int>((1u << d.shift) - 1));
+        __m256i q = _mm256_add_epi32(xmm0, _mm256_and_si256(_mm256_srai_epi32(xmm0, 31), mask));
+        q = _mm256_sra_epi32(q, shift);
+        return _mm256_sub_epi32(_mm256_xor_si256(q, sign), sign);
+    }
+    __m256i q = _mm256_mulhi_epi32(xmm0, _mm256_set1_epi32(d.magic));
+    if (d.add)
+        q = _mm256_add_epi32(q, _mm256_sub_epi32(_mm256_xor_si256(xmm0, sign), sign));
+    q = _mm256_sra_epi32(q, shift);
+    return _mm256_sub_epi32(q, _mm256_srai_epi32(q, 31)); // +1 if negative
+#else
+    return _mm256_set_m128i(_mm_div_invariant_epi32(_mm256_extractf128_si256(xmm0, 1), d),
+                            _mm_div_invariant_epi32(_mm256_extractf128_si256(xmm0, 0), d));
+#endif
+}
+
+/** remainder by an invariant divisor, n - (n/d)*d */
+forceinline __m256i _mm256_mod_invariant_epi32(__m256i xmm0, int_divisor const &d) {
+#ifdef __AVX2__
+    return _mm256_sub_epi32(xmm0,
+                            _mm256_mullo_epi32(_mm256_div_invariant_epi32(xmm0, d), _mm256_set1_epi32(d.value)));
+#else
+    return _mm256_set_m128i(_mm_mod_invariant_epi32(_mm256_extractf128_si256(xmm0, 1), d),
+                            _mm_mod_invariant_epi32(_mm256_extractf128_si256(xmm0, 0), d));
+#endif
+}
+} // namespace detail
+/** \endcond */
+
+/**
+ Divide the 32 bits integers by an invariant divisor (multiply-high and shift)
+ specialisation int,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<int, cyme::avx, 1>::register_type
+_mm_div_invariant<int, cyme::avx, 1>(simd_trait<int, cyme::avx, 1>::register_type xmm0, int_divisor const &d) {
+    return detail::_mm256_div_invariant_epi32(xmm0, d);
+}
+
+/**
+ Divide the 32 bits integers by an invariant divisor (multiply-high and shift)
+ specialisation int,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<int, cyme::avx, 2>::register_type
+_mm_div_invariant<int, cyme::avx, 2>(simd_trait<int, cyme::avx, 2>::register_type xmm0, int_divisor const &d) {
+    return simd_trait<int, cyme::avx, 2>::register_type(detail::_mm256_div_invariant_epi32(xmm0.r0, d),
+                                                        detail::_mm256_div_invariant_epi32(xmm0.r1, d));
+}
+
+/**
+ Divide the 32 bits integers by an invariant divisor (multiply-high and shift)
+ specialisation int,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<int, cyme::avx, 4>::register_type
+_mm_div_invariant<int, cyme::avx, 4>(simd_trait<int, cyme::avx, 4>::register_type xmm0, int_divisor const &d) {
+    return simd_trait<int, cyme::avx, 4>::register_type(
+        detail::_mm256_div_invariant_epi32(xmm0.r0, d), detail::_mm256_div_invariant_epi32(xmm0.r1, d),
+        detail::_mm256_div_invariant_epi32(xmm0.r2, d), detail::_mm256_div_invariant_epi32(xmm0.r3, d));
+}
+
+/**
+ Remainder of the 32 bits integers by an invariant divisor
+ specialisation int,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<int, cyme::avx, 1>::register_type
+_mm_mod_invariant<int, cyme::avx, 1>(simd_trait<int, cyme::avx, 1>::register_type xmm0, int_divisor const &d) {
+    return detail::_mm256_mod_invariant_epi32(xmm0, d);
+}
+
+/**
+ Remainder of the 32 bits integers by an invariant divisor
+ specialisation int,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<int, cyme::avx, 2>::register_type
+_mm_mod_invariant<int, cyme::avx, 2>(simd_trait<int, cyme::avx, 2>::register_type xmm0, int_divisor const &d) {
+    return simd_trait<int, cyme::avx, 2>::register_type(detail::_mm256_mod_invariant_epi32(xmm0.r0, d),
+                                                        detail::_mm256_mod_invariant_epi32(xmm0.r1, d));
+}
+
+/**
+ Remainder of the 32 bits integers by an invariant divisor
+ specialisation int,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<int, cyme::avx, 4>::register_type
+_mm_mod_invariant<int, cyme::avx, 4>(simd_trait<int, cyme::avx, 4>::register_type xmm0, int_divisor const &d) {
+    return simd_trait<int, cyme::avx, 4>::register_type(
+        detail::_mm256_mod_invariant_epi32(xmm0.r0, d), detail::_mm256_mod_invariant_epi32(xmm0.r1, d),
+        detail::_mm256_mod_invariant_epi32(xmm0.r2, d), detail::_mm256_mod_invariant_epi32(xmm0.r3, d));
+}
+
+/** \cond */
+namespace detail {
+/** the halves of the registers, AVX without AVX2 calls the SSE integer instructions twice */
+forceinline __m128i high128(__m256i xmm0) { return _mm256_extractf128_si256(xmm0, 1); }
+
+forceinline __m128i low128(__m256i xmm0) { return _mm256_castsi256_si128(xmm0); }
+
+/** the bitwise operations are AVX with the double */
+forceinline __m256i and_si(__m256i xmm0, __m256i xmm1) {
+    return _mm256_castpd_si256(_mm256_and_pd(_mm256_castsi256_pd(xmm0), _mm256_castsi256_pd(xmm1)));
+}
+
+forceinline __m256i or_si(__m256i xmm0, __m256i xmm1) {
+    return _mm256_castpd_si256(_mm256_or_pd(_mm256_castsi256_pd(xmm0), _mm256_castsi256_pd(xmm1)));
+}
+
+forceinline __m256i xor_si(__m256i xmm0, __m256i xmm1) {
+    return _mm256_castpd_si256(_mm256_xor_pd(_mm256_castsi256_pd(xmm0), _mm256_castsi256_pd(xmm1)));
+}
+
+forceinline __m256i not_si(__m256i xmm0) { return xor_si(xmm0, _mm256_set1_epi32(-1)); }
+
+forceinline __m256i add_epi32(__m256i xmm0, __m256i xmm1) {
+#ifdef __AVX2__
+    return _mm256_add_epi32(xmm0, xmm1);
+#else
+    return _mm256_set_m128i(_mm_add_epi32(high128(xmm0), high128(xmm1)), _mm_add_epi32(low128(xmm0), low128(xmm1)));
+#endif
+}
+
+forceinline __m256i sub_epi32(__m256i xmm0, __m256i xmm1) {
+#ifdef __AVX2__
+    return _mm256_sub_epi32(xmm0, xmm1);
+#else
+    return _mm256_set_m128i(_mm_sub_epi32(high128(xmm0), high128(xmm1)), _mm_sub_epi32(low128(xmm0), low128(xmm1)));
+#endif
+}
+
+forceinline __m256i mullo_epi32(__m256i xmm0, __m256i xmm1) {
+#ifdef __AVX2__
+    return _mm256_mullo_epi32(xmm0, xmm1);
+#else
+    return _mm256_set_m128i(_mm_mullo_epi32(high128(xmm0), high128(xmm1)), _mm_mullo_epi32(low128(xmm0), low128(xmm1)));
+#endif
+}
+
+forceinline __m256i add_epi64(__m256i xmm0, __m256i xmm1) {
+#ifdef __AVX2__
+    return _mm256_add_epi64(xmm0, xmm1);
+#else
+    return _mm256_set_m128i(_mm_add_epi64(high128(xmm0), high128(xmm1)), _mm_add_epi64(low128(xmm0), low128(xmm1)));
+#endif
+}
+
+forceinline __m256i sub_epi64(__m256i xmm0, __m256i xmm1) {
+#ifdef __AVX2__
+    return _mm256_sub_epi64(xmm0, xmm1);
+#else
+    return _mm256_set_m128i(_mm_sub_epi64(high128(xmm0), high128(xmm1)), _mm_sub_epi64(low128(xmm0), low128(xmm1)));
+#endif
+}
+
+forceinline __m256i cmpeq_epi32(__m256i xmm0, __m256i xmm1) {
+#ifdef __AVX2__
+    return _mm256_cmpeq_epi32(xmm0, xmm1);
+#else
+    return _mm256_set_m128i(_mm_cmpeq_epi32(high128(xmm0), high128(xmm1)), _mm_cmpeq_epi32(low128(xmm0), low128(xmm1)));
+#endif
+}
+
+forceinline __m256i cmpeq_epi64(__m256i xmm0, __m256i xmm1) {
+#ifdef __AVX2__
+    return _mm256_cmpeq_epi64(xmm0, xmm1);
+#else
+    return _mm256_set_m128i(_mm_cmpeq_epi64(high128(xmm0), high128(xmm1)), _mm_cmpeq_epi64(low128(xmm0), low128(xmm1)));
+#endif
+}
+
+forceinline __m256i cmplt_epi64(__m256i xmm0, __m256i xmm1) {
+#ifdef __AVX2__
+    return _mm256_cmpgt_epi64(xmm1, xmm0);
+#else
+    return _mm256_set_m128i(cmplt_epi64(high128(xmm0), high128(xmm1)), cmplt_epi64(low128(xmm0), low128(xmm1)));
+#endif
+}
+
+forceinline __m256i cmplt_epu32(__m256i xmm0, __m256i xmm1) {
+#ifdef __AVX2__
+    const __m256i flip = _mm256_set1_epi32(static_cast<int>(1u << 31));
+    return _mm256_cmpgt_epi32(_mm256_xor_si256(xmm1, flip), _mm256_xor_si256(xmm0, flip));
+#else
+    return _mm256_set_m128i(cmplt_epu32(high128(xmm0), high128(xmm1)), cmplt_epu32(low128(xmm0), low128(xmm1)));
+#endif
+}
+
+forceinline __m256i cmplt_epu64(__m256i xmm0, __m256i xmm1) {
+#ifdef __AVX2__
+    const __m256i flip = _mm256_set1_epi64x(static_cast<long long>(1ull << 63));
+    return _mm256_cmpgt_epi64(_mm256_xor_si256(xmm1, flip), _mm256_xor_si256(xmm0, flip));
+#else
+    return _mm256_set_m128i(cmplt_epu64(high128(xmm0), high128(xmm1)), cmplt_epu64(low128(xmm0), low128(xmm1)));
+#endif
+}
+
+forceinline __m256i sll_epi32(__m256i xmm0, __m256i xmm1) {
+#ifdef __AVX2__
+    return _mm256_sll_epi32(xmm0, _mm_and_si128(_mm256_castsi256_si128(xmm1), _mm_set_epi32(0, 0, 0, -1)));
+#else
+    return _mm256_set_m128i(sll_epi32(high128(xmm0), low128(xmm1)), sll_epi32(low128(xmm0), low128(xmm1)));
+#endif
+}
+
+forceinline __m256i srl_epi32(__m256i xmm0, __m256i xmm1) {
+#ifdef __AVX2__
+    return _mm256_srl_epi32(xmm0, _mm_and_si128(_mm256_castsi256_si128(xmm1), _mm_set_epi32(0, 0, 0, -1)));
+#else
+    return _mm256_set_m128i(srl_epi32(high128(xmm0), low128(xmm1)), srl_epi32(low128(xmm0), low128(xmm1)));
+#endif
+}
+
+forceinline __m256i sll_epi64(__m256i xmm0, __m256i xmm1) {
+#ifdef __AVX2__
+    return _mm256_sll_epi64(xmm0, _mm256_castsi256_si128(xmm1));
+#else
+    return _mm256_set_m128i(_mm_sll_epi64(high128(xmm0), low128(xmm1)), _mm_sll_epi64(low128(xmm0), low128(xmm1)));
+#endif
+}
+
+forceinline __m256i srl_epi64(__m256i xmm0, __m256i xmm1) {
+#ifdef __AVX2__
+    return _mm256_srl_epi64(xmm0, _mm256_castsi256_si128(xmm1));
+#else
+    return _mm256_set_m128i(_mm_srl_epi64(high128(xmm0), low128(xmm1)), _mm_srl_epi64(low128(xmm0), low128(xmm1)));
+#endif
+}
+
+forceinline __m256i sra_epi64(__m256i xmm0, __m256i xmm1) {
+#ifdef __AVX2__
+    const __m256i s = _mm256_cmpgt_epi64(_mm256_setzero_si256(), xmm0);
+    return _mm256_xor_si256(_mm256_srl_epi64(_mm256_xor_si256(xmm0, s), _mm256_castsi256_si128(xmm1)), s);
+#else
+    return _mm256_set_m128i(sra_epi64(high128(xmm0), low128(xmm1)), sra_epi64(low128(xmm0), low128(xmm1)));
+#endif
+}
+
+/** low 64 bits of the products, as the SSE version */
+forceinline __m256i mullo_epi64(__m256i xmm0, __m256i xmm1) {
+#ifdef __AVX2__
+    const __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(xmm0, 32), xmm1),
+                                           _mm256_mul_epu32(xmm0, _mm256_srli_epi64(xmm1, 32)));
+    return _mm256_add_epi64(_mm256_mul_epu32(xmm0, xmm1), _mm256_slli_epi64(cross, 32));
+#else
+    return _mm256_set_m128i(mullo_epi64(high128(xmm0), high128(xmm1)), mullo_epi64(low128(xmm0), low128(xmm1)));
+#endif
+}
+
+forceinline __m256i cmpne_epi32(__m256i xmm0, __m256i xmm1) { return not_si(cmpeq_epi32(xmm0, xmm1)); }
+
+forceinline __m256i cmpne_epi64(__m256i xmm0, __m256i xmm1) { return not_si(cmpeq_epi64(xmm0, xmm1)); }
+
+forceinline __m256i cmple_epi64(__m256i xmm0, __m256i xmm1) { return not_si(cmplt_epi64(xmm1, xmm0)); }
+
+forceinline __m256i cmple_epu64(__m256i xmm0, __m256i xmm1) { return not_si(cmplt_epu64(xmm1, xmm0)); }
+
+forceinline __m256i cmple_epu32(__m256i xmm0, __m256i xmm1) { return not_si(cmplt_epu32(xmm1, xmm0)); }
+
+/** the conversions, as the SSE versions */
+forceinline __m256 cvtepu32_ps(__m256i xmm0) {
+#ifdef __AVX2__
+    const __m256 high = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(xmm0, 16)), _mm256_set1_ps(65536.f));
+    return _mm256_add_ps(high, _mm256_cvtepi32_ps(_mm256_and_si256(xmm0, _mm256_set1_epi32(0xffff))));
+#else
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(cvtepu32_ps(low128(xmm0))), cvtepu32_ps(high128(xmm0)), 1);
+#endif
+}
+
+forceinline __m256d cvtepu64_pd(__m256i xmm0) {
+#ifdef __AVX2__
+    const __m256i p84 = _mm256_castpd_si256(_mm256_set1_pd(19342813113834066795298816.)); // 2^84
+    const __m256i p52 = _mm256_castpd_si256(_mm256_set1_pd(4503599627370496.));           // 2^52
+    const __m256i high = _mm256_or_si256(_mm256_srli_epi64(xmm0, 32), p84);
+    const __m256i low = _mm256_blend_epi16(xmm0, p52, 0xcc);
+    const __m256d f = _mm256_sub_pd(_mm256_castsi256_pd(high), _mm256_set1_pd(19342813118337666422669312.));
+    return _mm256_add_pd(f, _mm256_castsi256_pd(low));
+#else
+    return _mm256_insertf128_pd(_mm256_castpd128_pd256(cvtepu64_pd(low128(xmm0))), cvtepu64_pd(high128(xmm0)), 1);
+#endif
+}
+
+forceinline __m256d cvtepi64_pd(__m256i xmm0) {
+#ifdef __AVX2__
+    const __m256i p67 = _mm256_castpd_si256(_mm256_set1_pd(442721857769029238784.)); // 3*2^67
+    const __m256i p52 = _mm256_castpd_si256(_mm256_set1_pd(4503599627370496.));      // 2^52
+    const __m256i sign = _mm256_blend_epi16(_mm256_srai_epi32(xmm0, 16), _mm256_setzero_si256(), 0x33);
+    const __m256i high = _mm256_add_epi64(sign, p67);
+    const __m256i low = _mm256_blend_epi16(xmm0, p52, 0x88);
+    const __m256d f = _mm256_sub_pd(_mm256_castsi256_pd(high), _mm256_set1_pd(442726361368656609280.));
+    return _mm256_add_pd(f, _mm256_castsi256_pd(low));
+#else
+    return _mm256_insertf128_pd(_mm256_castpd128_pd256(cvtepi64_pd(low128(xmm0))), cvtepi64_pd(high128(xmm0)), 1);
+#endif
+}
+} // namespace detail
+/** \endcond */
+
+/**
+ Evaluate the << operator between two registers, warning only the first 32 bits of xmm1 are used
+ specialisation int,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<int, cyme::avx, 1>::register_type
+_mm_sll<int, cyme::avx, 1>(simd_trait<int, cyme::avx, 1>::register_type xmm0,
+                           simd_trait<int, cyme::avx, 1>::register_type xmm1) {
+    return detail::sll_epi32(xmm0, xmm1);
+}
+
+/**
+ Evaluate the << operator between two registers, warning only the first 32 bits of xmm1 are used
+ specialisation int,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<int, cyme::avx, 2>::register_type
+_mm_sll<int, cyme::avx, 2>(simd_trait<int, cyme::avx, 2>::register_type xmm0,
+                           simd_trait<int, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<int, cyme::avx, 2>::register_type(detail::sll_epi32(xmm0.r0, xmm1.r0),
+                                                        detail::sll_epi32(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the << operator between two registers, warning only the first 32 bits of xmm1 are used
+ specialisation int,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<int, cyme::avx, 4>::register_type
+_mm_sll<int, cyme::avx, 4>(simd_trait<int, cyme::avx, 4>::register_type xmm0,
+                           simd_trait<int, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<int, cyme::avx, 4>::register_type(
+        detail::sll_epi32(xmm0.r0, xmm1.r0), detail::sll_epi32(xmm0.r1, xmm1.r1), detail::sll_epi32(xmm0.r2, xmm1.r2),
+        detail::sll_epi32(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Load a 64 bits integer into all the elements of the registers
+ specialisation int64_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 1>::register_type
+_mm_load1<std::int64_t, cyme::avx, 1>(const simd_trait<std::int64_t, cyme::avx, 1>::value_type &a) {
+    return _mm256_set1_epi64x(a);
+}
+
+/**
+ Load a 64 bits integer into all the elements of the registers
+ specialisation int64_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 2>::register_type
+_mm_load1<std::int64_t, cyme::avx, 2>(const simd_trait<std::int64_t, cyme::avx, 2>::value_type &a) {
+    return simd_trait<std::int64_t, cyme::avx, 2>::register_type(_mm256_set1_epi64x(a), _mm256_set1_epi64x(a));
+}
+
+/**
+ Load a 64 bits integer into all the elements of the registers
+ specialisation int64_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 4>::register_type
+_mm_load1<std::int64_t, cyme::avx, 4>(const simd_trait<std::int64_t, cyme::avx, 4>::value_type &a) {
+    return simd_trait<std::int64_t, cyme::avx, 4>::register_type(_mm256_set1_epi64x(a), _mm256_set1_epi64x(a),
+                                                                 _mm256_set1_epi64x(a), _mm256_set1_epi64x(a));
+}
+
+/**
+ Load the 64 bits integers from cyme (aligned)
+ specialisation int64_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 1>::register_type
+_mm_load<std::int64_t, cyme::avx, 1>(simd_trait<std::int64_t, cyme::avx, 1>::const_pointer a) {
+    return _mm256_load_si256((__m256i *)a);
+}
+
+/**
+ Load the 64 bits integers from cyme (aligned)
+ specialisation int64_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 2>::register_type
+_mm_load<std::int64_t, cyme::avx, 2>(simd_trait<std::int64_t, cyme::avx, 2>::const_pointer a) {
+    return simd_trait<std::int64_t, cyme::avx, 2>::register_type(_mm256_load_si256((__m256i *)a),
+                                                                 _mm256_load_si256((__m256i *)(a + 4)));
+}
+
+/**
+ Load the 64 bits integers from cyme (aligned)
+ specialisation int64_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 4>::register_type
+_mm_load<std::int64_t, cyme::avx, 4>(simd_trait<std::int64_t, cyme::avx, 4>::const_pointer a) {
+    return simd_trait<std::int64_t, cyme::avx, 4>::register_type(
+        _mm256_load_si256((__m256i *)a), _mm256_load_si256((__m256i *)(a + 4)), _mm256_load_si256((__m256i *)(a + 8)),
+        _mm256_load_si256((__m256i *)(a + 12)));
+}
+
+/**
+ Store the 64 bits integers into cyme (aligned)
+ specialisation int64_t,cyme::avx,1 regs
+ */
+template <>
+forceinline void
+_mm_store<std::int64_t, cyme::avx, 1>(simd_trait<std::int64_t, cyme::avx, 1>::register_type xmm0,
+                                      simd_trait<std::int64_t, cyme::avx, 1>::pointer a) {
+    _mm256_store_si256((__m256i *)a, xmm0);
+}
+
+/**
+ Store the 64 bits integers into cyme (aligned)
+ specialisation int64_t,cyme::avx,2 regs
+ */
+template <>
+forceinline void
+_mm_store<std::int64_t, cyme::avx, 2>(simd_trait<std::int64_t, cyme::avx, 2>::register_type xmm0,
+                                      simd_trait<std::int64_t, cyme::avx, 2>::pointer a) {
+    _mm256_store_si256((__m256i *)a, xmm0.r0);
+    _mm256_store_si256((__m256i *)(a + 4), xmm0.r1);
+}
+
+/**
+ Store the 64 bits integers into cyme (aligned)
+ specialisation int64_t,cyme::avx,4 regs
+ */
+template <>
+forceinline void
+_mm_store<std::int64_t, cyme::avx, 4>(simd_trait<std::int64_t, cyme::avx, 4>::register_type xmm0,
+                                      simd_trait<std::int64_t, cyme::avx, 4>::pointer a) {
+    _mm256_store_si256((__m256i *)a, xmm0.r0);
+    _mm256_store_si256((__m256i *)(a + 4), xmm0.r1);
+    _mm256_store_si256((__m256i *)(a + 8), xmm0.r2);
+    _mm256_store_si256((__m256i *)(a + 12), xmm0.r3);
+}
+
+/**
+ Add the 64 bits integers
+ specialisation int64_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 1>::register_type
+_mm_add<std::int64_t, cyme::avx, 1>(simd_trait<std::int64_t, cyme::avx, 1>::register_type xmm0,
+                                    simd_trait<std::int64_t, cyme::avx, 1>::register_type xmm1) {
+    return detail::add_epi64(xmm0, xmm1);
+}
+
+/**
+ Add the 64 bits integers
+ specialisation int64_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 2>::register_type
+_mm_add<std::int64_t, cyme::avx, 2>(simd_trait<std::int64_t, cyme::avx, 2>::register_type xmm0,
+                                    simd_trait<std::int64_t, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::avx, 2>::register_type(detail::add_epi64(xmm0.r0, xmm1.r0),
+                                                                 detail::add_epi64(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Add the 64 bits integers
+ specialisation int64_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 4>::register_type
+_mm_add<std::int64_t, cyme::avx, 4>(simd_trait<std::int64_t, cyme::avx, 4>::register_type xmm0,
+                                    simd_trait<std::int64_t, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::avx, 4>::register_type(
+        detail::add_epi64(xmm0.r0, xmm1.r0), detail::add_epi64(xmm0.r1, xmm1.r1), detail::add_epi64(xmm0.r2, xmm1.r2),
+        detail::add_epi64(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Subtract the 64 bits integers, xmm0 - xmm1
+ specialisation int64_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 1>::register_type
+_mm_sub<std::int64_t, cyme::avx, 1>(simd_trait<std::int64_t, cyme::avx, 1>::register_type xmm0,
+                                    simd_trait<std::int64_t, cyme::avx, 1>::register_type xmm1) {
+    return detail::sub_epi64(xmm0, xmm1);
+}
+
+/**
+ Subtract the 64 bits integers, xmm0 - xmm1
+ specialisation int64_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 2>::register_type
+_mm_sub<std::int64_t, cyme::avx, 2>(simd_trait<std::int64_t, cyme::avx, 2>::register_type xmm0,
+                                    simd_trait<std::int64_t, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::avx, 2>::register_type(detail::sub_epi64(xmm0.r0, xmm1.r0),
+                                                                 detail::sub_epi64(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Subtract the 64 bits integers, xmm0 - xmm1
+ specialisation int64_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 4>::register_type
+_mm_sub<std::int64_t, cyme::avx, 4>(simd_trait<std::int64_t, cyme::avx, 4>::register_type xmm0,
+                                    simd_trait<std::int64_t, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::avx, 4>::register_type(
+        detail::sub_epi64(xmm0.r0, xmm1.r0), detail::sub_epi64(xmm0.r1, xmm1.r1), detail::sub_epi64(xmm0.r2, xmm1.r2),
+        detail::sub_epi64(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Multiply the 64 bits integers, the low 64 bits of the products
+ specialisation int64_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 1>::register_type
+_mm_mul<std::int64_t, cyme::avx, 1>(simd_trait<std::int64_t, cyme::avx, 1>::register_type xmm0,
+                                    simd_trait<std::int64_t, cyme::avx, 1>::register_type xmm1) {
+    return detail::mullo_epi64(xmm0, xmm1);
+}
+
+/**
+ Multiply the 64 bits integers, the low 64 bits of the products
+ specialisation int64_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 2>::register_type
+_mm_mul<std::int64_t, cyme::avx, 2>(simd_trait<std::int64_t, cyme::avx, 2>::register_type xmm0,
+                                    simd_trait<std::int64_t, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::avx, 2>::register_type(detail::mullo_epi64(xmm0.r0, xmm1.r0),
+                                                                 detail::mullo_epi64(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Multiply the 64 bits integers, the low 64 bits of the products
+ specialisation int64_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 4>::register_type
+_mm_mul<std::int64_t, cyme::avx, 4>(simd_trait<std::int64_t, cyme::avx, 4>::register_type xmm0,
+                                    simd_trait<std::int64_t, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::avx, 4>::register_type(
+        detail::mullo_epi64(xmm0.r0, xmm1.r0), detail::mullo_epi64(xmm0.r1, xmm1.r1),
+        detail::mullo_epi64(xmm0.r2, xmm1.r2), detail::mullo_epi64(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the << operator, the shift is the first element of xmm1
+ specialisation int64_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 1>::register_type
+_mm_sll<std::int64_t, cyme::avx, 1>(simd_trait<std::int64_t, cyme::avx, 1>::register_type xmm0,
+                                    simd_trait<std::int64_t, cyme::avx, 1>::register_type xmm1) {
+    return detail::sll_epi64(xmm0, xmm1);
+}
+
+/**
+ Evaluate the << operator, the shift is the first element of xmm1
+ specialisation int64_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 2>::register_type
+_mm_sll<std::int64_t, cyme::avx, 2>(simd_trait<std::int64_t, cyme::avx, 2>::register_type xmm0,
+                                    simd_trait<std::int64_t, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::avx, 2>::register_type(detail::sll_epi64(xmm0.r0, xmm1.r0),
+                                                                 detail::sll_epi64(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the << operator, the shift is the first element of xmm1
+ specialisation int64_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 4>::register_type
+_mm_sll<std::int64_t, cyme::avx, 4>(simd_trait<std::int64_t, cyme::avx, 4>::register_type xmm0,
+                                    simd_trait<std::int64_t, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::avx, 4>::register_type(
+        detail::sll_epi64(xmm0.r0, xmm1.r0), detail::sll_epi64(xmm0.r1, xmm1.r1), detail::sll_epi64(xmm0.r2, xmm1.r2),
+        detail::sll_epi64(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the >> operator, the shift is the first element of xmm1, arithmetic shift
+ specialisation int64_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 1>::register_type
+_mm_srl<std::int64_t, cyme::avx, 1>(simd_trait<std::int64_t, cyme::avx, 1>::register_type xmm0,
+                                    simd_trait<std::int64_t, cyme::avx, 1>::register_type xmm1) {
+    return detail::sra_epi64(xmm0, xmm1);
+}
+
+/**
+ Evaluate the >> operator, the shift is the first element of xmm1, arithmetic shift
+ specialisation int64_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 2>::register_type
+_mm_srl<std::int64_t, cyme::avx, 2>(simd_trait<std::int64_t, cyme::avx, 2>::register_type xmm0,
+                                    simd_trait<std::int64_t, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::avx, 2>::register_type(detail::sra_epi64(xmm0.r0, xmm1.r0),
+                                                                 detail::sra_epi64(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the >> operator, the shift is the first element of xmm1, arithmetic shift
+ specialisation int64_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 4>::register_type
+_mm_srl<std::int64_t, cyme::avx, 4>(simd_trait<std::int64_t, cyme::avx, 4>::register_type xmm0,
+                                    simd_trait<std::int64_t, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::avx, 4>::register_type(
+        detail::sra_epi64(xmm0.r0, xmm1.r0), detail::sra_epi64(xmm0.r1, xmm1.r1), detail::sra_epi64(xmm0.r2, xmm1.r2),
+        detail::sra_epi64(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the == operator, the elements are 0 (false) or all bits set (true)
+ specialisation int64_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 1>::register_type
+_mm_eq<std::int64_t, cyme::avx, 1>(simd_trait<std::int64_t, cyme::avx, 1>::register_type xmm0,
+                                   simd_trait<std::int64_t, cyme::avx, 1>::register_type xmm1) {
+    return detail::cmpeq_epi64(xmm0, xmm1);
+}
+
+/**
+ Evaluate the == operator, the elements are 0 (false) or all bits set (true)
+ specialisation int64_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 2>::register_type
+_mm_eq<std::int64_t, cyme::avx, 2>(simd_trait<std::int64_t, cyme::avx, 2>::register_type xmm0,
+                                   simd_trait<std::int64_t, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::avx, 2>::register_type(detail::cmpeq_epi64(xmm0.r0, xmm1.r0),
+                                                                 detail::cmpeq_epi64(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the == operator, the elements are 0 (false) or all bits set (true)
+ specialisation int64_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 4>::register_type
+_mm_eq<std::int64_t, cyme::avx, 4>(simd_trait<std::int64_t, cyme::avx, 4>::register_type xmm0,
+                                   simd_trait<std::int64_t, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::avx, 4>::register_type(
+        detail::cmpeq_epi64(xmm0.r0, xmm1.r0), detail::cmpeq_epi64(xmm0.r1, xmm1.r1),
+        detail::cmpeq_epi64(xmm0.r2, xmm1.r2), detail::cmpeq_epi64(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the != operator, the elements are 0 (false) or all bits set (true)
+ specialisation int64_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 1>::register_type
+_mm_ne<std::int64_t, cyme::avx, 1>(simd_trait<std::int64_t, cyme::avx, 1>::register_type xmm0,
+                                   simd_trait<std::int64_t, cyme::avx, 1>::register_type xmm1) {
+    return detail::cmpne_epi64(xmm0, xmm1);
+}
+
+/**
+ Evaluate the != operator, the elements are 0 (false) or all bits set (true)
+ specialisation int64_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 2>::register_type
+_mm_ne<std::int64_t, cyme::avx, 2>(simd_trait<std::int64_t, cyme::avx, 2>::register_type xmm0,
+                                   simd_trait<std::int64_t, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::avx, 2>::register_type(detail::cmpne_epi64(xmm0.r0, xmm1.r0),
+                                                                 detail::cmpne_epi64(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the != operator, the elements are 0 (false) or all bits set (true)
+ specialisation int64_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 4>::register_type
+_mm_ne<std::int64_t, cyme::avx, 4>(simd_trait<std::int64_t, cyme::avx, 4>::register_type xmm0,
+                                   simd_trait<std::int64_t, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::avx, 4>::register_type(
+        detail::cmpne_epi64(xmm0.r0, xmm1.r0), detail::cmpne_epi64(xmm0.r1, xmm1.r1),
+        detail::cmpne_epi64(xmm0.r2, xmm1.r2), detail::cmpne_epi64(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the < operator, the elements are 0 (false) or all bits set (true)
+ specialisation int64_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 1>::register_type
+_mm_lt<std::int64_t, cyme::avx, 1>(simd_trait<std::int64_t, cyme::avx, 1>::register_type xmm0,
+                                   simd_trait<std::int64_t, cyme::avx, 1>::register_type xmm1) {
+    return detail::cmplt_epi64(xmm0, xmm1);
+}
+
+/**
+ Evaluate the < operator, the elements are 0 (false) or all bits set (true)
+ specialisation int64_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 2>::register_type
+_mm_lt<std::int64_t, cyme::avx, 2>(simd_trait<std::int64_t, cyme::avx, 2>::register_type xmm0,
+                                   simd_trait<std::int64_t, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::avx, 2>::register_type(detail::cmplt_epi64(xmm0.r0, xmm1.r0),
+                                                                 detail::cmplt_epi64(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the < operator, the elements are 0 (false) or all bits set (true)
+ specialisation int64_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 4>::register_type
+_mm_lt<std::int64_t, cyme::avx, 4>(simd_trait<std::int64_t, cyme::avx, 4>::register_type xmm0,
+                                   simd_trait<std::int64_t, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::avx, 4>::register_type(
+        detail::cmplt_epi64(xmm0.r0, xmm1.r0), detail::cmplt_epi64(xmm0.r1, xmm1.r1),
+        detail::cmplt_epi64(xmm0.r2, xmm1.r2), detail::cmplt_epi64(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the <= operator, the elements are 0 (false) or all bits set (true)
+ specialisation int64_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 1>::register_type
+_mm_le<std::int64_t, cyme::avx, 1>(simd_trait<std::int64_t, cyme::avx, 1>::register_type xmm0,
+                                   simd_trait<std::int64_t, cyme::avx, 1>::register_type xmm1) {
+    return detail::cmple_epi64(xmm0, xmm1);
+}
+
+/**
+ Evaluate the <= operator, the elements are 0 (false) or all bits set (true)
+ specialisation int64_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 2>::register_type
+_mm_le<std::int64_t, cyme::avx, 2>(simd_trait<std::int64_t, cyme::avx, 2>::register_type xmm0,
+                                   simd_trait<std::int64_t, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::avx, 2>::register_type(detail::cmple_epi64(xmm0.r0, xmm1.r0),
+                                                                 detail::cmple_epi64(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the <= operator, the elements are 0 (false) or all bits set (true)
+ specialisation int64_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 4>::register_type
+_mm_le<std::int64_t, cyme::avx, 4>(simd_trait<std::int64_t, cyme::avx, 4>::register_type xmm0,
+                                   simd_trait<std::int64_t, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::avx, 4>::register_type(
+        detail::cmple_epi64(xmm0.r0, xmm1.r0), detail::cmple_epi64(xmm0.r1, xmm1.r1),
+        detail::cmple_epi64(xmm0.r2, xmm1.r2), detail::cmple_epi64(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the & operator between two registers
+ specialisation int64_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 1>::register_type
+_mm_and<std::int64_t, cyme::avx, 1>(simd_trait<std::int64_t, cyme::avx, 1>::register_type xmm0,
+                                    simd_trait<std::int64_t, cyme::avx, 1>::register_type xmm1) {
+    return detail::and_si(xmm0, xmm1);
+}
+
+/**
+ Evaluate the & operator between two registers
+ specialisation int64_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 2>::register_type
+_mm_and<std::int64_t, cyme::avx, 2>(simd_trait<std::int64_t, cyme::avx, 2>::register_type xmm0,
+                                    simd_trait<std::int64_t, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::avx, 2>::register_type(detail::and_si(xmm0.r0, xmm1.r0),
+                                                                 detail::and_si(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the & operator between two registers
+ specialisation int64_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 4>::register_type
+_mm_and<std::int64_t, cyme::avx, 4>(simd_trait<std::int64_t, cyme::avx, 4>::register_type xmm0,
+                                    simd_trait<std::int64_t, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::avx, 4>::register_type(
+        detail::and_si(xmm0.r0, xmm1.r0), detail::and_si(xmm0.r1, xmm1.r1), detail::and_si(xmm0.r2, xmm1.r2),
+        detail::and_si(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the | operator between two registers
+ specialisation int64_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 1>::register_type
+_mm_or<std::int64_t, cyme::avx, 1>(simd_trait<std::int64_t, cyme::avx, 1>::register_type xmm0,
+                                   simd_trait<std::int64_t, cyme::avx, 1>::register_type xmm1) {
+    return detail::or_si(xmm0, xmm1);
+}
+
+/**
+ Evaluate the | operator between two registers
+ specialisation int64_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 2>::register_type
+_mm_or<std::int64_t, cyme::avx, 2>(simd_trait<std::int64_t, cyme::avx, 2>::register_type xmm0,
+                                   simd_trait<std::int64_t, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::avx, 2>::register_type(detail::or_si(xmm0.r0, xmm1.r0),
+                                                                 detail::or_si(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the | operator between two registers
+ specialisation int64_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 4>::register_type
+_mm_or<std::int64_t, cyme::avx, 4>(simd_trait<std::int64_t, cyme::avx, 4>::register_type xmm0,
+                                   simd_trait<std::int64_t, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::avx, 4>::register_type(
+        detail::or_si(xmm0.r0, xmm1.r0), detail::or_si(xmm0.r1, xmm1.r1), detail::or_si(xmm0.r2, xmm1.r2),
+        detail::or_si(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the ^ operator between two registers
+ specialisation int64_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 1>::register_type
+_mm_xor<std::int64_t, cyme::avx, 1>(simd_trait<std::int64_t, cyme::avx, 1>::register_type xmm0,
+                                    simd_trait<std::int64_t, cyme::avx, 1>::register_type xmm1) {
+    return detail::xor_si(xmm0, xmm1);
+}
+
+/**
+ Evaluate the ^ operator between two registers
+ specialisation int64_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 2>::register_type
+_mm_xor<std::int64_t, cyme::avx, 2>(simd_trait<std::int64_t, cyme::avx, 2>::register_type xmm0,
+                                    simd_trait<std::int64_t, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::avx, 2>::register_type(detail::xor_si(xmm0.r0, xmm1.r0),
+                                                                 detail::xor_si(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the ^ operator between two registers
+ specialisation int64_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 4>::register_type
+_mm_xor<std::int64_t, cyme::avx, 4>(simd_trait<std::int64_t, cyme::avx, 4>::register_type xmm0,
+                                    simd_trait<std::int64_t, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::avx, 4>::register_type(
+        detail::xor_si(xmm0.r0, xmm1.r0), detail::xor_si(xmm0.r1, xmm1.r1), detail::xor_si(xmm0.r2, xmm1.r2),
+        detail::xor_si(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the ~ operator
+ specialisation int64_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 1>::register_type
+_mm_andnot<std::int64_t, cyme::avx, 1>(simd_trait<std::int64_t, cyme::avx, 1>::register_type xmm0) {
+    return detail::not_si(xmm0);
+}
+
+/**
+ Evaluate the ~ operator
+ specialisation int64_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 2>::register_type
+_mm_andnot<std::int64_t, cyme::avx, 2>(simd_trait<std::int64_t, cyme::avx, 2>::register_type xmm0) {
+    return simd_trait<std::int64_t, cyme::avx, 2>::register_type(detail::not_si(xmm0.r0), detail::not_si(xmm0.r1));
+}
+
+/**
+ Evaluate the ~ operator
+ specialisation int64_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::avx, 4>::register_type
+_mm_andnot<std::int64_t, cyme::avx, 4>(simd_trait<std::int64_t, cyme::avx, 4>::register_type xmm0) {
+    return simd_trait<std::int64_t, cyme::avx, 4>::register_type(detail::not_si(xmm0.r0), detail::not_si(xmm0.r1),
+                                                                 detail::not_si(xmm0.r2), detail::not_si(xmm0.r3));
+}
+
+/**
+ Convert the 64 bits integers to double, rounded to the nearest
+ specialisation int64_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::avx, 1>::register_type
+_mm_cvt<std::int64_t, cyme::avx, 1, double>(simd_trait<std::int64_t, cyme::avx, 1>::register_type xmm0) {
+    return detail::cvtepi64_pd(xmm0);
+}
+
+/**
+ Convert the 64 bits integers to double, rounded to the nearest
+ specialisation int64_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::avx, 2>::register_type
+_mm_cvt<std::int64_t, cyme::avx, 2, double>(simd_trait<std::int64_t, cyme::avx, 2>::register_type xmm0) {
+    return simd_trait<double, cyme::avx, 2>::register_type(detail::cvtepi64_pd(xmm0.r0), detail::cvtepi64_pd(xmm0.r1));
+}
+
+/**
+ Convert the 64 bits integers to double, rounded to the nearest
+ specialisation int64_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::avx, 4>::register_type
+_mm_cvt<std::int64_t, cyme::avx, 4, double>(simd_trait<std::int64_t, cyme::avx, 4>::register_type xmm0) {
+    return simd_trait<double, cyme::avx, 4>::register_type(detail::cvtepi64_pd(xmm0.r0), detail::cvtepi64_pd(xmm0.r1),
+                                                           detail::cvtepi64_pd(xmm0.r2), detail::cvtepi64_pd(xmm0.r3));
+}
+
+/**
+ Load a 32 bits unsigned integer into all the elements of the registers
+ specialisation uint32_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 1>::register_type
+_mm_load1<std::uint32_t, cyme::avx, 1>(const simd_trait<std::uint32_t, cyme::avx, 1>::value_type &a) {
+    return _mm256_set1_epi32(a);
+}
+
+/**
+ Load a 32 bits unsigned integer into all the elements of the registers
+ specialisation uint32_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 2>::register_type
+_mm_load1<std::uint32_t, cyme::avx, 2>(const simd_trait<std::uint32_t, cyme::avx, 2>::value_type &a) {
+    return simd_trait<std::uint32_t, cyme::avx, 2>::register_type(_mm256_set1_epi32(a), _mm256_set1_epi32(a));
+}
+
+/**
+ Load a 32 bits unsigned integer into all the elements of the registers
+ specialisation uint32_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 4>::register_type
+_mm_load1<std::uint32_t, cyme::avx, 4>(const simd_trait<std::uint32_t, cyme::avx, 4>::value_type &a) {
+    return simd_trait<std::uint32_t, cyme::avx, 4>::register_type(_mm256_set1_epi32(a), _mm256_set1_epi32(a),
+                                                                  _mm256_set1_epi32(a), _mm256_set1_epi32(a));
+}
+
+/**
+ Load the 32 bits unsigned integers from cyme (aligned)
+ specialisation uint32_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 1>::register_type
+_mm_load<std::uint32_t, cyme::avx, 1>(simd_trait<std::uint32_t, cyme::avx, 1>::const_pointer a) {
+    return _mm256_load_si256((__m256i *)a);
+}
+
+/**
+ Load the 32 bits unsigned integers from cyme (aligned)
+ specialisation uint32_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 2>::register_type
+_mm_load<std::uint32_t, cyme::avx, 2>(simd_trait<std::uint32_t, cyme::avx, 2>::const_pointer a) {
+    return simd_trait<std::uint32_t, cyme::avx, 2>::register_type(_mm256_load_si256((__m256i *)a),
+                                                                  _mm256_load_si256((__m256i *)(a + 8)));
+}
+
+/**
+ Load the 32 bits unsigned integers from cyme (aligned)
+ specialisation uint32_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 4>::register_type
+_mm_load<std::uint32_t, cyme::avx, 4>(simd_trait<std::uint32_t, cyme::avx, 4>::const_pointer a) {
+    return simd_trait<std::uint32_t, cyme::avx, 4>::register_type(
+        _mm256_load_si256((__m256i *)a), _mm256_load_si256((__m256i *)(a + 8)),
+        _mm256_load_si256((__m256i *)(a + 16)), _mm256_load_si256((__m256i *)(a + 24)));
+}
+
+/**
+ Store the 32 bits unsigned integers into cyme (aligned)
+ specialisation uint32_t,cyme::avx,1 regs
+ */
+template <>
+forceinline void
+_mm_store<std::uint32_t, cyme::avx, 1>(simd_trait<std::uint32_t, cyme::avx, 1>::register_type xmm0,
+                                       simd_trait<std::uint32_t, cyme::avx, 1>::pointer a) {
+    _mm256_store_si256((__m256i *)a, xmm0);
+}
+
+/**
+ Store the 32 bits unsigned integers into cyme (aligned)
+ specialisation uint32_t,cyme::avx,2 regs
+ */
+template <>
+forceinline void
+_mm_store<std::uint32_t, cyme::avx, 2>(simd_trait<std::uint32_t, cyme::avx, 2>::register_type xmm0,
+                                       simd_trait<std::uint32_t, cyme::avx, 2>::pointer a) {
+    _mm256_store_si256((__m256i *)a, xmm0.r0);
+    _mm256_store_si256((__m256i *)(a + 8), xmm0.r1);
+}
+
+/**
+ Store the 32 bits unsigned integers into cyme (aligned)
+ specialisation uint32_t,cyme::avx,4 regs
+ */
+template <>
+forceinline void
+_mm_store<std::uint32_t, cyme::avx, 4>(simd_trait<std::uint32_t, cyme::avx, 4>::register_type xmm0,
+                                       simd_trait<std::uint32_t, cyme::avx, 4>::pointer a) {
+    _mm256_store_si256((__m256i *)a, xmm0.r0);
+    _mm256_store_si256((__m256i *)(a + 8), xmm0.r1);
+    _mm256_store_si256((__m256i *)(a + 16), xmm0.r2);
+    _mm256_store_si256((__m256i *)(a + 24), xmm0.r3);
+}
+
+/**
+ Add the 32 bits unsigned integers
+ specialisation uint32_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 1>::register_type
+_mm_add<std::uint32_t, cyme::avx, 1>(simd_trait<std::uint32_t, cyme::avx, 1>::register_type xmm0,
+                                     simd_trait<std::uint32_t, cyme::avx, 1>::register_type xmm1) {
+    return detail::add_epi32(xmm0, xmm1);
+}
+
+/**
+ Add the 32 bits unsigned integers
+ specialisation uint32_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 2>::register_type
+_mm_add<std::uint32_t, cyme::avx, 2>(simd_trait<std::uint32_t, cyme::avx, 2>::register_type xmm0,
+                                     simd_trait<std::uint32_t, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::avx, 2>::register_type(detail::add_epi32(xmm0.r0, xmm1.r0),
+                                                                  detail::add_epi32(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Add the 32 bits unsigned integers
+ specialisation uint32_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 4>::register_type
+_mm_add<std::uint32_t, cyme::avx, 4>(simd_trait<std::uint32_t, cyme::avx, 4>::register_type xmm0,
+                                     simd_trait<std::uint32_t, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::avx, 4>::register_type(
+        detail::add_epi32(xmm0.r0, xmm1.r0), detail::add_epi32(xmm0.r1, xmm1.r1), detail::add_epi32(xmm0.r2, xmm1.r2),
+        detail::add_epi32(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Subtract the 32 bits unsigned integers, xmm0 - xmm1
+ specialisation uint32_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 1>::register_type
+_mm_sub<std::uint32_t, cyme::avx, 1>(simd_trait<std::uint32_t, cyme::avx, 1>::register_type xmm0,
+                                     simd_trait<std::uint32_t, cyme::avx, 1>::register_type xmm1) {
+    return detail::sub_epi32(xmm0, xmm1);
+}
+
+/**
+ Subtract the 32 bits unsigned integers, xmm0 - xmm1
+ specialisation uint32_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 2>::register_type
+_mm_sub<std::uint32_t, cyme::avx, 2>(simd_trait<std::uint32_t, cyme::avx, 2>::register_type xmm0,
+                                     simd_trait<std::uint32_t, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::avx, 2>::register_type(detail::sub_epi32(xmm0.r0, xmm1.r0),
+                                                                  detail::sub_epi32(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Subtract the 32 bits unsigned integers, xmm0 - xmm1
+ specialisation uint32_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 4>::register_type
+_mm_sub<std::uint32_t, cyme::avx, 4>(simd_trait<std::uint32_t, cyme::avx, 4>::register_type xmm0,
+                                     simd_trait<std::uint32_t, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::avx, 4>::register_type(
+        detail::sub_epi32(xmm0.r0, xmm1.r0), detail::sub_epi32(xmm0.r1, xmm1.r1), detail::sub_epi32(xmm0.r2, xmm1.r2),
+        detail::sub_epi32(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Multiply the 32 bits unsigned integers, the low 32 bits of the products
+ specialisation uint32_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 1>::register_type
+_mm_mul<std::uint32_t, cyme::avx, 1>(simd_trait<std::uint32_t, cyme::avx, 1>::register_type xmm0,
+                                     simd_trait<std::uint32_t, cyme::avx, 1>::register_type xmm1) {
+    return detail::mullo_epi32(xmm0, xmm1);
+}
+
+/**
+ Multiply the 32 bits unsigned integers, the low 32 bits of the products
+ specialisation uint32_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 2>::register_type
+_mm_mul<std::uint32_t, cyme::avx, 2>(simd_trait<std::uint32_t, cyme::avx, 2>::register_type xmm0,
+                                     simd_trait<std::uint32_t, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::avx, 2>::register_type(detail::mullo_epi32(xmm0.r0, xmm1.r0),
+                                                                  detail::mullo_epi32(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Multiply the 32 bits unsigned integers, the low 32 bits of the products
+ specialisation uint32_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 4>::register_type
+_mm_mul<std::uint32_t, cyme::avx, 4>(simd_trait<std::uint32_t, cyme::avx, 4>::register_type xmm0,
+                                     simd_trait<std::uint32_t, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::avx, 4>::register_type(
+        detail::mullo_epi32(xmm0.r0, xmm1.r0), detail::mullo_epi32(xmm0.r1, xmm1.r1),
+        detail::mullo_epi32(xmm0.r2, xmm1.r2), detail::mullo_epi32(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the << operator, the shift is the first element of xmm1
+ specialisation uint32_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 1>::register_type
+_mm_sll<std::uint32_t, cyme::avx, 1>(simd_trait<std::uint32_t, cyme::avx, 1>::register_type xmm0,
+                                     simd_trait<std::uint32_t, cyme::avx, 1>::register_type xmm1) {
+    return detail::sll_epi32(xmm0, xmm1);
+}
+
+/**
+ Evaluate the << operator, the shift is the first element of xmm1
+ specialisation uint32_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 2>::register_type
+_mm_sll<std::uint32_t, cyme::avx, 2>(simd_trait<std::uint32_t, cyme::avx, 2>::register_type xmm0,
+                                     simd_trait<std::uint32_t, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::avx, 2>::register_type(detail::sll_epi32(xmm0.r0, xmm1.r0),
+                                                                  detail::sll_epi32(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the << operator, the shift is the first element of xmm1
+ specialisation uint32_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 4>::register_type
+_mm_sll<std::uint32_t, cyme::avx, 4>(simd_trait<std::uint32_t, cyme::avx, 4>::register_type xmm0,
+                                     simd_trait<std::uint32_t, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::avx, 4>::register_type(
+        detail::sll_epi32(xmm0.r0, xmm1.r0), detail::sll_epi32(xmm0.r1, xmm1.r1), detail::sll_epi32(xmm0.r2, xmm1.r2),
+        detail::sll_epi32(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the >> operator, the shift is the first element of xmm1
+ specialisation uint32_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 1>::register_type
+_mm_srl<std::uint32_t, cyme::avx, 1>(simd_trait<std::uint32_t, cyme::avx, 1>::register_type xmm0,
+                                     simd_trait<std::uint32_t, cyme::avx, 1>::register_type xmm1) {
+    return detail::srl_epi32(xmm0, xmm1);
+}
+
+/**
+ Evaluate the >> operator, the shift is the first element of xmm1
+ specialisation uint32_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 2>::register_type
+_mm_srl<std::uint32_t, cyme::avx, 2>(simd_trait<std::uint32_t, cyme::avx, 2>::register_type xmm0,
+                                     simd_trait<std::uint32_t, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::avx, 2>::register_type(detail::srl_epi32(xmm0.r0, xmm1.r0),
+                                                                  detail::srl_epi32(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the >> operator, the shift is the first element of xmm1
+ specialisation uint32_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 4>::register_type
+_mm_srl<std::uint32_t, cyme::avx, 4>(simd_trait<std::uint32_t, cyme::avx, 4>::register_type xmm0,
+                                     simd_trait<std::uint32_t, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::avx, 4>::register_type(
+        detail::srl_epi32(xmm0.r0, xmm1.r0), detail::srl_epi32(xmm0.r1, xmm1.r1), detail::srl_epi32(xmm0.r2, xmm1.r2),
+        detail::srl_epi32(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the == operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint32_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 1>::register_type
+_mm_eq<std::uint32_t, cyme::avx, 1>(simd_trait<std::uint32_t, cyme::avx, 1>::register_type xmm0,
+                                    simd_trait<std::uint32_t, cyme::avx, 1>::register_type xmm1) {
+    return detail::cmpeq_epi32(xmm0, xmm1);
+}
+
+/**
+ Evaluate the == operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint32_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 2>::register_type
+_mm_eq<std::uint32_t, cyme::avx, 2>(simd_trait<std::uint32_t, cyme::avx, 2>::register_type xmm0,
+                                    simd_trait<std::uint32_t, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::avx, 2>::register_type(detail::cmpeq_epi32(xmm0.r0, xmm1.r0),
+                                                                  detail::cmpeq_epi32(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the == operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint32_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 4>::register_type
+_mm_eq<std::uint32_t, cyme::avx, 4>(simd_trait<std::uint32_t, cyme::avx, 4>::register_type xmm0,
+                                    simd_trait<std::uint32_t, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::avx, 4>::register_type(
+        detail::cmpeq_epi32(xmm0.r0, xmm1.r0), detail::cmpeq_epi32(xmm0.r1, xmm1.r1),
+        detail::cmpeq_epi32(xmm0.r2, xmm1.r2), detail::cmpeq_epi32(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the != operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint32_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 1>::register_type
+_mm_ne<std::uint32_t, cyme::avx, 1>(simd_trait<std::uint32_t, cyme::avx, 1>::register_type xmm0,
+                                    simd_trait<std::uint32_t, cyme::avx, 1>::register_type xmm1) {
+    return detail::cmpne_epi32(xmm0, xmm1);
+}
+
+/**
+ Evaluate the != operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint32_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 2>::register_type
+_mm_ne<std::uint32_t, cyme::avx, 2>(simd_trait<std::uint32_t, cyme::avx, 2>::register_type xmm0,
+                                    simd_trait<std::uint32_t, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::avx, 2>::register_type(detail::cmpne_epi32(xmm0.r0, xmm1.r0),
+                                                                  detail::cmpne_epi32(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the != operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint32_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 4>::register_type
+_mm_ne<std::uint32_t, cyme::avx, 4>(simd_trait<std::uint32_t, cyme::avx, 4>::register_type xmm0,
+                                    simd_trait<std::uint32_t, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::avx, 4>::register_type(
+        detail::cmpne_epi32(xmm0.r0, xmm1.r0), detail::cmpne_epi32(xmm0.r1, xmm1.r1),
+        detail::cmpne_epi32(xmm0.r2, xmm1.r2), detail::cmpne_epi32(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the < operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint32_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 1>::register_type
+_mm_lt<std::uint32_t, cyme::avx, 1>(simd_trait<std::uint32_t, cyme::avx, 1>::register_type xmm0,
+                                    simd_trait<std::uint32_t, cyme::avx, 1>::register_type xmm1) {
+    return detail::cmplt_epu32(xmm0, xmm1);
+}
+
+/**
+ Evaluate the < operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint32_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 2>::register_type
+_mm_lt<std::uint32_t, cyme::avx, 2>(simd_trait<std::uint32_t, cyme::avx, 2>::register_type xmm0,
+                                    simd_trait<std::uint32_t, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::avx, 2>::register_type(detail::cmplt_epu32(xmm0.r0, xmm1.r0),
+                                                                  detail::cmplt_epu32(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the < operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint32_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 4>::register_type
+_mm_lt<std::uint32_t, cyme::avx, 4>(simd_trait<std::uint32_t, cyme::avx, 4>::register_type xmm0,
+                                    simd_trait<std::uint32_t, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::avx, 4>::register_type(
+        detail::cmplt_epu32(xmm0.r0, xmm1.r0), detail::cmplt_epu32(xmm0.r1, xmm1.r1),
+        detail::cmplt_epu32(xmm0.r2, xmm1.r2), detail::cmplt_epu32(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the <= operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint32_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 1>::register_type
+_mm_le<std::uint32_t, cyme::avx, 1>(simd_trait<std::uint32_t, cyme::avx, 1>::register_type xmm0,
+                                    simd_trait<std::uint32_t, cyme::avx, 1>::register_type xmm1) {
+    return detail::cmple_epu32(xmm0, xmm1);
+}
+
+/**
+ Evaluate the <= operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint32_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 2>::register_type
+_mm_le<std::uint32_t, cyme::avx, 2>(simd_trait<std::uint32_t, cyme::avx, 2>::register_type xmm0,
+                                    simd_trait<std::uint32_t, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::avx, 2>::register_type(detail::cmple_epu32(xmm0.r0, xmm1.r0),
+                                                                  detail::cmple_epu32(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the <= operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint32_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 4>::register_type
+_mm_le<std::uint32_t, cyme::avx, 4>(simd_trait<std::uint32_t, cyme::avx, 4>::register_type xmm0,
+                                    simd_trait<std::uint32_t, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::avx, 4>::register_type(
+        detail::cmple_epu32(xmm0.r0, xmm1.r0), detail::cmple_epu32(xmm0.r1, xmm1.r1),
+        detail::cmple_epu32(xmm0.r2, xmm1.r2), detail::cmple_epu32(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the & operator between two registers
+ specialisation uint32_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 1>::register_type
+_mm_and<std::uint32_t, cyme::avx, 1>(simd_trait<std::uint32_t, cyme::avx, 1>::register_type xmm0,
+                                     simd_trait<std::uint32_t, cyme::avx, 1>::register_type xmm1) {
+    return detail::and_si(xmm0, xmm1);
+}
+
+/**
+ Evaluate the & operator between two registers
+ specialisation uint32_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 2>::register_type
+_mm_and<std::uint32_t, cyme::avx, 2>(simd_trait<std::uint32_t, cyme::avx, 2>::register_type xmm0,
+                                     simd_trait<std::uint32_t, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::avx, 2>::register_type(detail::and_si(xmm0.r0, xmm1.r0),
+                                                                  detail::and_si(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the & operator between two registers
+ specialisation uint32_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 4>::register_type
+_mm_and<std::uint32_t, cyme::avx, 4>(simd_trait<std::uint32_t, cyme::avx, 4>::register_type xmm0,
+                                     simd_trait<std::uint32_t, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::avx, 4>::register_type(
+        detail::and_si(xmm0.r0, xmm1.r0), detail::and_si(xmm0.r1, xmm1.r1), detail::and_si(xmm0.r2, xmm1.r2),
+        detail::and_si(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the | operator between two registers
+ specialisation uint32_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 1>::register_type
+_mm_or<std::uint32_t, cyme::avx, 1>(simd_trait<std::uint32_t, cyme::avx, 1>::register_type xmm0,
+                                    simd_trait<std::uint32_t, cyme::avx, 1>::register_type xmm1) {
+    return detail::or_si(xmm0, xmm1);
+}
+
+/**
+ Evaluate the | operator between two registers
+ specialisation uint32_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 2>::register_type
+_mm_or<std::uint32_t, cyme::avx, 2>(simd_trait<std::uint32_t, cyme::avx, 2>::register_type xmm0,
+                                    simd_trait<std::uint32_t, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::avx, 2>::register_type(detail::or_si(xmm0.r0, xmm1.r0),
+                                                                  detail::or_si(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the | operator between two registers
+ specialisation uint32_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 4>::register_type
+_mm_or<std::uint32_t, cyme::avx, 4>(simd_trait<std::uint32_t, cyme::avx, 4>::register_type xmm0,
+                                    simd_trait<std::uint32_t, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::avx, 4>::register_type(
+        detail::or_si(xmm0.r0, xmm1.r0), detail::or_si(xmm0.r1, xmm1.r1), detail::or_si(xmm0.r2, xmm1.r2),
+        detail::or_si(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the ^ operator between two registers
+ specialisation uint32_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 1>::register_type
+_mm_xor<std::uint32_t, cyme::avx, 1>(simd_trait<std::uint32_t, cyme::avx, 1>::register_type xmm0,
+                                     simd_trait<std::uint32_t, cyme::avx, 1>::register_type xmm1) {
+    return detail::xor_si(xmm0, xmm1);
+}
+
+/**
+ Evaluate the ^ operator between two registers
+ specialisation uint32_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 2>::register_type
+_mm_xor<std::uint32_t, cyme::avx, 2>(simd_trait<std::uint32_t, cyme::avx, 2>::register_type xmm0,
+                                     simd_trait<std::uint32_t, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::avx, 2>::register_type(detail::xor_si(xmm0.r0, xmm1.r0),
+                                                                  detail::xor_si(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the ^ operator between two registers
+ specialisation uint32_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 4>::register_type
+_mm_xor<std::uint32_t, cyme::avx, 4>(simd_trait<std::uint32_t, cyme::avx, 4>::register_type xmm0,
+                                     simd_trait<std::uint32_t, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::avx, 4>::register_type(
+        detail::xor_si(xmm0.r0, xmm1.r0), detail::xor_si(xmm0.r1, xmm1.r1), detail::xor_si(xmm0.r2, xmm1.r2),
+        detail::xor_si(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the ~ operator
+ specialisation uint32_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 1>::register_type
+_mm_andnot<std::uint32_t, cyme::avx, 1>(simd_trait<std::uint32_t, cyme::avx, 1>::register_type xmm0) {
+    return detail::not_si(xmm0);
+}
+
+/**
+ Evaluate the ~ operator
+ specialisation uint32_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 2>::register_type
+_mm_andnot<std::uint32_t, cyme::avx, 2>(simd_trait<std::uint32_t, cyme::avx, 2>::register_type xmm0) {
+    return simd_trait<std::uint32_t, cyme::avx, 2>::register_type(detail::not_si(xmm0.r0), detail::not_si(xmm0.r1));
+}
+
+/**
+ Evaluate the ~ operator
+ specialisation uint32_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::avx, 4>::register_type
+_mm_andnot<std::uint32_t, cyme::avx, 4>(simd_trait<std::uint32_t, cyme::avx, 4>::register_type xmm0) {
+    return simd_trait<std::uint32_t, cyme::avx, 4>::register_type(detail::not_si(xmm0.r0), detail::not_si(xmm0.r1),
+                                                                  detail::not_si(xmm0.r2), detail::not_si(xmm0.r3));
+}
+
+/**
+ Convert the 32 bits unsigned integers to float, rounded to the nearest
+ specialisation uint32_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<float, cyme::avx, 1>::register_type
+_mm_cvt<std::uint32_t, cyme::avx, 1, float>(simd_trait<std::uint32_t, cyme::avx, 1>::register_type xmm0) {
+    return detail::cvtepu32_ps(xmm0);
+}
+
+/**
+ Convert the 32 bits unsigned integers to float, rounded to the nearest
+ specialisation uint32_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<float, cyme::avx, 2>::register_type
+_mm_cvt<std::uint32_t, cyme::avx, 2, float>(simd_trait<std::uint32_t, cyme::avx, 2>::register_type xmm0) {
+    return simd_trait<float, cyme::avx, 2>::register_type(detail::cvtepu32_ps(xmm0.r0), detail::cvtepu32_ps(xmm0.r1));
+}
+
+/**
+ Convert the 32 bits unsigned integers to float, rounded to the nearest
+ specialisation uint32_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<float, cyme::avx, 4>::register_type
+_mm_cvt<std::uint32_t, cyme::avx, 4, float>(simd_trait<std::uint32_t, cyme::avx, 4>::register_type xmm0) {
+    return simd_trait<float, cyme::avx, 4>::register_type(detail::cvtepu32_ps(xmm0.r0), detail::cvtepu32_ps(xmm0.r1),
+                                                          detail::cvtepu32_ps(xmm0.r2), detail::cvtepu32_ps(xmm0.r3));
+}
+
+/**
+ Load a 64 bits unsigned integer into all the elements of the registers
+ specialisation uint64_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 1>::register_type
+_mm_load1<std::uint64_t, cyme::avx, 1>(const simd_trait<std::uint64_t, cyme::avx, 1>::value_type &a) {
+    return _mm256_set1_epi64x(a);
+}
+
+/**
+ Load a 64 bits unsigned integer into all the elements of the registers
+ specialisation uint64_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 2>::register_type
+_mm_load1<std::uint64_t, cyme::avx, 2>(const simd_trait<std::uint64_t, cyme::avx, 2>::value_type &a) {
+    return simd_trait<std::uint64_t, cyme::avx, 2>::register_type(_mm256_set1_epi64x(a), _mm256_set1_epi64x(a));
+}
+
+/**
+ Load a 64 bits unsigned integer into all the elements of the registers
+ specialisation uint64_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 4>::register_type
+_mm_load1<std::uint64_t, cyme::avx, 4>(const simd_trait<std::uint64_t, cyme::avx, 4>::value_type &a) {
+    return simd_trait<std::uint64_t, cyme::avx, 4>::register_type(_mm256_set1_epi64x(a), _mm256_set1_epi64x(a),
+                                                                  _mm256_set1_epi64x(a), _mm256_set1_epi64x(a));
+}
+
+/**
+ Load the 64 bits unsigned integers from cyme (aligned)
+ specialisation uint64_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 1>::register_type
+_mm_load<std::uint64_t, cyme::avx, 1>(simd_trait<std::uint64_t, cyme::avx, 1>::const_pointer a) {
+    return _mm256_load_si256((__m256i *)a);
+}
+
+/**
+ Load the 64 bits unsigned integers from cyme (aligned)
+ specialisation uint64_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 2>::register_type
+_mm_load<std::uint64_t, cyme::avx, 2>(simd_trait<std::uint64_t, cyme::avx, 2>::const_pointer a) {
+    return simd_trait<std::uint64_t, cyme::avx, 2>::register_type(_mm256_load_si256((__m256i *)a),
+                                                                  _mm256_load_si256((__m256i *)(a + 4)));
+}
+
+/**
+ Load the 64 bits unsigned integers from cyme (aligned)
+ specialisation uint64_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 4>::register_type
+_mm_load<std::uint64_t, cyme::avx, 4>(simd_trait<std::uint64_t, cyme::avx, 4>::const_pointer a) {
+    return simd_trait<std::uint64_t, cyme::avx, 4>::register_type(
+        _mm256_load_si256((__m256i *)a), _mm256_load_si256((__m256i *)(a + 4)), _mm256_load_si256((__m256i *)(a + 8)),
+        _mm256_load_si256((__m256i *)(a + 12)));
+}
+
+/**
+ Store the 64 bits unsigned integers into cyme (aligned)
+ specialisation uint64_t,cyme::avx,1 regs
+ */
+template <>
+forceinline void
+_mm_store<std::uint64_t, cyme::avx, 1>(simd_trait<std::uint64_t, cyme::avx, 1>::register_type xmm0,
+                                       simd_trait<std::uint64_t, cyme::avx, 1>::pointer a) {
+    _mm256_store_si256((__m256i *)a, xmm0);
+}
+
+/**
+ Store the 64 bits unsigned integers into cyme (aligned)
+ specialisation uint64_t,cyme::avx,2 regs
+ */
+template <>
+forceinline void
+_mm_store<std::uint64_t, cyme::avx, 2>(simd_trait<std::uint64_t, cyme::avx, 2>::register_type xmm0,
+                                       simd_trait<std::uint64_t, cyme::avx, 2>::pointer a) {
+    _mm256_store_si256((__m256i *)a, xmm0.r0);
+    _mm256_store_si256((__m256i *)(a + 4), xmm0.r1);
+}
+
+/**
+ Store the 64 bits unsigned integers into cyme (aligned)
+ specialisation uint64_t,cyme::avx,4 regs
+ */
+template <>
+forceinline void
+_mm_store<std::uint64_t, cyme::avx, 4>(simd_trait<std::uint64_t, cyme::avx, 4>::register_type xmm0,
+                                       simd_trait<std::uint64_t, cyme::avx, 4>::pointer a) {
+    _mm256_store_si256((__m256i *)a, xmm0.r0);
+    _mm256_store_si256((__m256i *)(a + 4), xmm0.r1);
+    _mm256_store_si256((__m256i *)(a + 8), xmm0.r2);
+    _mm256_store_si256((__m256i *)(a + 12), xmm0.r3);
+}
+
+/**
+ Add the 64 bits unsigned integers
+ specialisation uint64_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 1>::register_type
+_mm_add<std::uint64_t, cyme::avx, 1>(simd_trait<std::uint64_t, cyme::avx, 1>::register_type xmm0,
+                                     simd_trait<std::uint64_t, cyme::avx, 1>::register_type xmm1) {
+    return detail::add_epi64(xmm0, xmm1);
+}
+
+/**
+ Add the 64 bits unsigned integers
+ specialisation uint64_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 2>::register_type
+_mm_add<std::uint64_t, cyme::avx, 2>(simd_trait<std::uint64_t, cyme::avx, 2>::register_type xmm0,
+                                     simd_trait<std::uint64_t, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::avx, 2>::register_type(detail::add_epi64(xmm0.r0, xmm1.r0),
+                                                                  detail::add_epi64(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Add the 64 bits unsigned integers
+ specialisation uint64_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 4>::register_type
+_mm_add<std::uint64_t, cyme::avx, 4>(simd_trait<std::uint64_t, cyme::avx, 4>::register_type xmm0,
+                                     simd_trait<std::uint64_t, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::avx, 4>::register_type(
+        detail::add_epi64(xmm0.r0, xmm1.r0), detail::add_epi64(xmm0.r1, xmm1.r1), detail::add_epi64(xmm0.r2, xmm1.r2),
+        detail::add_epi64(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Subtract the 64 bits unsigned integers, xmm0 - xmm1
+ specialisation uint64_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 1>::register_type
+_mm_sub<std::uint64_t, cyme::avx, 1>(simd_trait<std::uint64_t, cyme::avx, 1>::register_type xmm0,
+                                     simd_trait<std::uint64_t, cyme::avx, 1>::register_type xmm1) {
+    return detail::sub_epi64(xmm0, xmm1);
+}
+
+/**
+ Subtract the 64 bits unsigned integers, xmm0 - xmm1
+ specialisation uint64_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 2>::register_type
+_mm_sub<std::uint64_t, cyme::avx, 2>(simd_trait<std::uint64_t, cyme::avx, 2>::register_type xmm0,
+                                     simd_trait<std::uint64_t, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::avx, 2>::register_type(detail::sub_epi64(xmm0.r0, xmm1.r0),
+                                                                  detail::sub_epi64(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Subtract the 64 bits unsigned integers, xmm0 - xmm1
+ specialisation uint64_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 4>::register_type
+_mm_sub<std::uint64_t, cyme::avx, 4>(simd_trait<std::uint64_t, cyme::avx, 4>::register_type xmm0,
+                                     simd_trait<std::uint64_t, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::avx, 4>::register_type(
+        detail::sub_epi64(xmm0.r0, xmm1.r0), detail::sub_epi64(xmm0.r1, xmm1.r1), detail::sub_epi64(xmm0.r2, xmm1.r2),
+        detail::sub_epi64(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Multiply the 64 bits unsigned integers, the low 64 bits of the products
+ specialisation uint64_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 1>::register_type
+_mm_mul<std::uint64_t, cyme::avx, 1>(simd_trait<std::uint64_t, cyme::avx, 1>::register_type xmm0,
+                                     simd_trait<std::uint64_t, cyme::avx, 1>::register_type xmm1) {
+    return detail::mullo_epi64(xmm0, xmm1);
+}
+
+/**
+ Multiply the 64 bits unsigned integers, the low 64 bits of the products
+ specialisation uint64_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 2>::register_type
+_mm_mul<std::uint64_t, cyme::avx, 2>(simd_trait<std::uint64_t, cyme::avx, 2>::register_type xmm0,
+                                     simd_trait<std::uint64_t, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::avx, 2>::register_type(detail::mullo_epi64(xmm0.r0, xmm1.r0),
+                                                                  detail::mullo_epi64(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Multiply the 64 bits unsigned integers, the low 64 bits of the products
+ specialisation uint64_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 4>::register_type
+_mm_mul<std::uint64_t, cyme::avx, 4>(simd_trait<std::uint64_t, cyme::avx, 4>::register_type xmm0,
+                                     simd_trait<std::uint64_t, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::avx, 4>::register_type(
+        detail::mullo_epi64(xmm0.r0, xmm1.r0), detail::mullo_epi64(xmm0.r1, xmm1.r1),
+        detail::mullo_epi64(xmm0.r2, xmm1.r2), detail::mullo_epi64(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the << operator, the shift is the first element of xmm1
+ specialisation uint64_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 1>::register_type
+_mm_sll<std::uint64_t, cyme::avx, 1>(simd_trait<std::uint64_t, cyme::avx, 1>::register_type xmm0,
+                                     simd_trait<std::uint64_t, cyme::avx, 1>::register_type xmm1) {
+    return detail::sll_epi64(xmm0, xmm1);
+}
+
+/**
+ Evaluate the << operator, the shift is the first element of xmm1
+ specialisation uint64_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 2>::register_type
+_mm_sll<std::uint64_t, cyme::avx, 2>(simd_trait<std::uint64_t, cyme::avx, 2>::register_type xmm0,
+                                     simd_trait<std::uint64_t, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::avx, 2>::register_type(detail::sll_epi64(xmm0.r0, xmm1.r0),
+                                                                  detail::sll_epi64(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the << operator, the shift is the first element of xmm1
+ specialisation uint64_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 4>::register_type
+_mm_sll<std::uint64_t, cyme::avx, 4>(simd_trait<std::uint64_t, cyme::avx, 4>::register_type xmm0,
+                                     simd_trait<std::uint64_t, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::avx, 4>::register_type(
+        detail::sll_epi64(xmm0.r0, xmm1.r0), detail::sll_epi64(xmm0.r1, xmm1.r1), detail::sll_epi64(xmm0.r2, xmm1.r2),
+        detail::sll_epi64(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the >> operator, the shift is the first element of xmm1
+ specialisation uint64_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 1>::register_type
+_mm_srl<std::uint64_t, cyme::avx, 1>(simd_trait<std::uint64_t, cyme::avx, 1>::register_type xmm0,
+                                     simd_trait<std::uint64_t, cyme::avx, 1>::register_type xmm1) {
+    return detail::srl_epi64(xmm0, xmm1);
+}
+
+/**
+ Evaluate the >> operator, the shift is the first element of xmm1
+ specialisation uint64_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 2>::register_type
+_mm_srl<std::uint64_t, cyme::avx, 2>(simd_trait<std::uint64_t, cyme::avx, 2>::register_type xmm0,
+                                     simd_trait<std::uint64_t, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::avx, 2>::register_type(detail::srl_epi64(xmm0.r0, xmm1.r0),
+                                                                  detail::srl_epi64(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the >> operator, the shift is the first element of xmm1
+ specialisation uint64_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 4>::register_type
+_mm_srl<std::uint64_t, cyme::avx, 4>(simd_trait<std::uint64_t, cyme::avx, 4>::register_type xmm0,
+                                     simd_trait<std::uint64_t, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::avx, 4>::register_type(
+        detail::srl_epi64(xmm0.r0, xmm1.r0), detail::srl_epi64(xmm0.r1, xmm1.r1), detail::srl_epi64(xmm0.r2, xmm1.r2),
+        detail::srl_epi64(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the == operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint64_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 1>::register_type
+_mm_eq<std::uint64_t, cyme::avx, 1>(simd_trait<std::uint64_t, cyme::avx, 1>::register_type xmm0,
+                                    simd_trait<std::uint64_t, cyme::avx, 1>::register_type xmm1) {
+    return detail::cmpeq_epi64(xmm0, xmm1);
+}
+
+/**
+ Evaluate the == operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint64_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 2>::register_type
+_mm_eq<std::uint64_t, cyme::avx, 2>(simd_trait<std::uint64_t, cyme::avx, 2>::register_type xmm0,
+                                    simd_trait<std::uint64_t, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::avx, 2>::register_type(detail::cmpeq_epi64(xmm0.r0, xmm1.r0),
+                                                                  detail::cmpeq_epi64(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the == operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint64_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 4>::register_type
+_mm_eq<std::uint64_t, cyme::avx, 4>(simd_trait<std::uint64_t, cyme::avx, 4>::register_type xmm0,
+                                    simd_trait<std::uint64_t, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::avx, 4>::register_type(
+        detail::cmpeq_epi64(xmm0.r0, xmm1.r0), detail::cmpeq_epi64(xmm0.r1, xmm1.r1),
+        detail::cmpeq_epi64(xmm0.r2, xmm1.r2), detail::cmpeq_epi64(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the != operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint64_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 1>::register_type
+_mm_ne<std::uint64_t, cyme::avx, 1>(simd_trait<std::uint64_t, cyme::avx, 1>::register_type xmm0,
+                                    simd_trait<std::uint64_t, cyme::avx, 1>::register_type xmm1) {
+    return detail::cmpne_epi64(xmm0, xmm1);
+}
+
+/**
+ Evaluate the != operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint64_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 2>::register_type
+_mm_ne<std::uint64_t, cyme::avx, 2>(simd_trait<std::uint64_t, cyme::avx, 2>::register_type xmm0,
+                                    simd_trait<std::uint64_t, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::avx, 2>::register_type(detail::cmpne_epi64(xmm0.r0, xmm1.r0),
+                                                                  detail::cmpne_epi64(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the != operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint64_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 4>::register_type
+_mm_ne<std::uint64_t, cyme::avx, 4>(simd_trait<std::uint64_t, cyme::avx, 4>::register_type xmm0,
+                                    simd_trait<std::uint64_t, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::avx, 4>::register_type(
+        detail::cmpne_epi64(xmm0.r0, xmm1.r0), detail::cmpne_epi64(xmm0.r1, xmm1.r1),
+        detail::cmpne_epi64(xmm0.r2, xmm1.r2), detail::cmpne_epi64(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the < operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint64_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 1>::register_type
+_mm_lt<std::uint64_t, cyme::avx, 1>(simd_trait<std::uint64_t, cyme::avx, 1>::register_type xmm0,
+                                    simd_trait<std::uint64_t, cyme::avx, 1>::register_type xmm1) {
+    return detail::cmplt_epu64(xmm0, xmm1);
+}
+
+/**
+ Evaluate the < operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint64_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 2>::register_type
+_mm_lt<std::uint64_t, cyme::avx, 2>(simd_trait<std::uint64_t, cyme::avx, 2>::register_type xmm0,
+                                    simd_trait<std::uint64_t, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::avx, 2>::register_type(detail::cmplt_epu64(xmm0.r0, xmm1.r0),
+                                                                  detail::cmplt_epu64(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the < operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint64_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 4>::register_type
+_mm_lt<std::uint64_t, cyme::avx, 4>(simd_trait<std::uint64_t, cyme::avx, 4>::register_type xmm0,
+                                    simd_trait<std::uint64_t, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::avx, 4>::register_type(
+        detail::cmplt_epu64(xmm0.r0, xmm1.r0), detail::cmplt_epu64(xmm0.r1, xmm1.r1),
+        detail::cmplt_epu64(xmm0.r2, xmm1.r2), detail::cmplt_epu64(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the <= operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint64_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 1>::register_type
+_mm_le<std::uint64_t, cyme::avx, 1>(simd_trait<std::uint64_t, cyme::avx, 1>::register_type xmm0,
+                                    simd_trait<std::uint64_t, cyme::avx, 1>::register_type xmm1) {
+    return detail::cmple_epu64(xmm0, xmm1);
+}
+
+/**
+ Evaluate the <= operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint64_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 2>::register_type
+_mm_le<std::uint64_t, cyme::avx, 2>(simd_trait<std::uint64_t, cyme::avx, 2>::register_type xmm0,
+                                    simd_trait<std::uint64_t, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::avx, 2>::register_type(detail::cmple_epu64(xmm0.r0, xmm1.r0),
+                                                                  detail::cmple_epu64(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the <= operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint64_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 4>::register_type
+_mm_le<std::uint64_t, cyme::avx, 4>(simd_trait<std::uint64_t, cyme::avx, 4>::register_type xmm0,
+                                    simd_trait<std::uint64_t, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::avx, 4>::register_type(
+        detail::cmple_epu64(xmm0.r0, xmm1.r0), detail::cmple_epu64(xmm0.r1, xmm1.r1),
+        detail::cmple_epu64(xmm0.r2, xmm1.r2), detail::cmple_epu64(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the & operator between two registers
+ specialisation uint64_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 1>::register_type
+_mm_and<std::uint64_t, cyme::avx, 1>(simd_trait<std::uint64_t, cyme::avx, 1>::register_type xmm0,
+                                     simd_trait<std::uint64_t, cyme::avx, 1>::register_type xmm1) {
+    return detail::and_si(xmm0, xmm1);
+}
+
+/**
+ Evaluate the & operator between two registers
+ specialisation uint64_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 2>::register_type
+_mm_and<std::uint64_t, cyme::avx, 2>(simd_trait<std::uint64_t, cyme::avx, 2>::register_type xmm0,
+                                     simd_trait<std::uint64_t, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::avx, 2>::register_type(detail::and_si(xmm0.r0, xmm1.r0),
+                                                                  detail::and_si(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the & operator between two registers
+ specialisation uint64_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 4>::register_type
+_mm_and<std::uint64_t, cyme::avx, 4>(simd_trait<std::uint64_t, cyme::avx, 4>::register_type xmm0,
+                                     simd_trait<std::uint64_t, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::avx, 4>::register_type(
+        detail::and_si(xmm0.r0, xmm1.r0), detail::and_si(xmm0.r1, xmm1.r1), detail::and_si(xmm0.r2, xmm1.r2),
+        detail::and_si(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the | operator between two registers
+ specialisation uint64_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 1>::register_type
+_mm_or<std::uint64_t, cyme::avx, 1>(simd_trait<std::uint64_t, cyme::avx, 1>::register_type xmm0,
+                                    simd_trait<std::uint64_t, cyme::avx, 1>::register_type xmm1) {
+    return detail::or_si(xmm0, xmm1);
+}
+
+/**
+ Evaluate the | operator between two registers
+ specialisation uint64_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 2>::register_type
+_mm_or<std::uint64_t, cyme::avx, 2>(simd_trait<std::uint64_t, cyme::avx, 2>::register_type xmm0,
+                                    simd_trait<std::uint64_t, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::avx, 2>::register_type(detail::or_si(xmm0.r0, xmm1.r0),
+                                                                  detail::or_si(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the | operator between two registers
+ specialisation uint64_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 4>::register_type
+_mm_or<std::uint64_t, cyme::avx, 4>(simd_trait<std::uint64_t, cyme::avx, 4>::register_type xmm0,
+                                    simd_trait<std::uint64_t, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::avx, 4>::register_type(
+        detail::or_si(xmm0.r0, xmm1.r0), detail::or_si(xmm0.r1, xmm1.r1), detail::or_si(xmm0.r2, xmm1.r2),
+        detail::or_si(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the ^ operator between two registers
+ specialisation uint64_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 1>::register_type
+_mm_xor<std::uint64_t, cyme::avx, 1>(simd_trait<std::uint64_t, cyme::avx, 1>::register_type xmm0,
+                                     simd_trait<std::uint64_t, cyme::avx, 1>::register_type xmm1) {
+    return detail::xor_si(xmm0, xmm1);
+}
+
+/**
+ Evaluate the ^ operator between two registers
+ specialisation uint64_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 2>::register_type
+_mm_xor<std::uint64_t, cyme::avx, 2>(simd_trait<std::uint64_t, cyme::avx, 2>::register_type xmm0,
+                                     simd_trait<std::uint64_t, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::avx, 2>::register_type(detail::xor_si(xmm0.r0, xmm1.r0),
+                                                                  detail::xor_si(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the ^ operator between two registers
+ specialisation uint64_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 4>::register_type
+_mm_xor<std::uint64_t, cyme::avx, 4>(simd_trait<std::uint64_t, cyme::avx, 4>::register_type xmm0,
+                                     simd_trait<std::uint64_t, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::avx, 4>::register_type(
+        detail::xor_si(xmm0.r0, xmm1.r0), detail::xor_si(xmm0.r1, xmm1.r1), detail::xor_si(xmm0.r2, xmm1.r2),
+        detail::xor_si(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the ~ operator
+ specialisation uint64_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 1>::register_type
+_mm_andnot<std::uint64_t, cyme::avx, 1>(simd_trait<std::uint64_t, cyme::avx, 1>::register_type xmm0) {
+    return detail::not_si(xmm0);
+}
+
+/**
+ Evaluate the ~ operator
+ specialisation uint64_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 2>::register_type
+_mm_andnot<std::uint64_t, cyme::avx, 2>(simd_trait<std::uint64_t, cyme::avx, 2>::register_type xmm0) {
+    return simd_trait<std::uint64_t, cyme::avx, 2>::register_type(detail::not_si(xmm0.r0), detail::not_si(xmm0.r1));
+}
+
+/**
+ Evaluate the ~ operator
+ specialisation uint64_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::avx, 4>::register_type
+_mm_andnot<std::uint64_t, cyme::avx, 4>(simd_trait<std::uint64_t, cyme::avx, 4>::register_type xmm0) {
+    return simd_trait<std::uint64_t, cyme::avx, 4>::register_type(detail::not_si(xmm0.r0), detail::not_si(xmm0.r1),
+                                                                  detail::not_si(xmm0.r2), detail::not_si(xmm0.r3));
+}
+
+/**
+ Convert the 64 bits unsigned integers to double, rounded to the nearest
+ specialisation uint64_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::avx, 1>::register_type
+_mm_cvt<std::uint64_t, cyme::avx, 1, double>(simd_trait<std::uint64_t, cyme::avx, 1>::register_type xmm0) {
+    return detail::cvtepu64_pd(xmm0);
+}
+
+/**
+ Convert the 64 bits unsigned integers to double, rounded to the nearest
+ specialisation uint64_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::avx, 2>::register_type
+_mm_cvt<std::uint64_t, cyme::avx, 2, double>(simd_trait<std::uint64_t, cyme::avx, 2>::register_type xmm0) {
+    return simd_trait<double, cyme::avx, 2>::register_type(detail::cvtepu64_pd(xmm0.r0), detail::cvtepu64_pd(xmm0.r1));
+}
+
+/**
+ Convert the 64 bits unsigned integers to double, rounded to the nearest
+ specialisation uint64_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::avx, 4>::register_type
+_mm_cvt<std::uint64_t, cyme::avx, 4, double>(simd_trait<std::uint64_t, cyme::avx, 4>::register_type xmm0) {
+    return simd_trait<double, cyme::avx, 4>::register_type(detail::cvtepu64_pd(xmm0.r0), detail::cvtepu64_pd(xmm0.r1),
+                                                           detail::cvtepu64_pd(xmm0.r2), detail::cvtepu64_pd(xmm0.r3));
+}
+
+/** \cond */
+namespace detail {
+/** the rounding of the AVX registers, as the SSE ones */
+forceinline __m256d round_pd(__m256d xmm0, cyme::round_mode m) {
+    switch (m) {
+    case cyme::round_down:
+        return _mm256_round_pd(xmm0, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+    case cyme::round_up:
+        return _mm256_round_pd(xmm0, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+    case cyme::round_zero:
+        return _mm256_round_pd(xmm0, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+    default:
+        return _mm256_round_pd(xmm0, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    }
+}
+
+forceinline __m256 round_ps(__m256 xmm0, cyme::round_mode m) {
+    switch (m) {
+    case cyme::round_down:
+        return _mm256_round_ps(xmm0, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+    case cyme::round_up:
+        return _mm256_round_ps(xmm0, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+    case cyme::round_zero:
+        return _mm256_round_ps(xmm0, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+    default:
+        return _mm256_round_ps(xmm0, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    }
+}
+} // namespace detail
+/** \endcond */
+
+/**
+ Round to an integral value in the floating point format, the rounding mode m
+ specialisation double,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::avx, 1>::register_type
+_mm_round<double, cyme::avx, 1>(simd_trait<double, cyme::avx, 1>::register_type xmm0, cyme::round_mode m) {
+    return detail::round_pd(xmm0, m);
+}
+
+/**
+ Round to an integral value in the floating point format, the rounding mode m
+ specialisation double,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::avx, 2>::register_type
+_mm_round<double, cyme::avx, 2>(simd_trait<double, cyme::avx, 2>::register_type xmm0, cyme::round_mode m) {
+    return simd_trait<double, cyme::avx, 2>::register_type(detail::round_pd(xmm0.r0, m), detail::round_pd(xmm0.r1, m));
+}
+
+/**
+ Round to an integral value in the floating point format, the rounding mode m
+ specialisation double,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::avx, 4>::register_type
+_mm_round<double, cyme::avx, 4>(simd_trait<double, cyme::avx, 4>::register_type xmm0, cyme::round_mode m) {
+    return simd_trait<double, cyme::avx, 4>::register_type(detail::round_pd(xmm0.r0, m), detail::round_pd(xmm0.r1, m),
+                                                           detail::round_pd(xmm0.r2, m), detail::round_pd(xmm0.r3, m));
+}
+
+/**
+ Round to an integral value in the floating point format, the rounding mode m
+ specialisation float,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<float, cyme::avx, 1>::register_type
+_mm_round<float, cyme::avx, 1>(simd_trait<float, cyme::avx, 1>::register_type xmm0, cyme::round_mode m) {
+    return detail::round_ps(xmm0, m);
+}
+
+/**
+ Round to an integral value in the floating point format, the rounding mode m
+ specialisation float,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<float, cyme::avx, 2>::register_type
+_mm_round<float, cyme::avx, 2>(simd_trait<float, cyme::avx, 2>::register_type xmm0, cyme::round_mode m) {
+    return simd_trait<float, cyme::avx, 2>::register_type(detail::round_ps(xmm0.r0, m), detail::round_ps(xmm0.r1, m));
+}
+
+/**
+ Round to an integral value in the floating point format, the rounding mode m
+ specialisation float,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<float, cyme::avx, 4>::register_type
+_mm_round<float, cyme::avx, 4>(simd_trait<float, cyme::avx, 4>::register_type xmm0, cyme::round_mode m) {
+    return simd_trait<float, cyme::avx, 4>::register_type(detail::round_ps(xmm0.r0, m), detail::round_ps(xmm0.r1, m),
+                                                          detail::round_ps(xmm0.r2, m), detail::round_ps(xmm0.r3, m));
+}
+
+/** \cond */
+namespace detail {
+/** the lanes of the first and the second half of a register widened to double, the 128 bits halves */
+forceinline __m256d widen_lo(__m256 xmm0) { return _mm256_cvtps_pd(_mm256_castps256_ps128(xmm0)); }
+
+forceinline __m256d widen_hi(__m256 xmm0) { return _mm256_cvtps_pd(_mm256_extractf128_ps(xmm0, 1)); }
+
+forceinline __m256d widen_lo(__m256i xmm0) { return _mm256_cvtepi32_pd(_mm256_castsi256_si128(xmm0)); }
+
+forceinline __m256d widen_hi(__m256i xmm0) { return _mm256_cvtepi32_pd(_mm256_extractf128_si256(xmm0, 1)); }
+
+/** the unsigned lanes, moved by -2^31 into the range of int before the conversion and back after, exact */
+forceinline __m256d widen_epu32(__m128i xmm0) {
+    const __m128i flip = _mm_set1_epi32(static_cast<int>(1u << 31));
+    return _mm256_add_pd(_mm256_cvtepi32_pd(_mm_xor_si128(xmm0, flip)), _mm256_set1_pd(2147483648.));
+}
+
+forceinline __m256d widen_lo_epu32(__m256i xmm0) { return widen_epu32(_mm256_castsi256_si128(xmm0)); }
+
+forceinline __m256d widen_hi_epu32(__m256i xmm0) { return widen_epu32(_mm256_extractf128_si256(xmm0, 1)); }
+
+/** two registers of double narrowed into one, rounded to the nearest float, truncated to int as static_cast */
+forceinline __m256 narrow_ps(__m256d xmm0, __m256d xmm1) {
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm256_cvtpd_ps(xmm0)), _mm256_cvtpd_ps(xmm1), 1);
+}
+
+forceinline __m256i narrow_epi32(__m256d xmm0, __m256d xmm1) {
+    return _mm256_set_m128i(_mm256_cvttpd_epi32(xmm1), _mm256_cvttpd_epi32(xmm0));
+}
+} // namespace detail
+/** \endcond */
+
+/**
+ Widen the first half of the lanes of xmm0 to double, the lanes in memory order
+ specialisation float,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::avx, 1>::register_type
+_mm_widen_lo<float, cyme::avx, 1>(simd_trait<float, cyme::avx, 1>::register_type xmm0) {
+    return detail::widen_lo(xmm0);
+}
+
+/**
+ Widen the first half of the lanes of xmm0 to double, the lanes in memory order
+ specialisation float,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::avx, 2>::register_type
+_mm_widen_lo<float, cyme::avx, 2>(simd_trait<float, cyme::avx, 2>::register_type xmm0) {
+    return simd_trait<double, cyme::avx, 2>::register_type(detail::widen_lo(xmm0.r0), detail::widen_hi(xmm0.r0));
+}
+
+/**
+ Widen the first half of the lanes of xmm0 to double, the lanes in memory order
+ specialisation float,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::avx, 4>::register_type
+_mm_widen_lo<float, cyme::avx, 4>(simd_trait<float, cyme::avx, 4>::register_type xmm0) {
+    return simd_trait<double, cyme::avx, 4>::register_type(detail::widen_lo(xmm0.r0), detail::widen_hi(xmm0.r0),
+                                                           detail::widen_lo(xmm0.r1), detail::widen_hi(xmm0.r1));
+}
+
+/**
+ Widen the second half of the lanes of xmm0 to double, the lanes in memory order
+ specialisation float,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::avx, 1>::register_type
+_mm_widen_hi<float, cyme::avx, 1>(simd_trait<float, cyme::avx, 1>::register_type xmm0) {
+    return detail::widen_hi(xmm0);
+}
+
+/**
+ Widen the second half of the lanes of xmm0 to double, the lanes in memory order
+ specialisation float,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::avx, 2>::register_type
+_mm_widen_hi<float, cyme::avx, 2>(simd_trait<float, cyme::avx, 2>::register_type xmm0) {
+    return simd_trait<double, cyme::avx, 2>::register_type(detail::widen_lo(xmm0.r1), detail::widen_hi(xmm0.r1));
+}
+
+/**
+ Widen the second half of the lanes of xmm0 to double, the lanes in memory order
+ specialisation float,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::avx, 4>::register_type
+_mm_widen_hi<float, cyme::avx, 4>(simd_trait<float, cyme::avx, 4>::register_type xmm0) {
+    return simd_trait<double, cyme::avx, 4>::register_type(detail::widen_lo(xmm0.r2), detail::widen_hi(xmm0.r2),
+                                                           detail::widen_lo(xmm0.r3), detail::widen_hi(xmm0.r3));
+}
+
+/**
+ Narrow the lanes of xmm0 then xmm1 (double) into one float register
+ specialisation float,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<float, cyme::avx, 1>::register_type
+_mm_narrow<float, cyme::avx, 1>(simd_trait<double, cyme::avx, 1>::register_type xmm0,
+                                simd_trait<double, cyme::avx, 1>::register_type xmm1) {
+    return detail::narrow_ps(xmm0, xmm1);
+}
+
+/**
+ Narrow the lanes of xmm0 then xmm1 (double) into one float register
+ specialisation float,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<float, cyme::avx, 2>::register_type
+_mm_narrow<float, cyme::avx, 2>(simd_trait<double, cyme::avx, 2>::register_type xmm0,
+                                simd_trait<double, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<float, cyme::avx, 2>::register_type(detail::narrow_ps(xmm0.r0, xmm0.r1),
+                                                          detail::narrow_ps(xmm1.r0, xmm1.r1));
+}
+
+/**
+ Narrow the lanes of xmm0 then xmm1 (double) into one float register
+ specialisation float,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<float, cyme::avx, 4>::register_type
+_mm_narrow<float, cyme::avx, 4>(simd_trait<double, cyme::avx, 4>::register_type xmm0,
+                                simd_trait<double, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<float, cyme::avx, 4>::register_type(
+        detail::narrow_ps(xmm0.r0, xmm0.r1), detail::narrow_ps(xmm0.r2, xmm0.r3), detail::narrow_ps(xmm1.r0, xmm1.r1),
+        detail::narrow_ps(xmm1.r2, xmm1.r3));
+}
+
+/**
+ Widen the first half of the lanes of xmm0 to double, the lanes in memory order
+ specialisation int,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::avx, 1>::register_type
+_mm_widen_lo<int, cyme::avx, 1>(simd_trait<int, cyme::avx, 1>::register_type xmm0) {
+    return detail::widen_lo(xmm0);
+}
+
+/**
+ Widen the first half of the lanes of xmm0 to double, the lanes in memory order
+ specialisation int,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::avx, 2>::register_type
+_mm_widen_lo<int, cyme::avx, 2>(simd_trait<int, cyme::avx, 2>::register_type xmm0) {
+    return simd_trait<double, cyme::avx, 2>::register_type(detail::widen_lo(xmm0.r0), detail::widen_hi(xmm0.r0));
+}
+
+/**
+ Widen the first half of the lanes of xmm0 to double, the lanes in memory order
+ specialisation int,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::avx, 4>::register_type
+_mm_widen_lo<int, cyme::avx, 4>(simd_trait<int, cyme::avx, 4>::register_type xmm0) {
+    return simd_trait<double, cyme::avx, 4>::register_type(detail::widen_lo(xmm0.r0), detail::widen_hi(xmm0.r0),
+                                                           detail::widen_lo(xmm0.r1), detail::widen_hi(xmm0.r1));
+}
+
+/**
+ Widen the second half of the lanes of xmm0 to double, the lanes in memory order
+ specialisation int,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::avx, 1>::register_type
+_mm_widen_hi<int, cyme::avx, 1>(simd_trait<int, cyme::avx, 1>::register_type xmm0) {
+    return detail::widen_hi(xmm0);
+}
+
+/**
+ Widen the second half of the lanes of xmm0 to double, the lanes in memory order
+ specialisation int,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::avx, 2>::register_type
+_mm_widen_hi<int, cyme::avx, 2>(simd_trait<int, cyme::avx, 2>::register_type xmm0) {
+    return simd_trait<double, cyme::avx, 2>::register_type(detail::widen_lo(xmm0.r1), detail::widen_hi(xmm0.r1));
+}
+
+/**
+ Widen the second half of the lanes of xmm0 to double, the lanes in memory order
+ specialisation int,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::avx, 4>::register_type
+_mm_widen_hi<int, cyme::avx, 4>(simd_trait<int, cyme::avx, 4>::register_type xmm0) {
+    return simd_trait<double, cyme::avx, 4>::register_type(detail::widen_lo(xmm0.r2), detail::widen_hi(xmm0.r2),
+                                                           detail::widen_lo(xmm0.r3), detail::widen_hi(xmm0.r3));
+}
+
+/**
+ Widen the first half of the lanes of xmm0 to double, the lanes in memory order
+ specialisation uint32_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::avx, 1>::register_type
+_mm_widen_lo<std::uint32_t, cyme::avx, 1>(simd_trait<std::uint32_t, cyme::avx, 1>::register_type xmm0) {
+    return detail::widen_lo_epu32(xmm0);
+}
+
+/**
+ Widen the first half of the lanes of xmm0 to double, the lanes in memory order
+ specialisation uint32_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::avx, 2>::register_type
+_mm_widen_lo<std::uint32_t, cyme::avx, 2>(simd_trait<std::uint32_t, cyme::avx, 2>::register_type xmm0) {
+    return simd_trait<double, cyme::avx, 2>::register_type(detail::widen_lo_epu32(xmm0.r0),
+                                                           detail::widen_hi_epu32(xmm0.r0));
+}
+
+/**
+ Widen the first half of the lanes of xmm0 to double, the lanes in memory order
+ specialisation uint32_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::avx, 4>::register_type
+_mm_widen_lo<std::uint32_t, cyme::avx, 4>(simd_trait<std::uint32_t, cyme::avx, 4>::register_type xmm0) {
+    return simd_trait<double, cyme::avx, 4>::register_type(detail::widen_lo_epu32(xmm0.r0),
+                                                           detail::widen_hi_epu32(xmm0.r0),
+                                                           detail::widen_lo_epu32(xmm0.r1),
+                                                           detail::widen_hi_epu32(xmm0.r1));
+}
+
+/**
+ Widen the second half of the lanes of xmm0 to double, the lanes in memory order
+ specialisation uint32_t,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::avx, 1>::register_type
+_mm_widen_hi<std::uint32_t, cyme::avx, 1>(simd_trait<std::uint32_t, cyme::avx, 1>::register_type xmm0) {
+    return detail::widen_hi_epu32(xmm0);
+}
+
+/**
+ Widen the second half of the lanes of xmm0 to double, the lanes in memory order
+ specialisation uint32_t,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::avx, 2>::register_type
+_mm_widen_hi<std::uint32_t, cyme::avx, 2>(simd_trait<std::uint32_t, cyme::avx, 2>::register_type xmm0) {
+    return simd_trait<double, cyme::avx, 2>::register_type(detail::widen_lo_epu32(xmm0.r1),
+                                                           detail::widen_hi_epu32(xmm0.r1));
+}
+
+/**
+ Widen the second half of the lanes of xmm0 to double, the lanes in memory order
+ specialisation uint32_t,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::avx, 4>::register_type
+_mm_widen_hi<std::uint32_t, cyme::avx, 4>(simd_trait<std::uint32_t, cyme::avx, 4>::register_type xmm0) {
+    return simd_trait<double, cyme::avx, 4>::register_type(detail::widen_lo_epu32(xmm0.r2),
+                                                           detail::widen_hi_epu32(xmm0.r2),
+                                                           detail::widen_lo_epu32(xmm0.r3),
+                                                           detail::widen_hi_epu32(xmm0.r3));
+}
+
+/**
+ Narrow the lanes of xmm0 then xmm1 (double) into one int register
+ specialisation int,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<int, cyme::avx, 1>::register_type
+_mm_narrow<int, cyme::avx, 1>(simd_trait<double, cyme::avx, 1>::register_type xmm0,
+                              simd_trait<double, cyme::avx, 1>::register_type xmm1) {
+    return detail::narrow_epi32(xmm0, xmm1);
+}
+
+/**
+ Narrow the lanes of xmm0 then xmm1 (double) into one int register
+ specialisation int,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<int, cyme::avx, 2>::register_type
+_mm_narrow<int, cyme::avx, 2>(simd_trait<double, cyme::avx, 2>::register_type xmm0,
+                              simd_trait<double, cyme::avx, 2>::register_type xmm1) {
+    return simd_trait<int, cyme::avx, 2>::register_type(detail::narrow_epi32(xmm0.r0, xmm0.r1),
+                                                        detail::narrow_epi32(xmm1.r0, xmm1.r1));
+}
+
+/**
+ Narrow the lanes of xmm0 then xmm1 (double) into one int register
+ specialisation int,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<int, cyme::avx, 4>::register_type
+_mm_narrow<int, cyme::avx, 4>(simd_trait<double, cyme::avx, 4>::register_type xmm0,
+                              simd_trait<double, cyme::avx, 4>::register_type xmm1) {
+    return simd_trait<int, cyme::avx, 4>::register_type(
+        detail::narrow_epi32(xmm0.r0, xmm0.r1), detail::narrow_epi32(xmm0.r2, xmm0.r3),
+        detail::narrow_epi32(xmm1.r0, xmm1.r1), detail::narrow_epi32(xmm1.r2, xmm1.r3));
+}
+
+/**
+ Convert the float to int, truncated as static_cast
+ specialisation float,cyme::avx,1 regs
+ */
+template <>
+forceinline simd_trait<int, cyme::avx, 1>::register_type
+_mm_cvt<float, cyme::avx, 1, int>(simd_trait<float, cyme::avx, 1>::register_type xmm0) {
+    return _mm256_cvttps_epi32(xmm0);
+}
+
+/**
+ Convert the float to int, truncated as static_cast
+ specialisation float,cyme::avx,2 regs
+ */
+template <>
+forceinline simd_trait<int, cyme::avx, 2>::register_type
+_mm_cvt<float, cyme::avx, 2, int>(simd_trait<float, cyme::avx, 2>::register_type xmm0) {
+    return simd_trait<int, cyme::avx, 2>::register_type(_mm256_cvttps_epi32(xmm0.r0), _mm256_cvttps_epi32(xmm0.r1));
+}
+
+/**
+ Convert the float to int, truncated as static_cast
+ specialisation float,cyme::avx,4 regs
+ */
+template <>
+forceinline simd_trait<int, cyme::avx, 4>::register_type
+_mm_cvt<float, cyme::avx, 4, int>(simd_trait<float, cyme::avx, 4>::register_type xmm0) {
+    return simd_trait<int, cyme::avx, 4>::register_type(_mm256_cvttps_epi32(xmm0.r0), _mm256_cvttps_epi32(xmm0.r1),
+                                                        _mm256_cvttps_epi32(xmm0.r2), _mm256_cvttps_epi32(xmm0.r3));
+}
+
 #undef _mm256_set_m128i
 
 } // end namespace
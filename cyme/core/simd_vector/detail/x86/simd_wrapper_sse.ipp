@@ -476,6 +476,116 @@ forceinline bool _mm_is_empty<double, cyme::sse, 4>(simd_trait<double, cyme::sse
            _mm_test_all_zeros(_mm_castpd_si128(xmm0.r2), mask) & _mm_test_all_zeros(_mm_castpd_si128(xmm0.r3), mask);
 }
 
+/**
+ Horizontal sum of the register, the lanes are added with a pairwise tree, return a scalar.
+ specialisation double,cyme::sse,1 regs
+ */
+template <>
+forceinline double _mm_hsum<double, cyme::sse, 1>(simd_trait<double, cyme::sse, 1>::register_type xmm0) {
+    return _mm_cvtsd_f64(_mm_add_sd(xmm0, _mm_unpackhi_pd(xmm0, xmm0)));
+}
+
+/**
+ Horizontal sum of the register, the lanes are added with a pairwise tree, return a scalar.
+ specialisation double,cyme::sse,2 regs
+ */
+template <>
+forceinline double _mm_hsum<double, cyme::sse, 2>(simd_trait<double, cyme::sse, 2>::register_type xmm0) {
+    return _mm_hsum<double, cyme::sse, 1>(_mm_add_pd(xmm0.r0, xmm0.r1));
+}
+
+/**
+ Horizontal sum of the register, the lanes are added with a pairwise tree, return a scalar.
+ specialisation double,cyme::sse,4 regs
+ */
+template <>
+forceinline double _mm_hsum<double, cyme::sse, 4>(simd_trait<double, cyme::sse, 4>::register_type xmm0) {
+    return _mm_hsum<double, cyme::sse, 1>(_mm_add_pd(_mm_add_pd(xmm0.r0, xmm0.r2), _mm_add_pd(xmm0.r1, xmm0.r3)));
+}
+
+/**
+ Horizontal minimum of the register, the lanes are compared with a pairwise tree, return a scalar.
+ specialisation double,cyme::sse,1 regs
+ */
+template <>
+forceinline double _mm_hmin<double, cyme::sse, 1>(simd_trait<double, cyme::sse, 1>::register_type xmm0) {
+    return _mm_cvtsd_f64(_mm_min_sd(xmm0, _mm_unpackhi_pd(xmm0, xmm0)));
+}
+
+/**
+ Horizontal minimum of the register, the lanes are compared with a pairwise tree, return a scalar.
+ specialisation double,cyme::sse,2 regs
+ */
+template <>
+forceinline double _mm_hmin<double, cyme::sse, 2>(simd_trait<double, cyme::sse, 2>::register_type xmm0) {
+    return _mm_hmin<double, cyme::sse, 1>(_mm_min_pd(xmm0.r0, xmm0.r1));
+}
+
+/**
+ Horizontal minimum of the register, the lanes are compared with a pairwise tree, return a scalar.
+ specialisation double,cyme::sse,4 regs
+ */
+template <>
+forceinline double _mm_hmin<double, cyme::sse, 4>(simd_trait<double, cyme::sse, 4>::register_type xmm0) {
+    return _mm_hmin<double, cyme::sse, 1>(_mm_min_pd(_mm_min_pd(xmm0.r0, xmm0.r2), _mm_min_pd(xmm0.r1, xmm0.r3)));
+}
+
+/**
+ Horizontal maximum of the register, the lanes are compared with a pairwise tree, return a scalar.
+ specialisation double,cyme::sse,1 regs
+ */
+template <>
+forceinline double _mm_hmax<double, cyme::sse, 1>(simd_trait<double, cyme::sse, 1>::register_type xmm0) {
+    return _mm_cvtsd_f64(_mm_max_sd(xmm0, _mm_unpackhi_pd(xmm0, xmm0)));
+}
+
+/**
+ Horizontal maximum of the register, the lanes are compared with a pairwise tree, return a scalar.
+ specialisation double,cyme::sse,2 regs
+ */
+template <>
+forceinline double _mm_hmax<double, cyme::sse, 2>(simd_trait<double, cyme::sse, 2>::register_type xmm0) {
+    return _mm_hmax<double, cyme::sse, 1>(_mm_max_pd(xmm0.r0, xmm0.r1));
+}
+
+/**
+ Horizontal maximum of the register, the lanes are compared with a pairwise tree, return a scalar.
+ specialisation double,cyme::sse,4 regs
+ */
+template <>
+forceinline double _mm_hmax<double, cyme::sse, 4>(simd_trait<double, cyme::sse, 4>::register_type xmm0) {
+    return _mm_hmax<double, cyme::sse, 1>(_mm_max_pd(_mm_max_pd(xmm0.r0, xmm0.r2), _mm_max_pd(xmm0.r1, xmm0.r3)));
+}
+
+/**
+ Gather the sign bits of the lanes of a mask into an integer, a bit per lane.
+ specialisation double,cyme::sse,1 regs
+ */
+template <>
+forceinline unsigned int _mm_movemask<double, cyme::sse, 1>(simd_trait<double, cyme::sse, 1>::register_type xmm0) {
+    return _mm_movemask_pd(xmm0);
+}
+
+/**
+ Gather the sign bits of the lanes of a mask into an integer, a bit per lane.
+ specialisation double,cyme::sse,2 regs
+ */
+template <>
+forceinline unsigned int _mm_movemask<double, cyme::sse, 2>(simd_trait<double, cyme::sse, 2>::register_type xmm0) {
+    return _mm_movemask_pd(xmm0.r0) | (static_cast<unsigned int>(_mm_movemask_pd(xmm0.r1)) << 2);
+}
+
+/**
+ Gather the sign bits of the lanes of a mask into an integer, a bit per lane.
+ specialisation double,cyme::sse,4 regs
+ */
+template <>
+forceinline unsigned int _mm_movemask<double, cyme::sse, 4>(simd_trait<double, cyme::sse, 4>::register_type xmm0) {
+    return _mm_movemask_pd(xmm0.r0) | (static_cast<unsigned int>(_mm_movemask_pd(xmm0.r1)) << 2) |
+           (static_cast<unsigned int>(_mm_movemask_pd(xmm0.r2)) << 4) |
+           (static_cast<unsigned int>(_mm_movemask_pd(xmm0.r3)) << 6);
+}
+
 /**
   Convert packed double-precision (64-bit) floating-point elements in xmm0 to packed 32-bit integers with
  truncation, and store the results in dst.
@@ -1346,6 +1456,154 @@ _mm_min<double, cyme::sse, 4>(simd_trait<double, cyme::sse, 4>::register_type xm
                                                            _mm_min_pd(xmm0.r2, xmm1.r2), _mm_min_pd(xmm0.r3, xmm1.r3));
 }
 
+/**
+ Evaluate the <= operator, return if true return 0xffffffffffffffff (true) else 0 (false)
+ specialisation double,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::sse, 1>::register_type
+_mm_le<double, cyme::sse, 1>(simd_trait<double, cyme::sse, 1>::register_type xmm0,
+                             simd_trait<double, cyme::sse, 1>::register_type xmm1) {
+    return _mm_cmple_pd(xmm0, xmm1);
+}
+
+/**
+ Evaluate the <= operator, return if true return 0xffffffffffffffff (true) else 0 (false)
+ specialisation double,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::sse, 2>::register_type
+_mm_le<double, cyme::sse, 2>(simd_trait<double, cyme::sse, 2>::register_type xmm0,
+                             simd_trait<double, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<double, cyme::sse, 2>::register_type(_mm_cmple_pd(xmm0.r0, xmm1.r0),
+                                                           _mm_cmple_pd(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the <= operator, return if true return 0xffffffffffffffff (true) else 0 (false)
+ specialisation double,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::sse, 4>::register_type
+_mm_le<double, cyme::sse, 4>(simd_trait<double, cyme::sse, 4>::register_type xmm0,
+                             simd_trait<double, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<double, cyme::sse, 4>::register_type(_mm_cmple_pd(xmm0.r0, xmm1.r0),
+                                                           _mm_cmple_pd(xmm0.r1, xmm1.r1),
+                                                           _mm_cmple_pd(xmm0.r2, xmm1.r2),
+                                                           _mm_cmple_pd(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the != operator, return if true return 0xffffffffffffffff (true) else 0 (false)
+ specialisation double,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::sse, 1>::register_type
+_mm_ne<double, cyme::sse, 1>(simd_trait<double, cyme::sse, 1>::register_type xmm0,
+                             simd_trait<double, cyme::sse, 1>::register_type xmm1) {
+    return _mm_cmpneq_pd(xmm0, xmm1);
+}
+
+/**
+ Evaluate the != operator, return if true return 0xffffffffffffffff (true) else 0 (false)
+ specialisation double,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::sse, 2>::register_type
+_mm_ne<double, cyme::sse, 2>(simd_trait<double, cyme::sse, 2>::register_type xmm0,
+                             simd_trait<double, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<double, cyme::sse, 2>::register_type(_mm_cmpneq_pd(xmm0.r0, xmm1.r0),
+                                                           _mm_cmpneq_pd(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the != operator, return if true return 0xffffffffffffffff (true) else 0 (false)
+ specialisation double,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::sse, 4>::register_type
+_mm_ne<double, cyme::sse, 4>(simd_trait<double, cyme::sse, 4>::register_type xmm0,
+                             simd_trait<double, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<double, cyme::sse, 4>::register_type(_mm_cmpneq_pd(xmm0.r0, xmm1.r0),
+                                                           _mm_cmpneq_pd(xmm0.r1, xmm1.r1),
+                                                           _mm_cmpneq_pd(xmm0.r2, xmm1.r2),
+                                                           _mm_cmpneq_pd(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the  max operator between two registers
+ specialisation double,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::sse, 1>::register_type
+_mm_max<double, cyme::sse, 1>(simd_trait<double, cyme::sse, 1>::register_type xmm0,
+                              simd_trait<double, cyme::sse, 1>::register_type xmm1) {
+    return _mm_max_pd(xmm0, xmm1);
+}
+
+/**
+ Evaluate the  max operator between two registers
+ specialisation double,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::sse, 2>::register_type
+_mm_max<double, cyme::sse, 2>(simd_trait<double, cyme::sse, 2>::register_type xmm0,
+                              simd_trait<double, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<double, cyme::sse, 2>::register_type(_mm_max_pd(xmm0.r0, xmm1.r0), _mm_max_pd(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the  max operator between two registers
+ specialisation double,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::sse, 4>::register_type
+_mm_max<double, cyme::sse, 4>(simd_trait<double, cyme::sse, 4>::register_type xmm0,
+                              simd_trait<double, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<double, cyme::sse, 4>::register_type(_mm_max_pd(xmm0.r0, xmm1.r0), _mm_max_pd(xmm0.r1, xmm1.r1),
+                                                           _mm_max_pd(xmm0.r2, xmm1.r2), _mm_max_pd(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Select xmm1 where the mask xmm0 is true else xmm2, a single blendv
+ specialisation double,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::sse, 1>::register_type
+_mm_select<double, cyme::sse, 1>(simd_trait<double, cyme::sse, 1>::register_type xmm0,
+                                 simd_trait<double, cyme::sse, 1>::register_type xmm1,
+                                 simd_trait<double, cyme::sse, 1>::register_type xmm2) {
+    return _mm_blendv_pd(xmm2, xmm1, xmm0);
+}
+
+/**
+ Select xmm1 where the mask xmm0 is true else xmm2, a single blendv
+ specialisation double,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::sse, 2>::register_type
+_mm_select<double, cyme::sse, 2>(simd_trait<double, cyme::sse, 2>::register_type xmm0,
+                                 simd_trait<double, cyme::sse, 2>::register_type xmm1,
+                                 simd_trait<double, cyme::sse, 2>::register_type xmm2) {
+    return simd_trait<double, cyme::sse, 2>::register_type(_mm_blendv_pd(xmm2.r0, xmm1.r0, xmm0.r0),
+                                                           _mm_blendv_pd(xmm2.r1, xmm1.r1, xmm0.r1));
+}
+
+/**
+ Select xmm1 where the mask xmm0 is true else xmm2, a single blendv
+ specialisation double,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::sse, 4>::register_type
+_mm_select<double, cyme::sse, 4>(simd_trait<double, cyme::sse, 4>::register_type xmm0,
+                                 simd_trait<double, cyme::sse, 4>::register_type xmm1,
+                                 simd_trait<double, cyme::sse, 4>::register_type xmm2) {
+    return simd_trait<double, cyme::sse, 4>::register_type(_mm_blendv_pd(xmm2.r0, xmm1.r0, xmm0.r0),
+                                                           _mm_blendv_pd(xmm2.r1, xmm1.r1, xmm0.r1),
+                                                           _mm_blendv_pd(xmm2.r2, xmm1.r2, xmm0.r2),
+                                                           _mm_blendv_pd(xmm2.r3, xmm1.r3, xmm0.r3));
+}
+
 /**
  change the interpretation of the SIMD register
  specialisation double,cyme::sse,1 regs
@@ -2147,6 +2405,119 @@ forceinline bool _mm_is_empty<float, cyme::sse, 4>(simd_trait<float, cyme::sse,
            _mm_test_all_zeros(_mm_castps_si128(xmm0.r2), mask) & _mm_test_all_zeros(_mm_castps_si128(xmm0.r3), mask);
 }
 
+/**
+ Horizontal sum of the register, the lanes are added with a pairwise tree, return a scalar.
+ specialisation float,cyme::sse,1 regs
+ */
+template <>
+forceinline float _mm_hsum<float, cyme::sse, 1>(simd_trait<float, cyme::sse, 1>::register_type xmm0) {
+    xmm0 = _mm_add_ps(xmm0, _mm_movehl_ps(xmm0, xmm0));
+    return _mm_cvtss_f32(_mm_add_ss(xmm0, _mm_shuffle_ps(xmm0, xmm0, 1)));
+}
+
+/**
+ Horizontal sum of the register, the lanes are added with a pairwise tree, return a scalar.
+ specialisation float,cyme::sse,2 regs
+ */
+template <>
+forceinline float _mm_hsum<float, cyme::sse, 2>(simd_trait<float, cyme::sse, 2>::register_type xmm0) {
+    return _mm_hsum<float, cyme::sse, 1>(_mm_add_ps(xmm0.r0, xmm0.r1));
+}
+
+/**
+ Horizontal sum of the register, the lanes are added with a pairwise tree, return a scalar.
+ specialisation float,cyme::sse,4 regs
+ */
+template <>
+forceinline float _mm_hsum<float, cyme::sse, 4>(simd_trait<float, cyme::sse, 4>::register_type xmm0) {
+    return _mm_hsum<float, cyme::sse, 1>(_mm_add_ps(_mm_add_ps(xmm0.r0, xmm0.r2), _mm_add_ps(xmm0.r1, xmm0.r3)));
+}
+
+/**
+ Horizontal minimum of the register, the lanes are compared with a pairwise tree, return a scalar.
+ specialisation float,cyme::sse,1 regs
+ */
+template <>
+forceinline float _mm_hmin<float, cyme::sse, 1>(simd_trait<float, cyme::sse, 1>::register_type xmm0) {
+    xmm0 = _mm_min_ps(xmm0, _mm_movehl_ps(xmm0, xmm0));
+    return _mm_cvtss_f32(_mm_min_ss(xmm0, _mm_shuffle_ps(xmm0, xmm0, 1)));
+}
+
+/**
+ Horizontal minimum of the register, the lanes are compared with a pairwise tree, return a scalar.
+ specialisation float,cyme::sse,2 regs
+ */
+template <>
+forceinline float _mm_hmin<float, cyme::sse, 2>(simd_trait<float, cyme::sse, 2>::register_type xmm0) {
+    return _mm_hmin<float, cyme::sse, 1>(_mm_min_ps(xmm0.r0, xmm0.r1));
+}
+
+/**
+ Horizontal minimum of the register, the lanes are compared with a pairwise tree, return a scalar.
+ specialisation float,cyme::sse,4 regs
+ */
+template <>
+forceinline float _mm_hmin<float, cyme::sse, 4>(simd_trait<float, cyme::sse, 4>::register_type xmm0) {
+    return _mm_hmin<float, cyme::sse, 1>(_mm_min_ps(_mm_min_ps(xmm0.r0, xmm0.r2), _mm_min_ps(xmm0.r1, xmm0.r3)));
+}
+
+/**
+ Horizontal maximum of the register, the lanes are compared with a pairwise tree, return a scalar.
+ specialisation float,cyme::sse,1 regs
+ */
+template <>
+forceinline float _mm_hmax<float, cyme::sse, 1>(simd_trait<float, cyme::sse, 1>::register_type xmm0) {
+    xmm0 = _mm_max_ps(xmm0, _mm_movehl_ps(xmm0, xmm0));
+    return _mm_cvtss_f32(_mm_max_ss(xmm0, _mm_shuffle_ps(xmm0, xmm0, 1)));
+}
+
+/**
+ Horizontal maximum of the register, the lanes are compared with a pairwise tree, return a scalar.
+ specialisation float,cyme::sse,2 regs
+ */
+template <>
+forceinline float _mm_hmax<float, cyme::sse, 2>(simd_trait<float, cyme::sse, 2>::register_type xmm0) {
+    return _mm_hmax<float, cyme::sse, 1>(_mm_max_ps(xmm0.r0, xmm0.r1));
+}
+
+/**
+ Horizontal maximum of the register, the lanes are compared with a pairwise tree, return a scalar.
+ specialisation float,cyme::sse,4 regs
+ */
+template <>
+forceinline float _mm_hmax<float, cyme::sse, 4>(simd_trait<float, cyme::sse, 4>::register_type xmm0) {
+    return _mm_hmax<float, cyme::sse, 1>(_mm_max_ps(_mm_max_ps(xmm0.r0, xmm0.r2), _mm_max_ps(xmm0.r1, xmm0.r3)));
+}
+
+/**
+ Gather the sign bits of the lanes of a mask into an integer, a bit per lane.
+ specialisation float,cyme::sse,1 regs
+ */
+template <>
+forceinline unsigned int _mm_movemask<float, cyme::sse, 1>(simd_trait<float, cyme::sse, 1>::register_type xmm0) {
+    return _mm_movemask_ps(xmm0);
+}
+
+/**
+ Gather the sign bits of the lanes of a mask into an integer, a bit per lane.
+ specialisation float,cyme::sse,2 regs
+ */
+template <>
+forceinline unsigned int _mm_movemask<float, cyme::sse, 2>(simd_trait<float, cyme::sse, 2>::register_type xmm0) {
+    return _mm_movemask_ps(xmm0.r0) | (static_cast<unsigned int>(_mm_movemask_ps(xmm0.r1)) << 4);
+}
+
+/**
+ Gather the sign bits of the lanes of a mask into an integer, a bit per lane.
+ specialisation float,cyme::sse,4 regs
+ */
+template <>
+forceinline unsigned int _mm_movemask<float, cyme::sse, 4>(simd_trait<float, cyme::sse, 4>::register_type xmm0) {
+    return _mm_movemask_ps(xmm0.r0) | (static_cast<unsigned int>(_mm_movemask_ps(xmm0.r1)) << 4) |
+           (static_cast<unsigned int>(_mm_movemask_ps(xmm0.r2)) << 8) |
+           (static_cast<unsigned int>(_mm_movemask_ps(xmm0.r3)) << 12);
+}
+
 /**
   Convert packed single-precision (32-bit) floating-point elements in xmm0 to packed 32-bit integers with
  truncation, and store the results in dst.
@@ -3630,34 +4001,182 @@ _mm_min<float, cyme::sse, 4>(simd_trait<float, cyme::sse, 4>::register_type xmm0
 }
 
 /**
- change the interpretation of the SIMD register
+ Evaluate the <= operator, return if true return 0xffffffffffffffff (true) else 0 (false)
  specialisation float,cyme::sse,1 regs
  */
 template <>
-forceinline simd_trait<int, cyme::sse, 1>::register_type
-_mm_cast<float, cyme::sse, 1, int>(simd_trait<float, cyme::sse, 1>::register_type xmm0) {
-    return _mm_castps_si128(xmm0);
+forceinline simd_trait<float, cyme::sse, 1>::register_type
+_mm_le<float, cyme::sse, 1>(simd_trait<float, cyme::sse, 1>::register_type xmm0,
+                            simd_trait<float, cyme::sse, 1>::register_type xmm1) {
+    return _mm_cmple_ps(xmm0, xmm1);
 }
 
 /**
- change the interpretation of the SIMD register
+ Evaluate the <= operator, return if true return 0xffffffffffffffff (true) else 0 (false)
  specialisation float,cyme::sse,2 regs
  */
 template <>
-forceinline simd_trait<int, cyme::sse, 2>::register_type
-_mm_cast<float, cyme::sse, 2, int>(simd_trait<float, cyme::sse, 2>::register_type xmm0) {
-    return simd_trait<int, cyme::sse, 2>::register_type(_mm_castps_si128(xmm0.r0), _mm_castps_si128(xmm0.r1));
+forceinline simd_trait<float, cyme::sse, 2>::register_type
+_mm_le<float, cyme::sse, 2>(simd_trait<float, cyme::sse, 2>::register_type xmm0,
+                            simd_trait<float, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<float, cyme::sse, 2>::register_type(_mm_cmple_ps(xmm0.r0, xmm1.r0),
+                                                          _mm_cmple_ps(xmm0.r1, xmm1.r1));
 }
 
 /**
- change the interpretation of the SIMD register
+ Evaluate the <= operator, return if true return 0xffffffffffffffff (true) else 0 (false)
  specialisation float,cyme::sse,4 regs
  */
 template <>
-forceinline simd_trait<int, cyme::sse, 4>::register_type
-_mm_cast<float, cyme::sse, 4, int>(simd_trait<float, cyme::sse, 4>::register_type xmm0) {
-    return simd_trait<int, cyme::sse, 4>::register_type(_mm_castps_si128(xmm0.r0), _mm_castps_si128(xmm0.r1),
-                                                        _mm_castps_si128(xmm0.r2), _mm_castps_si128(xmm0.r3));
+forceinline simd_trait<float, cyme::sse, 4>::register_type
+_mm_le<float, cyme::sse, 4>(simd_trait<float, cyme::sse, 4>::register_type xmm0,
+                            simd_trait<float, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<float, cyme::sse, 4>::register_type(_mm_cmple_ps(xmm0.r0, xmm1.r0),
+                                                          _mm_cmple_ps(xmm0.r1, xmm1.r1),
+                                                          _mm_cmple_ps(xmm0.r2, xmm1.r2),
+                                                          _mm_cmple_ps(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the != operator, return if true return 0xffffffffffffffff (true) else 0 (false)
+ specialisation float,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<float, cyme::sse, 1>::register_type
+_mm_ne<float, cyme::sse, 1>(simd_trait<float, cyme::sse, 1>::register_type xmm0,
+                            simd_trait<float, cyme::sse, 1>::register_type xmm1) {
+    return _mm_cmpneq_ps(xmm0, xmm1);
+}
+
+/**
+ Evaluate the != operator, return if true return 0xffffffffffffffff (true) else 0 (false)
+ specialisation float,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<float, cyme::sse, 2>::register_type
+_mm_ne<float, cyme::sse, 2>(simd_trait<float, cyme::sse, 2>::register_type xmm0,
+                            simd_trait<float, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<float, cyme::sse, 2>::register_type(_mm_cmpneq_ps(xmm0.r0, xmm1.r0),
+                                                          _mm_cmpneq_ps(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the != operator, return if true return 0xffffffffffffffff (true) else 0 (false)
+ specialisation float,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<float, cyme::sse, 4>::register_type
+_mm_ne<float, cyme::sse, 4>(simd_trait<float, cyme::sse, 4>::register_type xmm0,
+                            simd_trait<float, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<float, cyme::sse, 4>::register_type(_mm_cmpneq_ps(xmm0.r0, xmm1.r0),
+                                                          _mm_cmpneq_ps(xmm0.r1, xmm1.r1),
+                                                          _mm_cmpneq_ps(xmm0.r2, xmm1.r2),
+                                                          _mm_cmpneq_ps(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the  max operator between two registers
+ specialisation float,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<float, cyme::sse, 1>::register_type
+_mm_max<float, cyme::sse, 1>(simd_trait<float, cyme::sse, 1>::register_type xmm0,
+                             simd_trait<float, cyme::sse, 1>::register_type xmm1) {
+    return _mm_max_ps(xmm0, xmm1);
+}
+
+/**
+ Evaluate the  max operator between two registers
+ specialisation float,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<float, cyme::sse, 2>::register_type
+_mm_max<float, cyme::sse, 2>(simd_trait<float, cyme::sse, 2>::register_type xmm0,
+                             simd_trait<float, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<float, cyme::sse, 2>::register_type(_mm_max_ps(xmm0.r0, xmm1.r0), _mm_max_ps(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the  max operator between two registers
+ specialisation float,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<float, cyme::sse, 4>::register_type
+_mm_max<float, cyme::sse, 4>(simd_trait<float, cyme::sse, 4>::register_type xmm0,
+                             simd_trait<float, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<float, cyme::sse, 4>::register_type(_mm_max_ps(xmm0.r0, xmm1.r0), _mm_max_ps(xmm0.r1, xmm1.r1),
+                                                          _mm_max_ps(xmm0.r2, xmm1.r2), _mm_max_ps(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Select xmm1 where the mask xmm0 is true else xmm2, a single blendv
+ specialisation float,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<float, cyme::sse, 1>::register_type
+_mm_select<float, cyme::sse, 1>(simd_trait<float, cyme::sse, 1>::register_type xmm0,
+                                simd_trait<float, cyme::sse, 1>::register_type xmm1,
+                                simd_trait<float, cyme::sse, 1>::register_type xmm2) {
+    return _mm_blendv_ps(xmm2, xmm1, xmm0);
+}
+
+/**
+ Select xmm1 where the mask xmm0 is true else xmm2, a single blendv
+ specialisation float,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<float, cyme::sse, 2>::register_type
+_mm_select<float, cyme::sse, 2>(simd_trait<float, cyme::sse, 2>::register_type xmm0,
+                                simd_trait<float, cyme::sse, 2>::register_type xmm1,
+                                simd_trait<float, cyme::sse, 2>::register_type xmm2) {
+    return simd_trait<float, cyme::sse, 2>::register_type(_mm_blendv_ps(xmm2.r0, xmm1.r0, xmm0.r0),
+                                                          _mm_blendv_ps(xmm2.r1, xmm1.r1, xmm0.r1));
+}
+
+/**
+ Select xmm1 where the mask xmm0 is true else xmm2, a single blendv
+ specialisation float,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<float, cyme::sse, 4>::register_type
+_mm_select<float, cyme::sse, 4>(simd_trait<float, cyme::sse, 4>::register_type xmm0,
+                                simd_trait<float, cyme::sse, 4>::register_type xmm1,
+                                simd_trait<float, cyme::sse, 4>::register_type xmm2) {
+    return simd_trait<float, cyme::sse, 4>::register_type(_mm_blendv_ps(xmm2.r0, xmm1.r0, xmm0.r0),
+                                                          _mm_blendv_ps(xmm2.r1, xmm1.r1, xmm0.r1),
+                                                          _mm_blendv_ps(xmm2.r2, xmm1.r2, xmm0.r2),
+                                                          _mm_blendv_ps(xmm2.r3, xmm1.r3, xmm0.r3));
+}
+
+/**
+ change the interpretation of the SIMD register
+ specialisation float,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<int, cyme::sse, 1>::register_type
+_mm_cast<float, cyme::sse, 1, int>(simd_trait<float, cyme::sse, 1>::register_type xmm0) {
+    return _mm_castps_si128(xmm0);
+}
+
+/**
+ change the interpretation of the SIMD register
+ specialisation float,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<int, cyme::sse, 2>::register_type
+_mm_cast<float, cyme::sse, 2, int>(simd_trait<float, cyme::sse, 2>::register_type xmm0) {
+    return simd_trait<int, cyme::sse, 2>::register_type(_mm_castps_si128(xmm0.r0), _mm_castps_si128(xmm0.r1));
+}
+
+/**
+ change the interpretation of the SIMD register
+ specialisation float,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<int, cyme::sse, 4>::register_type
+_mm_cast<float, cyme::sse, 4, int>(simd_trait<float, cyme::sse, 4>::register_type xmm0) {
+    return simd_trait<int, cyme::sse, 4>::register_type(_mm_castps_si128(xmm0.r0), _mm_castps_si128(xmm0.r1),
+                                                        _mm_castps_si128(xmm0.r2), _mm_castps_si128(xmm0.r3));
 }
 
 /**
@@ -3691,6 +4210,2440 @@ _mm_cast<int, cyme::sse, 4, float>(simd_trait<int, cyme::sse, 4>::register_type
                                                           _mm_castsi128_ps(xmm0.r2), _mm_castsi128_ps(xmm0.r3));
 }
 
+/** \cond */
+namespace detail {
+/** high part of the signed products of the 32 bits integers, the even lanes then the odd lanes */
+forceinline __m128i _mm_mulhi_epi32(__m128i xmm0, __m128i xmm1) {
+    const __m128i even = _mm_srli_epi64(_mm_mul_epi32(xmm0, xmm1), 32);
+    const __m128i odd = _mm_mul_epi32(_mm_srli_epi64(xmm0, 32), _mm_srli_epi64(xmm1, 32));
+    return _mm_blend_epi16(even, odd, 0xcc);
+}
+
+/** division by an invariant divisor, libdivide s32 algorithm */
+forceinline __m128i _mm_div_invariant_epi32(__m128i xmm0, int_divisor const &d) {
+    const __m128i sign = _mm_set1_epi32(d.sign);
+    const __m128i shift = _mm_cvtsi32_si128(d.shift);
+    if (d.magic == 0) { // power of two, the negative numerators are rounded to zero
+        const __m128i mask = _mm_set1_epi32(static_cast<int>((1u << d.shift) - 1));
+        __m128i q = _mm_add_epi32(xmm0, _mm_and_si128(_mm_srai_epi32(xmm0, 31), mask));
+        q = _mm_sra_epi32(q, shift);
+        return _mm_sub_epi32(_mm_xor_si128(q, sign), sign);
+    }
+    __m128i q = _mm_mulhi_epi32(xmm0, _mm_set1_epi32(d.magic));
+    if (d.add)
+        q = _mm_add_epi32(q, _mm_sub_epi32(_mm_xor_si128(xmm0, sign), sign));
+    q = _mm_sra_epi32(q, shift);
+    return _mm_sub_epi32(q, _mm_srai_epi32(q, 31)); // +1 if negative
+}
+
+/** remainder by an invariant divisor, n - (n/d)*d */
+forceinline __m128i _mm_mod_invariant_epi32(__m128i xmm0, int_divisor const &d) {
+    return _mm_sub_epi32(xmm0, _mm_mullo_epi32(_mm_div_invariant_epi32(xmm0, d), _mm_set1_epi32(d.value)));
+}
+} // namespace detail
+/** \endcond */
+
+/**
+ Divide the 32 bits integers by an invariant divisor (multiply-high and shift)
+ specialisation int,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<int, cyme::sse, 1>::register_type
+_mm_div_invariant<int, cyme::sse, 1>(simd_trait<int, cyme::sse, 1>::register_type xmm0, int_divisor const &d) {
+    return detail::_mm_div_invariant_epi32(xmm0, d);
+}
+
+/**
+ Divide the 32 bits integers by an invariant divisor (multiply-high and shift)
+ specialisation int,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<int, cyme::sse, 2>::register_type
+_mm_div_invariant<int, cyme::sse, 2>(simd_trait<int, cyme::sse, 2>::register_type xmm0, int_divisor const &d) {
+    return simd_trait<int, cyme::sse, 2>::register_type(detail::_mm_div_invariant_epi32(xmm0.r0, d),
+                                                        detail::_mm_div_invariant_epi32(xmm0.r1, d));
+}
+
+/**
+ Divide the 32 bits integers by an invariant divisor (multiply-high and shift)
+ specialisation int,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<int, cyme::sse, 4>::register_type
+_mm_div_invariant<int, cyme::sse, 4>(simd_trait<int, cyme::sse, 4>::register_type xmm0, int_divisor const &d) {
+    return simd_trait<int, cyme::sse, 4>::register_type(
+        detail::_mm_div_invariant_epi32(xmm0.r0, d), detail::_mm_div_invariant_epi32(xmm0.r1, d),
+        detail::_mm_div_invariant_epi32(xmm0.r2, d), detail::_mm_div_invariant_epi32(xmm0.r3, d));
+}
+
+/**
+ Remainder of the 32 bits integers by an invariant divisor
+ specialisation int,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<int, cyme::sse, 1>::register_type
+_mm_mod_invariant<int, cyme::sse, 1>(simd_trait<int, cyme::sse, 1>::register_type xmm0, int_divisor const &d) {
+    return detail::_mm_mod_invariant_epi32(xmm0, d);
+}
+
+/**
+ Remainder of the 32 bits integers by an invariant divisor
+ specialisation int,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<int, cyme::sse, 2>::register_type
+_mm_mod_invariant<int, cyme::sse, 2>(simd_trait<int, cyme::sse, 2>::register_type xmm0, int_divisor const &d) {
+    return simd_trait<int, cyme::sse, 2>::register_type(detail::_mm_mod_invariant_epi32(xmm0.r0, d),
+                                                        detail::_mm_mod_invariant_epi32(xmm0.r1, d));
+}
+
+/**
+ Remainder of the 32 bits integers by an invariant divisor
+ specialisation int,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<int, cyme::sse, 4>::register_type
+_mm_mod_invariant<int, cyme::sse, 4>(simd_trait<int, cyme::sse, 4>::register_type xmm0, int_divisor const &d) {
+    return simd_trait<int, cyme::sse, 4>::register_type(
+        detail::_mm_mod_invariant_epi32(xmm0.r0, d), detail::_mm_mod_invariant_epi32(xmm0.r1, d),
+        detail::_mm_mod_invariant_epi32(xmm0.r2, d), detail::_mm_mod_invariant_epi32(xmm0.r3, d));
+}
+
+/** \cond */
+namespace detail {
+/** the shifts of the 32 bits integers, only the first 32 bits of xmm1 are used */
+forceinline __m128i sll_epi32(__m128i xmm0, __m128i xmm1) {
+    return _mm_sll_epi32(xmm0, _mm_and_si128(xmm1, _mm_set_epi32(0, 0, 0, 0xffffffff)));
+}
+
+forceinline __m128i srl_epi32(__m128i xmm0, __m128i xmm1) {
+    return _mm_srl_epi32(xmm0, _mm_and_si128(xmm1, _mm_set_epi32(0, 0, 0, 0xffffffff)));
+}
+
+/** the sign of the 64 bits integers in all their bits */
+forceinline __m128i sign_epi64(__m128i xmm0) {
+    return _mm_srai_epi32(_mm_shuffle_epi32(xmm0, _MM_SHUFFLE(3, 3, 1, 1)), 31);
+}
+
+/** arithmetic right shift of the 64 bits integers, no instruction before AVX-512: (x ^ s) >> n ^ s */
+forceinline __m128i sra_epi64(__m128i xmm0, __m128i xmm1) {
+    const __m128i s = sign_epi64(xmm0);
+    return _mm_xor_si128(_mm_srl_epi64(_mm_xor_si128(xmm0, s), xmm1), s);
+}
+
+/** low 64 bits of the products, lo*lo + ((hi*lo + lo*hi) << 32), signed or unsigned */
+forceinline __m128i mullo_epi64(__m128i xmm0, __m128i xmm1) {
+    const __m128i cross = _mm_add_epi64(_mm_mul_epu32(_mm_srli_epi64(xmm0, 32), xmm1),
+                                        _mm_mul_epu32(xmm0, _mm_srli_epi64(xmm1, 32)));
+    return _mm_add_epi64(_mm_mul_epu32(xmm0, xmm1), _mm_slli_epi64(cross, 32));
+}
+
+forceinline __m128i not_si(__m128i xmm0) { return _mm_xor_si128(xmm0, _mm_set1_epi32(-1)); }
+
+forceinline __m128i cmpne_epi32(__m128i xmm0, __m128i xmm1) { return not_si(_mm_cmpeq_epi32(xmm0, xmm1)); }
+
+forceinline __m128i cmpne_epi64(__m128i xmm0, __m128i xmm1) { return not_si(_mm_cmpeq_epi64(xmm0, xmm1)); }
+
+/** xmm0 < xmm1 for the 64 bits integers, _mm_cmpgt_epi64 is SSE4.2, else the sign of xmm0 - xmm1 corrected
+    by the overflow */
+forceinline __m128i cmplt_epi64(__m128i xmm0, __m128i xmm1) {
+#ifdef __SSE4_2__
+    return _mm_cmpgt_epi64(xmm1, xmm0);
+#else
+    const __m128i d = _mm_sub_epi64(xmm0, xmm1);
+    return sign_epi64(_mm_xor_si128(d, _mm_and_si128(_mm_xor_si128(xmm0, xmm1), _mm_xor_si128(d, xmm0))));
+#endif
+}
+
+forceinline __m128i cmple_epi64(__m128i xmm0, __m128i xmm1) { return not_si(cmplt_epi64(xmm1, xmm0)); }
+
+/** the unsigned comparisons are the signed ones with the sign bits flipped */
+forceinline __m128i cmplt_epu64(__m128i xmm0, __m128i xmm1) {
+    const __m128i flip = _mm_set1_epi64x(static_cast<long long>(1ull << 63));
+    return cmplt_epi64(_mm_xor_si128(xmm0, flip), _mm_xor_si128(xmm1, flip));
+}
+
+forceinline __m128i cmple_epu64(__m128i xmm0, __m128i xmm1) { return not_si(cmplt_epu64(xmm1, xmm0)); }
+
+forceinline __m128i cmplt_epu32(__m128i xmm0, __m128i xmm1) {
+    const __m128i flip = _mm_set1_epi32(static_cast<int>(1u << 31));
+    return _mm_cmplt_epi32(_mm_xor_si128(xmm0, flip), _mm_xor_si128(xmm1, flip));
+}
+
+forceinline __m128i cmple_epu32(__m128i xmm0, __m128i xmm1) { return not_si(cmplt_epu32(xmm1, xmm0)); }
+
+/** unsigned 32 bits to float, the two 16 bits halves are exact, one rounding in the addition */
+forceinline __m128 cvtepu32_ps(__m128i xmm0) {
+    const __m128 high = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(xmm0, 16)), _mm_set1_ps(65536.f));
+    return _mm_add_ps(high, _mm_cvtepi32_ps(_mm_and_si128(xmm0, _mm_set1_epi32(0xffff))));
+}
+
+/** unsigned 64 bits to double, no instruction before AVX-512: the 32 bits halves in the mantissas of 2^84 and
+    2^52, the subtraction is exact, one rounding in the addition */
+forceinline __m128d cvtepu64_pd(__m128i xmm0) {
+    const __m128i p84 = _mm_castpd_si128(_mm_set1_pd(19342813113834066795298816.)); // 2^84
+    const __m128i p52 = _mm_castpd_si128(_mm_set1_pd(4503599627370496.));           // 2^52
+    const __m128i high = _mm_or_si128(_mm_srli_epi64(xmm0, 32), p84);
+    const __m128i low = _mm_blend_epi16(xmm0, p52, 0xcc);
+    const __m128d f = _mm_sub_pd(_mm_castsi128_pd(high), _mm_set1_pd(19342813118337666422669312.)); // 2^84 + 2^52
+    return _mm_add_pd(f, _mm_castsi128_pd(low));
+}
+
+/** signed 64 bits to double, the signed 16 high bits in the mantissa of 3*2^67, the 48 low bits in the one of
+    2^52 */
+forceinline __m128d cvtepi64_pd(__m128i xmm0) {
+    const __m128i p67 = _mm_castpd_si128(_mm_set1_pd(442721857769029238784.)); // 3*2^67
+    const __m128i p52 = _mm_castpd_si128(_mm_set1_pd(4503599627370496.));      // 2^52
+    const __m128i high = _mm_add_epi64(_mm_blend_epi16(_mm_srai_epi32(xmm0, 16), _mm_setzero_si128(), 0x33), p67);
+    const __m128i low = _mm_blend_epi16(xmm0, p52, 0x88);
+    const __m128d f = _mm_sub_pd(_mm_castsi128_pd(high), _mm_set1_pd(442726361368656609280.)); // 3*2^67 + 2^52
+    return _mm_add_pd(f, _mm_castsi128_pd(low));
+}
+} // namespace detail
+/** \endcond */
+
+/**
+ Evaluate the << operator between two registers, warning only the first 32 bits of xmm1 are used
+ specialisation int,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<int, cyme::sse, 1>::register_type
+_mm_sll<int, cyme::sse, 1>(simd_trait<int, cyme::sse, 1>::register_type xmm0,
+                           simd_trait<int, cyme::sse, 1>::register_type xmm1) {
+    return detail::sll_epi32(xmm0, xmm1);
+}
+
+/**
+ Evaluate the << operator between two registers, warning only the first 32 bits of xmm1 are used
+ specialisation int,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<int, cyme::sse, 2>::register_type
+_mm_sll<int, cyme::sse, 2>(simd_trait<int, cyme::sse, 2>::register_type xmm0,
+                           simd_trait<int, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<int, cyme::sse, 2>::register_type(detail::sll_epi32(xmm0.r0, xmm1.r0),
+                                                        detail::sll_epi32(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the << operator between two registers, warning only the first 32 bits of xmm1 are used
+ specialisation int,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<int, cyme::sse, 4>::register_type
+_mm_sll<int, cyme::sse, 4>(simd_trait<int, cyme::sse, 4>::register_type xmm0,
+                           simd_trait<int, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<int, cyme::sse, 4>::register_type(
+        detail::sll_epi32(xmm0.r0, xmm1.r0), detail::sll_epi32(xmm0.r1, xmm1.r1), detail::sll_epi32(xmm0.r2, xmm1.r2),
+        detail::sll_epi32(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Load a 64 bits integer into all the elements of the registers
+ specialisation int64_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 1>::register_type
+_mm_load1<std::int64_t, cyme::sse, 1>(const simd_trait<std::int64_t, cyme::sse, 1>::value_type &a) {
+    return _mm_set1_epi64x(a);
+}
+
+/**
+ Load a 64 bits integer into all the elements of the registers
+ specialisation int64_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 2>::register_type
+_mm_load1<std::int64_t, cyme::sse, 2>(const simd_trait<std::int64_t, cyme::sse, 2>::value_type &a) {
+    return simd_trait<std::int64_t, cyme::sse, 2>::register_type(_mm_set1_epi64x(a), _mm_set1_epi64x(a));
+}
+
+/**
+ Load a 64 bits integer into all the elements of the registers
+ specialisation int64_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 4>::register_type
+_mm_load1<std::int64_t, cyme::sse, 4>(const simd_trait<std::int64_t, cyme::sse, 4>::value_type &a) {
+    return simd_trait<std::int64_t, cyme::sse, 4>::register_type(_mm_set1_epi64x(a), _mm_set1_epi64x(a),
+                                                                 _mm_set1_epi64x(a), _mm_set1_epi64x(a));
+}
+
+/**
+ Load the 64 bits integers from cyme (aligned)
+ specialisation int64_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 1>::register_type
+_mm_load<std::int64_t, cyme::sse, 1>(simd_trait<std::int64_t, cyme::sse, 1>::const_pointer a) {
+    return _mm_load_si128((__m128i *)a);
+}
+
+/**
+ Load the 64 bits integers from cyme (aligned)
+ specialisation int64_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 2>::register_type
+_mm_load<std::int64_t, cyme::sse, 2>(simd_trait<std::int64_t, cyme::sse, 2>::const_pointer a) {
+    return simd_trait<std::int64_t, cyme::sse, 2>::register_type(_mm_load_si128((__m128i *)a),
+                                                                 _mm_load_si128((__m128i *)(a + 2)));
+}
+
+/**
+ Load the 64 bits integers from cyme (aligned)
+ specialisation int64_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 4>::register_type
+_mm_load<std::int64_t, cyme::sse, 4>(simd_trait<std::int64_t, cyme::sse, 4>::const_pointer a) {
+    return simd_trait<std::int64_t, cyme::sse, 4>::register_type(
+        _mm_load_si128((__m128i *)a), _mm_load_si128((__m128i *)(a + 2)), _mm_load_si128((__m128i *)(a + 4)),
+        _mm_load_si128((__m128i *)(a + 6)));
+}
+
+/**
+ Store the 64 bits integers into cyme (aligned)
+ specialisation int64_t,cyme::sse,1 regs
+ */
+template <>
+forceinline void
+_mm_store<std::int64_t, cyme::sse, 1>(simd_trait<std::int64_t, cyme::sse, 1>::register_type xmm0,
+                                      simd_trait<std::int64_t, cyme::sse, 1>::pointer a) {
+    _mm_store_si128((__m128i *)a, xmm0);
+}
+
+/**
+ Store the 64 bits integers into cyme (aligned)
+ specialisation int64_t,cyme::sse,2 regs
+ */
+template <>
+forceinline void
+_mm_store<std::int64_t, cyme::sse, 2>(simd_trait<std::int64_t, cyme::sse, 2>::register_type xmm0,
+                                      simd_trait<std::int64_t, cyme::sse, 2>::pointer a) {
+    _mm_store_si128((__m128i *)a, xmm0.r0);
+    _mm_store_si128((__m128i *)(a + 2), xmm0.r1);
+}
+
+/**
+ Store the 64 bits integers into cyme (aligned)
+ specialisation int64_t,cyme::sse,4 regs
+ */
+template <>
+forceinline void
+_mm_store<std::int64_t, cyme::sse, 4>(simd_trait<std::int64_t, cyme::sse, 4>::register_type xmm0,
+                                      simd_trait<std::int64_t, cyme::sse, 4>::pointer a) {
+    _mm_store_si128((__m128i *)a, xmm0.r0);
+    _mm_store_si128((__m128i *)(a + 2), xmm0.r1);
+    _mm_store_si128((__m128i *)(a + 4), xmm0.r2);
+    _mm_store_si128((__m128i *)(a + 6), xmm0.r3);
+}
+
+/**
+ Add the 64 bits integers
+ specialisation int64_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 1>::register_type
+_mm_add<std::int64_t, cyme::sse, 1>(simd_trait<std::int64_t, cyme::sse, 1>::register_type xmm0,
+                                    simd_trait<std::int64_t, cyme::sse, 1>::register_type xmm1) {
+    return _mm_add_epi64(xmm0, xmm1);
+}
+
+/**
+ Add the 64 bits integers
+ specialisation int64_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 2>::register_type
+_mm_add<std::int64_t, cyme::sse, 2>(simd_trait<std::int64_t, cyme::sse, 2>::register_type xmm0,
+                                    simd_trait<std::int64_t, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::sse, 2>::register_type(_mm_add_epi64(xmm0.r0, xmm1.r0),
+                                                                 _mm_add_epi64(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Add the 64 bits integers
+ specialisation int64_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 4>::register_type
+_mm_add<std::int64_t, cyme::sse, 4>(simd_trait<std::int64_t, cyme::sse, 4>::register_type xmm0,
+                                    simd_trait<std::int64_t, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::sse, 4>::register_type(
+        _mm_add_epi64(xmm0.r0, xmm1.r0), _mm_add_epi64(xmm0.r1, xmm1.r1), _mm_add_epi64(xmm0.r2, xmm1.r2),
+        _mm_add_epi64(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Subtract the 64 bits integers, xmm0 - xmm1
+ specialisation int64_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 1>::register_type
+_mm_sub<std::int64_t, cyme::sse, 1>(simd_trait<std::int64_t, cyme::sse, 1>::register_type xmm0,
+                                    simd_trait<std::int64_t, cyme::sse, 1>::register_type xmm1) {
+    return _mm_sub_epi64(xmm0, xmm1);
+}
+
+/**
+ Subtract the 64 bits integers, xmm0 - xmm1
+ specialisation int64_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 2>::register_type
+_mm_sub<std::int64_t, cyme::sse, 2>(simd_trait<std::int64_t, cyme::sse, 2>::register_type xmm0,
+                                    simd_trait<std::int64_t, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::sse, 2>::register_type(_mm_sub_epi64(xmm0.r0, xmm1.r0),
+                                                                 _mm_sub_epi64(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Subtract the 64 bits integers, xmm0 - xmm1
+ specialisation int64_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 4>::register_type
+_mm_sub<std::int64_t, cyme::sse, 4>(simd_trait<std::int64_t, cyme::sse, 4>::register_type xmm0,
+                                    simd_trait<std::int64_t, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::sse, 4>::register_type(
+        _mm_sub_epi64(xmm0.r0, xmm1.r0), _mm_sub_epi64(xmm0.r1, xmm1.r1), _mm_sub_epi64(xmm0.r2, xmm1.r2),
+        _mm_sub_epi64(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Multiply the 64 bits integers, the low 64 bits of the products
+ specialisation int64_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 1>::register_type
+_mm_mul<std::int64_t, cyme::sse, 1>(simd_trait<std::int64_t, cyme::sse, 1>::register_type xmm0,
+                                    simd_trait<std::int64_t, cyme::sse, 1>::register_type xmm1) {
+    return detail::mullo_epi64(xmm0, xmm1);
+}
+
+/**
+ Multiply the 64 bits integers, the low 64 bits of the products
+ specialisation int64_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 2>::register_type
+_mm_mul<std::int64_t, cyme::sse, 2>(simd_trait<std::int64_t, cyme::sse, 2>::register_type xmm0,
+                                    simd_trait<std::int64_t, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::sse, 2>::register_type(detail::mullo_epi64(xmm0.r0, xmm1.r0),
+                                                                 detail::mullo_epi64(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Multiply the 64 bits integers, the low 64 bits of the products
+ specialisation int64_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 4>::register_type
+_mm_mul<std::int64_t, cyme::sse, 4>(simd_trait<std::int64_t, cyme::sse, 4>::register_type xmm0,
+                                    simd_trait<std::int64_t, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::sse, 4>::register_type(
+        detail::mullo_epi64(xmm0.r0, xmm1.r0), detail::mullo_epi64(xmm0.r1, xmm1.r1),
+        detail::mullo_epi64(xmm0.r2, xmm1.r2), detail::mullo_epi64(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the << operator, the shift is the first element of xmm1
+ specialisation int64_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 1>::register_type
+_mm_sll<std::int64_t, cyme::sse, 1>(simd_trait<std::int64_t, cyme::sse, 1>::register_type xmm0,
+                                    simd_trait<std::int64_t, cyme::sse, 1>::register_type xmm1) {
+    return _mm_sll_epi64(xmm0, xmm1);
+}
+
+/**
+ Evaluate the << operator, the shift is the first element of xmm1
+ specialisation int64_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 2>::register_type
+_mm_sll<std::int64_t, cyme::sse, 2>(simd_trait<std::int64_t, cyme::sse, 2>::register_type xmm0,
+                                    simd_trait<std::int64_t, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::sse, 2>::register_type(_mm_sll_epi64(xmm0.r0, xmm1.r0),
+                                                                 _mm_sll_epi64(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the << operator, the shift is the first element of xmm1
+ specialisation int64_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 4>::register_type
+_mm_sll<std::int64_t, cyme::sse, 4>(simd_trait<std::int64_t, cyme::sse, 4>::register_type xmm0,
+                                    simd_trait<std::int64_t, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::sse, 4>::register_type(
+        _mm_sll_epi64(xmm0.r0, xmm1.r0), _mm_sll_epi64(xmm0.r1, xmm1.r1), _mm_sll_epi64(xmm0.r2, xmm1.r2),
+        _mm_sll_epi64(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the >> operator, the shift is the first element of xmm1, arithmetic shift
+ specialisation int64_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 1>::register_type
+_mm_srl<std::int64_t, cyme::sse, 1>(simd_trait<std::int64_t, cyme::sse, 1>::register_type xmm0,
+                                    simd_trait<std::int64_t, cyme::sse, 1>::register_type xmm1) {
+    return detail::sra_epi64(xmm0, xmm1);
+}
+
+/**
+ Evaluate the >> operator, the shift is the first element of xmm1, arithmetic shift
+ specialisation int64_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 2>::register_type
+_mm_srl<std::int64_t, cyme::sse, 2>(simd_trait<std::int64_t, cyme::sse, 2>::register_type xmm0,
+                                    simd_trait<std::int64_t, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::sse, 2>::register_type(detail::sra_epi64(xmm0.r0, xmm1.r0),
+                                                                 detail::sra_epi64(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the >> operator, the shift is the first element of xmm1, arithmetic shift
+ specialisation int64_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 4>::register_type
+_mm_srl<std::int64_t, cyme::sse, 4>(simd_trait<std::int64_t, cyme::sse, 4>::register_type xmm0,
+                                    simd_trait<std::int64_t, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::sse, 4>::register_type(
+        detail::sra_epi64(xmm0.r0, xmm1.r0), detail::sra_epi64(xmm0.r1, xmm1.r1), detail::sra_epi64(xmm0.r2, xmm1.r2),
+        detail::sra_epi64(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the == operator, the elements are 0 (false) or all bits set (true)
+ specialisation int64_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 1>::register_type
+_mm_eq<std::int64_t, cyme::sse, 1>(simd_trait<std::int64_t, cyme::sse, 1>::register_type xmm0,
+                                   simd_trait<std::int64_t, cyme::sse, 1>::register_type xmm1) {
+    return _mm_cmpeq_epi64(xmm0, xmm1);
+}
+
+/**
+ Evaluate the == operator, the elements are 0 (false) or all bits set (true)
+ specialisation int64_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 2>::register_type
+_mm_eq<std::int64_t, cyme::sse, 2>(simd_trait<std::int64_t, cyme::sse, 2>::register_type xmm0,
+                                   simd_trait<std::int64_t, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::sse, 2>::register_type(_mm_cmpeq_epi64(xmm0.r0, xmm1.r0),
+                                                                 _mm_cmpeq_epi64(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the == operator, the elements are 0 (false) or all bits set (true)
+ specialisation int64_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 4>::register_type
+_mm_eq<std::int64_t, cyme::sse, 4>(simd_trait<std::int64_t, cyme::sse, 4>::register_type xmm0,
+                                   simd_trait<std::int64_t, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::sse, 4>::register_type(
+        _mm_cmpeq_epi64(xmm0.r0, xmm1.r0), _mm_cmpeq_epi64(xmm0.r1, xmm1.r1), _mm_cmpeq_epi64(xmm0.r2, xmm1.r2),
+        _mm_cmpeq_epi64(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the != operator, the elements are 0 (false) or all bits set (true)
+ specialisation int64_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 1>::register_type
+_mm_ne<std::int64_t, cyme::sse, 1>(simd_trait<std::int64_t, cyme::sse, 1>::register_type xmm0,
+                                   simd_trait<std::int64_t, cyme::sse, 1>::register_type xmm1) {
+    return detail::cmpne_epi64(xmm0, xmm1);
+}
+
+/**
+ Evaluate the != operator, the elements are 0 (false) or all bits set (true)
+ specialisation int64_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 2>::register_type
+_mm_ne<std::int64_t, cyme::sse, 2>(simd_trait<std::int64_t, cyme::sse, 2>::register_type xmm0,
+                                   simd_trait<std::int64_t, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::sse, 2>::register_type(detail::cmpne_epi64(xmm0.r0, xmm1.r0),
+                                                                 detail::cmpne_epi64(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the != operator, the elements are 0 (false) or all bits set (true)
+ specialisation int64_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 4>::register_type
+_mm_ne<std::int64_t, cyme::sse, 4>(simd_trait<std::int64_t, cyme::sse, 4>::register_type xmm0,
+                                   simd_trait<std::int64_t, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::sse, 4>::register_type(
+        detail::cmpne_epi64(xmm0.r0, xmm1.r0), detail::cmpne_epi64(xmm0.r1, xmm1.r1),
+        detail::cmpne_epi64(xmm0.r2, xmm1.r2), detail::cmpne_epi64(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the < operator, the elements are 0 (false) or all bits set (true)
+ specialisation int64_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 1>::register_type
+_mm_lt<std::int64_t, cyme::sse, 1>(simd_trait<std::int64_t, cyme::sse, 1>::register_type xmm0,
+                                   simd_trait<std::int64_t, cyme::sse, 1>::register_type xmm1) {
+    return detail::cmplt_epi64(xmm0, xmm1);
+}
+
+/**
+ Evaluate the < operator, the elements are 0 (false) or all bits set (true)
+ specialisation int64_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 2>::register_type
+_mm_lt<std::int64_t, cyme::sse, 2>(simd_trait<std::int64_t, cyme::sse, 2>::register_type xmm0,
+                                   simd_trait<std::int64_t, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::sse, 2>::register_type(detail::cmplt_epi64(xmm0.r0, xmm1.r0),
+                                                                 detail::cmplt_epi64(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the < operator, the elements are 0 (false) or all bits set (true)
+ specialisation int64_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 4>::register_type
+_mm_lt<std::int64_t, cyme::sse, 4>(simd_trait<std::int64_t, cyme::sse, 4>::register_type xmm0,
+                                   simd_trait<std::int64_t, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::sse, 4>::register_type(
+        detail::cmplt_epi64(xmm0.r0, xmm1.r0), detail::cmplt_epi64(xmm0.r1, xmm1.r1),
+        detail::cmplt_epi64(xmm0.r2, xmm1.r2), detail::cmplt_epi64(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the <= operator, the elements are 0 (false) or all bits set (true)
+ specialisation int64_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 1>::register_type
+_mm_le<std::int64_t, cyme::sse, 1>(simd_trait<std::int64_t, cyme::sse, 1>::register_type xmm0,
+                                   simd_trait<std::int64_t, cyme::sse, 1>::register_type xmm1) {
+    return detail::cmple_epi64(xmm0, xmm1);
+}
+
+/**
+ Evaluate the <= operator, the elements are 0 (false) or all bits set (true)
+ specialisation int64_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 2>::register_type
+_mm_le<std::int64_t, cyme::sse, 2>(simd_trait<std::int64_t, cyme::sse, 2>::register_type xmm0,
+                                   simd_trait<std::int64_t, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::sse, 2>::register_type(detail::cmple_epi64(xmm0.r0, xmm1.r0),
+                                                                 detail::cmple_epi64(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the <= operator, the elements are 0 (false) or all bits set (true)
+ specialisation int64_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 4>::register_type
+_mm_le<std::int64_t, cyme::sse, 4>(simd_trait<std::int64_t, cyme::sse, 4>::register_type xmm0,
+                                   simd_trait<std::int64_t, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::sse, 4>::register_type(
+        detail::cmple_epi64(xmm0.r0, xmm1.r0), detail::cmple_epi64(xmm0.r1, xmm1.r1),
+        detail::cmple_epi64(xmm0.r2, xmm1.r2), detail::cmple_epi64(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the & operator between two registers
+ specialisation int64_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 1>::register_type
+_mm_and<std::int64_t, cyme::sse, 1>(simd_trait<std::int64_t, cyme::sse, 1>::register_type xmm0,
+                                    simd_trait<std::int64_t, cyme::sse, 1>::register_type xmm1) {
+    return _mm_and_si128(xmm0, xmm1);
+}
+
+/**
+ Evaluate the & operator between two registers
+ specialisation int64_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 2>::register_type
+_mm_and<std::int64_t, cyme::sse, 2>(simd_trait<std::int64_t, cyme::sse, 2>::register_type xmm0,
+                                    simd_trait<std::int64_t, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::sse, 2>::register_type(_mm_and_si128(xmm0.r0, xmm1.r0),
+                                                                 _mm_and_si128(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the & operator between two registers
+ specialisation int64_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 4>::register_type
+_mm_and<std::int64_t, cyme::sse, 4>(simd_trait<std::int64_t, cyme::sse, 4>::register_type xmm0,
+                                    simd_trait<std::int64_t, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::sse, 4>::register_type(
+        _mm_and_si128(xmm0.r0, xmm1.r0), _mm_and_si128(xmm0.r1, xmm1.r1), _mm_and_si128(xmm0.r2, xmm1.r2),
+        _mm_and_si128(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the | operator between two registers
+ specialisation int64_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 1>::register_type
+_mm_or<std::int64_t, cyme::sse, 1>(simd_trait<std::int64_t, cyme::sse, 1>::register_type xmm0,
+                                   simd_trait<std::int64_t, cyme::sse, 1>::register_type xmm1) {
+    return _mm_or_si128(xmm0, xmm1);
+}
+
+/**
+ Evaluate the | operator between two registers
+ specialisation int64_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 2>::register_type
+_mm_or<std::int64_t, cyme::sse, 2>(simd_trait<std::int64_t, cyme::sse, 2>::register_type xmm0,
+                                   simd_trait<std::int64_t, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::sse, 2>::register_type(_mm_or_si128(xmm0.r0, xmm1.r0),
+                                                                 _mm_or_si128(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the | operator between two registers
+ specialisation int64_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 4>::register_type
+_mm_or<std::int64_t, cyme::sse, 4>(simd_trait<std::int64_t, cyme::sse, 4>::register_type xmm0,
+                                   simd_trait<std::int64_t, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::sse, 4>::register_type(
+        _mm_or_si128(xmm0.r0, xmm1.r0), _mm_or_si128(xmm0.r1, xmm1.r1), _mm_or_si128(xmm0.r2, xmm1.r2),
+        _mm_or_si128(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the ^ operator between two registers
+ specialisation int64_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 1>::register_type
+_mm_xor<std::int64_t, cyme::sse, 1>(simd_trait<std::int64_t, cyme::sse, 1>::register_type xmm0,
+                                    simd_trait<std::int64_t, cyme::sse, 1>::register_type xmm1) {
+    return _mm_xor_si128(xmm0, xmm1);
+}
+
+/**
+ Evaluate the ^ operator between two registers
+ specialisation int64_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 2>::register_type
+_mm_xor<std::int64_t, cyme::sse, 2>(simd_trait<std::int64_t, cyme::sse, 2>::register_type xmm0,
+                                    simd_trait<std::int64_t, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::sse, 2>::register_type(_mm_xor_si128(xmm0.r0, xmm1.r0),
+                                                                 _mm_xor_si128(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the ^ operator between two registers
+ specialisation int64_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 4>::register_type
+_mm_xor<std::int64_t, cyme::sse, 4>(simd_trait<std::int64_t, cyme::sse, 4>::register_type xmm0,
+                                    simd_trait<std::int64_t, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<std::int64_t, cyme::sse, 4>::register_type(
+        _mm_xor_si128(xmm0.r0, xmm1.r0), _mm_xor_si128(xmm0.r1, xmm1.r1), _mm_xor_si128(xmm0.r2, xmm1.r2),
+        _mm_xor_si128(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the ~ operator
+ specialisation int64_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 1>::register_type
+_mm_andnot<std::int64_t, cyme::sse, 1>(simd_trait<std::int64_t, cyme::sse, 1>::register_type xmm0) {
+    return detail::not_si(xmm0);
+}
+
+/**
+ Evaluate the ~ operator
+ specialisation int64_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 2>::register_type
+_mm_andnot<std::int64_t, cyme::sse, 2>(simd_trait<std::int64_t, cyme::sse, 2>::register_type xmm0) {
+    return simd_trait<std::int64_t, cyme::sse, 2>::register_type(detail::not_si(xmm0.r0), detail::not_si(xmm0.r1));
+}
+
+/**
+ Evaluate the ~ operator
+ specialisation int64_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::int64_t, cyme::sse, 4>::register_type
+_mm_andnot<std::int64_t, cyme::sse, 4>(simd_trait<std::int64_t, cyme::sse, 4>::register_type xmm0) {
+    return simd_trait<std::int64_t, cyme::sse, 4>::register_type(detail::not_si(xmm0.r0), detail::not_si(xmm0.r1),
+                                                                 detail::not_si(xmm0.r2), detail::not_si(xmm0.r3));
+}
+
+/**
+ Convert the 64 bits integers to double, rounded to the nearest
+ specialisation int64_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::sse, 1>::register_type
+_mm_cvt<std::int64_t, cyme::sse, 1, double>(simd_trait<std::int64_t, cyme::sse, 1>::register_type xmm0) {
+    return detail::cvtepi64_pd(xmm0);
+}
+
+/**
+ Convert the 64 bits integers to double, rounded to the nearest
+ specialisation int64_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::sse, 2>::register_type
+_mm_cvt<std::int64_t, cyme::sse, 2, double>(simd_trait<std::int64_t, cyme::sse, 2>::register_type xmm0) {
+    return simd_trait<double, cyme::sse, 2>::register_type(detail::cvtepi64_pd(xmm0.r0), detail::cvtepi64_pd(xmm0.r1));
+}
+
+/**
+ Convert the 64 bits integers to double, rounded to the nearest
+ specialisation int64_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::sse, 4>::register_type
+_mm_cvt<std::int64_t, cyme::sse, 4, double>(simd_trait<std::int64_t, cyme::sse, 4>::register_type xmm0) {
+    return simd_trait<double, cyme::sse, 4>::register_type(detail::cvtepi64_pd(xmm0.r0), detail::cvtepi64_pd(xmm0.r1),
+                                                           detail::cvtepi64_pd(xmm0.r2), detail::cvtepi64_pd(xmm0.r3));
+}
+
+/**
+ Load a 32 bits unsigned integer into all the elements of the registers
+ specialisation uint32_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 1>::register_type
+_mm_load1<std::uint32_t, cyme::sse, 1>(const simd_trait<std::uint32_t, cyme::sse, 1>::value_type &a) {
+    return _mm_set1_epi32(a);
+}
+
+/**
+ Load a 32 bits unsigned integer into all the elements of the registers
+ specialisation uint32_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 2>::register_type
+_mm_load1<std::uint32_t, cyme::sse, 2>(const simd_trait<std::uint32_t, cyme::sse, 2>::value_type &a) {
+    return simd_trait<std::uint32_t, cyme::sse, 2>::register_type(_mm_set1_epi32(a), _mm_set1_epi32(a));
+}
+
+/**
+ Load a 32 bits unsigned integer into all the elements of the registers
+ specialisation uint32_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 4>::register_type
+_mm_load1<std::uint32_t, cyme::sse, 4>(const simd_trait<std::uint32_t, cyme::sse, 4>::value_type &a) {
+    return simd_trait<std::uint32_t, cyme::sse, 4>::register_type(_mm_set1_epi32(a), _mm_set1_epi32(a),
+                                                                  _mm_set1_epi32(a), _mm_set1_epi32(a));
+}
+
+/**
+ Load the 32 bits unsigned integers from cyme (aligned)
+ specialisation uint32_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 1>::register_type
+_mm_load<std::uint32_t, cyme::sse, 1>(simd_trait<std::uint32_t, cyme::sse, 1>::const_pointer a) {
+    return _mm_load_si128((__m128i *)a);
+}
+
+/**
+ Load the 32 bits unsigned integers from cyme (aligned)
+ specialisation uint32_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 2>::register_type
+_mm_load<std::uint32_t, cyme::sse, 2>(simd_trait<std::uint32_t, cyme::sse, 2>::const_pointer a) {
+    return simd_trait<std::uint32_t, cyme::sse, 2>::register_type(_mm_load_si128((__m128i *)a),
+                                                                  _mm_load_si128((__m128i *)(a + 4)));
+}
+
+/**
+ Load the 32 bits unsigned integers from cyme (aligned)
+ specialisation uint32_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 4>::register_type
+_mm_load<std::uint32_t, cyme::sse, 4>(simd_trait<std::uint32_t, cyme::sse, 4>::const_pointer a) {
+    return simd_trait<std::uint32_t, cyme::sse, 4>::register_type(
+        _mm_load_si128((__m128i *)a), _mm_load_si128((__m128i *)(a + 4)), _mm_load_si128((__m128i *)(a + 8)),
+        _mm_load_si128((__m128i *)(a + 12)));
+}
+
+/**
+ Store the 32 bits unsigned integers into cyme (aligned)
+ specialisation uint32_t,cyme::sse,1 regs
+ */
+template <>
+forceinline void
+_mm_store<std::uint32_t, cyme::sse, 1>(simd_trait<std::uint32_t, cyme::sse, 1>::register_type xmm0,
+                                       simd_trait<std::uint32_t, cyme::sse, 1>::pointer a) {
+    _mm_store_si128((__m128i *)a, xmm0);
+}
+
+/**
+ Store the 32 bits unsigned integers into cyme (aligned)
+ specialisation uint32_t,cyme::sse,2 regs
+ */
+template <>
+forceinline void
+_mm_store<std::uint32_t, cyme::sse, 2>(simd_trait<std::uint32_t, cyme::sse, 2>::register_type xmm0,
+                                       simd_trait<std::uint32_t, cyme::sse, 2>::pointer a) {
+    _mm_store_si128((__m128i *)a, xmm0.r0);
+    _mm_store_si128((__m128i *)(a + 4), xmm0.r1);
+}
+
+/**
+ Store the 32 bits unsigned integers into cyme (aligned)
+ specialisation uint32_t,cyme::sse,4 regs
+ */
+template <>
+forceinline void
+_mm_store<std::uint32_t, cyme::sse, 4>(simd_trait<std::uint32_t, cyme::sse, 4>::register_type xmm0,
+                                       simd_trait<std::uint32_t, cyme::sse, 4>::pointer a) {
+    _mm_store_si128((__m128i *)a, xmm0.r0);
+    _mm_store_si128((__m128i *)(a + 4), xmm0.r1);
+    _mm_store_si128((__m128i *)(a + 8), xmm0.r2);
+    _mm_store_si128((__m128i *)(a + 12), xmm0.r3);
+}
+
+/**
+ Add the 32 bits unsigned integers
+ specialisation uint32_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 1>::register_type
+_mm_add<std::uint32_t, cyme::sse, 1>(simd_trait<std::uint32_t, cyme::sse, 1>::register_type xmm0,
+                                     simd_trait<std::uint32_t, cyme::sse, 1>::register_type xmm1) {
+    return _mm_add_epi32(xmm0, xmm1);
+}
+
+/**
+ Add the 32 bits unsigned integers
+ specialisation uint32_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 2>::register_type
+_mm_add<std::uint32_t, cyme::sse, 2>(simd_trait<std::uint32_t, cyme::sse, 2>::register_type xmm0,
+                                     simd_trait<std::uint32_t, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::sse, 2>::register_type(_mm_add_epi32(xmm0.r0, xmm1.r0),
+                                                                  _mm_add_epi32(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Add the 32 bits unsigned integers
+ specialisation uint32_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 4>::register_type
+_mm_add<std::uint32_t, cyme::sse, 4>(simd_trait<std::uint32_t, cyme::sse, 4>::register_type xmm0,
+                                     simd_trait<std::uint32_t, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::sse, 4>::register_type(
+        _mm_add_epi32(xmm0.r0, xmm1.r0), _mm_add_epi32(xmm0.r1, xmm1.r1), _mm_add_epi32(xmm0.r2, xmm1.r2),
+        _mm_add_epi32(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Subtract the 32 bits unsigned integers, xmm0 - xmm1
+ specialisation uint32_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 1>::register_type
+_mm_sub<std::uint32_t, cyme::sse, 1>(simd_trait<std::uint32_t, cyme::sse, 1>::register_type xmm0,
+                                     simd_trait<std::uint32_t, cyme::sse, 1>::register_type xmm1) {
+    return _mm_sub_epi32(xmm0, xmm1);
+}
+
+/**
+ Subtract the 32 bits unsigned integers, xmm0 - xmm1
+ specialisation uint32_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 2>::register_type
+_mm_sub<std::uint32_t, cyme::sse, 2>(simd_trait<std::uint32_t, cyme::sse, 2>::register_type xmm0,
+                                     simd_trait<std::uint32_t, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::sse, 2>::register_type(_mm_sub_epi32(xmm0.r0, xmm1.r0),
+                                                                  _mm_sub_epi32(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Subtract the 32 bits unsigned integers, xmm0 - xmm1
+ specialisation uint32_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 4>::register_type
+_mm_sub<std::uint32_t, cyme::sse, 4>(simd_trait<std::uint32_t, cyme::sse, 4>::register_type xmm0,
+                                     simd_trait<std::uint32_t, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::sse, 4>::register_type(
+        _mm_sub_epi32(xmm0.r0, xmm1.r0), _mm_sub_epi32(xmm0.r1, xmm1.r1), _mm_sub_epi32(xmm0.r2, xmm1.r2),
+        _mm_sub_epi32(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Multiply the 32 bits unsigned integers, the low 32 bits of the products
+ specialisation uint32_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 1>::register_type
+_mm_mul<std::uint32_t, cyme::sse, 1>(simd_trait<std::uint32_t, cyme::sse, 1>::register_type xmm0,
+                                     simd_trait<std::uint32_t, cyme::sse, 1>::register_type xmm1) {
+    return _mm_mullo_epi32(xmm0, xmm1);
+}
+
+/**
+ Multiply the 32 bits unsigned integers, the low 32 bits of the products
+ specialisation uint32_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 2>::register_type
+_mm_mul<std::uint32_t, cyme::sse, 2>(simd_trait<std::uint32_t, cyme::sse, 2>::register_type xmm0,
+                                     simd_trait<std::uint32_t, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::sse, 2>::register_type(_mm_mullo_epi32(xmm0.r0, xmm1.r0),
+                                                                  _mm_mullo_epi32(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Multiply the 32 bits unsigned integers, the low 32 bits of the products
+ specialisation uint32_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 4>::register_type
+_mm_mul<std::uint32_t, cyme::sse, 4>(simd_trait<std::uint32_t, cyme::sse, 4>::register_type xmm0,
+                                     simd_trait<std::uint32_t, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::sse, 4>::register_type(
+        _mm_mullo_epi32(xmm0.r0, xmm1.r0), _mm_mullo_epi32(xmm0.r1, xmm1.r1), _mm_mullo_epi32(xmm0.r2, xmm1.r2),
+        _mm_mullo_epi32(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the << operator, the shift is the first element of xmm1
+ specialisation uint32_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 1>::register_type
+_mm_sll<std::uint32_t, cyme::sse, 1>(simd_trait<std::uint32_t, cyme::sse, 1>::register_type xmm0,
+                                     simd_trait<std::uint32_t, cyme::sse, 1>::register_type xmm1) {
+    return detail::sll_epi32(xmm0, xmm1);
+}
+
+/**
+ Evaluate the << operator, the shift is the first element of xmm1
+ specialisation uint32_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 2>::register_type
+_mm_sll<std::uint32_t, cyme::sse, 2>(simd_trait<std::uint32_t, cyme::sse, 2>::register_type xmm0,
+                                     simd_trait<std::uint32_t, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::sse, 2>::register_type(detail::sll_epi32(xmm0.r0, xmm1.r0),
+                                                                  detail::sll_epi32(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the << operator, the shift is the first element of xmm1
+ specialisation uint32_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 4>::register_type
+_mm_sll<std::uint32_t, cyme::sse, 4>(simd_trait<std::uint32_t, cyme::sse, 4>::register_type xmm0,
+                                     simd_trait<std::uint32_t, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::sse, 4>::register_type(
+        detail::sll_epi32(xmm0.r0, xmm1.r0), detail::sll_epi32(xmm0.r1, xmm1.r1), detail::sll_epi32(xmm0.r2, xmm1.r2),
+        detail::sll_epi32(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the >> operator, the shift is the first element of xmm1
+ specialisation uint32_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 1>::register_type
+_mm_srl<std::uint32_t, cyme::sse, 1>(simd_trait<std::uint32_t, cyme::sse, 1>::register_type xmm0,
+                                     simd_trait<std::uint32_t, cyme::sse, 1>::register_type xmm1) {
+    return detail::srl_epi32(xmm0, xmm1);
+}
+
+/**
+ Evaluate the >> operator, the shift is the first element of xmm1
+ specialisation uint32_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 2>::register_type
+_mm_srl<std::uint32_t, cyme::sse, 2>(simd_trait<std::uint32_t, cyme::sse, 2>::register_type xmm0,
+                                     simd_trait<std::uint32_t, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::sse, 2>::register_type(detail::srl_epi32(xmm0.r0, xmm1.r0),
+                                                                  detail::srl_epi32(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the >> operator, the shift is the first element of xmm1
+ specialisation uint32_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 4>::register_type
+_mm_srl<std::uint32_t, cyme::sse, 4>(simd_trait<std::uint32_t, cyme::sse, 4>::register_type xmm0,
+                                     simd_trait<std::uint32_t, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::sse, 4>::register_type(
+        detail::srl_epi32(xmm0.r0, xmm1.r0), detail::srl_epi32(xmm0.r1, xmm1.r1), detail::srl_epi32(xmm0.r2, xmm1.r2),
+        detail::srl_epi32(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the == operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint32_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 1>::register_type
+_mm_eq<std::uint32_t, cyme::sse, 1>(simd_trait<std::uint32_t, cyme::sse, 1>::register_type xmm0,
+                                    simd_trait<std::uint32_t, cyme::sse, 1>::register_type xmm1) {
+    return _mm_cmpeq_epi32(xmm0, xmm1);
+}
+
+/**
+ Evaluate the == operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint32_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 2>::register_type
+_mm_eq<std::uint32_t, cyme::sse, 2>(simd_trait<std::uint32_t, cyme::sse, 2>::register_type xmm0,
+                                    simd_trait<std::uint32_t, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::sse, 2>::register_type(_mm_cmpeq_epi32(xmm0.r0, xmm1.r0),
+                                                                  _mm_cmpeq_epi32(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the == operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint32_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 4>::register_type
+_mm_eq<std::uint32_t, cyme::sse, 4>(simd_trait<std::uint32_t, cyme::sse, 4>::register_type xmm0,
+                                    simd_trait<std::uint32_t, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::sse, 4>::register_type(
+        _mm_cmpeq_epi32(xmm0.r0, xmm1.r0), _mm_cmpeq_epi32(xmm0.r1, xmm1.r1), _mm_cmpeq_epi32(xmm0.r2, xmm1.r2),
+        _mm_cmpeq_epi32(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the != operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint32_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 1>::register_type
+_mm_ne<std::uint32_t, cyme::sse, 1>(simd_trait<std::uint32_t, cyme::sse, 1>::register_type xmm0,
+                                    simd_trait<std::uint32_t, cyme::sse, 1>::register_type xmm1) {
+    return detail::cmpne_epi32(xmm0, xmm1);
+}
+
+/**
+ Evaluate the != operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint32_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 2>::register_type
+_mm_ne<std::uint32_t, cyme::sse, 2>(simd_trait<std::uint32_t, cyme::sse, 2>::register_type xmm0,
+                                    simd_trait<std::uint32_t, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::sse, 2>::register_type(detail::cmpne_epi32(xmm0.r0, xmm1.r0),
+                                                                  detail::cmpne_epi32(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the != operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint32_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 4>::register_type
+_mm_ne<std::uint32_t, cyme::sse, 4>(simd_trait<std::uint32_t, cyme::sse, 4>::register_type xmm0,
+                                    simd_trait<std::uint32_t, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::sse, 4>::register_type(
+        detail::cmpne_epi32(xmm0.r0, xmm1.r0), detail::cmpne_epi32(xmm0.r1, xmm1.r1),
+        detail::cmpne_epi32(xmm0.r2, xmm1.r2), detail::cmpne_epi32(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the < operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint32_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 1>::register_type
+_mm_lt<std::uint32_t, cyme::sse, 1>(simd_trait<std::uint32_t, cyme::sse, 1>::register_type xmm0,
+                                    simd_trait<std::uint32_t, cyme::sse, 1>::register_type xmm1) {
+    return detail::cmplt_epu32(xmm0, xmm1);
+}
+
+/**
+ Evaluate the < operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint32_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 2>::register_type
+_mm_lt<std::uint32_t, cyme::sse, 2>(simd_trait<std::uint32_t, cyme::sse, 2>::register_type xmm0,
+                                    simd_trait<std::uint32_t, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::sse, 2>::register_type(detail::cmplt_epu32(xmm0.r0, xmm1.r0),
+                                                                  detail::cmplt_epu32(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the < operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint32_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 4>::register_type
+_mm_lt<std::uint32_t, cyme::sse, 4>(simd_trait<std::uint32_t, cyme::sse, 4>::register_type xmm0,
+                                    simd_trait<std::uint32_t, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::sse, 4>::register_type(
+        detail::cmplt_epu32(xmm0.r0, xmm1.r0), detail::cmplt_epu32(xmm0.r1, xmm1.r1),
+        detail::cmplt_epu32(xmm0.r2, xmm1.r2), detail::cmplt_epu32(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the <= operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint32_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 1>::register_type
+_mm_le<std::uint32_t, cyme::sse, 1>(simd_trait<std::uint32_t, cyme::sse, 1>::register_type xmm0,
+                                    simd_trait<std::uint32_t, cyme::sse, 1>::register_type xmm1) {
+    return detail::cmple_epu32(xmm0, xmm1);
+}
+
+/**
+ Evaluate the <= operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint32_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 2>::register_type
+_mm_le<std::uint32_t, cyme::sse, 2>(simd_trait<std::uint32_t, cyme::sse, 2>::register_type xmm0,
+                                    simd_trait<std::uint32_t, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::sse, 2>::register_type(detail::cmple_epu32(xmm0.r0, xmm1.r0),
+                                                                  detail::cmple_epu32(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the <= operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint32_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 4>::register_type
+_mm_le<std::uint32_t, cyme::sse, 4>(simd_trait<std::uint32_t, cyme::sse, 4>::register_type xmm0,
+                                    simd_trait<std::uint32_t, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::sse, 4>::register_type(
+        detail::cmple_epu32(xmm0.r0, xmm1.r0), detail::cmple_epu32(xmm0.r1, xmm1.r1),
+        detail::cmple_epu32(xmm0.r2, xmm1.r2), detail::cmple_epu32(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the & operator between two registers
+ specialisation uint32_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 1>::register_type
+_mm_and<std::uint32_t, cyme::sse, 1>(simd_trait<std::uint32_t, cyme::sse, 1>::register_type xmm0,
+                                     simd_trait<std::uint32_t, cyme::sse, 1>::register_type xmm1) {
+    return _mm_and_si128(xmm0, xmm1);
+}
+
+/**
+ Evaluate the & operator between two registers
+ specialisation uint32_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 2>::register_type
+_mm_and<std::uint32_t, cyme::sse, 2>(simd_trait<std::uint32_t, cyme::sse, 2>::register_type xmm0,
+                                     simd_trait<std::uint32_t, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::sse, 2>::register_type(_mm_and_si128(xmm0.r0, xmm1.r0),
+                                                                  _mm_and_si128(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the & operator between two registers
+ specialisation uint32_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 4>::register_type
+_mm_and<std::uint32_t, cyme::sse, 4>(simd_trait<std::uint32_t, cyme::sse, 4>::register_type xmm0,
+                                     simd_trait<std::uint32_t, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::sse, 4>::register_type(
+        _mm_and_si128(xmm0.r0, xmm1.r0), _mm_and_si128(xmm0.r1, xmm1.r1), _mm_and_si128(xmm0.r2, xmm1.r2),
+        _mm_and_si128(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the | operator between two registers
+ specialisation uint32_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 1>::register_type
+_mm_or<std::uint32_t, cyme::sse, 1>(simd_trait<std::uint32_t, cyme::sse, 1>::register_type xmm0,
+                                    simd_trait<std::uint32_t, cyme::sse, 1>::register_type xmm1) {
+    return _mm_or_si128(xmm0, xmm1);
+}
+
+/**
+ Evaluate the | operator between two registers
+ specialisation uint32_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 2>::register_type
+_mm_or<std::uint32_t, cyme::sse, 2>(simd_trait<std::uint32_t, cyme::sse, 2>::register_type xmm0,
+                                    simd_trait<std::uint32_t, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::sse, 2>::register_type(_mm_or_si128(xmm0.r0, xmm1.r0),
+                                                                  _mm_or_si128(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the | operator between two registers
+ specialisation uint32_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 4>::register_type
+_mm_or<std::uint32_t, cyme::sse, 4>(simd_trait<std::uint32_t, cyme::sse, 4>::register_type xmm0,
+                                    simd_trait<std::uint32_t, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::sse, 4>::register_type(
+        _mm_or_si128(xmm0.r0, xmm1.r0), _mm_or_si128(xmm0.r1, xmm1.r1), _mm_or_si128(xmm0.r2, xmm1.r2),
+        _mm_or_si128(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the ^ operator between two registers
+ specialisation uint32_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 1>::register_type
+_mm_xor<std::uint32_t, cyme::sse, 1>(simd_trait<std::uint32_t, cyme::sse, 1>::register_type xmm0,
+                                     simd_trait<std::uint32_t, cyme::sse, 1>::register_type xmm1) {
+    return _mm_xor_si128(xmm0, xmm1);
+}
+
+/**
+ Evaluate the ^ operator between two registers
+ specialisation uint32_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 2>::register_type
+_mm_xor<std::uint32_t, cyme::sse, 2>(simd_trait<std::uint32_t, cyme::sse, 2>::register_type xmm0,
+                                     simd_trait<std::uint32_t, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::sse, 2>::register_type(_mm_xor_si128(xmm0.r0, xmm1.r0),
+                                                                  _mm_xor_si128(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the ^ operator between two registers
+ specialisation uint32_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 4>::register_type
+_mm_xor<std::uint32_t, cyme::sse, 4>(simd_trait<std::uint32_t, cyme::sse, 4>::register_type xmm0,
+                                     simd_trait<std::uint32_t, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<std::uint32_t, cyme::sse, 4>::register_type(
+        _mm_xor_si128(xmm0.r0, xmm1.r0), _mm_xor_si128(xmm0.r1, xmm1.r1), _mm_xor_si128(xmm0.r2, xmm1.r2),
+        _mm_xor_si128(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the ~ operator
+ specialisation uint32_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 1>::register_type
+_mm_andnot<std::uint32_t, cyme::sse, 1>(simd_trait<std::uint32_t, cyme::sse, 1>::register_type xmm0) {
+    return detail::not_si(xmm0);
+}
+
+/**
+ Evaluate the ~ operator
+ specialisation uint32_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 2>::register_type
+_mm_andnot<std::uint32_t, cyme::sse, 2>(simd_trait<std::uint32_t, cyme::sse, 2>::register_type xmm0) {
+    return simd_trait<std::uint32_t, cyme::sse, 2>::register_type(detail::not_si(xmm0.r0), detail::not_si(xmm0.r1));
+}
+
+/**
+ Evaluate the ~ operator
+ specialisation uint32_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint32_t, cyme::sse, 4>::register_type
+_mm_andnot<std::uint32_t, cyme::sse, 4>(simd_trait<std::uint32_t, cyme::sse, 4>::register_type xmm0) {
+    return simd_trait<std::uint32_t, cyme::sse, 4>::register_type(detail::not_si(xmm0.r0), detail::not_si(xmm0.r1),
+                                                                  detail::not_si(xmm0.r2), detail::not_si(xmm0.r3));
+}
+
+/**
+ Convert the 32 bits unsigned integers to float, rounded to the nearest
+ specialisation uint32_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<float, cyme::sse, 1>::register_type
+_mm_cvt<std::uint32_t, cyme::sse, 1, float>(simd_trait<std::uint32_t, cyme::sse, 1>::register_type xmm0) {
+    return detail::cvtepu32_ps(xmm0);
+}
+
+/**
+ Convert the 32 bits unsigned integers to float, rounded to the nearest
+ specialisation uint32_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<float, cyme::sse, 2>::register_type
+_mm_cvt<std::uint32_t, cyme::sse, 2, float>(simd_trait<std::uint32_t, cyme::sse, 2>::register_type xmm0) {
+    return simd_trait<float, cyme::sse, 2>::register_type(detail::cvtepu32_ps(xmm0.r0), detail::cvtepu32_ps(xmm0.r1));
+}
+
+/**
+ Convert the 32 bits unsigned integers to float, rounded to the nearest
+ specialisation uint32_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<float, cyme::sse, 4>::register_type
+_mm_cvt<std::uint32_t, cyme::sse, 4, float>(simd_trait<std::uint32_t, cyme::sse, 4>::register_type xmm0) {
+    return simd_trait<float, cyme::sse, 4>::register_type(detail::cvtepu32_ps(xmm0.r0), detail::cvtepu32_ps(xmm0.r1),
+                                                          detail::cvtepu32_ps(xmm0.r2), detail::cvtepu32_ps(xmm0.r3));
+}
+
+/**
+ Load a 64 bits unsigned integer into all the elements of the registers
+ specialisation uint64_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 1>::register_type
+_mm_load1<std::uint64_t, cyme::sse, 1>(const simd_trait<std::uint64_t, cyme::sse, 1>::value_type &a) {
+    return _mm_set1_epi64x(a);
+}
+
+/**
+ Load a 64 bits unsigned integer into all the elements of the registers
+ specialisation uint64_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 2>::register_type
+_mm_load1<std::uint64_t, cyme::sse, 2>(const simd_trait<std::uint64_t, cyme::sse, 2>::value_type &a) {
+    return simd_trait<std::uint64_t, cyme::sse, 2>::register_type(_mm_set1_epi64x(a), _mm_set1_epi64x(a));
+}
+
+/**
+ Load a 64 bits unsigned integer into all the elements of the registers
+ specialisation uint64_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 4>::register_type
+_mm_load1<std::uint64_t, cyme::sse, 4>(const simd_trait<std::uint64_t, cyme::sse, 4>::value_type &a) {
+    return simd_trait<std::uint64_t, cyme::sse, 4>::register_type(_mm_set1_epi64x(a), _mm_set1_epi64x(a),
+                                                                  _mm_set1_epi64x(a), _mm_set1_epi64x(a));
+}
+
+/**
+ Load the 64 bits unsigned integers from cyme (aligned)
+ specialisation uint64_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 1>::register_type
+_mm_load<std::uint64_t, cyme::sse, 1>(simd_trait<std::uint64_t, cyme::sse, 1>::const_pointer a) {
+    return _mm_load_si128((__m128i *)a);
+}
+
+/**
+ Load the 64 bits unsigned integers from cyme (aligned)
+ specialisation uint64_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 2>::register_type
+_mm_load<std::uint64_t, cyme::sse, 2>(simd_trait<std::uint64_t, cyme::sse, 2>::const_pointer a) {
+    return simd_trait<std::uint64_t, cyme::sse, 2>::register_type(_mm_load_si128((__m128i *)a),
+                                                                  _mm_load_si128((__m128i *)(a + 2)));
+}
+
+/**
+ Load the 64 bits unsigned integers from cyme (aligned)
+ specialisation uint64_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 4>::register_type
+_mm_load<std::uint64_t, cyme::sse, 4>(simd_trait<std::uint64_t, cyme::sse, 4>::const_pointer a) {
+    return simd_trait<std::uint64_t, cyme::sse, 4>::register_type(
+        _mm_load_si128((__m128i *)a), _mm_load_si128((__m128i *)(a + 2)), _mm_load_si128((__m128i *)(a + 4)),
+        _mm_load_si128((__m128i *)(a + 6)));
+}
+
+/**
+ Store the 64 bits unsigned integers into cyme (aligned)
+ specialisation uint64_t,cyme::sse,1 regs
+ */
+template <>
+forceinline void
+_mm_store<std::uint64_t, cyme::sse, 1>(simd_trait<std::uint64_t, cyme::sse, 1>::register_type xmm0,
+                                       simd_trait<std::uint64_t, cyme::sse, 1>::pointer a) {
+    _mm_store_si128((__m128i *)a, xmm0);
+}
+
+/**
+ Store the 64 bits unsigned integers into cyme (aligned)
+ specialisation uint64_t,cyme::sse,2 regs
+ */
+template <>
+forceinline void
+_mm_store<std::uint64_t, cyme::sse, 2>(simd_trait<std::uint64_t, cyme::sse, 2>::register_type xmm0,
+                                       simd_trait<std::uint64_t, cyme::sse, 2>::pointer a) {
+    _mm_store_si128((__m128i *)a, xmm0.r0);
+    _mm_store_si128((__m128i *)(a + 2), xmm0.r1);
+}
+
+/**
+ Store the 64 bits unsigned integers into cyme (aligned)
+ specialisation uint64_t,cyme::sse,4 regs
+ */
+template <>
+forceinline void
+_mm_store<std::uint64_t, cyme::sse, 4>(simd_trait<std::uint64_t, cyme::sse, 4>::register_type xmm0,
+                                       simd_trait<std::uint64_t, cyme::sse, 4>::pointer a) {
+    _mm_store_si128((__m128i *)a, xmm0.r0);
+    _mm_store_si128((__m128i *)(a + 2), xmm0.r1);
+    _mm_store_si128((__m128i *)(a + 4), xmm0.r2);
+    _mm_store_si128((__m128i *)(a + 6), xmm0.r3);
+}
+
+/**
+ Add the 64 bits unsigned integers
+ specialisation uint64_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 1>::register_type
+_mm_add<std::uint64_t, cyme::sse, 1>(simd_trait<std::uint64_t, cyme::sse, 1>::register_type xmm0,
+                                     simd_trait<std::uint64_t, cyme::sse, 1>::register_type xmm1) {
+    return _mm_add_epi64(xmm0, xmm1);
+}
+
+/**
+ Add the 64 bits unsigned integers
+ specialisation uint64_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 2>::register_type
+_mm_add<std::uint64_t, cyme::sse, 2>(simd_trait<std::uint64_t, cyme::sse, 2>::register_type xmm0,
+                                     simd_trait<std::uint64_t, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::sse, 2>::register_type(_mm_add_epi64(xmm0.r0, xmm1.r0),
+                                                                  _mm_add_epi64(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Add the 64 bits unsigned integers
+ specialisation uint64_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 4>::register_type
+_mm_add<std::uint64_t, cyme::sse, 4>(simd_trait<std::uint64_t, cyme::sse, 4>::register_type xmm0,
+                                     simd_trait<std::uint64_t, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::sse, 4>::register_type(
+        _mm_add_epi64(xmm0.r0, xmm1.r0), _mm_add_epi64(xmm0.r1, xmm1.r1), _mm_add_epi64(xmm0.r2, xmm1.r2),
+        _mm_add_epi64(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Subtract the 64 bits unsigned integers, xmm0 - xmm1
+ specialisation uint64_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 1>::register_type
+_mm_sub<std::uint64_t, cyme::sse, 1>(simd_trait<std::uint64_t, cyme::sse, 1>::register_type xmm0,
+                                     simd_trait<std::uint64_t, cyme::sse, 1>::register_type xmm1) {
+    return _mm_sub_epi64(xmm0, xmm1);
+}
+
+/**
+ Subtract the 64 bits unsigned integers, xmm0 - xmm1
+ specialisation uint64_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 2>::register_type
+_mm_sub<std::uint64_t, cyme::sse, 2>(simd_trait<std::uint64_t, cyme::sse, 2>::register_type xmm0,
+                                     simd_trait<std::uint64_t, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::sse, 2>::register_type(_mm_sub_epi64(xmm0.r0, xmm1.r0),
+                                                                  _mm_sub_epi64(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Subtract the 64 bits unsigned integers, xmm0 - xmm1
+ specialisation uint64_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 4>::register_type
+_mm_sub<std::uint64_t, cyme::sse, 4>(simd_trait<std::uint64_t, cyme::sse, 4>::register_type xmm0,
+                                     simd_trait<std::uint64_t, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::sse, 4>::register_type(
+        _mm_sub_epi64(xmm0.r0, xmm1.r0), _mm_sub_epi64(xmm0.r1, xmm1.r1), _mm_sub_epi64(xmm0.r2, xmm1.r2),
+        _mm_sub_epi64(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Multiply the 64 bits unsigned integers, the low 64 bits of the products
+ specialisation uint64_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 1>::register_type
+_mm_mul<std::uint64_t, cyme::sse, 1>(simd_trait<std::uint64_t, cyme::sse, 1>::register_type xmm0,
+                                     simd_trait<std::uint64_t, cyme::sse, 1>::register_type xmm1) {
+    return detail::mullo_epi64(xmm0, xmm1);
+}
+
+/**
+ Multiply the 64 bits unsigned integers, the low 64 bits of the products
+ specialisation uint64_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 2>::register_type
+_mm_mul<std::uint64_t, cyme::sse, 2>(simd_trait<std::uint64_t, cyme::sse, 2>::register_type xmm0,
+                                     simd_trait<std::uint64_t, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::sse, 2>::register_type(detail::mullo_epi64(xmm0.r0, xmm1.r0),
+                                                                  detail::mullo_epi64(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Multiply the 64 bits unsigned integers, the low 64 bits of the products
+ specialisation uint64_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 4>::register_type
+_mm_mul<std::uint64_t, cyme::sse, 4>(simd_trait<std::uint64_t, cyme::sse, 4>::register_type xmm0,
+                                     simd_trait<std::uint64_t, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::sse, 4>::register_type(
+        detail::mullo_epi64(xmm0.r0, xmm1.r0), detail::mullo_epi64(xmm0.r1, xmm1.r1),
+        detail::mullo_epi64(xmm0.r2, xmm1.r2), detail::mullo_epi64(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the << operator, the shift is the first element of xmm1
+ specialisation uint64_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 1>::register_type
+_mm_sll<std::uint64_t, cyme::sse, 1>(simd_trait<std::uint64_t, cyme::sse, 1>::register_type xmm0,
+                                     simd_trait<std::uint64_t, cyme::sse, 1>::register_type xmm1) {
+    return _mm_sll_epi64(xmm0, xmm1);
+}
+
+/**
+ Evaluate the << operator, the shift is the first element of xmm1
+ specialisation uint64_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 2>::register_type
+_mm_sll<std::uint64_t, cyme::sse, 2>(simd_trait<std::uint64_t, cyme::sse, 2>::register_type xmm0,
+                                     simd_trait<std::uint64_t, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::sse, 2>::register_type(_mm_sll_epi64(xmm0.r0, xmm1.r0),
+                                                                  _mm_sll_epi64(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the << operator, the shift is the first element of xmm1
+ specialisation uint64_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 4>::register_type
+_mm_sll<std::uint64_t, cyme::sse, 4>(simd_trait<std::uint64_t, cyme::sse, 4>::register_type xmm0,
+                                     simd_trait<std::uint64_t, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::sse, 4>::register_type(
+        _mm_sll_epi64(xmm0.r0, xmm1.r0), _mm_sll_epi64(xmm0.r1, xmm1.r1), _mm_sll_epi64(xmm0.r2, xmm1.r2),
+        _mm_sll_epi64(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the >> operator, the shift is the first element of xmm1
+ specialisation uint64_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 1>::register_type
+_mm_srl<std::uint64_t, cyme::sse, 1>(simd_trait<std::uint64_t, cyme::sse, 1>::register_type xmm0,
+                                     simd_trait<std::uint64_t, cyme::sse, 1>::register_type xmm1) {
+    return _mm_srl_epi64(xmm0, xmm1);
+}
+
+/**
+ Evaluate the >> operator, the shift is the first element of xmm1
+ specialisation uint64_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 2>::register_type
+_mm_srl<std::uint64_t, cyme::sse, 2>(simd_trait<std::uint64_t, cyme::sse, 2>::register_type xmm0,
+                                     simd_trait<std::uint64_t, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::sse, 2>::register_type(_mm_srl_epi64(xmm0.r0, xmm1.r0),
+                                                                  _mm_srl_epi64(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the >> operator, the shift is the first element of xmm1
+ specialisation uint64_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 4>::register_type
+_mm_srl<std::uint64_t, cyme::sse, 4>(simd_trait<std::uint64_t, cyme::sse, 4>::register_type xmm0,
+                                     simd_trait<std::uint64_t, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::sse, 4>::register_type(
+        _mm_srl_epi64(xmm0.r0, xmm1.r0), _mm_srl_epi64(xmm0.r1, xmm1.r1), _mm_srl_epi64(xmm0.r2, xmm1.r2),
+        _mm_srl_epi64(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the == operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint64_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 1>::register_type
+_mm_eq<std::uint64_t, cyme::sse, 1>(simd_trait<std::uint64_t, cyme::sse, 1>::register_type xmm0,
+                                    simd_trait<std::uint64_t, cyme::sse, 1>::register_type xmm1) {
+    return _mm_cmpeq_epi64(xmm0, xmm1);
+}
+
+/**
+ Evaluate the == operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint64_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 2>::register_type
+_mm_eq<std::uint64_t, cyme::sse, 2>(simd_trait<std::uint64_t, cyme::sse, 2>::register_type xmm0,
+                                    simd_trait<std::uint64_t, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::sse, 2>::register_type(_mm_cmpeq_epi64(xmm0.r0, xmm1.r0),
+                                                                  _mm_cmpeq_epi64(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the == operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint64_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 4>::register_type
+_mm_eq<std::uint64_t, cyme::sse, 4>(simd_trait<std::uint64_t, cyme::sse, 4>::register_type xmm0,
+                                    simd_trait<std::uint64_t, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::sse, 4>::register_type(
+        _mm_cmpeq_epi64(xmm0.r0, xmm1.r0), _mm_cmpeq_epi64(xmm0.r1, xmm1.r1), _mm_cmpeq_epi64(xmm0.r2, xmm1.r2),
+        _mm_cmpeq_epi64(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the != operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint64_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 1>::register_type
+_mm_ne<std::uint64_t, cyme::sse, 1>(simd_trait<std::uint64_t, cyme::sse, 1>::register_type xmm0,
+                                    simd_trait<std::uint64_t, cyme::sse, 1>::register_type xmm1) {
+    return detail::cmpne_epi64(xmm0, xmm1);
+}
+
+/**
+ Evaluate the != operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint64_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 2>::register_type
+_mm_ne<std::uint64_t, cyme::sse, 2>(simd_trait<std::uint64_t, cyme::sse, 2>::register_type xmm0,
+                                    simd_trait<std::uint64_t, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::sse, 2>::register_type(detail::cmpne_epi64(xmm0.r0, xmm1.r0),
+                                                                  detail::cmpne_epi64(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the != operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint64_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 4>::register_type
+_mm_ne<std::uint64_t, cyme::sse, 4>(simd_trait<std::uint64_t, cyme::sse, 4>::register_type xmm0,
+                                    simd_trait<std::uint64_t, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::sse, 4>::register_type(
+        detail::cmpne_epi64(xmm0.r0, xmm1.r0), detail::cmpne_epi64(xmm0.r1, xmm1.r1),
+        detail::cmpne_epi64(xmm0.r2, xmm1.r2), detail::cmpne_epi64(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the < operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint64_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 1>::register_type
+_mm_lt<std::uint64_t, cyme::sse, 1>(simd_trait<std::uint64_t, cyme::sse, 1>::register_type xmm0,
+                                    simd_trait<std::uint64_t, cyme::sse, 1>::register_type xmm1) {
+    return detail::cmplt_epu64(xmm0, xmm1);
+}
+
+/**
+ Evaluate the < operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint64_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 2>::register_type
+_mm_lt<std::uint64_t, cyme::sse, 2>(simd_trait<std::uint64_t, cyme::sse, 2>::register_type xmm0,
+                                    simd_trait<std::uint64_t, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::sse, 2>::register_type(detail::cmplt_epu64(xmm0.r0, xmm1.r0),
+                                                                  detail::cmplt_epu64(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the < operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint64_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 4>::register_type
+_mm_lt<std::uint64_t, cyme::sse, 4>(simd_trait<std::uint64_t, cyme::sse, 4>::register_type xmm0,
+                                    simd_trait<std::uint64_t, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::sse, 4>::register_type(
+        detail::cmplt_epu64(xmm0.r0, xmm1.r0), detail::cmplt_epu64(xmm0.r1, xmm1.r1),
+        detail::cmplt_epu64(xmm0.r2, xmm1.r2), detail::cmplt_epu64(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the <= operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint64_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 1>::register_type
+_mm_le<std::uint64_t, cyme::sse, 1>(simd_trait<std::uint64_t, cyme::sse, 1>::register_type xmm0,
+                                    simd_trait<std::uint64_t, cyme::sse, 1>::register_type xmm1) {
+    return detail::cmple_epu64(xmm0, xmm1);
+}
+
+/**
+ Evaluate the <= operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint64_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 2>::register_type
+_mm_le<std::uint64_t, cyme::sse, 2>(simd_trait<std::uint64_t, cyme::sse, 2>::register_type xmm0,
+                                    simd_trait<std::uint64_t, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::sse, 2>::register_type(detail::cmple_epu64(xmm0.r0, xmm1.r0),
+                                                                  detail::cmple_epu64(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the <= operator, the elements are 0 (false) or all bits set (true)
+ specialisation uint64_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 4>::register_type
+_mm_le<std::uint64_t, cyme::sse, 4>(simd_trait<std::uint64_t, cyme::sse, 4>::register_type xmm0,
+                                    simd_trait<std::uint64_t, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::sse, 4>::register_type(
+        detail::cmple_epu64(xmm0.r0, xmm1.r0), detail::cmple_epu64(xmm0.r1, xmm1.r1),
+        detail::cmple_epu64(xmm0.r2, xmm1.r2), detail::cmple_epu64(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the & operator between two registers
+ specialisation uint64_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 1>::register_type
+_mm_and<std::uint64_t, cyme::sse, 1>(simd_trait<std::uint64_t, cyme::sse, 1>::register_type xmm0,
+                                     simd_trait<std::uint64_t, cyme::sse, 1>::register_type xmm1) {
+    return _mm_and_si128(xmm0, xmm1);
+}
+
+/**
+ Evaluate the & operator between two registers
+ specialisation uint64_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 2>::register_type
+_mm_and<std::uint64_t, cyme::sse, 2>(simd_trait<std::uint64_t, cyme::sse, 2>::register_type xmm0,
+                                     simd_trait<std::uint64_t, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::sse, 2>::register_type(_mm_and_si128(xmm0.r0, xmm1.r0),
+                                                                  _mm_and_si128(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the & operator between two registers
+ specialisation uint64_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 4>::register_type
+_mm_and<std::uint64_t, cyme::sse, 4>(simd_trait<std::uint64_t, cyme::sse, 4>::register_type xmm0,
+                                     simd_trait<std::uint64_t, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::sse, 4>::register_type(
+        _mm_and_si128(xmm0.r0, xmm1.r0), _mm_and_si128(xmm0.r1, xmm1.r1), _mm_and_si128(xmm0.r2, xmm1.r2),
+        _mm_and_si128(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the | operator between two registers
+ specialisation uint64_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 1>::register_type
+_mm_or<std::uint64_t, cyme::sse, 1>(simd_trait<std::uint64_t, cyme::sse, 1>::register_type xmm0,
+                                    simd_trait<std::uint64_t, cyme::sse, 1>::register_type xmm1) {
+    return _mm_or_si128(xmm0, xmm1);
+}
+
+/**
+ Evaluate the | operator between two registers
+ specialisation uint64_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 2>::register_type
+_mm_or<std::uint64_t, cyme::sse, 2>(simd_trait<std::uint64_t, cyme::sse, 2>::register_type xmm0,
+                                    simd_trait<std::uint64_t, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::sse, 2>::register_type(_mm_or_si128(xmm0.r0, xmm1.r0),
+                                                                  _mm_or_si128(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the | operator between two registers
+ specialisation uint64_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 4>::register_type
+_mm_or<std::uint64_t, cyme::sse, 4>(simd_trait<std::uint64_t, cyme::sse, 4>::register_type xmm0,
+                                    simd_trait<std::uint64_t, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::sse, 4>::register_type(
+        _mm_or_si128(xmm0.r0, xmm1.r0), _mm_or_si128(xmm0.r1, xmm1.r1), _mm_or_si128(xmm0.r2, xmm1.r2),
+        _mm_or_si128(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the ^ operator between two registers
+ specialisation uint64_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 1>::register_type
+_mm_xor<std::uint64_t, cyme::sse, 1>(simd_trait<std::uint64_t, cyme::sse, 1>::register_type xmm0,
+                                     simd_trait<std::uint64_t, cyme::sse, 1>::register_type xmm1) {
+    return _mm_xor_si128(xmm0, xmm1);
+}
+
+/**
+ Evaluate the ^ operator between two registers
+ specialisation uint64_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 2>::register_type
+_mm_xor<std::uint64_t, cyme::sse, 2>(simd_trait<std::uint64_t, cyme::sse, 2>::register_type xmm0,
+                                     simd_trait<std::uint64_t, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::sse, 2>::register_type(_mm_xor_si128(xmm0.r0, xmm1.r0),
+                                                                  _mm_xor_si128(xmm0.r1, xmm1.r1));
+}
+
+/**
+ Evaluate the ^ operator between two registers
+ specialisation uint64_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 4>::register_type
+_mm_xor<std::uint64_t, cyme::sse, 4>(simd_trait<std::uint64_t, cyme::sse, 4>::register_type xmm0,
+                                     simd_trait<std::uint64_t, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<std::uint64_t, cyme::sse, 4>::register_type(
+        _mm_xor_si128(xmm0.r0, xmm1.r0), _mm_xor_si128(xmm0.r1, xmm1.r1), _mm_xor_si128(xmm0.r2, xmm1.r2),
+        _mm_xor_si128(xmm0.r3, xmm1.r3));
+}
+
+/**
+ Evaluate the ~ operator
+ specialisation uint64_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 1>::register_type
+_mm_andnot<std::uint64_t, cyme::sse, 1>(simd_trait<std::uint64_t, cyme::sse, 1>::register_type xmm0) {
+    return detail::not_si(xmm0);
+}
+
+/**
+ Evaluate the ~ operator
+ specialisation uint64_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 2>::register_type
+_mm_andnot<std::uint64_t, cyme::sse, 2>(simd_trait<std::uint64_t, cyme::sse, 2>::register_type xmm0) {
+    return simd_trait<std::uint64_t, cyme::sse, 2>::register_type(detail::not_si(xmm0.r0), detail::not_si(xmm0.r1));
+}
+
+/**
+ Evaluate the ~ operator
+ specialisation uint64_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<std::uint64_t, cyme::sse, 4>::register_type
+_mm_andnot<std::uint64_t, cyme::sse, 4>(simd_trait<std::uint64_t, cyme::sse, 4>::register_type xmm0) {
+    return simd_trait<std::uint64_t, cyme::sse, 4>::register_type(detail::not_si(xmm0.r0), detail::not_si(xmm0.r1),
+                                                                  detail::not_si(xmm0.r2), detail::not_si(xmm0.r3));
+}
+
+/**
+ Convert the 64 bits unsigned integers to double, rounded to the nearest
+ specialisation uint64_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::sse, 1>::register_type
+_mm_cvt<std::uint64_t, cyme::sse, 1, double>(simd_trait<std::uint64_t, cyme::sse, 1>::register_type xmm0) {
+    return detail::cvtepu64_pd(xmm0);
+}
+
+/**
+ Convert the 64 bits unsigned integers to double, rounded to the nearest
+ specialisation uint64_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::sse, 2>::register_type
+_mm_cvt<std::uint64_t, cyme::sse, 2, double>(simd_trait<std::uint64_t, cyme::sse, 2>::register_type xmm0) {
+    return simd_trait<double, cyme::sse, 2>::register_type(detail::cvtepu64_pd(xmm0.r0), detail::cvtepu64_pd(xmm0.r1));
+}
+
+/**
+ Convert the 64 bits unsigned integers to double, rounded to the nearest
+ specialisation uint64_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::sse, 4>::register_type
+_mm_cvt<std::uint64_t, cyme::sse, 4, double>(simd_trait<std::uint64_t, cyme::sse, 4>::register_type xmm0) {
+    return simd_trait<double, cyme::sse, 4>::register_type(detail::cvtepu64_pd(xmm0.r0), detail::cvtepu64_pd(xmm0.r1),
+                                                           detail::cvtepu64_pd(xmm0.r2), detail::cvtepu64_pd(xmm0.r3));
+}
+
+/** \cond */
+namespace detail {
+/** the rounding of the floating point numbers, the mode is given to the instruction as an immediate */
+forceinline __m128d round_pd(__m128d xmm0, cyme::round_mode m) {
+    switch (m) {
+    case cyme::round_down:
+        return _mm_round_pd(xmm0, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+    case cyme::round_up:
+        return _mm_round_pd(xmm0, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+    case cyme::round_zero:
+        return _mm_round_pd(xmm0, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+    default:
+        return _mm_round_pd(xmm0, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    }
+}
+
+forceinline __m128 round_ps(__m128 xmm0, cyme::round_mode m) {
+    switch (m) {
+    case cyme::round_down:
+        return _mm_round_ps(xmm0, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+    case cyme::round_up:
+        return _mm_round_ps(xmm0, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+    case cyme::round_zero:
+        return _mm_round_ps(xmm0, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+    default:
+        return _mm_round_ps(xmm0, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    }
+}
+} // namespace detail
+/** \endcond */
+
+/**
+ Round to an integral value in the floating point format, the rounding mode m
+ specialisation double,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::sse, 1>::register_type
+_mm_round<double, cyme::sse, 1>(simd_trait<double, cyme::sse, 1>::register_type xmm0, cyme::round_mode m) {
+    return detail::round_pd(xmm0, m);
+}
+
+/**
+ Round to an integral value in the floating point format, the rounding mode m
+ specialisation double,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::sse, 2>::register_type
+_mm_round<double, cyme::sse, 2>(simd_trait<double, cyme::sse, 2>::register_type xmm0, cyme::round_mode m) {
+    return simd_trait<double, cyme::sse, 2>::register_type(detail::round_pd(xmm0.r0, m), detail::round_pd(xmm0.r1, m));
+}
+
+/**
+ Round to an integral value in the floating point format, the rounding mode m
+ specialisation double,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::sse, 4>::register_type
+_mm_round<double, cyme::sse, 4>(simd_trait<double, cyme::sse, 4>::register_type xmm0, cyme::round_mode m) {
+    return simd_trait<double, cyme::sse, 4>::register_type(detail::round_pd(xmm0.r0, m), detail::round_pd(xmm0.r1, m),
+                                                           detail::round_pd(xmm0.r2, m), detail::round_pd(xmm0.r3, m));
+}
+
+/**
+ Round to an integral value in the floating point format, the rounding mode m
+ specialisation float,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<float, cyme::sse, 1>::register_type
+_mm_round<float, cyme::sse, 1>(simd_trait<float, cyme::sse, 1>::register_type xmm0, cyme::round_mode m) {
+    return detail::round_ps(xmm0, m);
+}
+
+/**
+ Round to an integral value in the floating point format, the rounding mode m
+ specialisation float,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<float, cyme::sse, 2>::register_type
+_mm_round<float, cyme::sse, 2>(simd_trait<float, cyme::sse, 2>::register_type xmm0, cyme::round_mode m) {
+    return simd_trait<float, cyme::sse, 2>::register_type(detail::round_ps(xmm0.r0, m), detail::round_ps(xmm0.r1, m));
+}
+
+/**
+ Round to an integral value in the floating point format, the rounding mode m
+ specialisation float,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<float, cyme::sse, 4>::register_type
+_mm_round<float, cyme::sse, 4>(simd_trait<float, cyme::sse, 4>::register_type xmm0, cyme::round_mode m) {
+    return simd_trait<float, cyme::sse, 4>::register_type(detail::round_ps(xmm0.r0, m), detail::round_ps(xmm0.r1, m),
+                                                          detail::round_ps(xmm0.r2, m), detail::round_ps(xmm0.r3, m));
+}
+
+/** \cond */
+namespace detail {
+/** the lanes of the first and the second half of a register widened to double */
+forceinline __m128d widen_lo(__m128 xmm0) { return _mm_cvtps_pd(xmm0); }
+
+forceinline __m128d widen_hi(__m128 xmm0) { return _mm_cvtps_pd(_mm_movehl_ps(xmm0, xmm0)); }
+
+forceinline __m128d widen_lo(__m128i xmm0) { return _mm_cvtepi32_pd(xmm0); }
+
+forceinline __m128d widen_hi(__m128i xmm0) { return _mm_cvtepi32_pd(_mm_unpackhi_epi64(xmm0, xmm0)); }
+
+/** the unsigned lanes, moved by -2^31 into the range of int before the conversion and back after, exact */
+forceinline __m128d widen_lo_epu32(__m128i xmm0) {
+    const __m128i flip = _mm_set1_epi32(static_cast<int>(1u << 31));
+    return _mm_add_pd(widen_lo(_mm_xor_si128(xmm0, flip)), _mm_set1_pd(2147483648.));
+}
+
+forceinline __m128d widen_hi_epu32(__m128i xmm0) {
+    const __m128i flip = _mm_set1_epi32(static_cast<int>(1u << 31));
+    return _mm_add_pd(widen_hi(_mm_xor_si128(xmm0, flip)), _mm_set1_pd(2147483648.));
+}
+
+/** two registers of double narrowed into one, rounded to the nearest float, truncated to int as static_cast */
+forceinline __m128 narrow_ps(__m128d xmm0, __m128d xmm1) {
+    return _mm_movelh_ps(_mm_cvtpd_ps(xmm0), _mm_cvtpd_ps(xmm1));
+}
+
+forceinline __m128i narrow_epi32(__m128d xmm0, __m128d xmm1) {
+    return _mm_unpacklo_epi64(_mm_cvttpd_epi32(xmm0), _mm_cvttpd_epi32(xmm1));
+}
+} // namespace detail
+/** \endcond */
+
+/**
+ Widen the first half of the lanes of xmm0 to double, the lanes in memory order
+ specialisation float,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::sse, 1>::register_type
+_mm_widen_lo<float, cyme::sse, 1>(simd_trait<float, cyme::sse, 1>::register_type xmm0) {
+    return detail::widen_lo(xmm0);
+}
+
+/**
+ Widen the first half of the lanes of xmm0 to double, the lanes in memory order
+ specialisation float,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::sse, 2>::register_type
+_mm_widen_lo<float, cyme::sse, 2>(simd_trait<float, cyme::sse, 2>::register_type xmm0) {
+    return simd_trait<double, cyme::sse, 2>::register_type(detail::widen_lo(xmm0.r0), detail::widen_hi(xmm0.r0));
+}
+
+/**
+ Widen the first half of the lanes of xmm0 to double, the lanes in memory order
+ specialisation float,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::sse, 4>::register_type
+_mm_widen_lo<float, cyme::sse, 4>(simd_trait<float, cyme::sse, 4>::register_type xmm0) {
+    return simd_trait<double, cyme::sse, 4>::register_type(detail::widen_lo(xmm0.r0), detail::widen_hi(xmm0.r0),
+                                                           detail::widen_lo(xmm0.r1), detail::widen_hi(xmm0.r1));
+}
+
+/**
+ Widen the second half of the lanes of xmm0 to double, the lanes in memory order
+ specialisation float,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::sse, 1>::register_type
+_mm_widen_hi<float, cyme::sse, 1>(simd_trait<float, cyme::sse, 1>::register_type xmm0) {
+    return detail::widen_hi(xmm0);
+}
+
+/**
+ Widen the second half of the lanes of xmm0 to double, the lanes in memory order
+ specialisation float,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::sse, 2>::register_type
+_mm_widen_hi<float, cyme::sse, 2>(simd_trait<float, cyme::sse, 2>::register_type xmm0) {
+    return simd_trait<double, cyme::sse, 2>::register_type(detail::widen_lo(xmm0.r1), detail::widen_hi(xmm0.r1));
+}
+
+/**
+ Widen the second half of the lanes of xmm0 to double, the lanes in memory order
+ specialisation float,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::sse, 4>::register_type
+_mm_widen_hi<float, cyme::sse, 4>(simd_trait<float, cyme::sse, 4>::register_type xmm0) {
+    return simd_trait<double, cyme::sse, 4>::register_type(detail::widen_lo(xmm0.r2), detail::widen_hi(xmm0.r2),
+                                                           detail::widen_lo(xmm0.r3), detail::widen_hi(xmm0.r3));
+}
+
+/**
+ Narrow the lanes of xmm0 then xmm1 (double) into one float register
+ specialisation float,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<float, cyme::sse, 1>::register_type
+_mm_narrow<float, cyme::sse, 1>(simd_trait<double, cyme::sse, 1>::register_type xmm0,
+                                simd_trait<double, cyme::sse, 1>::register_type xmm1) {
+    return detail::narrow_ps(xmm0, xmm1);
+}
+
+/**
+ Narrow the lanes of xmm0 then xmm1 (double) into one float register
+ specialisation float,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<float, cyme::sse, 2>::register_type
+_mm_narrow<float, cyme::sse, 2>(simd_trait<double, cyme::sse, 2>::register_type xmm0,
+                                simd_trait<double, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<float, cyme::sse, 2>::register_type(detail::narrow_ps(xmm0.r0, xmm0.r1),
+                                                          detail::narrow_ps(xmm1.r0, xmm1.r1));
+}
+
+/**
+ Narrow the lanes of xmm0 then xmm1 (double) into one float register
+ specialisation float,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<float, cyme::sse, 4>::register_type
+_mm_narrow<float, cyme::sse, 4>(simd_trait<double, cyme::sse, 4>::register_type xmm0,
+                                simd_trait<double, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<float, cyme::sse, 4>::register_type(
+        detail::narrow_ps(xmm0.r0, xmm0.r1), detail::narrow_ps(xmm0.r2, xmm0.r3), detail::narrow_ps(xmm1.r0, xmm1.r1),
+        detail::narrow_ps(xmm1.r2, xmm1.r3));
+}
+
+/**
+ Widen the first half of the lanes of xmm0 to double, the lanes in memory order
+ specialisation int,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::sse, 1>::register_type
+_mm_widen_lo<int, cyme::sse, 1>(simd_trait<int, cyme::sse, 1>::register_type xmm0) {
+    return detail::widen_lo(xmm0);
+}
+
+/**
+ Widen the first half of the lanes of xmm0 to double, the lanes in memory order
+ specialisation int,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::sse, 2>::register_type
+_mm_widen_lo<int, cyme::sse, 2>(simd_trait<int, cyme::sse, 2>::register_type xmm0) {
+    return simd_trait<double, cyme::sse, 2>::register_type(detail::widen_lo(xmm0.r0), detail::widen_hi(xmm0.r0));
+}
+
+/**
+ Widen the first half of the lanes of xmm0 to double, the lanes in memory order
+ specialisation int,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::sse, 4>::register_type
+_mm_widen_lo<int, cyme::sse, 4>(simd_trait<int, cyme::sse, 4>::register_type xmm0) {
+    return simd_trait<double, cyme::sse, 4>::register_type(detail::widen_lo(xmm0.r0), detail::widen_hi(xmm0.r0),
+                                                           detail::widen_lo(xmm0.r1), detail::widen_hi(xmm0.r1));
+}
+
+/**
+ Widen the second half of the lanes of xmm0 to double, the lanes in memory order
+ specialisation int,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::sse, 1>::register_type
+_mm_widen_hi<int, cyme::sse, 1>(simd_trait<int, cyme::sse, 1>::register_type xmm0) {
+    return detail::widen_hi(xmm0);
+}
+
+/**
+ Widen the second half of the lanes of xmm0 to double, the lanes in memory order
+ specialisation int,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::sse, 2>::register_type
+_mm_widen_hi<int, cyme::sse, 2>(simd_trait<int, cyme::sse, 2>::register_type xmm0) {
+    return simd_trait<double, cyme::sse, 2>::register_type(detail::widen_lo(xmm0.r1), detail::widen_hi(xmm0.r1));
+}
+
+/**
+ Widen the second half of the lanes of xmm0 to double, the lanes in memory order
+ specialisation int,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::sse, 4>::register_type
+_mm_widen_hi<int, cyme::sse, 4>(simd_trait<int, cyme::sse, 4>::register_type xmm0) {
+    return simd_trait<double, cyme::sse, 4>::register_type(detail::widen_lo(xmm0.r2), detail::widen_hi(xmm0.r2),
+                                                           detail::widen_lo(xmm0.r3), detail::widen_hi(xmm0.r3));
+}
+
+/**
+ Widen the first half of the lanes of xmm0 to double, the lanes in memory order
+ specialisation uint32_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::sse, 1>::register_type
+_mm_widen_lo<std::uint32_t, cyme::sse, 1>(simd_trait<std::uint32_t, cyme::sse, 1>::register_type xmm0) {
+    return detail::widen_lo_epu32(xmm0);
+}
+
+/**
+ Widen the first half of the lanes of xmm0 to double, the lanes in memory order
+ specialisation uint32_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::sse, 2>::register_type
+_mm_widen_lo<std::uint32_t, cyme::sse, 2>(simd_trait<std::uint32_t, cyme::sse, 2>::register_type xmm0) {
+    return simd_trait<double, cyme::sse, 2>::register_type(detail::widen_lo_epu32(xmm0.r0),
+                                                           detail::widen_hi_epu32(xmm0.r0));
+}
+
+/**
+ Widen the first half of the lanes of xmm0 to double, the lanes in memory order
+ specialisation uint32_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::sse, 4>::register_type
+_mm_widen_lo<std::uint32_t, cyme::sse, 4>(simd_trait<std::uint32_t, cyme::sse, 4>::register_type xmm0) {
+    return simd_trait<double, cyme::sse, 4>::register_type(detail::widen_lo_epu32(xmm0.r0),
+                                                           detail::widen_hi_epu32(xmm0.r0),
+                                                           detail::widen_lo_epu32(xmm0.r1),
+                                                           detail::widen_hi_epu32(xmm0.r1));
+}
+
+/**
+ Widen the second half of the lanes of xmm0 to double, the lanes in memory order
+ specialisation uint32_t,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::sse, 1>::register_type
+_mm_widen_hi<std::uint32_t, cyme::sse, 1>(simd_trait<std::uint32_t, cyme::sse, 1>::register_type xmm0) {
+    return detail::widen_hi_epu32(xmm0);
+}
+
+/**
+ Widen the second half of the lanes of xmm0 to double, the lanes in memory order
+ specialisation uint32_t,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::sse, 2>::register_type
+_mm_widen_hi<std::uint32_t, cyme::sse, 2>(simd_trait<std::uint32_t, cyme::sse, 2>::register_type xmm0) {
+    return simd_trait<double, cyme::sse, 2>::register_type(detail::widen_lo_epu32(xmm0.r1),
+                                                           detail::widen_hi_epu32(xmm0.r1));
+}
+
+/**
+ Widen the second half of the lanes of xmm0 to double, the lanes in memory order
+ specialisation uint32_t,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<double, cyme::sse, 4>::register_type
+_mm_widen_hi<std::uint32_t, cyme::sse, 4>(simd_trait<std::uint32_t, cyme::sse, 4>::register_type xmm0) {
+    return simd_trait<double, cyme::sse, 4>::register_type(detail::widen_lo_epu32(xmm0.r2),
+                                                           detail::widen_hi_epu32(xmm0.r2),
+                                                           detail::widen_lo_epu32(xmm0.r3),
+                                                           detail::widen_hi_epu32(xmm0.r3));
+}
+
+/**
+ Narrow the lanes of xmm0 then xmm1 (double) into one int register
+ specialisation int,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<int, cyme::sse, 1>::register_type
+_mm_narrow<int, cyme::sse, 1>(simd_trait<double, cyme::sse, 1>::register_type xmm0,
+                              simd_trait<double, cyme::sse, 1>::register_type xmm1) {
+    return detail::narrow_epi32(xmm0, xmm1);
+}
+
+/**
+ Narrow the lanes of xmm0 then xmm1 (double) into one int register
+ specialisation int,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<int, cyme::sse, 2>::register_type
+_mm_narrow<int, cyme::sse, 2>(simd_trait<double, cyme::sse, 2>::register_type xmm0,
+                              simd_trait<double, cyme::sse, 2>::register_type xmm1) {
+    return simd_trait<int, cyme::sse, 2>::register_type(detail::narrow_epi32(xmm0.r0, xmm0.r1),
+                                                        detail::narrow_epi32(xmm1.r0, xmm1.r1));
+}
+
+/**
+ Narrow the lanes of xmm0 then xmm1 (double) into one int register
+ specialisation int,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<int, cyme::sse, 4>::register_type
+_mm_narrow<int, cyme::sse, 4>(simd_trait<double, cyme::sse, 4>::register_type xmm0,
+                              simd_trait<double, cyme::sse, 4>::register_type xmm1) {
+    return simd_trait<int, cyme::sse, 4>::register_type(
+        detail::narrow_epi32(xmm0.r0, xmm0.r1), detail::narrow_epi32(xmm0.r2, xmm0.r3),
+        detail::narrow_epi32(xmm1.r0, xmm1.r1), detail::narrow_epi32(xmm1.r2, xmm1.r3));
+}
+
+/**
+ Convert the float to int, truncated as static_cast
+ specialisation float,cyme::sse,1 regs
+ */
+template <>
+forceinline simd_trait<int, cyme::sse, 1>::register_type
+_mm_cvt<float, cyme::sse, 1, int>(simd_trait<float, cyme::sse, 1>::register_type xmm0) {
+    return _mm_cvttps_epi32(xmm0);
+}
+
+/**
+ Convert the float to int, truncated as static_cast
+ specialisation float,cyme::sse,2 regs
+ */
+template <>
+forceinline simd_trait<int, cyme::sse, 2>::register_type
+_mm_cvt<float, cyme::sse, 2, int>(simd_trait<float, cyme::sse, 2>::register_type xmm0) {
+    return simd_trait<int, cyme::sse, 2>::register_type(_mm_cvttps_epi32(xmm0.r0), _mm_cvttps_epi32(xmm0.r1));
+}
+
+/**
+ Convert the float to int, truncated as static_cast
+ specialisation float,cyme::sse,4 regs
+ */
+template <>
+forceinline simd_trait<int, cyme::sse, 4>::register_type
+_mm_cvt<float, cyme::sse, 4, int>(simd_trait<float, cyme::sse, 4>::register_type xmm0) {
+    return simd_trait<int, cyme::sse, 4>::register_type(_mm_cvttps_epi32(xmm0.r0), _mm_cvttps_epi32(xmm0.r1),
+                                                        _mm_cvttps_epi32(xmm0.r2), _mm_cvttps_epi32(xmm0.r3));
+}
+
 } // namespace cyme
 
 #endif
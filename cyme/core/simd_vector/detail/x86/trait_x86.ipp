@@ -28,6 +28,8 @@
 #ifndef CYME_TRAIT_X86_IPP
 #define CYME_TRAIT_X86_IPP
 
+#include <cstdint>
+
 #ifdef __AVX__
 #include <immintrin.h> //type SIMD, avx
 #else
@@ -60,6 +62,24 @@ struct register_trait<double, cyme::sse> {
     typedef __m128d trait_register_type;
 };
 
+/** Specialisation of the trait class for the 64 bits signed integers, cyme::sse */
+template <>
+struct register_trait<std::int64_t, cyme::sse> {
+    typedef __m128i trait_register_type;
+};
+
+/** Specialisation of the trait class for the 32 bits unsigned integers, cyme::sse */
+template <>
+struct register_trait<std::uint32_t, cyme::sse> {
+    typedef __m128i trait_register_type;
+};
+
+/** Specialisation of the trait class for the 64 bits unsigned integers, cyme::sse */
+template <>
+struct register_trait<std::uint64_t, cyme::sse> {
+    typedef __m128i trait_register_type;
+};
+
 #ifdef __AVX__
 /** Specialisation of the trait class for int, cyme::avx
     integer register name is standard whatever the size 4,8,16,32 or 64 bits
@@ -80,6 +100,24 @@ template <>
 struct register_trait<double, cyme::avx> {
     typedef __m256d trait_register_type;
 };
+
+/** Specialisation of the trait class for the 64 bits signed integers, cyme::avx */
+template <>
+struct register_trait<std::int64_t, cyme::avx> {
+    typedef __m256i trait_register_type;
+};
+
+/** Specialisation of the trait class for the 32 bits unsigned integers, cyme::avx */
+template <>
+struct register_trait<std::uint32_t, cyme::avx> {
+    typedef __m256i trait_register_type;
+};
+
+/** Specialisation of the trait class for the 64 bits unsigned integers, cyme::avx */
+template <>
+struct register_trait<std::uint64_t, cyme::avx> {
+    typedef __m256i trait_register_type;
+};
 #endif
 
 /** Specialisation of the trait class for the composite vector double,cyme::sse,4 regs*/
@@ -136,6 +174,60 @@ struct simd_trait<int, cyme::sse, 1> : trait<int> {
     typedef __m128i register_type;
 };
 
+/** Specialisation of the trait class for the composite vector int64_t,cyme::sse,4 regs*/
+template <>
+struct simd_trait<std::int64_t, cyme::sse, 4> : trait<std::int64_t> {
+    typedef simd_unroll<std::int64_t, cyme::sse, 4> register_type;
+};
+
+/** Specialisation of the trait class for the composite vector int64_t,cyme::sse,2 regs*/
+template <>
+struct simd_trait<std::int64_t, cyme::sse, 2> : trait<std::int64_t> {
+    typedef simd_unroll<std::int64_t, cyme::sse, 2> register_type;
+};
+
+/** Specialisation of the trait class for the composite vector int64_t,cyme::sse,1 reg*/
+template <>
+struct simd_trait<std::int64_t, cyme::sse, 1> : trait<std::int64_t> {
+    typedef __m128i register_type;
+};
+
+/** Specialisation of the trait class for the composite vector uint32_t,cyme::sse,4 regs*/
+template <>
+struct simd_trait<std::uint32_t, cyme::sse, 4> : trait<std::uint32_t> {
+    typedef simd_unroll<std::uint32_t, cyme::sse, 4> register_type;
+};
+
+/** Specialisation of the trait class for the composite vector uint32_t,cyme::sse,2 regs*/
+template <>
+struct simd_trait<std::uint32_t, cyme::sse, 2> : trait<std::uint32_t> {
+    typedef simd_unroll<std::uint32_t, cyme::sse, 2> register_type;
+};
+
+/** Specialisation of the trait class for the composite vector uint32_t,cyme::sse,1 reg*/
+template <>
+struct simd_trait<std::uint32_t, cyme::sse, 1> : trait<std::uint32_t> {
+    typedef __m128i register_type;
+};
+
+/** Specialisation of the trait class for the composite vector uint64_t,cyme::sse,4 regs*/
+template <>
+struct simd_trait<std::uint64_t, cyme::sse, 4> : trait<std::uint64_t> {
+    typedef simd_unroll<std::uint64_t, cyme::sse, 4> register_type;
+};
+
+/** Specialisation of the trait class for the composite vector uint64_t,cyme::sse,2 regs*/
+template <>
+struct simd_trait<std::uint64_t, cyme::sse, 2> : trait<std::uint64_t> {
+    typedef simd_unroll<std::uint64_t, cyme::sse, 2> register_type;
+};
+
+/** Specialisation of the trait class for the composite vector uint64_t,cyme::sse,1 reg*/
+template <>
+struct simd_trait<std::uint64_t, cyme::sse, 1> : trait<std::uint64_t> {
+    typedef __m128i register_type;
+};
+
 /** Specialization trait for float  Newton-Raphson division: number of iteration */
 template <>
 struct div_recursion<float, cyme::sse> {
@@ -239,6 +331,60 @@ struct simd_trait<int, cyme::avx, 1> : trait<int> {
     typedef __m256i register_type;
 };
 
+/** Specialisation of the trait class for the composite vector int64_t,cyme::avx,4 regs*/
+template <>
+struct simd_trait<std::int64_t, cyme::avx, 4> : trait<std::int64_t> {
+    typedef simd_unroll<std::int64_t, cyme::avx, 4> register_type;
+};
+
+/** Specialisation of the trait class for the composite vector int64_t,cyme::avx,2 regs*/
+template <>
+struct simd_trait<std::int64_t, cyme::avx, 2> : trait<std::int64_t> {
+    typedef simd_unroll<std::int64_t, cyme::avx, 2> register_type;
+};
+
+/** Specialisation of the trait class for the composite vector int64_t,cyme::avx,1 reg*/
+template <>
+struct simd_trait<std::int64_t, cyme::avx, 1> : trait<std::int64_t> {
+    typedef __m256i register_type;
+};
+
+/** Specialisation of the trait class for the composite vector uint32_t,cyme::avx,4 regs*/
+template <>
+struct simd_trait<std::uint32_t, cyme::avx, 4> : trait<std::uint32_t> {
+    typedef simd_unroll<std::uint32_t, cyme::avx, 4> register_type;
+};
+
+/** Specialisation of the trait class for the composite vector uint32_t,cyme::avx,2 regs*/
+template <>
+struct simd_trait<std::uint32_t, cyme::avx, 2> : trait<std::uint32_t> {
+    typedef simd_unroll<std::uint32_t, cyme::avx, 2> register_type;
+};
+
+/** Specialisation of the trait class for the composite vector uint32_t,cyme::avx,1 reg*/
+template <>
+struct simd_trait<std::uint32_t, cyme::avx, 1> : trait<std::uint32_t> {
+    typedef __m256i register_type;
+};
+
+/** Specialisation of the trait class for the composite vector uint64_t,cyme::avx,4 regs*/
+template <>
+struct simd_trait<std::uint64_t, cyme::avx, 4> : trait<std::uint64_t> {
+    typedef simd_unroll<std::uint64_t, cyme::avx, 4> register_type;
+};
+
+/** Specialisation of the trait class for the composite vector uint64_t,cyme::avx,2 regs*/
+template <>
+struct simd_trait<std::uint64_t, cyme::avx, 2> : trait<std::uint64_t> {
+    typedef simd_unroll<std::uint64_t, cyme::avx, 2> register_type;
+};
+
+/** Specialisation of the trait class for the composite vector uint64_t,cyme::avx,1 reg*/
+template <>
+struct simd_trait<std::uint64_t, cyme::avx, 1> : trait<std::uint64_t> {
+    typedef __m256i register_type;
+};
+
 #endif
 /** \endcond */
 } // namespace cyme
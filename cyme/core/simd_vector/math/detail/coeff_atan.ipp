@@ -0,0 +1,74 @@
+/*
+ * Cyme - coeff_atan.ipp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ * This file is part of Cyme <https://github.com/BlueBrain/cyme>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+
+/**
+ * @file cyme/core/simd_vector/math/detail/coeff_atan.ipp
+ * Implements coeff_cephes_atan class for horner's method
+ */
+
+#ifndef CYME_COEFF_ATAN_IPP
+#define CYME_COEFF_ATAN_IPP
+
+namespace cyme {
+
+/** this class encapsulates the cephes approximation coefficients for atan, atanf of cephes on |x| <= tan(Pi/8),
+ the precision of sin and cos, in float and double
+*/
+template <class T, std::size_t n>
+struct coeff_cephes_atan;
+
+/** coeff order 0 atan(x) */
+template <class T>
+struct coeff_cephes_atan<T, 0> {
+    const static inline T coeff() { return -3.33329491539e-1; }
+};
+
+/** coeff order 1 atan(x) */
+template <class T>
+struct coeff_cephes_atan<T, 1> {
+    const static inline T coeff() { return 1.99777106478e-1; }
+};
+
+/** coeff order 2 atan(x) */
+template <class T>
+struct coeff_cephes_atan<T, 2> {
+    const static inline T coeff() { return -1.38776856032e-1; }
+};
+
+/** coeff order 3 atan(x) */
+template <class T>
+struct coeff_cephes_atan<T, 3> {
+    const static inline T coeff() { return 8.05374449538e-2; }
+};
+
+/** Poly_order class encapsulates the number of Remez coefficient */
+template <class T, template <class, std::size_t> class C>
+struct poly_order;
+
+/** Poly_order partial specialisation for the atan */
+template <class T>
+struct poly_order<T, coeff_cephes_atan> {
+    static const std::size_t value = 3;
+};
+
+} // namespace cyme
+
+#endif
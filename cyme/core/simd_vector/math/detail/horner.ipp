@@ -23,42 +23,205 @@
 
 /**
  * @file cyme/core/simd_vector/math/detail/horner.ipp
- * Implements polynomial computation using horner's method
+ * Implements polynomial computation using Horner's, second order Horner's and Estrin's methods
  */
 
 #ifndef CYME_HORNER_IPP
 #define CYME_HORNER_IPP
 
+#include <cstddef>
+
 #include "cyme/core/simd_vector/math/detail/coeff_exp.ipp"
 #include "cyme/core/simd_vector/math/detail/coeff_log.ipp"
 #include "cyme/core/simd_vector/math/detail/coeff_sin_cos.ipp"
+#include "cyme/core/simd_vector/math/detail/coeff_atan.ipp"
 
 namespace cyme {
+/** \cond */
+namespace detail {
+/** a*b + c, fused on the registers if FMA */
+template <class T, cyme::simd O, int N>
+forceinline vec_simd<T, O, N> poly_muladd(vec_simd<T, O, N> const &a, vec_simd<T, O, N> const &b,
+                                          vec_simd<T, O, N> const &c) {
+#ifdef __FMA__
+    return muladd(a, b, c);
+#else
+    return a * b + c;
+#endif
+}
+
+template <class T>
+forceinline T poly_muladd(T a, T b, T c) {
+    return a * b + c;
+}
+
+/** the largest power of two smaller than n (n > 1), and its log2 */
+template <std::size_t n, std::size_t p = 1, bool next = (2 * p < n)>
+struct poly_split {
+    static const std::size_t value = poly_split<n, 2 * p>::value;
+    static const std::size_t log2 = poly_split<n, 2 * p>::log2 + 1;
+};
+
+template <std::size_t n, std::size_t p>
+struct poly_split<n, p, false> {
+    static const std::size_t value = p;
+    static const std::size_t log2 = 0;
+};
+
+/** the coefficient n of the table C, the tables of the user give it as C::coeff(n) */
+template <class C, std::size_t n>
+struct poly_coeff {
+    static forceinline double value() { return C::coeff(n); }
+};
+
+/** the polynomial of the coefficients first, first+stride ... (count of them) of the table C, R a register or a
+    basic type */
+template <class C, std::size_t first, std::size_t count, std::size_t stride = 1>
+struct helper_poly {
+    /** c[first] + x (c[first+stride] + x (...)) */
+    template <class R>
+    static forceinline R horner(R const &x) {
+        return poly_muladd(helper_poly<C, first + stride, count - 1, stride>::horner(x), x,
+                           R(poly_coeff<C, first>::value()));
+    }
+
+    /** p_even(x^2) + x p_odd(x^2), two independent chains */
+    template <class R>
+    static forceinline R horner2(R const &x) {
+        const R x2 = x * x;
+        return poly_muladd(helper_poly<C, first + stride, count / 2, 2 * stride>::horner(x2), x,
+                           helper_poly<C, first, (count + 1) / 2, 2 * stride>::horner(x2));
+    }
+
+    /** p_lo(x) + x^half p_hi(x), half the largest power of two smaller than count, pw[k] = x^(2^k) */
+    template <class R>
+    static forceinline R estrin(R const *pw) {
+        typedef poly_split<count> split;
+        return poly_muladd(
+            helper_poly<C, first + split::value * stride, count - split::value, stride>::estrin(pw), pw[split::log2],
+            helper_poly<C, first, split::value, stride>::estrin(pw));
+    }
+};
+
+template <class C, std::size_t first, std::size_t stride>
+struct helper_poly<C, first, 1, stride> {
+    template <class R>
+    static forceinline R horner(R const &) {
+        return R(poly_coeff<C, first>::value());
+    }
+
+    template <class R>
+    static forceinline R horner2(R const &) {
+        return R(poly_coeff<C, first>::value());
+    }
+
+    template <class R>
+    static forceinline R estrin(R const *) {
+        return R(poly_coeff<C, first>::value());
+    }
+};
+
+/** the selection of the scheme, powers the number of x, x^2, x^4 ... computed */
+template <class C, cyme::poly_scheme S>
+struct poly_eval;
+
+template <class C>
+struct poly_eval<C, cyme::poly_horner> {
+    static const std::size_t powers = 1;
+
+    template <class R>
+    static forceinline R eval(R const &x) {
+        return helper_poly<C, 0, C::order + 1>::horner(x);
+    }
+};
+
+template <class C>
+struct poly_eval<C, cyme::poly_horner2> {
+    static const std::size_t powers = (C::order > 0) ? 2 : 1;
+
+    template <class R>
+    static forceinline R eval(R const &x) {
+        return helper_poly<C, 0, C::order + 1>::horner2(x);
+    }
+};
+
+template <class C>
+struct poly_eval<C, cyme::poly_estrin> {
+    static const std::size_t powers = (C::order > 0) ? poly_split<C::order + 1>::log2 + 1 : 1;
+
+    template <class R>
+    static forceinline R eval(R const &x) {
+        R pw[powers];
+        pw[0] = x;
+        for (std::size_t k = 1; k < powers; ++k)
+            pw[k] = pw[k - 1] * pw[k - 1];
+        return helper_poly<C, 0, C::order + 1>::estrin(pw);
+    }
+};
+} // namespace detail
+/** \endcond */
+
+/** The coefficients of the table C of the library as a table of cyme::polyval: C<T, order-n+k> is the coefficient
+    of x^k, as helper_horner<T, O, N, C, n>.
+\code{.cpp}
+    cyme::polyval<cyme::poly_table<double, cyme::coeff_remez_exp>, cyme::poly_estrin>(x)
+\endcode
+ */
+template <class T, template <class, std::size_t> class C, std::size_t n = poly_order<T, C>::value>
+struct poly_table {
+    static const std::size_t order = n;
+};
+
+/** \cond */
+namespace detail {
+template <class T, template <class, std::size_t> class C, std::size_t n, std::size_t k>
+struct poly_coeff<poly_table<T, C, n>, k> {
+    static forceinline T value() { return C<T, poly_order<T, C>::value - n + k>::coeff(); }
+};
+} // namespace detail
+/** \endcond */
+
+/** The scheme of the polynomial of the table C in the functions of the library (exp, log, sin, cos, atan), per
+    backend O and unroll N. Horner by default: the fewest operations and the accuracy the functions are tested
+    with. Estrin shortens the chain of a long table (exp, log) from the order to log2(order): on SSE and AVX with
+    one register the latency of exp goes from ~44 to ~26 ns and of log from ~40 to ~16 ns, but the max error of
+    float exp from ~0.9 to ~1.4 ulp. On four registers its powers spill, the second order Horner keeps two chains.
+    sandbox/polynomial.cpp measures the three on the target. A caller opts in by specializing it for a table or a
+    backend:
+\code{.cpp}
+namespace cyme {
+template <class T, int N>
+struct poly_scheme_trait<coeff_remez_exp, T, cyme::avx, N> {
+    static const cyme::poly_scheme value = (N <= 2) ? cyme::poly_estrin : cyme::poly_horner2;
+};
+}
+\endcode
+ */
+template <template <class, std::size_t> class C, class T, cyme::simd O, int N>
+struct poly_scheme_trait {
+    static const cyme::poly_scheme value = cyme::poly_horner;
+};
 
 /** Implementation of a polynomial computation using Horner's method
 
 (http://en.wikipedia.org/wiki/Horner's_method)
- The template parameter C represents the coefficients described (log or exp coeff). This function is called
- into simd_log.hpp or simd_exp.log with the needed coefficient.
+ The template parameter C represents the coefficients described (log or exp coeff), the polynomial of order n of
+ the last n+1 coefficients.
  */
 template <class T, cyme::simd O, int N, template <typename, std::size_t> class C, std::size_t n>
 struct helper_horner {
     static forceinline vec_simd<T, O, N> horner(vec_simd<T, O, N> const &a) {
-#ifdef __FMA__
-        return muladd(helper_horner<T, O, N, C, n - 1>::horner(a), a,
-                      vec_simd<T, O, N>(C<T, poly_order<T, C>::value - n>::coeff()));
-#else
-        return vec_simd<T, O, N>(C<T, poly_order<T, C>::value - n>::coeff()) +
-               helper_horner<T, O, N, C, n - 1>::horner(a) * a;
-#endif
+        return detail::poly_eval<poly_table<T, C, n>, cyme::poly_horner>::eval(a);
     }
 };
 
-/** Implementation of the polynomial computation recursive template, final specialization */
-template <class T, cyme::simd O, int N, template <typename, std::size_t> class C>
-struct helper_horner<T, O, N, C, 0> {
-    static forceinline vec_simd<T, O, N> horner(vec_simd<T, O, N> const &) {
-        return vec_simd<T, O, N>(C<T, poly_order<T, C>::value>::coeff());
+/** Implementation of the polynomial computation of the functions of the library, the scheme of poly_scheme_trait.
+    This function is called into simd_log.ipp, simd_exp.ipp and simd_trig.ipp with the needed coefficient. */
+template <class T, cyme::simd O, int N, template <typename, std::size_t> class C,
+          std::size_t n = poly_order<T, C>::value>
+struct helper_polynomial {
+    static forceinline vec_simd<T, O, N> eval(vec_simd<T, O, N> const &a) {
+        return detail::poly_eval<poly_table<T, C, n>, poly_scheme_trait<C, T, O, N>::value>::eval(a);
     }
 };
 
@@ -77,10 +77,40 @@ struct Helper_div {
     }
 };
 
+/** Implements rcp<K> for syme::vec_simd, the precision is chosen by the caller instead of div_recursion */
+template <int K, class T, cyme::simd O, int N>
+forceinline vec_simd<T, O, N> rcp(vec_simd<T, O, N> const &rhs) {
+    static_assert(K >= 0, "cyme::rcp: the number of Newton-Raphson steps must not be negative");
+    return helper_div<T, O, N, K>::div(rhs);
+}
+
+/** Implements fast_div<K> for syme::vec_simd, as NewtonRaphson_div with K steps */
+template <int K, class T, cyme::simd O, int N>
+forceinline vec_simd<T, O, N> fast_div(vec_simd<T, O, N> const &lhs, vec_simd<T, O, N> const &rhs) {
+    static_assert(K >= 0, "cyme::fast_div: the number of Newton-Raphson steps must not be negative");
+    return lhs * helper_div<T, O, N, K>::div(rhs);
+}
+
 /** Implements operator/ for syme::vec_simd */
 template <class T, cyme::simd O, int N>
 forceinline vec_simd<T, O, N> operator/(const vec_simd<T, O, N> &lhs, const vec_simd<T, O, N> &rhs) {
     return Helper_div<T, O, N>::div(lhs, rhs);
 }
+
+/** Implements operator/ for syme::vec_simd of integers by an invariant divisor, rounded to zero as the scalar / */
+template <cyme::simd O, int N>
+forceinline vec_simd<int, O, N> operator/(const vec_simd<int, O, N> &lhs, int_divisor const &rhs) {
+    vec_simd<int, O, N> nrv;
+    nrv.xmm = _mm_div_invariant<int, O, N>(lhs.xmm, rhs);
+    return nrv;
+}
+
+/** Implements operator% for syme::vec_simd of integers by an invariant divisor, the sign of the numerator */
+template <cyme::simd O, int N>
+forceinline vec_simd<int, O, N> operator%(const vec_simd<int, O, N> &lhs, int_divisor const &rhs) {
+    vec_simd<int, O, N> nrv;
+    nrv.xmm = _mm_mod_invariant<int, O, N>(lhs.xmm, rhs);
+    return nrv;
+}
 } // namespace cyme
 #endif
@@ -33,11 +33,11 @@
 
 namespace cyme {
 
-/** Function object that compute the Remez approximation of e^x using Horner method */
+/** Function object that compute the Remez approximation of e^x, the scheme of poly_scheme_trait */
 template <class T, cyme::simd O, int N, std::size_t n>
 struct Remez_exp {
     static forceinline vec_simd<T, O, N> exp(vec_simd<T, O, N> const &a) {
-        return helper_horner<T, O, N, coeff_remez_exp, n>::horner(a);
+        return helper_polynomial<T, O, N, coeff_remez_exp, n>::eval(a);
     }
 };
 
@@ -79,9 +79,8 @@ template <class T, cyme::simd O, int N, std::size_t n = poly_order<T, coeff_reme
           class Solver = Remez_exp<T, O, N, n>> // Remez, series ...
 struct cyme_exp {
     static forceinline vec_simd<T, O, N> exp(vec_simd<T, O, N> x) {
-        vec_simd<T, O, N> mask0(~(fabs(x) > vec_simd<T, O, N>(exp_limits<T>::max_range()))); // mask for the boundary
-        vec_simd<T, O, N> mask1(x < vec_simd<T, O, N>(exp_limits<T>::max_range()));          // mask for the boundary
-        vec_simd<T, O, N> mask2(std::numeric_limits<T>::infinity());
+        vec_simd<T, O, N> mask0(x < vec_simd<T, O, N>(-exp_limits<T>::max_range()));  // mask for the boundary
+        vec_simd<T, O, N> mask1(x >= vec_simd<T, O, N>(exp_limits<T>::max_range())); // mask for the boundary
 
         /* calculate k,  k = (int)floor(a); p = (float)k; */
         vec_simd<T, O, N> log2e(1.4426950408889634073599);
@@ -105,9 +104,8 @@ struct cyme_exp {
         p = twok<T, O, N>(k);
         /* e^x = 2^k * e^y */
         x *= p;
-        x &= mask0;      // lower than -max_range becomes 0
-        mask2 &= ~mask1; // larger than max_range becomes +inf, step1
-        x |= mask2;      // larger than max_range becomes +inf, step2
+        x = where(mask0, vec_simd<T, O, N>(T(0)), x); // lower than -max_range becomes 0, a blend
+        x = where(mask1, vec_simd<T, O, N>(std::numeric_limits<T>::infinity()), x); // larger becomes +inf
         return x;
     }
 };
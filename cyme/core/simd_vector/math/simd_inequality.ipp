@@ -37,6 +37,13 @@ vec_simd<T, O, N> operator==(const vec_simd<T, O, N> &lhs, const vec_simd<T, O,
     return nrv;
 }
 
+/* create a new vector that contains the results of the inequality != */
+template <class T, cyme::simd O, int N>
+vec_simd<T, O, N> operator!=(const vec_simd<T, O, N> &lhs, const vec_simd<T, O, N> &rhs) {
+    vec_simd<T, O, N> nrv(_mm_ne<T, O, N>(lhs.xmm, rhs.xmm));
+    return nrv;
+}
+
 /* create a new vector that contains the results of the inequality < */
 template <class T, cyme::simd O, int N>
 vec_simd<T, O, N> operator<(const vec_simd<T, O, N> &lhs, const vec_simd<T, O, N> &rhs) {
@@ -47,8 +54,8 @@ vec_simd<T, O, N> operator<(const vec_simd<T, O, N> &lhs, const vec_simd<T, O, N
 /* create a new vector that contains the results of the inequality <= */
 template <class T, cyme::simd O, int N>
 vec_simd<T, O, N> operator<=(const vec_simd<T, O, N> &lhs, const vec_simd<T, O, N> &rhs) {
-    vec_simd<T, O, N> nrv(_mm_lt<T, O, N>(rhs.xmm, lhs.xmm));
-    return ~nrv;
+    vec_simd<T, O, N> nrv(_mm_le<T, O, N>(lhs.xmm, rhs.xmm));
+    return nrv;
 }
 
 /* create a new vector that contains the results of the inequality > */
@@ -61,8 +68,8 @@ vec_simd<T, O, N> operator>(const vec_simd<T, O, N> &lhs, const vec_simd<T, O, N
 /* create a new vector that contains the results of the inequality >= */
 template <class T, cyme::simd O, int N>
 vec_simd<T, O, N> operator>=(const vec_simd<T, O, N> &lhs, const vec_simd<T, O, N> &rhs) {
-    vec_simd<T, O, N> nrv(_mm_lt<T, O, N>(lhs.xmm, rhs.xmm));
-    return ~nrv;
+    vec_simd<T, O, N> nrv(_mm_le<T, O, N>(rhs.xmm, lhs.xmm));
+    return nrv;
 }
 
 } // namespace cyme
@@ -32,11 +32,11 @@
 
 namespace cyme {
 
-/** Function object that compute the Remez approximation of ln(x) using Horner method */
+/** Function object that compute the Remez approximation of ln(x), the scheme of poly_scheme_trait */
 template <class T, cyme::simd O, int N, std::size_t n>
 struct Remez_log {
     static forceinline vec_simd<T, O, N> log(vec_simd<T, O, N> const &a) {
-        return helper_horner<T, O, N, coeff_remez_log, n>::horner(a);
+        return helper_polynomial<T, O, N, coeff_remez_log, n>::eval(a);
     }
 };
 
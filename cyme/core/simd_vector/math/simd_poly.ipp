@@ -0,0 +1,72 @@
+/*
+ * Cyme - simd_poly.ipp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ * This file is part of Cyme <https://github.com/BlueBrain/cyme>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+
+/**
+ * @file cyme/core/simd_vector/math/simd_poly.ipp
+ * Implements polyval and ratval, the polynomials and the rational functions of the coefficient tables of the user
+ */
+
+#ifndef CYME_SIMD_POLY_IPP
+#define CYME_SIMD_POLY_IPP
+
+#include <cstddef>
+#include <type_traits>
+
+#include "cyme/core/simd_vector/math/detail/horner.ipp"
+
+namespace cyme {
+
+/** Polynomial of the coefficient table C, c[0] + c[1] x + ... + c[order] x^order. The table is a class:
+\code{.cpp}
+struct alpha_m { // fitted offline
+    static const std::size_t order = 3;
+    static double coeff(std::size_t n) {
+        static const double c[] = {0.182, 4.6e-2, 1.1e-3, -2.7e-6};
+        return c[n];
+    }
+};
+\endcode
+ the indices are known at compile time, the coefficients become constants of the code. The call is qualified,
+ cyme::polyval<alpha_m>(R[v]), the explicit template arguments disable the argument dependent lookup in C++11 */
+template <class C, cyme::poly_scheme S, class T, cyme::simd O, int N>
+forceinline vec_simd<T, O, N> polyval(const vec_simd<T, O, N> &rhs) {
+    return detail::poly_eval<C, S>::eval(rhs);
+}
+
+/** Rational function P(x)/Q(x), the Newton-Raphson division of cyme */
+template <class P, class Q, cyme::poly_scheme S, class T, cyme::simd O, int N>
+forceinline vec_simd<T, O, N> ratval(const vec_simd<T, O, N> &rhs) {
+    return detail::poly_eval<P, S>::eval(rhs) / detail::poly_eval<Q, S>::eval(rhs);
+}
+
+/** Polynomial of the coefficient table C for the basic types, the AoS layout */
+template <class C, cyme::poly_scheme S = cyme::poly_horner, class T>
+forceinline typename std::enable_if<std::is_floating_point<T>::value, T>::type polyval(T x) {
+    return detail::poly_eval<C, S>::eval(x);
+}
+
+/** Rational function P(x)/Q(x) for the basic types, the AoS layout */
+template <class P, class Q, cyme::poly_scheme S = cyme::poly_horner, class T>
+forceinline typename std::enable_if<std::is_floating_point<T>::value, T>::type ratval(T x) {
+    return detail::poly_eval<P, S>::eval(x) / detail::poly_eval<Q, S>::eval(x);
+}
+} // namespace cyme
+#endif
@@ -0,0 +1,145 @@
+/*
+ * Cyme - simd_round.ipp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ * This file is part of Cyme <https://github.com/BlueBrain/cyme>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+
+/**
+ * @file cyme/core/simd_vector/math/simd_round.ipp
+ * Implements round, copysign, frexp, logb, ldexp and fmod for vec_simd class
+ */
+
+#ifndef CYME_SIMD_ROUND_IPP
+#define CYME_SIMD_ROUND_IPP
+
+#include <cmath>
+#include <limits>
+
+namespace cyme {
+
+/** std::round, trunc(x + copysign(0.5 - ulp/2, x)): 0.5 itself would round 0.49999999999999994 up to 1 */
+template <class T, cyme::simd O, int N>
+forceinline vec_simd<T, O, N> round(const vec_simd<T, O, N> &rhs) {
+    const vec_simd<T, O, N> half(std::nextafter(static_cast<T>(0.5), static_cast<T>(0)));
+    return rounding<cyme::round_zero>(rhs + copysign(half, rhs));
+}
+
+/** the magnitude of lhs, the sign bit of rhs */
+template <class T, cyme::simd O, int N>
+forceinline vec_simd<T, O, N> copysign(const vec_simd<T, O, N> &lhs, const vec_simd<T, O, N> &rhs) {
+    const vec_simd<T, O, N> sign(static_cast<T>(-0.));
+    return fabs(lhs) | (rhs & sign);
+}
+
+/** the fraction gf/2 in [0.5,1), the subnormal numbers are scaled by 2^digits before */
+template <class T, cyme::simd O, int N>
+forceinline vec_simd<T, O, N> frexp(const vec_simd<T, O, N> &rhs) {
+    typedef std::numeric_limits<T> limits;
+    const vec_simd<T, O, N> a = fabs(rhs);
+    const vec_simd<T, O, N> scale =
+        where(a < vec_simd<T, O, N>(limits::min()), vec_simd<T, O, N>(std::ldexp(static_cast<T>(1), limits::digits)),
+              vec_simd<T, O, N>(static_cast<T>(1)));
+    const vec_simd<T, O, N> f = gf(a * scale) * vec_simd<T, O, N>(static_cast<T>(0.5));
+    const vec_simd<T, O, N> finite =
+        (a > vec_simd<T, O, N>(static_cast<T>(0))) & (a < vec_simd<T, O, N>(limits::infinity()));
+    return where(finite, copysign(f, rhs), rhs);
+}
+
+/** the exponent ge, -inf for 0, +inf for inf, nan for nan as std::logb */
+template <class T, cyme::simd O, int N>
+forceinline vec_simd<T, O, N> logb(const vec_simd<T, O, N> &rhs) {
+    typedef std::numeric_limits<T> limits;
+    const vec_simd<T, O, N> zero(static_cast<T>(0));
+    const vec_simd<T, O, N> a = fabs(rhs);
+    const vec_simd<T, O, N> subnormal = a < vec_simd<T, O, N>(limits::min());
+    const vec_simd<T, O, N> e =
+        ge(where(subnormal, a * vec_simd<T, O, N>(std::ldexp(static_cast<T>(1), limits::digits)), a)) -
+        where(subnormal, vec_simd<T, O, N>(static_cast<T>(limits::digits)), zero);
+    const vec_simd<T, O, N> finite = (a > zero) & (a < vec_simd<T, O, N>(limits::infinity()));
+    return where(finite, e, where(a == zero, vec_simd<T, O, N>(-limits::infinity()), a));
+}
+
+/** lhs*2^rhs as the scalbn of musl: twok covers the normal exponents only, the large |rhs| are reduced twice
+    before, by 2^emin*2^digits for the negative ones so the subnormal results are rounded once */
+template <class T, cyme::simd O, int N>
+forceinline vec_simd<T, O, N> ldexp(const vec_simd<T, O, N> &lhs, const vec_simd<T, O, N> &rhs) {
+    typedef std::numeric_limits<T> limits;
+    const int emax = limits::max_exponent - 1;
+    const int emin = limits::min_exponent - 1;
+    const vec_simd<T, O, N> up(std::ldexp(static_cast<T>(1), emax));
+    const vec_simd<T, O, N> down(std::ldexp(static_cast<T>(1), emin + limits::digits));
+    const vec_simd<T, O, N> nup(static_cast<T>(emax));
+    const vec_simd<T, O, N> ndown(static_cast<T>(emin + limits::digits));
+    const vec_simd<T, O, N> nmin(static_cast<T>(emin));
+    vec_simd<T, O, N> x(lhs);
+    vec_simd<T, O, N> n(rhs);
+    for (int k = 0; k < 2; ++k) {
+        const vec_simd<T, O, N> large = n > nup;
+        x = where(large, x * up, x);
+        n = where(large, n - nup, n);
+    }
+    for (int k = 0; k < 2; ++k) {
+        const vec_simd<T, O, N> small = n < nmin;
+        x = where(small, x * down, x);
+        n = where(small, n - ndown, n);
+    }
+    return x * twok<T, O, N>(floor(min(max(n, nmin), nup)));
+}
+
+/** the halves of Veltkamp, x = hi + lo with digits/2 bits each, their products are exact. C = 2^ceil(digits/2)+1 */
+template <class T, cyme::simd O, int N>
+forceinline void veltkamp_split(const vec_simd<T, O, N> &x, const vec_simd<T, O, N> &c, vec_simd<T, O, N> &hi,
+                                vec_simd<T, O, N> &lo) {
+    const vec_simd<T, O, N> t = c * x;
+    hi = t - (t - x);
+    lo = x - hi;
+}
+
+/** lhs - trunc(lhs/rhs)*rhs, the division of cyme is Newton-Raphson: the quotient may be one integer too small
+    (|r| >= |rhs|) or too large (r of the wrong sign), one correction each. Exact while |lhs/rhs| < 2^digits: the
+    product is the FMA, or without the FMA p + e of Dekker (lhs - p is exact, p is close to lhs). The halves of
+    Dekker overflow for |rhs| > max/2^(digits/2), the product is rounded there */
+template <class T, cyme::simd O, int N>
+forceinline vec_simd<T, O, N> fmod(const vec_simd<T, O, N> &lhs, const vec_simd<T, O, N> &rhs) {
+    typedef std::numeric_limits<T> limits;
+    const vec_simd<T, O, N> zero(static_cast<T>(0));
+    const vec_simd<T, O, N> inf(limits::infinity());
+    const vec_simd<T, O, N> q = rounding<cyme::round_zero>(lhs / rhs);
+#ifdef __FMA__
+    vec_simd<T, O, N> r = negatemuladd(q, rhs, lhs);
+#else
+    const T c = std::ldexp(static_cast<T>(1), (limits::digits + 1) / 2) + static_cast<T>(1);
+    const vec_simd<T, O, N> vc(c);
+    vec_simd<T, O, N> qh, ql, bh, bl;
+    veltkamp_split(q, vc, qh, ql);
+    veltkamp_split(rhs, vc, bh, bl);
+    const vec_simd<T, O, N> p = q * rhs;
+    const vec_simd<T, O, N> e = ((qh * bh - p) + qh * bl + ql * bh) + ql * bl;
+    const vec_simd<T, O, N> exact =
+        (fabs(q) < vec_simd<T, O, N>(std::ldexp(static_cast<T>(1), limits::digits))) &
+        (fabs(rhs) < vec_simd<T, O, N>(limits::max() / c));
+    vec_simd<T, O, N> r = (lhs - p) - where(exact, e, zero);
+#endif
+    const vec_simd<T, O, N> b = copysign(rhs, lhs);
+    r = where(fabs(r) >= fabs(rhs), r - b, r);
+    const vec_simd<T, O, N> wrong = ((r < zero) & (lhs > zero)) | ((r > zero) & (lhs < zero));
+    r = where(wrong, r + b, r);
+    return where((fabs(rhs) == inf) & (fabs(lhs) < inf), lhs, r); // a finite lhs is its own remainder
+}
+} // namespace cyme
+#endif
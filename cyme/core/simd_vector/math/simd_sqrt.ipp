@@ -98,6 +98,13 @@ struct Selector_sqrt {
     }
 };
 
+/** Implements rsqrt<K> for syme::vec_simd, the precision is chosen by the caller instead of sqrt_recursion */
+template <int K, class T, cyme::simd O, int N>
+forceinline vec_simd<T, O, N> rsqrt(vec_simd<T, O, N> const &rhs) {
+    static_assert(K >= 0, "cyme::rsqrt: the number of Newton-Raphson steps must not be negative");
+    return helper_rsqrt<T, O, N, K>::rsqrt(rhs);
+}
+
 /** Implements function sqrt for syme::vec_simd */
 template <class T, cyme::simd O, int N>
 forceinline vec_simd<T, O, N> sqrt(const vec_simd<T, O, N> &rhs) {
@@ -23,14 +23,17 @@
 
 /**
  * @file cyme/core/simd_vector/math/simd_trig.ipp
- * Implements sin for vec_simd class
+ * Implements sin, cos, tan, atan and atan2 for vec_simd class
  */
 
 #ifndef CYME_SIMD_TRIG_IPP
 #define CYME_SIMD_TRIG_IPP
 
+#include <limits>
+
 #include "cyme/core/simd_vector/math/detail/horner.ipp"
 #include "cyme/core/simd_vector/math/detail/coeff_sin_cos.ipp"
+#include "cyme/core/simd_vector/math/detail/coeff_atan.ipp"
 
 namespace cyme {
 /** Base struct*/
@@ -42,8 +45,7 @@ template <class T, cyme::simd O, int N>
 struct Poly_helper<T, O, N, coeff_cephes_cos> {
     static forceinline vec_simd<T, O, N> poly(vec_simd<T, O, N> x) {
         vec_simd<T, O, N> z(x * x);
-        vec_simd<T, O, N> y =
-            helper_horner<T, O, N, coeff_cephes_cos, poly_order<T, coeff_cephes_cos>::value>::horner(z);
+        vec_simd<T, O, N> y = helper_polynomial<T, O, N, coeff_cephes_cos>::eval(z);
         y *= z;
         y -= (z * vec_simd<T, O, N>(0.5));
         y += vec_simd<T, O, N>(1);
@@ -56,8 +58,7 @@ template <class T, cyme::simd O, int N>
 struct Poly_helper<T, O, N, coeff_cephes_sin> {
     static forceinline vec_simd<T, O, N> poly(vec_simd<T, O, N> x) {
         vec_simd<T, O, N> z(x * x);
-        vec_simd<T, O, N> y =
-            helper_horner<T, O, N, coeff_cephes_sin, poly_order<T, coeff_cephes_sin>::value>::horner(z);
+        vec_simd<T, O, N> y = helper_polynomial<T, O, N, coeff_cephes_sin>::eval(z);
         y *= x;
         y += x;
         return y;
@@ -189,5 +190,64 @@ forceinline vec_simd<T, O, N> tan(const vec_simd<T, O, N> &rhs) {
     // Select Sign
     return x / y;
 }
+
+/** Helper for polynom where |x| <= tan(Pi/8) (atan)*/
+template <class T, cyme::simd O, int N>
+struct Poly_helper<T, O, N, coeff_cephes_atan> {
+    static forceinline vec_simd<T, O, N> poly(vec_simd<T, O, N> x) {
+        vec_simd<T, O, N> z(x * x);
+        vec_simd<T, O, N> y = helper_polynomial<T, O, N, coeff_cephes_atan>::eval(z);
+        y *= z * x;
+        y += x;
+        return y;
+    }
+};
+
+/**
+  free function for atan of 0 <= x <= 1, atan(x) = Pi/4 + atan((x-1)/(x+1)) above tan(Pi/8)
+  Used references:
+  (http://github.com/jeremybarnes/cephes)
+*/
+template <class T, cyme::simd O, int N>
+forceinline vec_simd<T, O, N> atan_unit(const vec_simd<T, O, N> &x) {
+    const vec_simd<T, O, N> one(1.0);
+    const vec_simd<T, O, N> large = x > vec_simd<T, O, N>(0.4142135623730950); // tan(Pi/8)
+    const vec_simd<T, O, N> y = Poly_helper<T, O, N, coeff_cephes_atan>::poly(where(large, (x - one) / (x + one), x));
+    return where(large, y + vec_simd<T, O, N>(0.7853981633974483096), y);
+}
+
+/**
+  free function for atan, the argument is reduced to [0, 1] by atan(x) = Pi/2 - atan(1/x)
+*/
+template <class T, cyme::simd O, int N>
+forceinline vec_simd<T, O, N> atan(const vec_simd<T, O, N> &rhs) {
+    const vec_simd<T, O, N> one(1.0);
+    const vec_simd<T, O, N> x = fabs(rhs);
+    const vec_simd<T, O, N> large = x > one;
+    const vec_simd<T, O, N> inf(std::numeric_limits<T>::infinity());
+    const vec_simd<T, O, N> y = atan_unit(where(large, where(x == inf, vec_simd<T, O, N>(0.0), one / x), x));
+    return copysign(where(large, vec_simd<T, O, N>(1.5707963267948966192) - y, y), rhs);
+}
+
+/**
+  free function for atan2, atan of min(|x|,|y|)/max(|x|,|y|) then the octant. The zeros and the infinities as
+  std::atan2: atan2(+-0, -0) = +-Pi, atan2(+-inf, +-inf) = +-Pi/4 or +-3Pi/4
+*/
+template <class T, cyme::simd O, int N>
+forceinline vec_simd<T, O, N> atan2(const vec_simd<T, O, N> &lhs, const vec_simd<T, O, N> &rhs) {
+    const vec_simd<T, O, N> zero(0.0);
+    const vec_simd<T, O, N> one(1.0);
+    const vec_simd<T, O, N> y = fabs(lhs);
+    const vec_simd<T, O, N> x = fabs(rhs);
+    const vec_simd<T, O, N> small = min(x, y);
+    const vec_simd<T, O, N> big = max(x, y);
+    const vec_simd<T, O, N> inf(std::numeric_limits<T>::infinity());
+    const vec_simd<T, O, N> t =
+        where(big == zero, zero, where(small == big, one, where(big == inf, zero, small / big))); // no 0/0, inf/inf
+    vec_simd<T, O, N> r = atan_unit(t);
+    r = where(y > x, vec_simd<T, O, N>(1.5707963267948966192) - r, r);
+    r = where(copysign(one, rhs) < zero, vec_simd<T, O, N>(3.1415926535897932385) - r, r); // -0 included
+    return where((lhs != lhs) | (rhs != rhs), lhs + rhs, copysign(r, lhs));
+}
 } // namespace cyme
 #endif
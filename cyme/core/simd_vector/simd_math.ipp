@@ -46,5 +46,7 @@
 #include "cyme/core/simd_vector/math/simd_fma.ipp"
 #include "cyme/core/simd_vector/math/simd_fms.ipp"
 #endif
+#include "cyme/core/simd_vector/math/simd_round.ipp"
+#include "cyme/core/simd_vector/math/simd_poly.ipp"
 
 #endif
@@ -28,6 +28,8 @@
 #define CYME_SIMD_VEC_HPP
 
 #include <iostream>
+#include <cstdint>
+#include <utility>
 
 #include "cyme/core/simd_vector/trait.hpp"
 #include "cyme/core/simd_vector/simd_wrapper.hpp"
@@ -105,6 +107,9 @@ struct vec_simd {
     /** Operator >>= bewteen two vectors (right shift) */
     forceinline vec_simd &operator>>=(const vec_simd &rhs);
 
+    /** Operator <<= bewteen two vectors (left shift) */
+    forceinline vec_simd &operator<<=(const vec_simd &rhs);
+
     /** Operator bitwize not operator */
     forceinline vec_simd &operator~();
 
@@ -154,6 +159,40 @@ forceinline vec_simd<int, O, N> round_up_even(const vec_simd<int, O, N> &rhs);
 template <class T, cyme::simd O, int N>
 forceinline vec_simd<T, O, N> convert(const vec_simd<int, O, N> &ths);
 
+/** Convert the 64 bits integers to double, rounded to the nearest */
+template <class T, cyme::simd O, int N>
+forceinline vec_simd<T, O, N> convert(const vec_simd<std::int64_t, O, N> &ths);
+
+/** Convert the 64 bits unsigned integers to double, rounded to the nearest */
+template <class T, cyme::simd O, int N>
+forceinline vec_simd<T, O, N> convert(const vec_simd<std::uint64_t, O, N> &ths);
+
+/** Convert the 32 bits unsigned integers to float, rounded to the nearest */
+template <class T, cyme::simd O, int N>
+forceinline vec_simd<T, O, N> convert(const vec_simd<std::uint32_t, O, N> &ths);
+
+/** Convert float to int, truncated as static_cast, the same number of lanes */
+template <class T, cyme::simd O, int N>
+forceinline vec_simd<T, O, N> convert(const vec_simd<float, O, N> &ths);
+
+/** Widen the lanes of a float register to two registers of double, the first half of the lanes then the second,
+    in memory order: lo.store(p) and hi.store(p + size/2) give the lanes of ths */
+template <cyme::simd O, int N>
+forceinline std::pair<vec_simd<double, O, N>, vec_simd<double, O, N>> widen(const vec_simd<float, O, N> &ths);
+
+/** Widen the lanes of an int register to two registers of double, exact */
+template <cyme::simd O, int N>
+forceinline std::pair<vec_simd<double, O, N>, vec_simd<double, O, N>> widen(const vec_simd<int, O, N> &ths);
+
+/** Widen the lanes of a 32 bits unsigned integer register to two registers of double, exact (x86 only) */
+template <cyme::simd O, int N>
+forceinline std::pair<vec_simd<double, O, N>, vec_simd<double, O, N>> widen(const vec_simd<std::uint32_t, O, N> &ths);
+
+/** Narrow two registers of double to one register of float (rounded to the nearest) or int (truncated), the lanes
+    of lo then the lanes of hi, the inverse of widen */
+template <class T, cyme::simd O, int N>
+forceinline vec_simd<T, O, N> narrow(const vec_simd<double, O, N> &lo, const vec_simd<double, O, N> &hi);
+
 /** Return the 2^k where k is a vector base on an integer */
 template <class T, cyme::simd O, int N>
 forceinline vec_simd<T, O, N> twok(const vec_simd<int, O, N> &rhs);
@@ -192,6 +231,34 @@ forceinline vec_simd<T, O, N> gesqrt2(const vec_simd<T, O, N> &rhs);
 template <class T, cyme::simd O, int N>
 forceinline vec_simd<int, O, N> floor(const vec_simd<T, O, N> &rhs);
 
+/** Round to an integral value with the mode M, the result stays a floating point number (floor, ceil, trunc, rint) */
+template <cyme::round_mode M, class T, cyme::simd O, int N>
+forceinline vec_simd<T, O, N> rounding(const vec_simd<T, O, N> &rhs);
+
+/** Round to the nearest integral value, the halfway cases away from zero as std::round */
+template <class T, cyme::simd O, int N>
+forceinline vec_simd<T, O, N> round(const vec_simd<T, O, N> &rhs);
+
+/** Return the magnitude of lhs with the sign of rhs */
+template <class T, cyme::simd O, int N>
+forceinline vec_simd<T, O, N> copysign(const vec_simd<T, O, N> &lhs, const vec_simd<T, O, N> &rhs);
+
+/** Return the fraction of std::frexp, in [0.5,1) with the sign of rhs, rhs itself if 0, inf or nan */
+template <class T, cyme::simd O, int N>
+forceinline vec_simd<T, O, N> frexp(const vec_simd<T, O, N> &rhs);
+
+/** Return the exponent of std::logb, floor(log2|rhs|) with the subnormal numbers, the one of frexp minus one */
+template <class T, cyme::simd O, int N>
+forceinline vec_simd<T, O, N> logb(const vec_simd<T, O, N> &rhs);
+
+/** Return lhs*2^rhs, rhs integral values, as std::ldexp */
+template <class T, cyme::simd O, int N>
+forceinline vec_simd<T, O, N> ldexp(const vec_simd<T, O, N> &lhs, const vec_simd<T, O, N> &rhs);
+
+/** Return the remainder lhs - trunc(lhs/rhs)*rhs, the sign of lhs as std::fmod */
+template <class T, cyme::simd O, int N>
+forceinline vec_simd<T, O, N> fmod(const vec_simd<T, O, N> &lhs, const vec_simd<T, O, N> &rhs);
+
 /** Free function + operator between two vectors, this function uses the return value optimization */
 template <class T, cyme::simd O, int N>
 forceinline vec_simd<T, O, N> operator+(const vec_simd<T, O, N> &lhs, const vec_simd<T, O, N> &rhs);
@@ -216,6 +283,26 @@ forceinline vec_simd<T, O, N> rec(vec_simd<T, O, N> const &rhs);
 template <class T, cyme::simd O, int N>
 forceinline vec_simd<T, O, N> recsqrt(vec_simd<T, O, N> const &rhs);
 
+/** Free function for the reciprocal 1/x, K Newton-Raphson steps after the hardware approximation */
+template <int K, class T, cyme::simd O, int N>
+forceinline vec_simd<T, O, N> rcp(vec_simd<T, O, N> const &rhs);
+
+/** Free function for the reciprocal square root 1/sqrt(x), K Newton-Raphson steps after the hardware approximation */
+template <int K, class T, cyme::simd O, int N>
+forceinline vec_simd<T, O, N> rsqrt(vec_simd<T, O, N> const &rhs);
+
+/** Free function for the division a*rcp<K>(b) */
+template <int K, class T, cyme::simd O, int N>
+forceinline vec_simd<T, O, N> fast_div(vec_simd<T, O, N> const &lhs, vec_simd<T, O, N> const &rhs);
+
+/** Free function / operator between an integer vector and an invariant divisor, multiply-high and shift */
+template <cyme::simd O, int N>
+forceinline vec_simd<int, O, N> operator/(const vec_simd<int, O, N> &lhs, int_divisor const &rhs);
+
+/** Free function % operator between an integer vector and an invariant divisor */
+template <cyme::simd O, int N>
+forceinline vec_simd<int, O, N> operator%(const vec_simd<int, O, N> &lhs, int_divisor const &rhs);
+
 /** Free function for the negation */
 template <class T, cyme::simd O, int N>
 forceinline vec_simd<T, O, N> neg(const vec_simd<T, O, N> &rhs);
@@ -268,6 +355,23 @@ forceinline vec_simd<T, O, N> cos(const vec_simd<T, O, N> &rhs);
 template <class T, cyme::simd O, int N>
 forceinline vec_simd<T, O, N> tan(const vec_simd<T, O, N> &rhs);
 
+/** Free function for the polynomial of the coefficient table C: C::order the degree, C::coeff(n) the coefficient
+    of x^n, evaluated by the scheme S */
+template <class C, cyme::poly_scheme S = cyme::poly_horner, class T, cyme::simd O, int N>
+forceinline vec_simd<T, O, N> polyval(const vec_simd<T, O, N> &rhs);
+
+/** Free function for the rational function P(x)/Q(x) of the coefficient tables P and Q, one division */
+template <class P, class Q, cyme::poly_scheme S = cyme::poly_horner, class T, cyme::simd O, int N>
+forceinline vec_simd<T, O, N> ratval(const vec_simd<T, O, N> &rhs);
+
+/** Free function for the atan */
+template <class T, cyme::simd O, int N>
+forceinline vec_simd<T, O, N> atan(const vec_simd<T, O, N> &rhs);
+
+/** Free function for the atan2, the angle of the point (rhs, lhs) in [-pi, pi] */
+template <class T, cyme::simd O, int N>
+forceinline vec_simd<T, O, N> atan2(const vec_simd<T, O, N> &lhs, const vec_simd<T, O, N> &rhs);
+
 /** Free function for gather */
 template <class T, cyme::simd O, int N>
 forceinline vec_simd<T, O, N> help_gather(const T *src, const int *ind, const int range);
@@ -280,6 +384,43 @@ void help_scatter(vec_simd<T, O, N> const &src, T *des, const int *ind, const in
 template <class T, cyme::simd O, int N>
 forceinline vec_simd<T, O, N> min(const vec_simd<T, O, N> &lhs, const vec_simd<T, O, N> &rhs);
 
+/** Free function max operator between two vectors, this function uses the return value optimization */
+template <class T, cyme::simd O, int N>
+forceinline vec_simd<T, O, N> max(const vec_simd<T, O, N> &lhs, const vec_simd<T, O, N> &rhs);
+
+/** Free function select, lhs where the mask (result of a comparison) is true else rhs */
+template <class T, cyme::simd O, int N>
+forceinline vec_simd<T, O, N> where(const vec_simd<T, O, N> &mask, const vec_simd<T, O, N> &lhs,
+                                    const vec_simd<T, O, N> &rhs);
+
+/** Free function horizontal sum of the lanes of a vector, a pairwise tree into the registers */
+template <class T, cyme::simd O, int N>
+forceinline T hsum(const vec_simd<T, O, N> &v);
+
+/** Free function horizontal minimum of the lanes of a vector */
+template <class T, cyme::simd O, int N>
+forceinline T hmin(const vec_simd<T, O, N> &v);
+
+/** Free function horizontal maximum of the lanes of a vector */
+template <class T, cyme::simd O, int N>
+forceinline T hmax(const vec_simd<T, O, N> &v);
+
+/** Free function, true if a lane of the mask (result of a comparison) is true */
+template <class T, cyme::simd O, int N>
+forceinline bool any(const vec_simd<T, O, N> &mask);
+
+/** Free function, true if all the lanes of the mask (result of a comparison) are true */
+template <class T, cyme::simd O, int N>
+forceinline bool all(const vec_simd<T, O, N> &mask);
+
+/** Free function, number of true lanes of the mask (result of a comparison) */
+template <class T, cyme::simd O, int N>
+forceinline int popcount(const vec_simd<T, O, N> &mask);
+
+/** Free function, the lanes of the mask (result of a comparison) as bits, the bit i is the lane i */
+template <class T, cyme::simd O, int N>
+forceinline unsigned int movemask(const vec_simd<T, O, N> &mask);
+
 /** Free function "SIMD" sense of way static cast, from T1 to T2 */
 template <class T2, class T1, cyme::simd O, int N>
 forceinline vec_simd<T2, O, N> cast(const vec_simd<T1, O, N> &v1);
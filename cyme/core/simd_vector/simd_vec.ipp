@@ -114,6 +114,12 @@ vec_simd<T, O, N> &vec_simd<T, O, N>::operator>>=(const vec_simd<T, O, N> &rhs)
     return *this;
 }
 
+template <class T, cyme::simd O, int N>
+vec_simd<T, O, N> &vec_simd<T, O, N>::operator<<=(const vec_simd<T, O, N> &rhs) {
+    xmm = _mm_sll<typename simd_trait<T, O, N>::value_type, O, N>(xmm, rhs.xmm);
+    return *this;
+}
+
 template <class T, cyme::simd O, int N>
 vec_simd<T, O, N> &vec_simd<T, O, N>::operator~() {
     xmm = _mm_andnot<typename simd_trait<T, O, N>::value_type, O, N>(xmm);
@@ -170,6 +176,65 @@ vec_simd<T, O, N> convert(const vec_simd<int, O, N> &rhs) {
     return nrv;
 }
 
+template <class T, cyme::simd O, int N>
+vec_simd<T, O, N> convert(const vec_simd<std::int64_t, O, N> &rhs) {
+    vec_simd<T, O, N> nrv;
+    nrv.xmm = _mm_cvt<std::int64_t, O, N, typename simd_trait<T, O, N>::value_type>(rhs.xmm);
+    return nrv;
+}
+
+template <class T, cyme::simd O, int N>
+vec_simd<T, O, N> convert(const vec_simd<std::uint64_t, O, N> &rhs) {
+    vec_simd<T, O, N> nrv;
+    nrv.xmm = _mm_cvt<std::uint64_t, O, N, typename simd_trait<T, O, N>::value_type>(rhs.xmm);
+    return nrv;
+}
+
+template <class T, cyme::simd O, int N>
+vec_simd<T, O, N> convert(const vec_simd<std::uint32_t, O, N> &rhs) {
+    vec_simd<T, O, N> nrv;
+    nrv.xmm = _mm_cvt<std::uint32_t, O, N, typename simd_trait<T, O, N>::value_type>(rhs.xmm);
+    return nrv;
+}
+
+template <class T, cyme::simd O, int N>
+vec_simd<T, O, N> convert(const vec_simd<float, O, N> &rhs) {
+    vec_simd<T, O, N> nrv;
+    nrv.xmm = _mm_cvt<float, O, N, typename simd_trait<T, O, N>::value_type>(rhs.xmm);
+    return nrv;
+}
+
+template <cyme::simd O, int N>
+std::pair<vec_simd<double, O, N>, vec_simd<double, O, N>> widen(const vec_simd<float, O, N> &rhs) {
+    std::pair<vec_simd<double, O, N>, vec_simd<double, O, N>> nrv;
+    nrv.first.xmm = _mm_widen_lo<float, O, N>(rhs.xmm);
+    nrv.second.xmm = _mm_widen_hi<float, O, N>(rhs.xmm);
+    return nrv;
+}
+
+template <cyme::simd O, int N>
+std::pair<vec_simd<double, O, N>, vec_simd<double, O, N>> widen(const vec_simd<int, O, N> &rhs) {
+    std::pair<vec_simd<double, O, N>, vec_simd<double, O, N>> nrv;
+    nrv.first.xmm = _mm_widen_lo<int, O, N>(rhs.xmm);
+    nrv.second.xmm = _mm_widen_hi<int, O, N>(rhs.xmm);
+    return nrv;
+}
+
+template <cyme::simd O, int N>
+std::pair<vec_simd<double, O, N>, vec_simd<double, O, N>> widen(const vec_simd<std::uint32_t, O, N> &rhs) {
+    std::pair<vec_simd<double, O, N>, vec_simd<double, O, N>> nrv;
+    nrv.first.xmm = _mm_widen_lo<std::uint32_t, O, N>(rhs.xmm);
+    nrv.second.xmm = _mm_widen_hi<std::uint32_t, O, N>(rhs.xmm);
+    return nrv;
+}
+
+template <class T, cyme::simd O, int N>
+vec_simd<T, O, N> narrow(const vec_simd<double, O, N> &lo, const vec_simd<double, O, N> &hi) {
+    vec_simd<T, O, N> nrv;
+    nrv.xmm = _mm_narrow<typename simd_trait<T, O, N>::value_type, O, N>(lo.xmm, hi.xmm);
+    return nrv;
+}
+
 template <class T, cyme::simd O, int N>
 vec_simd<int, O, N> floor(const vec_simd<T, O, N> &rhs) {
     vec_simd<int, O, N> nrv;
@@ -177,6 +242,13 @@ vec_simd<int, O, N> floor(const vec_simd<T, O, N> &rhs) {
     return nrv;
 }
 
+template <cyme::round_mode M, class T, cyme::simd O, int N>
+vec_simd<T, O, N> rounding(const vec_simd<T, O, N> &rhs) {
+    vec_simd<T, O, N> nrv;
+    nrv.xmm = _mm_round<typename simd_trait<T, O, N>::value_type, O, N>(rhs.xmm, M);
+    return nrv;
+}
+
 template <class T, cyme::simd O, int N>
 vec_simd<T, O, N> ge(const vec_simd<T, O, N> &rhs) {
     vec_simd<T, O, N> nrv;
@@ -212,6 +284,56 @@ vec_simd<T, O, N> min(const vec_simd<T, O, N> &v1, const vec_simd<T, O, N> &v2)
     return nrv;
 }
 
+template <class T, cyme::simd O, int N>
+vec_simd<T, O, N> max(const vec_simd<T, O, N> &v1, const vec_simd<T, O, N> &v2) {
+    vec_simd<T, O, N> nrv;
+    nrv.xmm = _mm_max<typename simd_trait<T, O, N>::value_type, O, N>(v1.xmm, v2.xmm);
+    return nrv;
+}
+
+template <class T, cyme::simd O, int N>
+vec_simd<T, O, N> where(const vec_simd<T, O, N> &mask, const vec_simd<T, O, N> &lhs, const vec_simd<T, O, N> &rhs) {
+    vec_simd<T, O, N> nrv;
+    nrv.xmm = _mm_select<typename simd_trait<T, O, N>::value_type, O, N>(mask.xmm, lhs.xmm, rhs.xmm);
+    return nrv;
+}
+
+template <class T, cyme::simd O, int N>
+T hsum(const vec_simd<T, O, N> &v) {
+    return _mm_hsum<typename simd_trait<T, O, N>::value_type, O, N>(v.xmm);
+}
+
+template <class T, cyme::simd O, int N>
+T hmin(const vec_simd<T, O, N> &v) {
+    return _mm_hmin<typename simd_trait<T, O, N>::value_type, O, N>(v.xmm);
+}
+
+template <class T, cyme::simd O, int N>
+T hmax(const vec_simd<T, O, N> &v) {
+    return _mm_hmax<typename simd_trait<T, O, N>::value_type, O, N>(v.xmm);
+}
+
+template <class T, cyme::simd O, int N>
+bool any(const vec_simd<T, O, N> &mask) {
+    return _mm_movemask<typename simd_trait<T, O, N>::value_type, O, N>(mask.xmm) != 0;
+}
+
+template <class T, cyme::simd O, int N>
+bool all(const vec_simd<T, O, N> &mask) {
+    const int size = elems_helper<T, N>::size; // a bit per lane, up to 32 lanes (float, avx, 4 regs)
+    return _mm_movemask<typename simd_trait<T, O, N>::value_type, O, N>(mask.xmm) == (0xffffffffu >> (32 - size));
+}
+
+template <class T, cyme::simd O, int N>
+int popcount(const vec_simd<T, O, N> &mask) {
+    return __builtin_popcount(_mm_movemask<typename simd_trait<T, O, N>::value_type, O, N>(mask.xmm));
+}
+
+template <class T, cyme::simd O, int N>
+unsigned int movemask(const vec_simd<T, O, N> &mask) {
+    return _mm_movemask<typename simd_trait<T, O, N>::value_type, O, N>(mask.xmm);
+}
+
 template <class T, cyme::simd O, int N>
 vec_simd<T, O, N> select_poly(const vec_simd<int, O, N> &sel, const vec_simd<T, O, N> &lhs,
                               const vec_simd<T, O, N> &rhs) {
@@ -27,6 +27,8 @@
 #ifndef CYME_WRAPPER_HPP
 #define CYME_WRAPPER_HPP
 
+#include <cmath>
+
 namespace cyme {
 /**
   Free function (wrapper) to round integer up to the next even value.
@@ -112,6 +114,56 @@ forceinline typename simd_trait<T, O, N>::register_type _mm_neg(typename simd_tr
 template <class T, cyme::simd O, int N>
 forceinline bool _mm_is_empty(typename simd_trait<T, O, N>::register_type xmm0);
 
+/** Free function (wrapper) for the horizontal sum of a register, the lanes are added with a pairwise tree (lane k
+    with lane k + size/2, etc.), the generic version stores the register */
+template <class T, cyme::simd O, int N>
+forceinline T _mm_hsum(typename simd_trait<T, O, N>::register_type xmm0) {
+    const int size = N * trait_register<T, O>::size / sizeof(T);
+    T elems[size] __attribute__((aligned(static_cast<std::size_t>(trait_register<T, O>::a))));
+    _mm_store<T, O, N>(xmm0, elems);
+    for (int s = size / 2; s > 0; s /= 2)
+        for (int k = 0; k < s; ++k)
+            elems[k] += elems[k + s];
+    return elems[0];
+}
+
+/** Free function (wrapper) for the horizontal minimum of a register, same tree than _mm_hsum */
+template <class T, cyme::simd O, int N>
+forceinline T _mm_hmin(typename simd_trait<T, O, N>::register_type xmm0) {
+    const int size = N * trait_register<T, O>::size / sizeof(T);
+    T elems[size] __attribute__((aligned(static_cast<std::size_t>(trait_register<T, O>::a))));
+    _mm_store<T, O, N>(xmm0, elems);
+    for (int s = size / 2; s > 0; s /= 2)
+        for (int k = 0; k < s; ++k)
+            elems[k] = (elems[k + s] < elems[k]) ? elems[k + s] : elems[k];
+    return elems[0];
+}
+
+/** Free function (wrapper) for the horizontal maximum of a register, same tree than _mm_hsum */
+template <class T, cyme::simd O, int N>
+forceinline T _mm_hmax(typename simd_trait<T, O, N>::register_type xmm0) {
+    const int size = N * trait_register<T, O>::size / sizeof(T);
+    T elems[size] __attribute__((aligned(static_cast<std::size_t>(trait_register<T, O>::a))));
+    _mm_store<T, O, N>(xmm0, elems);
+    for (int s = size / 2; s > 0; s /= 2)
+        for (int k = 0; k < s; ++k)
+            elems[k] = (elems[k] < elems[k + s]) ? elems[k + s] : elems[k];
+    return elems[0];
+}
+
+/** Free function (wrapper) to gather the sign bits of a mask (result of a comparison) into an integer, the bit i is
+    the lane i, movemask on x86, the generic version stores the register */
+template <class T, cyme::simd O, int N>
+forceinline unsigned int _mm_movemask(typename simd_trait<T, O, N>::register_type xmm0) {
+    const int size = N * trait_register<T, O>::size / sizeof(T);
+    T elems[size] __attribute__((aligned(static_cast<std::size_t>(trait_register<T, O>::a))));
+    _mm_store<T, O, N>(xmm0, elems);
+    unsigned int bits = 0;
+    for (int k = 0; k < size; ++k)
+        bits |= static_cast<unsigned int>(std::signbit(elems[k])) << k;
+    return bits;
+}
+
 /** Free function to cast int to float for the exp */
 template <class T, cyme::simd O, int N>
 forceinline typename simd_trait<T, O, N>::register_type _mm_convert(typename simd_trait<int, O, N>::register_type xmm0);
@@ -120,6 +172,11 @@ forceinline typename simd_trait<T, O, N>::register_type _mm_convert(typename sim
 template <class T, cyme::simd O, int N>
 forceinline typename simd_trait<int, O, N>::register_type _mm_floor(typename simd_trait<T, O, N>::register_type xmm0);
 
+/** Free function (wrapper) rounding to an integral value, the result stays in the floating point format */
+template <class T, cyme::simd O, int N>
+forceinline typename simd_trait<T, O, N>::register_type _mm_round(typename simd_trait<T, O, N>::register_type xmm0,
+                                                                  cyme::round_mode m);
+
 /** Free function to return the float vector 2^k */
 template <class T, cyme::simd O, int N>
 forceinline typename simd_trait<T, O, N>::register_type _mm_twok(typename simd_trait<int, O, N>::register_type xmm0);
@@ -140,6 +197,28 @@ forceinline typename simd_trait<T, O, N>::register_type _mm_fabs(typename simd_t
 template <class T, cyme::simd O, int N, class T2>
 forceinline typename simd_trait<T2, O, N>::register_type _mm_cast(typename simd_trait<T, O, N>::register_type xmm0);
 
+/** Free function that converts the numbers T of a register to the numbers T2 with the same number of lanes, the
+    values are converted whereas _mm_cast keeps the bits */
+template <class T, cyme::simd O, int N, class T2>
+forceinline typename simd_trait<T2, O, N>::register_type _mm_cvt(typename simd_trait<T, O, N>::register_type xmm0);
+
+/** Free function (wrapper) converting the first half of the lanes of a float or int register to double, the
+    lanes in memory order: the first half of the unrolled registers, or the low half of a single one */
+template <class T, cyme::simd O, int N>
+forceinline typename simd_trait<double, O, N>::register_type
+_mm_widen_lo(typename simd_trait<T, O, N>::register_type xmm0);
+
+/** Free function (wrapper) converting the second half of the lanes of a float or int register to double */
+template <class T, cyme::simd O, int N>
+forceinline typename simd_trait<double, O, N>::register_type
+_mm_widen_hi(typename simd_trait<T, O, N>::register_type xmm0);
+
+/** Free function (wrapper) converting two registers of double to one float or int register, the lanes of xmm0
+    then the lanes of xmm1, the inverse of _mm_widen_lo and _mm_widen_hi */
+template <class T, cyme::simd O, int N>
+forceinline typename simd_trait<T, O, N>::register_type
+_mm_narrow(typename simd_trait<double, O, N>::register_type xmm0, typename simd_trait<double, O, N>::register_type xmm1);
+
 /** Free function to return poly1 or poly2 depending on the value of sel */
 template <class T, cyme::simd O, int N>
 forceinline typename simd_trait<T, O, N>::register_type
@@ -200,11 +279,57 @@ template <class T, cyme::simd O, int N>
 forceinline typename simd_trait<T, O, N>::register_type _mm_srl(typename simd_trait<T, O, N>::register_type xmm0,
                                                                 typename simd_trait<T, O, N>::register_type xmm1);
 
+/** Free function (wrapper) to bitwise xmm0 << xmm1 */
+template <class T, cyme::simd O, int N>
+forceinline typename simd_trait<T, O, N>::register_type _mm_sll(typename simd_trait<T, O, N>::register_type xmm0,
+                                                                typename simd_trait<T, O, N>::register_type xmm1);
+
+/** Free function (wrapper) for dividing the integers of a register by an invariant divisor, rounded to zero */
+template <class T, cyme::simd O, int N>
+forceinline typename simd_trait<T, O, N>::register_type
+_mm_div_invariant(typename simd_trait<T, O, N>::register_type xmm0, int_divisor const &d);
+
+/** Free function (wrapper) for the remainder of the integers of a register by an invariant divisor, the sign
+ *  of the numerator as the operator % */
+template <class T, cyme::simd O, int N>
+forceinline typename simd_trait<T, O, N>::register_type
+_mm_mod_invariant(typename simd_trait<T, O, N>::register_type xmm0, int_divisor const &d);
+
 /** Free function (wrapper) of the minimum function */
 template <class T, cyme::simd O, int N>
 forceinline typename simd_trait<T, O, N>::register_type _mm_min(typename simd_trait<T, O, N>::register_type xmm0,
                                                                 typename simd_trait<T, O, N>::register_type xmm1);
 
+/** Free function (wrapper) to select xmm1 where the mask xmm0 is true else xmm2, blendv on x86, the generic version
+    uses the bitwise operations */
+template <class T, cyme::simd O, int N>
+forceinline typename simd_trait<T, O, N>::register_type _mm_select(typename simd_trait<T, O, N>::register_type xmm0,
+                                                                   typename simd_trait<T, O, N>::register_type xmm1,
+                                                                   typename simd_trait<T, O, N>::register_type xmm2) {
+    return _mm_xor<T, O, N>(xmm2, _mm_and<T, O, N>(_mm_xor<T, O, N>(xmm1, xmm2), xmm0));
+}
+
+/** Free function (wrapper) of the maximum function, the generic version selects with < */
+template <class T, cyme::simd O, int N>
+forceinline typename simd_trait<T, O, N>::register_type _mm_max(typename simd_trait<T, O, N>::register_type xmm0,
+                                                                typename simd_trait<T, O, N>::register_type xmm1) {
+    return _mm_select<T, O, N>(_mm_lt<T, O, N>(xmm0, xmm1), xmm1, xmm0);
+}
+
+/** Free function (wrapper) to compare two register xmm0 less or equal to xmm1, the generic version negates > */
+template <class T, cyme::simd O, int N>
+forceinline typename simd_trait<T, O, N>::register_type _mm_le(typename simd_trait<T, O, N>::register_type xmm0,
+                                                               typename simd_trait<T, O, N>::register_type xmm1) {
+    return _mm_andnot<T, O, N>(_mm_lt<T, O, N>(xmm1, xmm0));
+}
+
+/** Free function (wrapper) to compare two register xmm0 not equal to xmm1, the generic version negates == */
+template <class T, cyme::simd O, int N>
+forceinline typename simd_trait<T, O, N>::register_type _mm_ne(typename simd_trait<T, O, N>::register_type xmm0,
+                                                               typename simd_trait<T, O, N>::register_type xmm1) {
+    return _mm_andnot<T, O, N>(_mm_eq<T, O, N>(xmm0, xmm1));
+}
+
 #ifdef __FMA__ // This macro is a compiler one
 /** Free function (wrapper) for FMA between three registers, a*b+c */
 template <class T, cyme::simd O, int N>
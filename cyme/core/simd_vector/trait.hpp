@@ -84,6 +84,71 @@ struct simd_unroll<T, O, 2> {
     register_simd r1;
 };
 
+/** \cond */
+namespace detail {
+/** |d| without overflow for the minimum integer */
+constexpr unsigned int divisor_abs(int d) { return (d < 0) ? 0u - static_cast<unsigned int>(d) : d; }
+
+constexpr int divisor_log2(unsigned int d) { return (d <= 1) ? 0 : 1 + divisor_log2(d >> 1); }
+
+constexpr bool divisor_power2(unsigned int d) { return (d & (d - 1)) == 0; }
+
+/** 2^(31+l)/|d| and its remainder, l = floor(log2 |d|) */
+constexpr unsigned long long divisor_quotient(unsigned int d) { return (1ull << (31 + divisor_log2(d))) / d; }
+
+constexpr unsigned long long divisor_remainder(unsigned int d) { return (1ull << (31 + divisor_log2(d))) % d; }
+
+/** the magic number is exact with l-1 bits of shift, else one bit more and an addition of the numerator */
+constexpr bool divisor_add(unsigned int d) {
+    return !divisor_power2(d) && d - divisor_remainder(d) >= (1u << divisor_log2(d));
+}
+
+constexpr unsigned int divisor_magic(unsigned int d) {
+    return divisor_power2(d)
+               ? 0u
+               : (divisor_add(d) ? static_cast<unsigned int>(2 * divisor_quotient(d) +
+                                                             (2 * divisor_remainder(d) >= d ? 1 : 0) + 1)
+                                 : static_cast<unsigned int>(divisor_quotient(d) + 1));
+}
+} // namespace detail
+/** \endcond */
+
+/** Division of 32 bits integers by an invariant divisor, multiply-high and shift.
+
+The magic number and the shift are computed once (Granlund-Montgomery, as
+libdivide), the division of a register is then a multiplication of the
+high parts, an optional addition and two shifts, instead of the scalar idiv
+of every element. The constructor is constexpr: a constant divisor is
+computed at compile time (cyme::divisor<D>()), a divisor known at runtime
+(a size, a number of bins) once before the loop. A power of two is a shift.
+*/
+struct int_divisor {
+    /** constructor, d != 0 */
+    constexpr int_divisor(int d)
+        : value(d), magic(detail::divisor_power2(detail::divisor_abs(d))
+                              ? 0
+                              : static_cast<int>((d < 0) ? 0u - detail::divisor_magic(detail::divisor_abs(d))
+                                                         : detail::divisor_magic(detail::divisor_abs(d)))),
+          shift(detail::divisor_log2(detail::divisor_abs(d)) -
+                ((detail::divisor_power2(detail::divisor_abs(d)) || detail::divisor_add(detail::divisor_abs(d)))
+                     ? 0
+                     : 1)),
+          add(detail::divisor_add(detail::divisor_abs(d))), sign((d < 0) ? -1 : 0) {}
+
+    int value; // the divisor, for the modulo
+    int magic; // 0 for a power of two
+    int shift; // arithmetic shift after the multiplication
+    bool add;  // add the numerator (subtract if the divisor is negative) after the multiplication
+    int sign;  // -1 if the divisor is negative, else 0
+};
+
+/** a divisor known at compile time */
+template <int D>
+constexpr int_divisor divisor() {
+    static_assert(D != 0, "cyme::divisor: division by zero");
+    return int_divisor(D);
+}
+
 /** Helper class for the Newton-Raphson division algorithm.
 
 The structure gives the maximum number of the recursion for the
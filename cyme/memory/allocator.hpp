@@ -29,6 +29,7 @@
 
 #include <assert.h>
 #include <stdlib.h> // POSIX, size_t is inside
+#include <sys/mman.h> // POSIX, mmap
 #include <limits>
 
 #include "cyme/memory/detail/simd.hpp" // enum only
@@ -68,6 +69,49 @@ class Align_POSIX {
     void deallocate_policy(void *ptr) { free(ptr); }
 };
 
+/**  allocator on shared pages, aligned on a specific boundary 16, 32 or 64 byte
+ *
+ *      Same policy interface as Align_POSIX, but the buffer is an anonymous
+ *      MAP_SHARED mapping: after a fork() the parent and the children see the
+ *      same pages, a container allocated with this policy is shared without
+ *      copy. The length of the mapping is saved in front of the buffer
+ *      because deallocate_policy does not receive the size. For named segments
+ *      between unrelated processes, see cyme::shared_vector (shared.hpp).
+ */
+template <class T, cyme::simd O>
+class Shm_POSIX {
+  public:
+    typedef std::size_t size_type;
+
+  protected:
+    /**   The allocate function used in the policy
+     *   \param size std::size_t the size of the buffer
+     */
+    void *allocate_policy(size_type size) {
+        assert((cyme::trait_register<T, O>::a) >= sizeof(size_type));
+        if (size == 0)
+            return NULL;
+
+        size_type length = size + cyme::trait_register<T, O>::a;
+        void *ptr = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+
+        if (ptr == MAP_FAILED)
+            return NULL;
+
+        *static_cast<size_type *>(ptr) = length; // a page is aligned, so ptr + a is aligned on a
+        return static_cast<char *>(ptr) + cyme::trait_register<T, O>::a;
+    }
+
+    /** The deallocate function used in the policy */
+    void deallocate_policy(void *ptr) {
+        if (ptr == NULL)
+            return;
+
+        char *base = static_cast<char *>(ptr) - cyme::trait_register<T, O>::a;
+        munmap(base, *reinterpret_cast<size_type *>(base));
+    }
+};
+
 /**  This class is an allocator for STL container: std::vectorr.
  *
  *    I guarantee the allocated buffer is bound on 8-16 or 32 byte cyme. It
@@ -108,7 +152,7 @@ class Allocator : private Policy {
     inline const_pointer adress(const_reference r) { return &r; }
 
     // cyme allocation
-    inline pointer allocate(size_type cnt, typename std::allocator<void>::const_pointer = 0) {
+    inline pointer allocate(size_type cnt, const void * = 0) {
         return reinterpret_cast<pointer>(allocate_policy(cnt * sizeof(T))); // I call my allocator using my pattern
     }
 
@@ -161,16 +161,16 @@ class array<T, N, cyme::AoSoA> {
     inline reference operator()(size_type i, size_type j) {
         // nothing on i as the original size is destroyed in the constructor
         BOOST_ASSERT_MSG(j < T::value_size, "out of range: storage_type_v AoSoA j");
-        // Please tune me ! (does it exist an alternative to this ? ^_^
-        return data[(i * T::value_size + j) / (T::value_size * offset)](j * offset + i % offset); // [..i..](..j..)
+        // j < value_size so the block is i / offset, offset is a power of two: a shift and a mask
+        return data[i / offset](j * offset + i % offset); // [..i..](..j..)
     }
 
     /** Return a needed element of perticular storage_type - serial - read */
     inline const_reference operator()(size_type i, size_type j) const {
         // nothing on i as the original size is destroyed in the constructor
         BOOST_ASSERT_MSG(j < T::value_size, "out of range: storage_type_v AoSoA j");
-        // Please tune me ! (does it exist an alternative to this ? ^_^
-        return data[(i * T::value_size + j) / (T::value_size * offset)](j * offset + i % offset); // [..i..](..j..)
+        // j < value_size so the block is i / offset, offset is a power of two: a shift and a mask
+        return data[i / offset](j * offset + i % offset); // [..i..](..j..)
     }
 
   private:
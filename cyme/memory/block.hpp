@@ -0,0 +1,180 @@
+/*
+ * Cyme - block.hpp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ * This file is part of Cyme <https://github.com/BlueBrain/cyme>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+
+/**
+ * @file cyme/memory/block.hpp
+ * Defines a register-resident proxy of a storage block
+ */
+
+#ifndef CYME_BLOCK_HPP
+#define CYME_BLOCK_HPP
+
+#include "cyme/memory/detail/storage.hpp"
+
+namespace cyme {
+
+/** Register-resident proxy of a storage block.
+ *
+ *  With a storage, every W[x] = ... stores immediately and every R[x] loads
+ *  again. The proxy keeps the fields into registers: a field is loaded the
+ *  first time it is read, a written field stays into its register and later
+ *  reads reuse it, the dirty fields are stored once by flush() or by the
+ *  destructor. The kernels do not change, only the argument:
+ *  \code{.cpp}
+ *  template <class T>
+ *  void operator()(T &S) {
+ *      cyme::register_block<T> W(S);
+ *      cnrn_states(W); // W[x] = ..., R[x], as with the storage
+ *  }
+ *  \endcode
+ *  The flags are known at compile time once the kernel is inlined, the
+ *  compiler removes them. The AoS specialization forwards to the storage.
+ */
+template <class S>
+class register_block;
+
+/** Specialisation of the register_block for the AoSoA layout */
+template <class T, std::size_t Size>
+class register_block<storage<T, Size, AoSoA>> {
+  public:
+    typedef storage<T, Size, AoSoA> storage_type;
+    typedef std::size_t size_type;
+    typedef T value_type;
+    typedef cyme::vec<T, cyme::__GETSIMD__()> vec_type;
+
+    static const size_type offset = elems_helper<T, cyme::unroll_factor::N>::size;
+    static const size_type fields = Size / offset;
+
+    /** write access of a field, only used by the operators =, +=, -=, *= and /= */
+    class reference {
+      public:
+        forceinline reference(register_block &b, size_type i) : b(b), i(i) {}
+
+        /** the field is overwritten, no load */
+        template <class Rep2>
+        forceinline reference &operator=(vec<T, cyme::__GETSIMD__(), cyme::unroll_factor::N, Rep2> const &rhs) {
+            b.regs[i].rep() = rhs.rep()();
+            b.loaded[i] = b.dirty[i] = true;
+            return *this;
+        }
+
+        template <class Rep2>
+        forceinline reference &operator+=(vec<T, cyme::__GETSIMD__(), cyme::unroll_factor::N, Rep2> const &rhs) {
+            b.load(i) += rhs;
+            b.dirty[i] = true;
+            return *this;
+        }
+
+        template <class Rep2>
+        forceinline reference &operator-=(vec<T, cyme::__GETSIMD__(), cyme::unroll_factor::N, Rep2> const &rhs) {
+            b.load(i) -= rhs;
+            b.dirty[i] = true;
+            return *this;
+        }
+
+        template <class Rep2>
+        forceinline reference &operator*=(vec<T, cyme::__GETSIMD__(), cyme::unroll_factor::N, Rep2> const &rhs) {
+            b.load(i) *= rhs;
+            b.dirty[i] = true;
+            return *this;
+        }
+
+        template <class Rep2>
+        forceinline reference &operator/=(vec<T, cyme::__GETSIMD__(), cyme::unroll_factor::N, Rep2> const &rhs) {
+            b.load(i) /= rhs;
+            b.dirty[i] = true;
+            return *this;
+        }
+
+      private:
+        register_block &b;
+        size_type i;
+    };
+
+    /** Constructor, nothing is loaded */
+    forceinline explicit register_block(storage_type &s) : s(s) {
+        for (size_type i = 0; i < fields; ++i)
+            loaded[i] = dirty[i] = false;
+    }
+
+    register_block(register_block const &) = delete;
+    register_block &operator=(register_block const &) = delete;
+
+    /** Destructor, store the dirty fields */
+    forceinline ~register_block() { flush(); }
+
+    /** write access operator, the field becomes dirty */
+    forceinline reference operator[](size_type i) { return reference(*this, i); }
+
+    /** read access operator, the field is loaded at the first read only */
+    forceinline vec_type const &operator[](size_type i) const { return load(i); }
+
+    /** Store the dirty fields into the storage, they stay into the registers */
+    forceinline void flush() {
+        for (size_type i = 0; i < fields; ++i)
+            if (dirty[i]) {
+                regs[i].rep().store(&s(i * offset));
+                dirty[i] = false;
+            }
+    }
+
+  private:
+    forceinline vec_type &load(size_type i) const {
+        if (!loaded[i]) {
+            regs[i] = s[i];
+            loaded[i] = true;
+        }
+        return regs[i];
+    }
+
+    storage_type &s;
+    mutable vec_type regs[fields];
+    mutable bool loaded[fields];
+    bool dirty[fields];
+};
+
+/** Specialisation of the register_block for the AoS layout, direct access to the storage */
+template <class T, std::size_t Size>
+class register_block<storage<T, Size, AoS>> {
+  public:
+    typedef storage<T, Size, AoS> storage_type;
+    typedef std::size_t size_type;
+    typedef T value_type;
+    typedef typename storage_type::reference reference;
+    typedef typename storage_type::const_reference const_reference;
+
+    forceinline explicit register_block(storage_type &s) : s(s) {}
+
+    register_block(register_block const &) = delete;
+    register_block &operator=(register_block const &) = delete;
+
+    forceinline reference operator[](size_type i) { return s[i]; }
+
+    forceinline const_reference operator[](size_type i) const { return s[i]; }
+
+    forceinline void flush() {}
+
+  private:
+    storage_type &s;
+};
+} // namespace cyme
+
+#endif
@@ -0,0 +1,190 @@
+/*
+ * Cyme - complex.hpp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ * This file is part of Cyme <https://github.com/BlueBrain/cyme>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+
+/**
+ * @file cyme/memory/complex.hpp
+ * Defines complex class, the real and the imaginary parts in two registers
+ */
+
+#ifndef CYME_COMPLEX_HPP
+#define CYME_COMPLEX_HPP
+
+#include <cmath>
+#include <complex>
+
+#include "cyme/core/simd_vector/simd_vec.hpp"
+#include "cyme/core/expression/expr_vec.hpp"
+#include "cyme/memory/detail/register_trait.hpp"
+
+namespace cyme {
+/**     The complex class carries the real and the imaginary parts of complex numbers in two registers.
+ *
+ *  As cyme::dual, if the order is AoS it encapsulates two basic float/double,
+ *  else two SIMD vectors. The real and the imaginary parts are two fields of
+ *  the block, the split storage of the AoSoA layout: a register of real parts
+ *  and a register of imaginary parts, no shuffle. The transfer function of a
+ *  RC circuit:
+ *  \code{.cpp}
+ *  const std::complex<T> i(0., 1.);
+ *  cyme::complex<T, AoSoA> h = 1. / (1. + i * cyme::complex<T, AoSoA>(R[W] * R[R] * R[C]));
+ *  W[GAIN] = abs(h);
+ *  W[PHASE] = arg(h);
+ *  \endcode
+ *  The product is two FMA (and two multiplications) when __FMA__ is defined,
+ *  the division and abs do not scale the operands as -fcx-limited-range:
+ *  |z|^2 must not overflow. exp, arg and the trigonometric functions have the
+ *  precision of cyme::sin and cyme::cos. The complex is evaluated at once, it
+ *  is not a vertex of the expression trees (two registers).
+ */
+template <class T, cyme::order O = cyme::AoSoA, int N = cyme::unroll_factor::N>
+class complex {
+    typedef detail::register_trait<T, O, N> trait;
+
+  public:
+    typedef T scalar_type;
+    typedef typename trait::register_type register_type;
+    typedef typename trait::value_type value_type;
+
+    /** constructor real constant */
+    complex(scalar_type s = scalar_type()) : re(s), im(scalar_type(0)) {}
+
+    /** constructor constant */
+    complex(std::complex<scalar_type> const &c) : re(c.real()), im(c.imag()) {}
+
+    /** constructor real, from a field or an expression of fields (AoSoA) */
+    template <class Rep>
+    complex(vec<T, cyme::__GETSIMD__(), N, Rep> const &r) : re(trait::evaluate(r)), im(scalar_type(0)) {}
+
+    /** constructor from the fields or the expressions of fields (AoSoA) of the real and the imaginary parts */
+    template <class Rep1, class Rep2>
+    complex(vec<T, cyme::__GETSIMD__(), N, Rep1> const &r, vec<T, cyme::__GETSIMD__(), N, Rep2> const &i)
+        : re(trait::evaluate(r)), im(trait::evaluate(i)) {}
+
+    /** constructor from the registers of the real and the imaginary parts */
+    complex(register_type const &r, register_type const &i) : re(r), im(i) {}
+
+    /** the real part, it can be assigned to a field */
+    forceinline value_type real() const { return value_type(re); }
+
+    /** the imaginary part, it can be assigned to a field */
+    forceinline value_type imag() const { return value_type(im); }
+
+    forceinline complex &operator+=(complex const &b) { return *this = *this + b; }
+
+    forceinline complex &operator-=(complex const &b) { return *this = *this - b; }
+
+    forceinline complex &operator*=(complex const &b) { return *this = *this * b; }
+
+    forceinline complex &operator/=(complex const &b) { return *this = *this / b; }
+
+    friend forceinline complex operator+(complex const &a, complex const &b) {
+        return complex(a.re + b.re, a.im + b.im);
+    }
+
+    friend forceinline complex operator+(complex const &a, scalar_type s) {
+        return complex(a.re + register_type(s), a.im);
+    }
+
+    friend forceinline complex operator+(scalar_type s, complex const &a) {
+        return complex(register_type(s) + a.re, a.im);
+    }
+
+    friend forceinline complex operator-(complex const &a, complex const &b) {
+        return complex(a.re - b.re, a.im - b.im);
+    }
+
+    friend forceinline complex operator-(complex const &a, scalar_type s) {
+        return complex(a.re - register_type(s), a.im);
+    }
+
+    friend forceinline complex operator-(scalar_type s, complex const &a) {
+        return complex(register_type(s) - a.re, trait::minus(a.im));
+    }
+
+    friend forceinline complex operator-(complex const &a) { return complex(trait::minus(a.re), trait::minus(a.im)); }
+
+    /** (ac - bd) + i(ad + bc), the second product of each part in the FMA */
+    friend forceinline complex operator*(complex const &a, complex const &b) {
+        return complex(trait::mulsub(a.re, b.re, a.im * b.im), trait::muladd(a.re, b.im, a.im * b.re));
+    }
+
+    friend forceinline complex operator*(complex const &a, scalar_type s) {
+        const register_type r(s);
+        return complex(a.re * r, a.im * r);
+    }
+
+    friend forceinline complex operator*(scalar_type s, complex const &a) { return a * s; }
+
+    /** a conj(b)/|b|^2, one division */
+    friend forceinline complex operator/(complex const &a, complex const &b) {
+        const register_type r = register_type(scalar_type(1)) / trait::muladd(b.re, b.re, b.im * b.im);
+        return complex(trait::muladd(a.re, b.re, a.im * b.im) * r, trait::mulsub(a.im, b.re, a.re * b.im) * r);
+    }
+
+    friend forceinline complex operator/(complex const &a, scalar_type s) { return a * (scalar_type(1) / s); }
+
+    friend forceinline complex operator/(scalar_type s, complex const &b) {
+        const register_type r = register_type(s) / trait::muladd(b.re, b.re, b.im * b.im);
+        return complex(b.re * r, trait::minus(b.im * r));
+    }
+
+    friend forceinline complex conj(complex const &a) { return complex(a.re, trait::minus(a.im)); }
+
+    /** |a|^2 */
+    friend forceinline value_type norm(complex const &a) { return value_type(trait::muladd(a.re, a.re, a.im * a.im)); }
+
+    friend forceinline value_type abs(complex const &a) {
+        using std::sqrt;
+        return value_type(sqrt(trait::muladd(a.re, a.re, a.im * a.im)));
+    }
+
+    /** the phase in [-pi, pi] */
+    friend forceinline value_type arg(complex const &a) {
+        using std::atan2;
+        return value_type(atan2(a.im, a.re));
+    }
+
+    /** exp(re) (cos(im) + i sin(im)) */
+    friend forceinline complex exp(complex const &a) {
+        using std::exp;
+        using std::cos;
+        using std::sin;
+        const register_type e = exp(a.re);
+        return complex(e * cos(a.im), e * sin(a.im));
+    }
+
+    /** m (cos(theta) + i sin(theta)), the fields or the expressions of fields (AoSoA) or the basic types (AoS) */
+    template <class M, class A>
+    static forceinline complex polar(M const &m, A const &theta) {
+        using std::cos;
+        using std::sin;
+        const register_type r = trait::evaluate(m);
+        const register_type t = trait::evaluate(theta);
+        return complex(r * cos(t), r * sin(t));
+    }
+
+  private:
+    register_type re;
+    register_type im;
+};
+} // namespace cyme
+
+#endif
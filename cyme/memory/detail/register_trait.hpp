@@ -0,0 +1,127 @@
+/*
+ * Cyme - register_trait.hpp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ * This file is part of Cyme <https://github.com/BlueBrain/cyme>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+
+/**
+ * @file cyme/memory/detail/register_trait.hpp
+ * Defines the registers of the numbers evaluated at once (cyme::dual, cyme::complex, cyme::small_vector)
+ */
+
+#ifndef CYME_REGISTER_TRAIT_HPP
+#define CYME_REGISTER_TRAIT_HPP
+
+#include <cmath>
+
+#include "cyme/core/simd_vector/simd_vec.hpp"
+#include "cyme/core/expression/expr_vec.hpp"
+
+namespace cyme {
+/** \cond */
+namespace detail {
+/** the registers of a layout: basic float/double for AoS, SIMD vector for AoSoA */
+template <class T, cyme::order O, int N>
+struct register_trait {
+    typedef T register_type;
+    typedef T value_type; // assigned to a field of a AoS block
+
+    static forceinline T evaluate(T v) { return v; }
+    static forceinline T select(bool mask, T a, T b) { return mask ? a : b; }
+    static forceinline T minus(T v) { return -v; }
+    /** d if v >= 0, -d else */
+    static forceinline T negative(T v, T d) { return (v < T(0)) ? -d : d; }
+    static forceinline T reciprocal(T v) { return T(1) / v; }
+    /** a*b + c */
+    static forceinline T muladd(T a, T b, T c) {
+#ifdef __FMA__
+        return std::fma(a, b, c);
+#else
+        return a * b + c;
+#endif
+    }
+    /** a*b - c */
+    static forceinline T mulsub(T a, T b, T c) {
+#ifdef __FMA__
+        return std::fma(a, b, -c);
+#else
+        return a * b - c;
+#endif
+    }
+    /** c - a*b */
+    static forceinline T negatemuladd(T a, T b, T c) {
+#ifdef __FMA__
+        return std::fma(-a, b, c);
+#else
+        return c - a * b;
+#endif
+    }
+};
+
+template <class T, int N>
+struct register_trait<T, cyme::AoSoA, N> {
+    typedef vec_simd<T, cyme::__GETSIMD__(), N> register_type;
+    typedef vec<T, cyme::__GETSIMD__(), N> value_type; // assigned to a field of a AoSoA block
+
+    template <class Rep>
+    static forceinline register_type evaluate(vec<T, cyme::__GETSIMD__(), N, Rep> const &v) {
+        return v.rep()();
+    }
+    static forceinline register_type evaluate(register_type const &v) { return v; }
+    static forceinline register_type select(register_type const &mask, register_type const &a,
+                                            register_type const &b) {
+        return where(mask, a, b);
+    }
+    static forceinline register_type minus(register_type const &v) { return neg(v); }
+    static forceinline register_type negative(register_type const &v, register_type const &d) {
+        return where(v < register_type(T(0)), neg(d), d);
+    }
+    /** the Newton-Raphson reciprocal, the steps of the division */
+    static forceinline register_type reciprocal(register_type const &v) {
+        return rcp<div_recursion<T, cyme::__GETSIMD__()>::value>(v);
+    }
+    static forceinline register_type muladd(register_type const &a, register_type const &b,
+                                            register_type const &c) {
+#ifdef __FMA__
+        return cyme::muladd(a, b, c);
+#else
+        return a * b + c;
+#endif
+    }
+    static forceinline register_type mulsub(register_type const &a, register_type const &b,
+                                            register_type const &c) {
+#ifdef __FMA__
+        return cyme::mulsub(a, b, c);
+#else
+        return a * b - c;
+#endif
+    }
+    static forceinline register_type negatemuladd(register_type const &a, register_type const &b,
+                                                  register_type const &c) {
+#ifdef __FMA__
+        return cyme::negatemuladd(a, b, c);
+#else
+        return c - a * b;
+#endif
+    }
+};
+} // namespace detail
+/** \endcond */
+} // namespace cyme
+
+#endif
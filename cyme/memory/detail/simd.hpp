@@ -55,6 +55,24 @@ struct unroll_factor {
  */
 enum scatter_op { eq, add, sub, mul, div };
 
+/**   Rounding mode of cyme::rounding.
+ *
+ *  The values are the ones of the x86 rounding immediate: to the nearest
+ *  even (rint), toward -inf (floor), toward +inf (ceil), toward zero (trunc).
+ */
+enum round_mode { round_even = 0, round_down = 1, round_up = 2, round_zero = 3 };
+
+/**   Evaluation scheme of cyme::polyval and cyme::ratval.
+ *
+ *  Horner: a multiply-add per coefficient, a dependency chain of the order
+ *  of the polynomial. Estrin: the pairs of coefficients are independent and
+ *  joined by x^2, x^4 ..., a chain of log2(order) multiply-add for the
+ *  squares of x, the pipelines of the FMA units are filled. Second order
+ *  Horner: the even and the odd coefficients, two chains in x^2 of half
+ *  the length joined by x.
+ */
+enum poly_scheme { poly_horner = 0, poly_estrin = 1, poly_horner2 = 2 };
+
 /**   Simd technology type.
  *
  *  cyme::simd defines the simd technology for which the cyme code will be
@@ -73,11 +91,23 @@ enum order { AoS = 0, AoSoA = 1 };
 
 #define __GETSIMD__() __CYME_SIMD_VALUE__
 
+/**   Micro-architecture type.
+ *
+ *  cyme::cpu selects the latencies and throughputs of the cost model
+ *  (cyme::trait_cost) which drives the FMA contraction of the DAG. It is given
+ *  by CMake (CYME_CPU), generic by default.
+ */
+enum cpu { generic, haswell, skylake, zen };
+
+#define __GETCPU__() __CYME_CPU_VALUE__
+
 /** Size of simd registers and memory alignment.
  *
  *  cyme::trait_register::size defines the size (in bytes) of the simd registers
  *  of the target machine.
  *  cyme::trait_register::a defines the memory alignment boundary (in bytes).
+ *  cyme::trait_register::count defines the number of simd registers of the
+ *  register file (the spill estimate of cyme::expression_info).
  *
  *  \warning cyme::trait_register::a is not NECESSARILY equal to the size of
  *  the register.
@@ -94,6 +124,7 @@ template <class T>
 struct trait_register<T, cyme::sse> {
     const static size_t size = 16;
     const static size_t a = 16;
+    const static int count = 16;
 };
 
 /** Partial specialisation for arm technology. */
@@ -102,6 +133,7 @@ struct trait_register<T, cyme::neon> {
     /*Filler for now. Will replace with actual ARM values*/
     const static size_t size = 16;
     const static size_t a = 16;
+    const static int count = 16;
 };
 
 /** Partial specialisation for vmx technology. */
@@ -109,6 +141,7 @@ template <class T>
 struct trait_register<T, cyme::vmx> {
     const static size_t size = 16;
     const static size_t a = 16;
+    const static int count = 32;
 };
 
 /** Partial specialisation for avx technology.  */
@@ -116,6 +149,7 @@ template <class T>
 struct trait_register<T, cyme::avx> {
     const static size_t size = 32;
     const static size_t a = 32;
+    const static int count = 16;
 };
 
 /** Partial specialisation for intel mic.  */
@@ -123,6 +157,7 @@ template <class T>
 struct trait_register<T, cyme::mic> {
     const static size_t size = 64;
     const static size_t a = 64;
+    const static int count = 32;
 };
 
 /**  Partial specialisation for qpx technology.
@@ -137,6 +172,7 @@ template <>
 struct trait_register<float, cyme::qpx> {
     const static size_t size = 16;
     const static size_t a = 32;
+    const static int count = 32;
 };
 
 /** Partial specialisation for qpx technology.  */
@@ -144,6 +180,76 @@ template <class T>
 struct trait_register<T, cyme::qpx> {
     const static size_t size = 32;
     const static size_t a = 32;
+    const static int count = 32;
+};
+
+/** Cost of the floating point operations of the target.
+ *
+ *  Latencies in cycles, throughputs in operations per cycle, for the SIMD
+ *  add, mul and fma. cyme::fma_contract derives from them the choices of the
+ *  FMA contraction. The numbers of a core are the same for all its SIMD
+ *  widths. The generic model is the Haswell one, for a*b+c and a*b+c*d.
+ */
+template <cyme::cpu C>
+struct trait_cost {
+    const static int add_latency = 3;
+    const static int mul_latency = 5;
+    const static int fma_latency = 5;
+    const static int add_throughput = 1;
+    const static int mul_throughput = 2;
+    const static int fma_throughput = 2;
+};
+
+/** Partial specialisation for Haswell/Broadwell, fadd on a single port  */
+template <>
+struct trait_cost<cyme::haswell> : trait_cost<cyme::generic> {};
+
+/** Partial specialisation for Skylake and later, add/mul/fma on the fma units */
+template <>
+struct trait_cost<cyme::skylake> {
+    const static int add_latency = 4;
+    const static int mul_latency = 4;
+    const static int fma_latency = 4;
+    const static int add_throughput = 2;
+    const static int mul_throughput = 2;
+    const static int fma_throughput = 2;
+};
+
+/** Partial specialisation for Zen, fast add/mul and a slower fma */
+template <>
+struct trait_cost<cyme::zen> {
+    const static int add_latency = 3;
+    const static int mul_latency = 3;
+    const static int fma_latency = 5;
+    const static int add_throughput = 2;
+    const static int mul_throughput = 2;
+    const static int fma_throughput = 2;
+};
+
+/** Choices of the FMA contraction from the cost model.
+ *
+ *  The critical path of every form is compared, at equal latency the form
+ *  with less instructions is kept:
+ *  - muladd: a*b+c, fma against mul then add;
+ *  - mul_add_mul: a*b+c*d, fma(a,b,c*d) against the two mul in parallel then add;
+ *  - mul_add_mul_add: a*b+c*d+e, fma(a,b,fma(c,d,e)) against fma(c,d,e) and a*b
+ *    in parallel then add.
+ *
+ *  model is false for cyme::generic: the vertices keep the choices before the
+ *  cost model, a*b+c*d+e is (a*b+c*d)+e.
+ */
+template <cyme::cpu C = __GETCPU__()>
+struct fma_contract {
+    typedef trait_cost<C> cost;
+    /** latency of two independent mul, the second waits if one mul per cycle */
+    const static int mul_pair_latency = cost::mul_latency + (cost::mul_throughput < 2 ? 1 : 0);
+    const static int max_fma_mul_latency =
+        (cost::fma_latency > cost::mul_latency) ? cost::fma_latency : cost::mul_latency;
+
+    const static bool muladd = cost::fma_latency <= cost::mul_latency + cost::add_latency;
+    const static bool mul_add_mul = cost::mul_latency + cost::fma_latency <= mul_pair_latency + cost::add_latency;
+    const static bool mul_add_mul_add = 2 * cost::fma_latency <= max_fma_mul_latency + cost::add_latency;
+    const static bool model = C != cyme::generic;
 };
 
 /** stride length for the asssociated iterator.
@@ -101,7 +101,10 @@ class storage<T, Size, AoSoA> {
 
     inline cyme::vec<T, cyme::__GETSIMD__()> operator[](size_type i);
 
-    inline const cyme::vec<T, cyme::__GETSIMD__()> operator[](size_type i) const;
+    /** read access operator, a field vertex: R[x] twice is the same leaf for cyme::tie */
+    inline const cyme::vec<T, cyme::__GETSIMD__(), cyme::unroll_factor::N,
+                           vec_field<T, cyme::__GETSIMD__(), cyme::unroll_factor::N>>
+    operator[](size_type i) const;
 
     /** return cyme layout of the container */
     static const cyme::order MemoryOrder = AoSoA;
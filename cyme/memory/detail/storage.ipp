@@ -96,8 +96,12 @@ cyme::vec<T, cyme::__GETSIMD__()> storage<T, Size, AoSoA>::operator[](size_type
 }
 
 template <class T, std::size_t Size>
-const cyme::vec<T, cyme::__GETSIMD__()> storage<T, Size, AoSoA>::operator[](size_type i) const {
-    return cyme::vec<T, cyme::__GETSIMD__()>(&data[i * stride<T, AoSoA>::helper_stride()]);
+const cyme::vec<T, cyme::__GETSIMD__(), cyme::unroll_factor::N,
+                vec_field<T, cyme::__GETSIMD__(), cyme::unroll_factor::N>>
+storage<T, Size, AoSoA>::operator[](size_type i) const {
+    return cyme::vec<T, cyme::__GETSIMD__(), cyme::unroll_factor::N,
+                     vec_field<T, cyme::__GETSIMD__(), cyme::unroll_factor::N>>(
+        &data[i * stride<T, AoSoA>::helper_stride()]);
 }
 } // namespace cyme
 #endif
@@ -0,0 +1,194 @@
+/*
+ * Cyme - dual.hpp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ * This file is part of Cyme <https://github.com/BlueBrain/cyme>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+
+/**
+ * @file cyme/memory/dual.hpp
+ * Defines dual class, a value and its derivative for the forward mode differentiation
+ */
+
+#ifndef CYME_DUAL_HPP
+#define CYME_DUAL_HPP
+
+#include <cmath>
+
+#include "cyme/core/simd_vector/simd_vec.hpp"
+#include "cyme/core/expression/expr_vec.hpp"
+#include "cyme/memory/detail/register_trait.hpp"
+
+namespace cyme {
+/**     The dual class carries a value and its derivative, forward mode differentiation.
+ *
+ *  As cyme::serial, if the order is AoS it encapsulates two basic float/double,
+ *  else two SIMD vectors. The operators and the math functions compute the
+ *  value and the derivative in one pass, the value is computed once (exp,
+ *  log ...) and used by the derivative. The conductance of a current:
+ *  \code{.cpp}
+ *  cyme::dual<T, AoSoA> v = cyme::dual<T, AoSoA>::variable(R[V]); // dv/dv = 1
+ *  cyme::dual<T, AoSoA> i = R[G] * (v - R[E]) / (1. + exp(-0.062 * v) * (R[MG] / 3.57));
+ *  W[I] = i.value();
+ *  W[DIDV] = i.derivative();
+ *  \endcode
+ *  The fields, the expressions of the fields and the scalars are constants
+ *  (derivative 0), the conversion is implicit. pow(x, y) is exp(y log|x|) as
+ *  cyme::pow. The dual is evaluated at once, it is not a vertex of the
+ *  expression trees: the trees would compute the value again for the
+ *  derivative, without common subexpression.
+ */
+template <class T, cyme::order O = cyme::AoSoA, int N = cyme::unroll_factor::N>
+class dual {
+    typedef detail::register_trait<T, O, N> trait;
+
+  public:
+    typedef T scalar_type;
+    typedef typename trait::register_type register_type;
+    typedef typename trait::value_type value_type;
+
+    /** constructor constant */
+    dual(scalar_type s = scalar_type()) : v(s), d(scalar_type(0)) {}
+
+    /** constructor from a field or an expression of fields (AoSoA), a constant */
+    template <class Rep>
+    dual(vec<T, cyme::__GETSIMD__(), N, Rep> const &e) : v(trait::evaluate(e)), d(scalar_type(0)) {}
+
+    /** constructor from the registers of the value and the derivative */
+    dual(register_type const &value, register_type const &derivative) : v(value), d(derivative) {}
+
+    /** the variable of the differentiation, the derivative is 1 */
+    static forceinline dual variable(dual const &x) { return dual(x.v, register_type(scalar_type(1))); }
+
+    /** the value, it can be assigned to a field */
+    forceinline value_type value() const { return value_type(v); }
+
+    /** the derivative, it can be assigned to a field */
+    forceinline value_type derivative() const { return value_type(d); }
+
+    forceinline dual &operator+=(dual const &b) { return *this = *this + b; }
+
+    forceinline dual &operator-=(dual const &b) { return *this = *this - b; }
+
+    forceinline dual &operator*=(dual const &b) { return *this = *this * b; }
+
+    forceinline dual &operator/=(dual const &b) { return *this = *this / b; }
+
+    friend forceinline dual operator+(dual const &a, dual const &b) { return dual(a.v + b.v, a.d + b.d); }
+
+    friend forceinline dual operator+(dual const &a, scalar_type s) { return dual(a.v + register_type(s), a.d); }
+
+    friend forceinline dual operator+(scalar_type s, dual const &a) { return dual(register_type(s) + a.v, a.d); }
+
+    friend forceinline dual operator-(dual const &a, dual const &b) { return dual(a.v - b.v, a.d - b.d); }
+
+    friend forceinline dual operator-(dual const &a, scalar_type s) { return dual(a.v - register_type(s), a.d); }
+
+    friend forceinline dual operator-(scalar_type s, dual const &a) {
+        return dual(register_type(s) - a.v, trait::minus(a.d));
+    }
+
+    friend forceinline dual operator-(dual const &a) { return dual(trait::minus(a.v), trait::minus(a.d)); }
+
+    /** (ab)' = a'b + ab' */
+    friend forceinline dual operator*(dual const &a, dual const &b) {
+        return dual(a.v * b.v, a.d * b.v + a.v * b.d);
+    }
+
+    friend forceinline dual operator*(dual const &a, scalar_type s) {
+        const register_type r(s);
+        return dual(a.v * r, a.d * r);
+    }
+
+    friend forceinline dual operator*(scalar_type s, dual const &a) { return a * s; }
+
+    /** (a/b)' = (a' - (a/b) b')/b, one division */
+    friend forceinline dual operator/(dual const &a, dual const &b) {
+        const register_type r = register_type(scalar_type(1)) / b.v;
+        const register_type q = a.v * r;
+        return dual(q, (a.d - q * b.d) * r);
+    }
+
+    friend forceinline dual operator/(dual const &a, scalar_type s) { return a * (scalar_type(1) / s); }
+
+    friend forceinline dual operator/(scalar_type s, dual const &b) {
+        const register_type r = register_type(scalar_type(1)) / b.v;
+        const register_type q = register_type(s) * r;
+        return dual(q, trait::minus(q * b.d) * r);
+    }
+
+    friend forceinline dual exp(dual const &a) {
+        using std::exp;
+        const register_type e = exp(a.v);
+        return dual(e, a.d * e);
+    }
+
+    friend forceinline dual log(dual const &a) {
+        using std::log;
+        return dual(log(a.v), a.d / a.v);
+    }
+
+    friend forceinline dual sqrt(dual const &a) {
+        using std::sqrt;
+        const register_type s = sqrt(a.v);
+        return dual(s, a.d * register_type(scalar_type(0.5)) / s);
+    }
+
+    friend forceinline dual fabs(dual const &a) {
+        using std::fabs;
+        return dual(fabs(a.v), trait::negative(a.v, a.d));
+    }
+
+    friend forceinline dual sin(dual const &a) {
+        using std::sin;
+        using std::cos;
+        return dual(sin(a.v), a.d * cos(a.v));
+    }
+
+    friend forceinline dual cos(dual const &a) {
+        using std::sin;
+        using std::cos;
+        return dual(cos(a.v), trait::minus(a.d * sin(a.v)));
+    }
+
+    /** exp(y log|x|), as cyme::pow */
+    friend forceinline dual pow(dual const &x, dual const &y) { return exp(y * log(fabs(x))); }
+
+    friend forceinline dual min(dual const &a, dual const &b) {
+        const auto mask = a.v < b.v;
+        return dual(trait::select(mask, a.v, b.v), trait::select(mask, a.d, b.d));
+    }
+
+    friend forceinline dual max(dual const &a, dual const &b) {
+        const auto mask = b.v < a.v;
+        return dual(trait::select(mask, a.v, b.v), trait::select(mask, a.d, b.d));
+    }
+
+    /** a where the mask (a comparison of values) is true else b */
+    template <class M>
+    friend forceinline dual where(M const &mask, dual const &a, dual const &b) {
+        const auto m = trait::evaluate(mask);
+        return dual(trait::select(m, a.v, b.v), trait::select(m, a.d, b.d));
+    }
+
+  private:
+    register_type v;
+    register_type d;
+};
+} // namespace cyme
+
+#endif
@@ -0,0 +1,259 @@
+/*
+ * Cyme - linalg.hpp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ * This file is part of Cyme <https://github.com/BlueBrain/cyme>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+
+/**
+ * @file cyme/memory/linalg.hpp
+ * Defines small_vector, small_matrix and small_lu classes, a small dense system per lane
+ */
+
+#ifndef CYME_LINALG_HPP
+#define CYME_LINALG_HPP
+
+#include <cstddef>
+
+#include "cyme/core/simd_vector/simd_vec.hpp"
+#include "cyme/core/expression/expr_vec.hpp"
+#include "cyme/memory/detail/register_trait.hpp"
+
+namespace cyme {
+/**     The small_vector class carries M numbers per lane, a register each.
+ *
+ *  If the order is AoS it encapsulates M basic float/double, else M SIMD
+ *  vectors: every lane is an independent vector. The elements are M
+ *  consecutive fields of a block, loaded by the constructor and stored by
+ *  store().
+ */
+template <class T, std::size_t M, cyme::order O = cyme::AoSoA, int N = cyme::unroll_factor::N>
+class small_vector {
+    typedef detail::register_trait<T, O, N> trait;
+
+  public:
+    typedef std::size_t size_type;
+    typedef T scalar_type;
+    typedef typename trait::register_type register_type;
+    typedef typename trait::value_type value_type;
+    static const size_type size = M;
+
+    /** constructor constant */
+    explicit small_vector(scalar_type s = scalar_type()) {
+        for (size_type i = 0; i < M; ++i)
+            v[i] = register_type(s);
+    }
+
+    /** constructor from the fields first, first+1 ... first+M-1 of a block */
+    template <class S>
+    small_vector(S const &R, size_type first) {
+        for (size_type i = 0; i < M; ++i)
+            v[i] = trait::evaluate(R[first + i]);
+    }
+
+    /** store into the fields first ... first+M-1 of a block */
+    template <class S>
+    forceinline void store(S &W, size_type first) const {
+        for (size_type i = 0; i < M; ++i)
+            W[first + i] = value_type(v[i]);
+    }
+
+    forceinline register_type &operator[](size_type i) { return v[i]; }
+
+    forceinline register_type const &operator[](size_type i) const { return v[i]; }
+
+  private:
+    register_type v[M];
+};
+
+/**     The small_matrix class carries a M x M matrix per lane, a register per element.
+ *
+ *  As small_vector, every lane is an independent matrix. The elements are
+ *  M*M consecutive fields of a block in row major order, a(i,j) is the
+ *  field first + i*M + j. The kinetic scheme of a channel of 3 states:
+ *  \code{.cpp}
+ *  cyme::small_matrix<T, 3, AoSoA> a(R, A00); // the fields A00 ... A22
+ *  cyme::small_vector<T, 3, AoSoA> b(R, B0);
+ *  cyme::small_lu<T, 3, AoSoA>(a).solve(b).store(W, X0);
+ *  \endcode
+ */
+template <class T, std::size_t M, cyme::order O = cyme::AoSoA, int N = cyme::unroll_factor::N>
+class small_matrix {
+    typedef detail::register_trait<T, O, N> trait;
+
+  public:
+    typedef std::size_t size_type;
+    typedef T scalar_type;
+    typedef typename trait::register_type register_type;
+    typedef typename trait::value_type value_type;
+    typedef small_vector<T, M, O, N> vector_type;
+    static const size_type size = M;
+
+    /** constructor diagonal, s*I */
+    explicit small_matrix(scalar_type s = scalar_type()) {
+        for (size_type i = 0; i < M; ++i)
+            for (size_type j = 0; j < M; ++j)
+                a[i][j] = register_type(i == j ? s : scalar_type(0));
+    }
+
+    /** constructor from the fields first ... first+M*M-1 of a block, row major */
+    template <class S>
+    small_matrix(S const &R, size_type first) {
+        for (size_type i = 0; i < M; ++i)
+            for (size_type j = 0; j < M; ++j)
+                a[i][j] = trait::evaluate(R[first + i * M + j]);
+    }
+
+    /** store into the fields first ... first+M*M-1 of a block, row major */
+    template <class S>
+    forceinline void store(S &W, size_type first) const {
+        for (size_type i = 0; i < M; ++i)
+            for (size_type j = 0; j < M; ++j)
+                W[first + i * M + j] = value_type(a[i][j]);
+    }
+
+    forceinline register_type &operator()(size_type i, size_type j) { return a[i][j]; }
+
+    forceinline register_type const &operator()(size_type i, size_type j) const { return a[i][j]; }
+
+    /** the matrix-vector product, M*M multiply-add */
+    friend forceinline vector_type operator*(small_matrix const &m, vector_type const &x) {
+        vector_type y;
+        for (size_type i = 0; i < M; ++i) {
+            register_type s = m.a[i][0] * x[0];
+            for (size_type j = 1; j < M; ++j)
+                s = trait::muladd(m.a[i][j], x[j], s);
+            y[i] = s;
+        }
+        return y;
+    }
+
+    /** the matrix-matrix product, M*M*M multiply-add */
+    friend forceinline small_matrix operator*(small_matrix const &l, small_matrix const &r) {
+        small_matrix p;
+        for (size_type i = 0; i < M; ++i)
+            for (size_type j = 0; j < M; ++j) {
+                register_type s = l.a[i][0] * r.a[0][j];
+                for (size_type k = 1; k < M; ++k)
+                    s = trait::muladd(l.a[i][k], r.a[k][j], s);
+                p.a[i][j] = s;
+            }
+        return p;
+    }
+
+  private:
+    register_type a[M][M];
+};
+
+/** the solution of l x = b, l lower triangular, the elements above the diagonal are ignored */
+template <class T, std::size_t M, cyme::order O, int N>
+forceinline small_vector<T, M, O, N> lower_solve(small_matrix<T, M, O, N> const &l,
+                                                 small_vector<T, M, O, N> const &b) {
+    typedef detail::register_trait<T, O, N> trait;
+    small_vector<T, M, O, N> x;
+    for (std::size_t i = 0; i < M; ++i) {
+        typename trait::register_type s = b[i];
+        for (std::size_t j = 0; j < i; ++j)
+            s = trait::negatemuladd(l(i, j), x[j], s);
+        x[i] = s * trait::reciprocal(l(i, i));
+    }
+    return x;
+}
+
+/** the solution of u x = b, u upper triangular, the elements below the diagonal are ignored */
+template <class T, std::size_t M, cyme::order O, int N>
+forceinline small_vector<T, M, O, N> upper_solve(small_matrix<T, M, O, N> const &u,
+                                                 small_vector<T, M, O, N> const &b) {
+    typedef detail::register_trait<T, O, N> trait;
+    small_vector<T, M, O, N> x;
+    for (std::size_t i = M; i-- > 0;) {
+        typename trait::register_type s = b[i];
+        for (std::size_t j = i + 1; j < M; ++j)
+            s = trait::negatemuladd(u(i, j), x[j], s);
+        x[i] = s * trait::reciprocal(u(i, i));
+    }
+    return x;
+}
+
+/**     The small_lu class is the LU factorisation of a small_matrix, a factorisation per lane.
+ *
+ *  Doolittle without pivoting, a lane cannot exchange its rows without a
+ *  gather: the matrices must be diagonally dominant (or symmetric positive
+ *  definite), as the kinetic schemes of the channels. L has a unit
+ *  diagonal, L and U share the registers of the matrix. The reciprocals of
+ *  the pivots are computed once (Newton-Raphson), solve() multiplies only.
+ */
+template <class T, std::size_t M, cyme::order O = cyme::AoSoA, int N = cyme::unroll_factor::N>
+class small_lu {
+    typedef detail::register_trait<T, O, N> trait;
+
+  public:
+    typedef std::size_t size_type;
+    typedef typename trait::register_type register_type;
+    typedef small_matrix<T, M, O, N> matrix_type;
+    typedef small_vector<T, M, O, N> vector_type;
+
+    /** factorisation of a, M^3/3 multiply-add and M reciprocals */
+    explicit small_lu(matrix_type const &a) : lu(a) {
+        for (size_type k = 0; k < M; ++k) {
+            rpivot[k] = trait::reciprocal(lu(k, k));
+            for (size_type i = k + 1; i < M; ++i) {
+                const register_type l = lu(i, k) * rpivot[k];
+                lu(i, k) = l;
+                for (size_type j = k + 1; j < M; ++j)
+                    lu(i, j) = trait::negatemuladd(l, lu(k, j), lu(i, j));
+            }
+        }
+    }
+
+    /** the solution of a x = b */
+    forceinline vector_type solve(vector_type const &b) const { return backward(forward(b)); }
+
+    /** the solution of L y = b, L unit lower triangular */
+    forceinline vector_type forward(vector_type const &b) const {
+        vector_type y;
+        for (size_type i = 0; i < M; ++i) {
+            register_type s = b[i];
+            for (size_type j = 0; j < i; ++j)
+                s = trait::negatemuladd(lu(i, j), y[j], s);
+            y[i] = s;
+        }
+        return y;
+    }
+
+    /** the solution of U x = y */
+    forceinline vector_type backward(vector_type const &y) const {
+        vector_type x;
+        for (size_type i = M; i-- > 0;) {
+            register_type s = y[i];
+            for (size_type j = i + 1; j < M; ++j)
+                s = trait::negatemuladd(lu(i, j), x[j], s);
+            x[i] = s * rpivot[i];
+        }
+        return x;
+    }
+
+    /** the factors, L below the diagonal (unit diagonal implied) and U */
+    forceinline matrix_type const &factors() const { return lu; }
+
+  private:
+    matrix_type lu;
+    register_type rpivot[M];
+};
+} // namespace cyme
+
+#endif
@@ -0,0 +1,183 @@
+/*
+ * Cyme - ring.hpp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ * This file is part of Cyme <https://github.com/BlueBrain/cyme>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+
+/**
+ * @file cyme/memory/ring.hpp
+ * Defines a lock-free single producer/single consumer ring of storage blocks
+ */
+
+#ifndef CYME_RING_HPP
+#define CYME_RING_HPP
+
+#include <atomic>
+#include <new>
+#include <stdlib.h>
+
+#include "cyme/memory/vector.hpp"
+
+namespace cyme {
+
+/** cyme::ring, bounded lock-free single producer/single consumer queue.
+ *
+ *  A slot is a group of Block cyme::storage, the same blocks than a
+ *  cyme::vector<T, cyme::AoSoA>, so the kernels written for the vector run
+ *  directly on a slot. The producer fills a slot in place and commits it, the
+ *  consumer computes in place and releases it: no lock, no copy.
+ *  \code{.cpp}
+ *  cyme::ring<synapse<float, 4>, 16, 32> r;
+ *  // producer thread
+ *  r.push([](iterator first, iterator last) { for (; first != last; ++first) (*first)[0] = ...; });
+ *  // consumer thread
+ *  r.pop([](iterator first, iterator last) { for (; first != last; ++first) (*first)[1] = exp((*first)[0]); });
+ *  \endcode
+ *  Capacity must be a power of two. Slots, producer and consumer indices are
+ *  on their own cache lines to avoid false sharing between the two threads.
+ */
+template <class T, std::size_t Capacity, std::size_t Block = 1>
+class ring {
+  public:
+    const static cyme::order order_value = cyme::AoSoA;
+    typedef std::size_t size_type;
+    typedef typename T::value_type value_type;
+    typedef typename cyme::vector<T, cyme::AoSoA>::storage_type storage_type;
+    typedef storage_type *iterator;
+    typedef const storage_type *const_iterator;
+
+    static const size_type cache_line = 64;
+    static const size_type capacity = Capacity;
+    static const size_type block = Block;
+    static const size_type offset = cyme::vector<T, cyme::AoSoA>::offset;
+
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "cyme::ring: Capacity must be a power of two");
+
+    /** Default constructor, the ring is empty, blocks set up to 0 */
+    ring() : head(0), tail_cache(0), tail(0), head_cache(0) {}
+
+    ring(ring const &) = delete;
+    ring &operator=(ring const &) = delete;
+
+    /** Return the number of storage_type per slot */
+    static inline size_type size_slot() { return Block; }
+
+    /** Return the size of storage_type */
+    static inline size_type size_block() { return T::value_size; }
+
+    /** Return the number of objects per slot */
+    static inline size_type cyme_size() { return Block * offset; }
+
+    /** producer: first block of the next free slot, NULL if the ring is full */
+    inline iterator write_acquire() {
+        const size_type t = tail.load(std::memory_order_relaxed);
+        if (t - head_cache == Capacity) {
+            head_cache = head.load(std::memory_order_acquire);
+            if (t - head_cache == Capacity)
+                return NULL;
+        }
+        return slots[t & (Capacity - 1)].data;
+    }
+
+    /** producer: publish the slot given by write_acquire */
+    inline void write_commit() { tail.store(tail.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+
+    /** consumer: first block of the oldest slot, NULL if the ring is empty */
+    inline iterator read_acquire() {
+        const size_type h = head.load(std::memory_order_relaxed);
+        if (h == tail_cache) {
+            tail_cache = tail.load(std::memory_order_acquire);
+            if (h == tail_cache)
+                return NULL;
+        }
+        return slots[h & (Capacity - 1)].data;
+    }
+
+    /** consumer: give back the slot given by read_acquire to the producer */
+    inline void read_release() { head.store(head.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+
+    /** producer: fill a slot with f(first, last), false if the ring is full */
+    template <class F>
+    bool push(F f) {
+        iterator it = write_acquire();
+        if (it == NULL)
+            return false;
+        f(it, it + Block);
+        write_commit();
+        return true;
+    }
+
+    /** consumer: compute f(first, last) on the oldest slot, false if the ring is empty */
+    template <class F>
+    bool pop(F f) {
+        iterator it = read_acquire();
+        if (it == NULL)
+            return false;
+        f(it, it + Block);
+        read_release();
+        return true;
+    }
+
+    /** Return true if no slot is available for the consumer, approximation if called by the producer */
+    inline bool empty() const {
+        return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+    }
+
+    /** Return the number of slots ready for the consumer, approximation if called concurrently */
+    inline size_type size() const {
+        return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+    }
+
+    /** new on heap respects the cache line alignment (not guaranteed before c++17) */
+    static void *operator new(std::size_t size) {
+        void *ptr = NULL;
+        if (posix_memalign(&ptr, cache_line, size) != 0)
+            throw std::bad_alloc();
+        return ptr;
+    }
+
+    /** delete matching the aligned new */
+    static void operator delete(void *ptr) { free(ptr); }
+
+  private:
+    /** a slot starts on a cache line */
+    struct alignas(64) slot {
+        storage_type data[Block];
+    };
+
+    slot slots[Capacity];
+    alignas(64) std::atomic<size_type> head; // consumer line: its index and its copy of tail
+    size_type tail_cache;
+    alignas(64) std::atomic<size_type> tail; // producer line: its index and its copy of head
+    size_type head_cache;
+};
+
+template <class T, std::size_t Capacity, std::size_t Block>
+const typename ring<T, Capacity, Block>::size_type ring<T, Capacity, Block>::cache_line;
+
+template <class T, std::size_t Capacity, std::size_t Block>
+const typename ring<T, Capacity, Block>::size_type ring<T, Capacity, Block>::capacity;
+
+template <class T, std::size_t Capacity, std::size_t Block>
+const typename ring<T, Capacity, Block>::size_type ring<T, Capacity, Block>::block;
+
+template <class T, std::size_t Capacity, std::size_t Block>
+const typename ring<T, Capacity, Block>::size_type ring<T, Capacity, Block>::offset;
+} // namespace cyme
+
+#endif
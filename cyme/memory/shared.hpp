@@ -0,0 +1,311 @@
+/*
+ * Cyme - shared.hpp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ * This file is part of Cyme <https://github.com/BlueBrain/cyme>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+
+/**
+ * @file cyme/memory/shared.hpp
+ * Defines a AoSoA vector living into a POSIX shared memory segment
+ */
+
+#ifndef CYME_SHARED_HPP
+#define CYME_SHARED_HPP
+
+#include <atomic>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <boost/assert.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/throw_exception.hpp>
+
+#include "cyme/memory/vector.hpp"
+
+namespace cyme {
+/** \cond  */
+namespace detail {
+
+/** header at the beginning of a shared segment, followed by the storage blocks */
+struct shm_header {
+    boost::uint64_t magic;                // identify a cyme segment
+    boost::uint64_t sizeof_value;         // float or double
+    boost::uint64_t storage_width;        // depends of the SIMD technology and the unroll factor
+    boost::uint64_t size_block;           // number of fields of the object
+    boost::uint64_t size;                 // number of storage blocks
+    boost::uint64_t size_cyme;            // number of objects asked by the user
+    std::atomic<boost::uint64_t> version; // seqlock counter, odd during a write
+};
+
+static const boost::uint64_t shm_magic = 0x454d5943454d5943ULL; // "CYMECYME"
+
+/** the blocks start on a cache line, it also covers all SIMD boundaries */
+static const std::size_t shm_data_offset = (sizeof(shm_header) + 63) & ~std::size_t(63);
+
+inline void shm_error(std::string const &what, std::string const &name) {
+    std::runtime_error e("cyme::shared_vector " + what + ": " + name);
+    boost::throw_exception(e);
+}
+} // namespace detail
+/** \endcond */
+
+/** cyme::shared_vector, AoSoA vector mapped into a POSIX shared memory segment.
+ *
+ *  The layout of the blocks is identical to cyme::vector<T, cyme::AoSoA>, so
+ *  the same kernels run on both. One process creates the segment with a name,
+ *  the others (analysis, visualisation, ...) attach to it and see the datas
+ *  without copy.
+ *  \code{.cpp}
+ *  cyme::shared_vector<synapse<float, 4>> w = cyme::shared_vector<synapse<float, 4>>::create("/cyme_sim", 1024);
+ *  cyme::shared_vector<synapse<float, 4>> r = cyme::shared_vector<synapse<float, 4>>::attach("/cyme_sim");
+ *  \endcode
+ *  A seqlock counter lives into the segment: the writer (a single one) brackets
+ *  its updates with write_begin/write_end, the readers never block the writer,
+ *  they retry their copy if the counter moved (read or snapshot).
+ *  \warning the segment can be attached only by a program compiled with the same
+ *  value type, SIMD technology and unroll factor, checked by attach.
+ */
+template <class T>
+class shared_vector {
+  public:
+    const static cyme::order order_value = cyme::AoSoA;
+    typedef std::size_t size_type;
+    typedef typename T::value_type value_type;
+    typedef value_type &reference;
+    typedef const value_type &const_reference;
+    typedef boost::uint64_t version_type;
+
+    typedef cyme::vector<T, cyme::AoSoA> vector_type;
+    typedef typename vector_type::storage_type storage_type;
+    typedef storage_type *iterator;
+    typedef const storage_type *const_iterator;
+
+    static const size_type offset = vector_type::offset;
+    static const size_type storage_width = vector_type::storage_width;
+
+    /** Default constructor, not attached to any segment */
+    shared_vector() : header(NULL), data(NULL), length(0) {}
+
+    /** Move constructor, the mapping is transferred */
+    shared_vector(shared_vector &&v) : header(v.header), data(v.data), length(v.length) {
+        v.header = NULL;
+        v.data = NULL;
+        v.length = 0;
+    }
+
+    /** Move assignment, the current mapping is detached */
+    shared_vector &operator=(shared_vector &&v) {
+        if (this != &v) {
+            detach();
+            std::swap(header, v.header);
+            std::swap(data, v.data);
+            std::swap(length, v.length);
+        }
+        return *this;
+    }
+
+    shared_vector(shared_vector const &) = delete;
+    shared_vector &operator=(shared_vector const &) = delete;
+
+    /** Destructor, detach the segment (the segment stays alive until unlink) */
+    ~shared_vector() { detach(); }
+
+    /** Create (or recreate) the named segment, the objects are set up to a given value */
+    static shared_vector create(std::string const &name, size_type Size, value_type value = value_type()) {
+        const size_type size = Size / offset + 1; // same number of blocks than cyme::vector
+        const size_type bytes = detail::shm_data_offset + size * sizeof(storage_type);
+
+        int fd = shm_open(name.c_str(), O_CREAT | O_RDWR, 0600);
+        if (fd == -1)
+            detail::shm_error("shm_open failed", name);
+        if (ftruncate(fd, bytes) == -1) {
+            close(fd);
+            detail::shm_error("ftruncate failed", name);
+        }
+
+        shared_vector v;
+        v.map(fd, bytes, name);
+
+        detail::shm_header *h = new (v.header) detail::shm_header;
+        h->version.store(1, std::memory_order_relaxed); // readers wait during the initialisation
+        h->sizeof_value = sizeof(value_type);
+        h->storage_width = storage_width;
+        h->size_block = T::value_size;
+        h->size = size;
+        h->size_cyme = Size;
+        for (size_type i = 0; i < size; ++i)
+            new (v.data + i) storage_type(value);
+        h->magic = detail::shm_magic;
+        h->version.store(2, std::memory_order_release);
+        return v;
+    }
+
+    /** Attach to an existing segment created by shared_vector::create */
+    static shared_vector attach(std::string const &name) {
+        int fd = shm_open(name.c_str(), O_RDWR, 0600);
+        if (fd == -1)
+            detail::shm_error("shm_open failed", name);
+
+        struct stat st;
+        if (fstat(fd, &st) == -1 || static_cast<size_type>(st.st_size) < detail::shm_data_offset) {
+            close(fd);
+            detail::shm_error("not a cyme segment", name);
+        }
+
+        shared_vector v;
+        v.map(fd, st.st_size, name);
+
+        detail::shm_header const *h = v.header;
+        if (h->magic != detail::shm_magic || h->sizeof_value != sizeof(value_type) ||
+            h->storage_width != storage_width || h->size_block != T::value_size ||
+            detail::shm_data_offset + h->size * sizeof(storage_type) > v.length)
+            detail::shm_error("incompatible segment (type, SIMD technology or unroll factor)", name);
+        return v;
+    }
+
+    /** Remove the name of the segment, the memory is released after the last detach */
+    static void unlink(std::string const &name) { shm_unlink(name.c_str()); }
+
+    /** Unmap the segment from the current process */
+    void detach() {
+        if (header != NULL)
+            munmap(static_cast<void *>(header), length);
+        header = NULL;
+        data = NULL;
+        length = 0;
+    }
+
+    /** Return true if the vector is mapped on a segment */
+    inline bool attached() const { return header != NULL; }
+
+    /** Return first iterator */
+    iterator begin() { return data; }
+
+    /** Return last iterator */
+    iterator end() { return data + size(); }
+
+    /** Return first const iterator */
+    const_iterator begin() const { return data; }
+
+    /** Return last const iterator */
+    const_iterator end() const { return data + size(); }
+
+    /** Return the storage_type needed for writing */
+    inline storage_type &operator[](size_type i) { return data[i]; }
+
+    /** Return the storage_type needed for reading */
+    const inline storage_type &operator[](size_type i) const { return data[i]; }
+
+    /** Return the size of storage_type */
+    static inline size_type size_block() { return T::value_size; }
+
+    /** Return the number of storage_type */
+    inline size_type size() const { return (header != NULL) ? header->size : 0; }
+
+    /** Return the AoSoA stride size */
+    inline size_type cyme_size() const { return (header != NULL) ? header->size_cyme : 0; }
+
+    /** Return a needed element of perticular storage_type - serial - write */
+    inline reference operator()(size_type i, size_type j) {
+        BOOST_ASSERT_MSG(j < T::value_size, "out of range: shared_vector AoSoA j");
+        return data[i / offset](j * offset + i % offset);
+    }
+
+    /** Return a needed element of perticular storage_type - serial - read */
+    inline const_reference operator()(size_type i, size_type j) const {
+        BOOST_ASSERT_MSG(j < T::value_size, "out of range: shared_vector AoSoA j");
+        return data[i / offset](j * offset + i % offset);
+    }
+
+    /** Return the current value of the seqlock counter */
+    inline version_type version() const { return header->version.load(std::memory_order_acquire); }
+
+    /** Start an update, the counter becomes odd, single writer only */
+    inline version_type write_begin() {
+        version_type v = header->version.fetch_add(1, std::memory_order_relaxed) + 1;
+        std::atomic_thread_fence(std::memory_order_release);
+        return v;
+    }
+
+    /** Finish an update, the counter becomes even again */
+    inline void write_end() { header->version.fetch_add(1, std::memory_order_release); }
+
+    /** Start a read, wait (without lock) if a write is in progress */
+    inline version_type read_begin() const {
+        version_type v = header->version.load(std::memory_order_acquire);
+        while (v & 1)
+            v = header->version.load(std::memory_order_acquire);
+        return v;
+    }
+
+    /** Return true if the datas read since read_begin may be inconsistent */
+    inline bool read_retry(version_type v) const {
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return header->version.load(std::memory_order_relaxed) != v;
+    }
+
+    /** Apply f(*this) as a single update */
+    template <class F>
+    void write(F f) {
+        write_begin();
+        f(*this);
+        write_end();
+    }
+
+    /** Apply f(*this) until it ran on a consistent state, f must only read (copy) */
+    template <class F>
+    void read(F f) const {
+        version_type v;
+        do {
+            v = read_begin();
+            f(*this);
+        } while (read_retry(v));
+    }
+
+    /** Copy a consistent state of the segment into a cyme::vector of the same size */
+    void snapshot(vector_type &v) const {
+        BOOST_ASSERT_MSG(v.size() == size(), "shared_vector snapshot: size mismatch");
+        version_type s;
+        do {
+            s = read_begin();
+            std::memcpy(static_cast<void *>(&v[0]), static_cast<void const *>(data), size() * sizeof(storage_type));
+        } while (read_retry(s));
+    }
+
+  private:
+    void map(int fd, size_type bytes, std::string const &name) {
+        void *ptr = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd); // the mapping keeps the segment
+        if (ptr == MAP_FAILED)
+            detail::shm_error("mmap failed", name);
+        header = static_cast<detail::shm_header *>(ptr);
+        data = reinterpret_cast<storage_type *>(static_cast<char *>(ptr) + detail::shm_data_offset);
+        length = bytes;
+    }
+
+    detail::shm_header *header;
+    storage_type *data;
+    size_type length;
+};
+} // namespace cyme
+
+#endif
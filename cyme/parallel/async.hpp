@@ -0,0 +1,199 @@
+/*
+ * Cyme - async.hpp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ * This file is part of Cyme <https://github.com/BlueBrain/cyme>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+
+/**
+ * @file cyme/parallel/async.hpp
+ * Defines asynchronous kernel launches over cyme containers
+ */
+
+#ifndef CYME_ASYNC_HPP
+#define CYME_ASYNC_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
+#if __cplusplus >= 202002L
+#include <coroutine>
+#endif
+
+namespace cyme {
+/** \cond  */
+namespace detail {
+
+/** shared by the chunks of a launch, the last chunk calls done */
+struct async_state {
+    explicit async_state(std::size_t n, std::function<void(std::exception_ptr)> f) : count(n), done(f) {}
+
+    void finish(std::exception_ptr e) {
+        if (e) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!error)
+                error = e; // keep the first one
+        }
+        if (count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            done(error);
+    }
+
+    std::atomic<std::size_t> count;
+    std::mutex mutex;
+    std::exception_ptr error;
+    std::function<void(std::exception_ptr)> done;
+};
+
+/** number of chunks: default one per hardware thread, never more than the groups of blocks */
+inline std::size_t async_chunks(std::size_t groups, std::size_t chunks) {
+    if (chunks == 0)
+        chunks = std::max(1u, std::thread::hardware_concurrency());
+    return std::max<std::size_t>(1, std::min(chunks, groups));
+}
+
+/** split [first, last) into chunks of whole blocks and run kernel on each of them on its own thread */
+template <class Iterator, class Kernel>
+void async_launch(Iterator first, Iterator last, Kernel kernel, std::size_t chunks,
+                  std::function<void(std::exception_ptr)> done) {
+    typedef typename std::iterator_traits<Iterator>::value_type block_type;
+    // chunk boundaries on groups of blocks covering a cache line, the container is aligned on the SIMD width only:
+    // two chunks may share the line of their boundary, no more
+    const std::size_t grain = (64 + sizeof(block_type) - 1) / sizeof(block_type);
+    const std::size_t blocks = std::distance(first, last);
+    const std::size_t groups = (blocks + grain - 1) / grain;
+    const std::size_t n = async_chunks(groups, chunks);
+
+    std::shared_ptr<async_state> state = std::make_shared<async_state>(n, done);
+    for (std::size_t i = 0; i < n; ++i) {
+        Iterator begin = first + std::min(blocks, (i * groups / n) * grain);
+        Iterator end = first + std::min(blocks, ((i + 1) * groups / n) * grain);
+        try {
+            std::thread([state, kernel, begin, end]() {
+                std::exception_ptr e;
+                try {
+                    std::for_each(begin, end, kernel);
+                } catch (...) {
+                    e = std::current_exception();
+                }
+                state->finish(e);
+            }).detach();
+        } catch (...) { // std::system_error of std::thread, the chunks not started finish with it
+            const std::exception_ptr e = std::current_exception();
+            for (std::size_t j = i; j < n; ++j)
+                state->finish(e);
+            return;
+        }
+    }
+}
+} // namespace detail
+/** \endcond */
+
+/** Launch kernel on every block of [first, last) and return immediately.
+ *
+ *  The range is split into chunks of whole storage blocks (rounded to a cache
+ *  line), each chunk runs on its own thread, std::for_each semantic inside a
+ *  chunk. The future becomes ready when all chunks are done, it rethrows the
+ *  first exception of the kernel. The container must live until then.
+ *  \code{.cpp}
+ *  std::future<void> f = cyme::async_for_each(v.begin(), v.end(), [](storage_type &s) { s[0] = exp(s[1]); });
+ *  // ... I/O, events, other mechanisms
+ *  f.get();
+ *  \endcode
+ *  \param chunks number of chunks, 0 for one per hardware thread
+ */
+template <class Iterator, class Kernel>
+std::future<void> async_for_each(Iterator first, Iterator last, Kernel kernel, std::size_t chunks = 0) {
+    std::shared_ptr<std::promise<void>> promise = std::make_shared<std::promise<void>>();
+    std::future<void> future = promise->get_future();
+    if (first == last) {
+        promise->set_value();
+        return future;
+    }
+    detail::async_launch(first, last, kernel, chunks, [promise](std::exception_ptr e) {
+        if (e)
+            promise->set_exception(e);
+        else
+            promise->set_value();
+    });
+    return future;
+}
+
+/** Launch kernel on every block of a cyme container, see async_for_each(first, last, kernel, chunks) */
+template <class Container, class Kernel>
+std::future<void> async_for_each(Container &c, Kernel kernel, std::size_t chunks = 0) {
+    return async_for_each(c.begin(), c.end(), kernel, chunks);
+}
+
+#if __cplusplus >= 202002L
+/** C++20 awaitable version of async_for_each.
+ *
+ *  Nothing runs before co_await: the chunks are launched in await_suspend and
+ *  the last chunk resumes the coroutine on its thread, no thread is blocked.
+ *  \code{.cpp}
+ *  co_await cyme::co_for_each(v, [](storage_type &s) { s[0] = exp(s[1]); });
+ *  \endcode
+ */
+template <class Iterator, class Kernel>
+class kernel_awaitable {
+  public:
+    kernel_awaitable(Iterator first, Iterator last, Kernel kernel, std::size_t chunks)
+        : first(first), last(last), kernel(kernel), chunks(chunks) {}
+
+    bool await_ready() const noexcept { return first == last; }
+
+    void await_suspend(std::coroutine_handle<> handle) {
+        detail::async_launch(first, last, kernel, chunks, [this, handle](std::exception_ptr e) {
+            error = e;
+            handle.resume();
+        });
+    }
+
+    void await_resume() {
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+  private:
+    Iterator first;
+    Iterator last;
+    Kernel kernel;
+    std::size_t chunks;
+    std::exception_ptr error;
+};
+
+/** Return an awaitable running kernel on every block of [first, last) */
+template <class Iterator, class Kernel>
+kernel_awaitable<Iterator, Kernel> co_for_each(Iterator first, Iterator last, Kernel kernel, std::size_t chunks = 0) {
+    return kernel_awaitable<Iterator, Kernel>(first, last, kernel, chunks);
+}
+
+/** Return an awaitable running kernel on every block of a cyme container */
+template <class Container, class Kernel>
+kernel_awaitable<typename Container::iterator, Kernel> co_for_each(Container &c, Kernel kernel,
+                                                                   std::size_t chunks = 0) {
+    return kernel_awaitable<typename Container::iterator, Kernel>(c.begin(), c.end(), kernel, chunks);
+}
+#endif
+} // namespace cyme
+
+#endif
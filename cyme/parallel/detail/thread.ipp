@@ -0,0 +1,67 @@
+/*
+ * Cyme - thread.ipp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ * This file is part of Cyme <https://github.com/BlueBrain/cyme>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+
+/**
+ * @file cyme/parallel/detail/thread.ipp
+ * Implements the fork/join helper of the parallel algorithms
+ */
+
+#ifndef CYME_THREAD_IPP
+#define CYME_THREAD_IPP
+
+#include <algorithm>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace cyme {
+/** \cond  */
+namespace detail {
+
+/** number of threads, 0 means one per hardware thread */
+inline std::size_t thread_count(std::size_t threads) {
+    return threads ? threads : std::max(1u, std::thread::hardware_concurrency());
+}
+
+/** run f(0) ... f(n-1) concurrently, f(0) on the calling thread, return when all are done */
+template <class F>
+void parallel_invoke(std::size_t n, F const &f) {
+    std::vector<std::thread> pool;
+    pool.reserve(n);
+    for (std::size_t i = 1; i < n; ++i)
+        pool.push_back(std::thread([&f, i]() { f(i); }));
+
+    std::exception_ptr e;
+    try {
+        f(0);
+    } catch (...) {
+        e = std::current_exception();
+    }
+    for (std::size_t i = 0; i < pool.size(); ++i)
+        pool[i].join();
+    if (e)
+        std::rethrow_exception(e);
+}
+} // namespace detail
+/** \endcond */
+} // namespace cyme
+
+#endif
@@ -0,0 +1,217 @@
+/*
+ * Cyme - reduce.hpp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ * This file is part of Cyme <https://github.com/BlueBrain/cyme>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+
+/**
+ * @file cyme/parallel/reduce.hpp
+ * Defines deterministic parallel reductions over a field of a cyme container
+ */
+
+#ifndef CYME_PARALLEL_REDUCE_HPP
+#define CYME_PARALLEL_REDUCE_HPP
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <boost/assert.hpp>
+
+#include "cyme/core/simd_vector/simd_vec.hpp"
+#include "cyme/parallel/detail/thread.ipp"
+
+namespace cyme {
+/** \cond  */
+namespace detail {
+
+/** blocks (AoSoA) or elements (AoS) per leaf of the reduction tree. It is fixed,
+ *  so the tree, and the rounding, do not depend of the number of threads */
+static const std::size_t reduce_leaf = 256;
+
+/** the reduction operators: identity, combine (associative, the unary one combines the lanes of a register) and
+ *  map of the element(s) */
+template <class T>
+struct reduce_sum_op {
+    typedef T value_type;
+    typedef vec_simd<T, cyme::__GETSIMD__(), cyme::unroll_factor::N> simd_type;
+    static const bool binary = false;
+    static forceinline T identity() { return T(0); }
+    static forceinline T combine(T a, T b) { return a + b; }
+    static forceinline simd_type combine(simd_type const &a, simd_type const &b) { return a + b; }
+    static forceinline T combine(simd_type const &a) { return hsum(a); }
+    static forceinline T map(T x, T) { return x; }
+    static forceinline simd_type map(simd_type const &x, simd_type const &) { return x; }
+};
+
+template <class T>
+struct reduce_min_op : reduce_sum_op<T> {
+    typedef typename reduce_sum_op<T>::simd_type simd_type;
+    static forceinline T identity() { return std::numeric_limits<T>::max(); }
+    static forceinline T combine(T a, T b) { return (b < a) ? b : a; }
+    static forceinline simd_type combine(simd_type const &a, simd_type const &b) { return min(a, b); }
+    static forceinline T combine(simd_type const &a) { return hmin(a); }
+};
+
+template <class T>
+struct reduce_max_op : reduce_sum_op<T> {
+    typedef typename reduce_sum_op<T>::simd_type simd_type;
+    static forceinline T identity() { return -std::numeric_limits<T>::max(); }
+    static forceinline T combine(T a, T b) { return (a < b) ? b : a; }
+    static forceinline simd_type combine(simd_type const &a, simd_type const &b) { return max(a, b); }
+    static forceinline T combine(simd_type const &a) { return hmax(a); }
+};
+
+template <class T>
+struct reduce_dot_op : reduce_sum_op<T> {
+    typedef typename reduce_sum_op<T>::simd_type simd_type;
+    static const bool binary = true;
+    static forceinline T map(T x, T y) { return x * y; }
+    static forceinline simd_type map(simd_type const &x, simd_type const &y) { return x * y; }
+};
+
+/** reduction of a leaf, the layout decides the vectorization */
+template <class Op, class Container, cyme::order O = Container::storage_type::MemoryOrder>
+struct reduce_helper;
+
+/** AoS: scalar, element after element */
+template <class Op, class Container>
+struct reduce_helper<Op, Container, cyme::AoS> {
+    typedef typename Op::value_type value_type;
+
+    static std::size_t leaves(Container &a) { return (a.size() + reduce_leaf - 1) / reduce_leaf; }
+
+    static value_type leaf(Container &a, std::size_t fa, Container &b, std::size_t fb, std::size_t l) {
+        const std::size_t last = std::min(a.size(), (l + 1) * reduce_leaf);
+        value_type acc = Op::identity();
+        for (std::size_t i = l * reduce_leaf; i < last; ++i)
+            acc = Op::combine(acc, Op::map(a[i](fa), Op::binary ? b[i](fb) : a[i](fa)));
+        return acc;
+    }
+};
+
+/** AoSoA: a register accumulator per leaf, the lanes are combined into the registers with a fixed tree at the end.
+ *  The padding of the last block is not read, the incomplete block is the last leaf. */
+template <class Op, class Container>
+struct reduce_helper<Op, Container, cyme::AoSoA> {
+    typedef typename Op::value_type value_type;
+    typedef typename Op::simd_type simd_type;
+
+    static std::size_t blocks(Container &a) { return a.cyme_size() / Container::offset; }
+
+    static std::size_t tail(Container &a) { return a.cyme_size() % Container::offset; }
+
+    static std::size_t leaves(Container &a) {
+        return (blocks(a) + reduce_leaf - 1) / reduce_leaf + (tail(a) ? 1 : 0);
+    }
+
+    static value_type leaf(Container &a, std::size_t fa, Container &b, std::size_t fb, std::size_t l) {
+        const std::size_t full = blocks(a);
+        const std::size_t first = l * reduce_leaf;
+        if (first >= full) { // incomplete block
+            value_type acc = Op::identity();
+            for (std::size_t k = 0; k < tail(a); ++k)
+                acc = Op::combine(acc, Op::map(a[full](fa * Container::offset + k),
+                                               Op::binary ? b[full](fb * Container::offset + k)
+                                                          : a[full](fa * Container::offset + k)));
+            return acc;
+        }
+
+        simd_type acc(Op::identity());
+        const std::size_t last = std::min(full, first + reduce_leaf);
+        for (std::size_t i = first; i < last; ++i) {
+            simd_type x(&a[i](fa * Container::offset));
+            acc = Op::combine(acc, Op::map(x, Op::binary ? simd_type(&b[i](fb * Container::offset)) : x));
+        }
+        return Op::combine(acc);
+    }
+};
+
+/** leaves in parallel, then the partial results are combined with a fixed pairwise tree */
+template <class Op, class Container>
+typename Op::value_type reduce(Container &a, std::size_t fa, Container &b, std::size_t fb, std::size_t threads) {
+    typedef reduce_helper<Op, Container> helper;
+    typedef typename Op::value_type value_type;
+    BOOST_ASSERT_MSG(fa < Container::size_block() && fb < Container::size_block(), "reduce: field out of range");
+
+    const std::size_t l = helper::leaves(a);
+    if (l == 0)
+        return Op::identity();
+
+    std::vector<value_type> partial(l);
+    threads = std::min(thread_count(threads), l);
+    parallel_invoke(threads, [&](std::size_t t) {
+        for (std::size_t i = t * l / threads; i < (t + 1) * l / threads; ++i)
+            partial[i] = helper::leaf(a, fa, b, fb, i);
+    });
+
+    for (std::size_t n = l; n > 1; n = (n + 1) / 2) {
+        for (std::size_t i = 0; i < n / 2; ++i)
+            partial[i] = Op::combine(partial[2 * i], partial[2 * i + 1]);
+        if (n % 2)
+            partial[n / 2] = partial[n - 1];
+    }
+    return partial[0];
+}
+} // namespace detail
+/** \endcond */
+
+/** Sum of the field of all the elements of a container.
+ *
+ *  The reductions are vectorized for AoSoA (one register accumulator per
+ *  leaf of blocks), the leaves are computed in parallel, then combined with a
+ *  fixed tree: the result is bitwise the same whatever the number of threads.
+ *  \param threads number of threads, 0 for one per hardware thread
+ */
+template <class Container>
+typename Container::value_type reduce_sum(Container &c, std::size_t field, std::size_t threads = 0) {
+    return detail::reduce<detail::reduce_sum_op<typename Container::value_type>>(c, field, c, field, threads);
+}
+
+/** Minimum of the field of all the elements of a container, see reduce_sum */
+template <class Container>
+typename Container::value_type reduce_min(Container &c, std::size_t field, std::size_t threads = 0) {
+    return detail::reduce<detail::reduce_min_op<typename Container::value_type>>(c, field, c, field, threads);
+}
+
+/** Maximum of the field of all the elements of a container, see reduce_sum */
+template <class Container>
+typename Container::value_type reduce_max(Container &c, std::size_t field, std::size_t threads = 0) {
+    return detail::reduce<detail::reduce_max_op<typename Container::value_type>>(c, field, c, field, threads);
+}
+
+/** Dot product between two fields of two containers of the same size, see reduce_sum */
+template <class Container>
+typename Container::value_type reduce_dot(Container &a, std::size_t fa, Container &b, std::size_t fb,
+                                          std::size_t threads = 0) {
+    return detail::reduce<detail::reduce_dot_op<typename Container::value_type>>(a, fa, b, fb, threads);
+}
+
+/** Dot product between two fields of a container, see reduce_sum */
+template <class Container>
+typename Container::value_type reduce_dot(Container &c, std::size_t fa, std::size_t fb, std::size_t threads = 0) {
+    return reduce_dot(c, fa, c, fb, threads);
+}
+
+/** L2 norm of the field of all the elements of a container, see reduce_sum */
+template <class Container>
+typename Container::value_type reduce_norm2(Container &c, std::size_t field, std::size_t threads = 0) {
+    return std::sqrt(reduce_dot(c, field, c, field, threads));
+}
+} // namespace cyme
+
+#endif
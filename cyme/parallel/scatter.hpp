@@ -0,0 +1,152 @@
+/*
+ * Cyme - scatter.hpp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ * This file is part of Cyme <https://github.com/BlueBrain/cyme>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+
+/**
+ * @file cyme/parallel/scatter.hpp
+ * Defines a thread-safe parallel scatter-accumulate without atomics
+ */
+
+#ifndef CYME_PARALLEL_SCATTER_HPP
+#define CYME_PARALLEL_SCATTER_HPP
+
+#include <vector>
+#include <boost/assert.hpp>
+
+#include "cyme/memory/allocator.hpp"
+#include "cyme/core/simd_vector/simd_vec.hpp"
+#include "cyme/parallel/detail/thread.ipp"
+
+namespace cyme {
+
+/** strategy of cyme::parallel_scatter */
+enum scatter_strategy {
+    scatter_auto,    // selected with the density of the indices
+    scatter_private, // private buffer per thread + vectorized reduction
+    scatter_owner    // every thread owns a range of the destination
+};
+
+/** \cond  */
+namespace detail {
+
+/** number of scatter per destination element above which the private buffers win */
+static const std::size_t scatter_density = 1;
+
+/** strategy for a given density: private buffers cost threads*size, ownership costs threads*range */
+inline scatter_strategy scatter_select(std::size_t range, std::size_t size) {
+    return (range >= scatter_density * size) ? scatter_private : scatter_owner;
+}
+
+/** Private buffers: thread t accumulates its part of the indices into its own buffer,
+ *  then the buffers are reduced with vec_simd, every thread on its own part of dst.
+ */
+template <class T, cyme::scatter_op P>
+void scatter_private_helper(const T *src, T *dst, const int *ind, std::size_t range, std::size_t size,
+                            std::size_t threads) {
+    typedef cyme::vec_simd<T, cyme::__GETSIMD__(), cyme::unroll_factor::N> simd_type;
+    const std::size_t width = elems_helper<T, cyme::unroll_factor::N>::size;
+    const std::size_t stride = (size + width - 1) / width * width; // every buffer starts aligned
+    std::vector<T, cyme::Allocator<T>> buffers(stride * threads, T());
+
+    parallel_invoke(threads, [=, &buffers](std::size_t t) {
+        T *buffer = &buffers[t * stride];
+        for (std::size_t i = t * range / threads; i < (t + 1) * range / threads; ++i)
+            buffer[ind[i]] += src[i];
+    });
+
+    parallel_invoke(threads, [=, &buffers](std::size_t t) {
+        const std::size_t vectors = stride / width;
+        T elems[width] __attribute__((aligned(static_cast<std::size_t>(
+            cyme::trait_register<T, cyme::__GETSIMD__()>::size))));
+
+        for (std::size_t v = t * vectors / threads; v < (t + 1) * vectors / threads; ++v) {
+            simd_type sum(&buffers[v * width]);
+            for (std::size_t b = 1; b < threads; ++b)
+                sum += simd_type(&buffers[b * stride + v * width]);
+            sum.store(elems);
+
+            const std::size_t lanes = std::min(width, size - v * width);
+            for (std::size_t l = 0; l < lanes; ++l)
+                scatter_op_selector_helper<T, P>::scatter_op_selector(dst[v * width + l], elems[l]);
+        }
+    });
+}
+
+/** Ownership: thread t updates only dst[lo, hi), cache line boundaries. Every dst element is
+ *  updated in the serial order, so the result is the one of the serial loop.
+ */
+template <class T, cyme::scatter_op P>
+void scatter_owner_helper(const T *src, T *dst, const int *ind, std::size_t range, std::size_t size,
+                          std::size_t threads) {
+    const std::size_t line = 64 / sizeof(T);
+    const std::size_t lines = (size + line - 1) / line;
+
+    parallel_invoke(threads, [=](std::size_t t) {
+        const std::size_t lo = std::min(size, t * lines / threads * line);
+        const std::size_t hi = std::min(size, (t + 1) * lines / threads * line);
+        for (std::size_t i = 0; i < range; ++i) {
+            const std::size_t k = ind[i];
+            if (k >= lo && k < hi)
+                scatter_op_selector_helper<T, P>::scatter_op_selector(dst[k], src[i]);
+        }
+    });
+}
+} // namespace detail
+/** \endcond */
+
+/** Parallel scatter-accumulate: dst[ind[i]] op= src[i] for i in [0, range).
+ *
+ *  Several i may share the same destination (channels on the same node), the
+ *  function is nevertheless thread-safe without atomics:
+ *  - scatter_private: per-thread accumulation buffers of the destination
+ *    size, then a vectorized reduction of the buffers, for dense indices;
+ *  - scatter_owner: the destination is partitioned, every thread scans the
+ *    indices and updates only its range, for sparse indices. Same result
+ *    than the serial loop;
+ *  - scatter_auto: scatter_private if range >= size, else scatter_owner.
+ *  Only cyme::add and cyme::sub are reductions. The private buffers reassociate
+ *  the sums, results may differ from the serial loop in the last bits.
+ *  \param size size of dst, all indices must be in [0, size)
+ *  \param threads number of threads, 0 for one per hardware thread
+ */
+template <class T, cyme::scatter_op P>
+void parallel_scatter(const T *src, T *dst, const int *ind, std::size_t range, std::size_t size,
+                      std::size_t threads = 0, scatter_strategy strategy = scatter_auto) {
+    static_assert(P == cyme::add || P == cyme::sub, "cyme::parallel_scatter: only add and sub are supported");
+    BOOST_ASSERT_MSG(std::find_if(ind, ind + range, [size](int k) { return k < 0 || std::size_t(k) >= size; }) ==
+                         ind + range,
+                     "parallel_scatter: index out of range");
+
+    threads = std::min(detail::thread_count(threads), std::max<std::size_t>(1, range));
+    if (strategy == scatter_auto)
+        strategy = detail::scatter_select(range, size);
+
+    if (threads == 1) {
+        for (std::size_t i = 0; i < range; ++i)
+            scatter_op_selector_helper<T, P>::scatter_op_selector(dst[ind[i]], src[i]);
+    } else if (strategy == scatter_private) {
+        detail::scatter_private_helper<T, P>(src, dst, ind, range, size, threads);
+    } else {
+        detail::scatter_owner_helper<T, P>(src, dst, ind, range, size, threads);
+    }
+}
+} // namespace cyme
+
+#endif
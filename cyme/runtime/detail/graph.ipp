@@ -0,0 +1,202 @@
+/*
+ * Cyme - graph.ipp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ * This file is part of Cyme <https://github.com/BlueBrain/cyme>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+
+/**
+ * @file cyme/runtime/detail/graph.ipp
+ * Defines the DAG of the runtime kernels, built by the parser
+ *
+ * A vertex is created once: the operations are folded if all the operands
+ * are constants, the neutral elements are removed, then a vertex with the
+ * same operation and the same operands is reused (common subexpression).
+ * The operands are always older vertices, the order of creation is a
+ * topological order.
+ */
+
+#ifndef CYME_RUNTIME_GRAPH_IPP
+#define CYME_RUNTIME_GRAPH_IPP
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <tuple>
+#include <vector>
+
+namespace cyme {
+/** \cond */
+namespace detail {
+
+/** the operations of the runtime DAG and of the bytecode */
+enum rt_op {
+    rt_const,
+    rt_load,
+    rt_store,
+    rt_add,
+    rt_sub,
+    rt_mul,
+    rt_div,
+    rt_neg,
+    rt_exp,
+    rt_log,
+    rt_sqrt,
+    rt_fabs,
+    rt_sin,
+    rt_cos,
+    rt_pow,
+    rt_min,
+    rt_max,
+    rt_lt,
+    rt_le,
+    rt_eq,
+    rt_ne,
+    rt_where
+};
+
+/** name of the operations, for the disassembly */
+inline const char *rt_name(rt_op op) {
+    static const char *names[] = {"const", "load", "store", "add", "sub", "mul", "div", "neg",
+                                  "exp",   "log",  "sqrt",  "fabs", "sin", "cos", "pow", "min",
+                                  "max",   "lt",   "le",    "eq",   "ne",  "where"};
+    return names[op];
+}
+
+inline bool rt_commutative(rt_op op) {
+    return op == rt_add || op == rt_mul || op == rt_min || op == rt_max || op == rt_eq || op == rt_ne;
+}
+
+inline bool rt_comparison(rt_op op) { return op == rt_lt || op == rt_le || op == rt_eq || op == rt_ne; }
+
+/** scalar evaluation of an operation: the constant folding and the AoS layout. A comparison gives 1 or 0 */
+template <class T>
+inline T rt_scalar(rt_op op, T a, T b, T c) {
+    switch (op) {
+    case rt_add:
+        return a + b;
+    case rt_sub:
+        return a - b;
+    case rt_mul:
+        return a * b;
+    case rt_div:
+        return a / b;
+    case rt_neg:
+        return -a;
+    case rt_exp:
+        return std::exp(a);
+    case rt_log:
+        return std::log(a);
+    case rt_sqrt:
+        return std::sqrt(a);
+    case rt_fabs:
+        return std::fabs(a);
+    case rt_sin:
+        return std::sin(a);
+    case rt_cos:
+        return std::cos(a);
+    case rt_pow:
+        return std::pow(std::fabs(a), b); // as cyme::pow, exp(b*log(|a|))
+    case rt_min:
+        return (b < a) ? b : a;
+    case rt_max:
+        return (a < b) ? b : a;
+    case rt_lt:
+        return (a < b) ? T(1) : T(0);
+    case rt_le:
+        return (a <= b) ? T(1) : T(0);
+    case rt_eq:
+        return (a == b) ? T(1) : T(0);
+    case rt_ne:
+        return (a != b) ? T(1) : T(0);
+    case rt_where:
+        return (a != T(0)) ? b : c;
+    default:
+        return T(0);
+    }
+}
+
+/** a vertex, the operands are the indices of older vertices, -1 if unused */
+template <class T>
+struct rt_node {
+    rt_op op;
+    int a, b, c;
+    int field;  // rt_load
+    T value;    // rt_const
+    bool mask;  // result of a comparison, only the condition of where
+};
+
+/** the DAG, see the file comment */
+template <class T>
+class rt_graph {
+  public:
+    typedef std::tuple<int, int, int, int, int, std::uint64_t> key_type;
+
+    std::vector<rt_node<T>> nodes;
+
+    int constant(T v, bool mask = false) {
+        std::uint64_t bits = 0;
+        std::memcpy(&bits, &v, sizeof(T)); // NaN is a key as another
+        rt_node<T> n = {rt_const, -1, -1, -1, -1, v, mask};
+        return insert(key_type(rt_const, -1, -1, -1, mask, bits), n);
+    }
+
+    int load(int field) {
+        rt_node<T> n = {rt_load, -1, -1, -1, field, T(0), false};
+        return insert(key_type(rt_load, -1, -1, -1, field, 0), n);
+    }
+
+    int op(rt_op o, int a, int b = -1, int c = -1) {
+        if (fold(a) && (b < 0 || fold(b)) && (c < 0 || fold(c)))
+            return constant(rt_scalar<T>(o, nodes[a].value, b < 0 ? T(0) : nodes[b].value,
+                                         c < 0 ? T(0) : nodes[c].value),
+                            rt_comparison(o));
+        if (o == rt_where && fold(a))
+            return (nodes[a].value != T(0)) ? b : c;
+        if (((o == rt_add || o == rt_sub) && is(b, T(0))) || ((o == rt_mul || o == rt_div) && is(b, T(1))))
+            return a;
+        if ((o == rt_add && is(a, T(0))) || (o == rt_mul && is(a, T(1))))
+            return b;
+        if (o == rt_neg && nodes[a].op == rt_neg)
+            return nodes[a].a;
+        if (rt_commutative(o) && b < a)
+            std::swap(a, b);
+        rt_node<T> n = {o, a, b, c, -1, T(0), rt_comparison(o)};
+        return insert(key_type(o, a, b, c, -1, 0), n);
+    }
+
+  private:
+    bool fold(int i) const { return nodes[i].op == rt_const; }
+
+    bool is(int i, T v) const { return nodes[i].op == rt_const && nodes[i].value == v; }
+
+    int insert(key_type const &k, rt_node<T> const &n) {
+        typename std::map<key_type, int>::const_iterator it = index.find(k);
+        if (it != index.end())
+            return it->second;
+        nodes.push_back(n);
+        return index[k] = static_cast<int>(nodes.size()) - 1;
+    }
+
+    std::map<key_type, int> index;
+};
+} // namespace detail
+/** \endcond */
+} // namespace cyme
+
+#endif
@@ -0,0 +1,304 @@
+/*
+ * Cyme - parser.ipp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ * This file is part of Cyme <https://github.com/BlueBrain/cyme>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+
+/**
+ * @file cyme/runtime/detail/parser.ipp
+ * Defines the parser of the runtime kernels, a recursive descent over the text
+ *
+ * \code
+ * statement  := name = expression          (separated by ; or new lines, # comments)
+ * expression := sum [(< | <= | > | >= | == | !=) sum]
+ * sum        := product {(+ | -) product}
+ * product    := unary {(* | /) unary}
+ * unary      := (- | +) unary | primary
+ * primary    := number | name | name(expression, ...) | (expression)
+ * \endcode
+ */
+
+#ifndef CYME_RUNTIME_PARSER_IPP
+#define CYME_RUNTIME_PARSER_IPP
+
+#include <cctype>
+#include <cstdlib>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <boost/throw_exception.hpp>
+
+namespace cyme {
+/** \cond */
+namespace detail {
+
+/** the functions known by the parser, the name, the operation and the number of arguments */
+struct rt_function {
+    const char *name;
+    rt_op op;
+    int arity;
+};
+
+inline rt_function const *rt_find_function(std::string const &name) {
+    static const rt_function functions[] = {{"exp", rt_exp, 1},  {"log", rt_log, 1},   {"sqrt", rt_sqrt, 1},
+                                            {"fabs", rt_fabs, 1}, {"sin", rt_sin, 1},   {"cos", rt_cos, 1},
+                                            {"pow", rt_pow, 2},   {"min", rt_min, 2},   {"max", rt_max, 2},
+                                            {"where", rt_where, 3}};
+    for (std::size_t i = 0; i < sizeof(functions) / sizeof(rt_function); ++i)
+        if (name == functions[i].name)
+            return &functions[i];
+    return NULL;
+}
+
+/** the parser, the statements are added to the graph, the names are resolved as:
+ *  variable assigned before (field or temporary), field (its initial value), named constant */
+template <class T>
+class rt_parser {
+  public:
+    rt_parser(std::string const &text, std::vector<std::string> const &fields,
+              std::map<std::string, T> const &constants, rt_graph<T> &g)
+        : text(text), fields(fields), constants(constants), g(g), pos(0), depth(0) {}
+
+    /** parse all the statements, the result is the vertex of every field, -1 if the field is not assigned */
+    std::vector<int> parse() {
+        for (;;) {
+            while (blank() || (pos < text.size() && (text[pos] == ';' || text[pos] == '\n')))
+                ++pos;
+            if (pos == text.size())
+                break;
+            const std::size_t start = pos;
+            const std::string name = identifier();
+            if (constants.count(name))
+                error("the constant " + name + " can not be assigned", start);
+            skip();
+            if (!accept("=") || peek() == '=')
+                error("expected = after " + name, pos);
+            const int v = expression();
+            if (g.nodes[v].mask)
+                error("a comparison is only the condition of where", start);
+            variables[name] = v;
+            skip();
+            if (pos < text.size() && text[pos] != ';' && text[pos] != '\n')
+                error("expected the end of the statement", pos);
+        }
+
+        std::vector<int> outputs(fields.size(), -1);
+        for (std::size_t f = 0; f < fields.size(); ++f) {
+            typename std::map<std::string, int>::const_iterator it = variables.find(fields[f]);
+            if (it != variables.end() && it->second != g.load(static_cast<int>(f)))
+                outputs[f] = it->second;
+        }
+        return outputs;
+    }
+
+  private:
+    int expression() {
+        const std::size_t start = (skip(), pos);
+        int a = sum();
+        skip();
+        static const char *comparisons[] = {"<=", ">=", "==", "!=", "<", ">"};
+        for (int i = 0; i < 6; ++i)
+            if (accept(comparisons[i])) {
+                const int b = sum();
+                value(a, start);
+                value(b, start);
+                switch (i) {
+                case 0:
+                    return g.op(rt_le, a, b);
+                case 1:
+                    return g.op(rt_le, b, a);
+                case 2:
+                    return g.op(rt_eq, a, b);
+                case 3:
+                    return g.op(rt_ne, a, b);
+                case 4:
+                    return g.op(rt_lt, a, b);
+                default:
+                    return g.op(rt_lt, b, a);
+                }
+            }
+        return a;
+    }
+
+    int sum() {
+        const std::size_t start = (skip(), pos);
+        int a = product();
+        for (;;) {
+            skip();
+            if (accept("+"))
+                a = g.op(rt_add, value(a, start), value(product(), start));
+            else if (accept("-"))
+                a = g.op(rt_sub, value(a, start), value(product(), start));
+            else
+                return a;
+        }
+    }
+
+    int product() {
+        const std::size_t start = (skip(), pos);
+        int a = unary();
+        for (;;) {
+            skip();
+            if (accept("*"))
+                a = g.op(rt_mul, value(a, start), value(unary(), start));
+            else if (accept("/"))
+                a = g.op(rt_div, value(a, start), value(unary(), start));
+            else
+                return a;
+        }
+    }
+
+    int unary() {
+        skip();
+        const std::size_t start = pos;
+        if (accept("-"))
+            return g.op(rt_neg, value(unary(), start));
+        if (accept("+"))
+            return value(unary(), start);
+        return primary();
+    }
+
+    int primary() {
+        skip();
+        const std::size_t start = pos;
+        if (accept("(")) {
+            ++depth;
+            const int v = expression();
+            close();
+            return v;
+        }
+        if (pos < text.size() && (std::isdigit(text[pos]) || text[pos] == '.')) {
+            const char *begin = text.c_str() + pos;
+            char *end = NULL;
+            const double v = std::strtod(begin, &end);
+            if (end == begin)
+                error("bad number", start);
+            pos += end - begin;
+            return g.constant(static_cast<T>(v));
+        }
+        const std::string name = identifier();
+        skip();
+        if (accept("(")) {
+            rt_function const *f = rt_find_function(name);
+            if (f == NULL)
+                error("unknown function " + name, start);
+            ++depth;
+            int args[3] = {-1, -1, -1};
+            for (int i = 0; i < f->arity; ++i) {
+                if (i > 0 && (skip(), !accept(",")))
+                    error(name + " expects " + std::string(1, char('0' + f->arity)) + " arguments", start);
+                args[i] = expression();
+                if (f->op == rt_where && i == 0) {
+                    if (!g.nodes[args[i]].mask)
+                        error("the condition of where is a comparison", start);
+                } else {
+                    value(args[i], start);
+                }
+            }
+            close();
+            return g.op(f->op, args[0], args[1], args[2]);
+        }
+        typename std::map<std::string, int>::const_iterator v = variables.find(name);
+        if (v != variables.end())
+            return v->second;
+        for (std::size_t f = 0; f < fields.size(); ++f)
+            if (fields[f] == name)
+                return g.load(static_cast<int>(f));
+        typename std::map<std::string, T>::const_iterator c = constants.find(name);
+        if (c != constants.end())
+            return g.constant(c->second);
+        error("unknown name " + name, start);
+        return -1;
+    }
+
+    /** a comparison is not a value */
+    int value(int v, std::size_t start) {
+        if (g.nodes[v].mask)
+            error("a comparison is only the condition of where", start);
+        return v;
+    }
+
+    void close() {
+        skip();
+        if (!accept(")"))
+            error("expected )", pos);
+        --depth;
+    }
+
+    std::string identifier() {
+        const std::size_t start = pos;
+        if (pos < text.size() && (std::isalpha(text[pos]) || text[pos] == '_'))
+            while (pos < text.size() && (std::isalnum(text[pos]) || text[pos] == '_'))
+                ++pos;
+        if (pos == start)
+            error("expected a name", start);
+        return text.substr(start, pos - start);
+    }
+
+    /** spaces and comments, the new lines too inside parenthesis */
+    bool blank() {
+        if (pos == text.size())
+            return false;
+        if (text[pos] == '#') {
+            while (pos < text.size() && text[pos] != '\n')
+                ++pos;
+            return pos < text.size() && depth > 0;
+        }
+        return text[pos] == ' ' || text[pos] == '\t' || text[pos] == '\r' || (text[pos] == '\n' && depth > 0);
+    }
+
+    void skip() {
+        while (blank())
+            ++pos;
+    }
+
+    char peek() const { return pos < text.size() ? text[pos] : '\0'; }
+
+    bool accept(const char *s) {
+        const std::size_t n = std::strlen(s);
+        if (text.compare(pos, n, s) != 0)
+            return false;
+        pos += n;
+        return true;
+    }
+
+    void error(std::string const &what, std::size_t where) const {
+        std::size_t line = 1, column = 1;
+        for (std::size_t i = 0; i < where && i < text.size(); ++i, ++column)
+            if (text[i] == '\n') {
+                ++line;
+                column = 0;
+            }
+        std::ostringstream s;
+        s << "cyme::runtime_kernel: " << what << ", line " << line << " column " << column;
+        boost::throw_exception(std::runtime_error(s.str()));
+    }
+
+    std::string const &text;
+    std::vector<std::string> const &fields;
+    std::map<std::string, T> const &constants;
+    rt_graph<T> &g;
+    std::map<std::string, int> variables;
+    std::size_t pos;
+    int depth;
+};
+} // namespace detail
+/** \endcond */
+} // namespace cyme
+
+#endif
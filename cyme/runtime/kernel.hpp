@@ -0,0 +1,379 @@
+/*
+ * Cyme - kernel.hpp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ * This file is part of Cyme <https://github.com/BlueBrain/cyme>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+
+/**
+ * @file cyme/runtime/kernel.hpp
+ * Defines runtime_kernel, the expressions of a kernel are given as a text at runtime
+ *
+ * The text is parsed to a DAG (constant folding, common subexpressions), the
+ * DAG is compiled to a register bytecode, and the bytecode is interpreted
+ * over the blocks of a container. For AoSoA, an instruction works on the
+ * registers of several blocks, the cost of the dispatch is shared by
+ * chunk x lanes x unroll elements.
+ */
+
+#ifndef CYME_RUNTIME_KERNEL_HPP
+#define CYME_RUNTIME_KERNEL_HPP
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <boost/assert.hpp>
+#include <boost/throw_exception.hpp>
+
+#include "cyme/memory/allocator.hpp"
+#include "cyme/memory/vector.hpp"
+#include "cyme/runtime/detail/graph.ipp"
+#include "cyme/runtime/detail/parser.ipp"
+
+namespace cyme {
+/** \cond */
+namespace detail {
+
+/** an instruction: load dst <- field a, store field dst <- a, else dst <- op(a, b, c) */
+struct rt_instruction {
+    unsigned short op, dst, a, b, c;
+};
+
+/** the operations of the interpreter, scalar (AoS) or register (AoSoA) */
+struct rt_math {
+    template <class T>
+    static forceinline void get(T &r, T const *p) {
+        r = *p;
+    }
+    template <class T>
+    static forceinline void put(T const &r, T *p) {
+        *p = r;
+    }
+    template <class T>
+    static forceinline T apply(rt_op op, T a, T b, T c) {
+        return rt_scalar<T>(op, a, b, c);
+    }
+
+    template <class T, cyme::simd O, int N>
+    static forceinline void get(vec_simd<T, O, N> &r, T const *p) {
+        r = vec_simd<T, O, N>(p);
+    }
+    template <class T, cyme::simd O, int N>
+    static forceinline void put(vec_simd<T, O, N> const &r, T *p) {
+        r.store(p);
+    }
+    template <class T, cyme::simd O, int N>
+    static forceinline vec_simd<T, O, N> apply(rt_op op, vec_simd<T, O, N> const &a, vec_simd<T, O, N> const &b,
+                                               vec_simd<T, O, N> const &c) {
+        switch (op) {
+        case rt_add:
+            return a + b;
+        case rt_sub:
+            return a - b;
+        case rt_mul:
+            return a * b;
+        case rt_div:
+            return a / b;
+        case rt_neg:
+            return cyme::neg(a);
+        case rt_exp:
+            return cyme::exp(a);
+        case rt_log:
+            return cyme::log(a);
+        case rt_sqrt:
+            return cyme::sqrt(a);
+        case rt_fabs:
+            return cyme::fabs(a);
+        case rt_sin:
+            return cyme::sin(a);
+        case rt_cos:
+            return cyme::cos(a);
+        case rt_pow:
+            return cyme::pow(a, b);
+        case rt_min:
+            return cyme::min(a, b);
+        case rt_max:
+            return cyme::max(a, b);
+        case rt_lt:
+            return a < b;
+        case rt_le:
+            return a <= b;
+        case rt_eq:
+            return a == b;
+        case rt_ne:
+            return a != b;
+        case rt_where:
+            return cyme::where(a, b, c);
+        default:
+            return a;
+        }
+    }
+};
+} // namespace detail
+/** \endcond */
+
+/** A kernel compiled at runtime from a text.
+ *
+ *  The kernel is defined over the named fields of the element, the
+ *  statements are executed in order, a statement assigns a field or a
+ *  temporary variable. The named constants are set before the compilation.
+ *  \code{.cpp}
+ *  cyme::runtime_kernel<double> k({"v", "m", "h"});
+ *  k.constant("dt", 0.025);
+ *  k.compile("a = 0.1 * (v + 40) / (1 - exp(-(v + 40) / 10))\n"
+ *            "b = 4 * exp(-(v + 65) / 18)\n"
+ *            "m = m + dt * (a * (1 - m) - b * m)");
+ *  k(container); // cyme::vector, AoS or AoSoA, the fields are the fields of the element
+ *  \endcode
+ *  The functions are exp, log, sqrt, fabs, sin, cos, pow, min, max and
+ *  where(comparison, a, b); a comparison is only the condition of a where.
+ *  A syntax or name error throws a std::runtime_error with the line and the
+ *  column. pow(x, y) is exp(y * log(|x|)), as cyme::pow.
+ *  \warning the register files are members, a kernel runs on one thread at a time
+ */
+template <class T>
+class runtime_kernel {
+  public:
+    typedef T value_type;
+    typedef vec_simd<T, cyme::__GETSIMD__(), cyme::unroll_factor::N> simd_type;
+
+    /** lanes of a register, the stride between two fields in an AoSoA block */
+    static const std::size_t offset = elems_helper<T, cyme::unroll_factor::N>::size;
+
+    /** blocks (AoSoA) or elements (AoS) per instruction */
+    static const std::size_t chunk = 4;
+
+    explicit runtime_kernel(std::vector<std::string> const &fields) : fields(fields), count(0) {}
+
+    /** a named constant, for the next compilations */
+    void constant(std::string const &name, T value) { constants[name] = value; }
+
+    /** compile the statements of text, the previous kernel is replaced */
+    void compile(std::string const &text);
+
+    /** number of instructions, loads and stores included (the constants are not instructions) */
+    std::size_t instructions() const { return code.size(); }
+
+    /** number of registers, the constants included */
+    std::size_t registers() const { return count; }
+
+    /** print the bytecode */
+    void print(std::ostream &out) const;
+
+    /** runs the kernel on the elements of an AoSoA block */
+    template <std::size_t Size>
+    void operator()(storage<T, Size, AoSoA> &s) {
+        BOOST_ASSERT_MSG(fields.size() * offset <= Size, "runtime_kernel: more fields than the block");
+        run(simd_registers.data(), 1, [&](std::size_t, std::size_t f) { return &s(f * offset); });
+    }
+
+    /** runs the kernel on an element, AoS */
+    template <std::size_t Size>
+    void operator()(storage<T, Size, AoS> &s) {
+        BOOST_ASSERT_MSG(fields.size() <= Size, "runtime_kernel: more fields than the element");
+        run(scalar_registers.data(), 1, [&](std::size_t, std::size_t f) { return &s(f); });
+    }
+
+    /** runs the kernel on all the blocks of an AoSoA container, chunk blocks per instruction */
+    template <class M>
+    void operator()(cyme::vector<M, AoSoA> &v) {
+        BOOST_ASSERT_MSG(fields.size() <= M::value_size, "runtime_kernel: more fields than the element");
+        const std::size_t size = v.size();
+        for (std::size_t i = 0; i < size; i += chunk)
+            run(simd_registers.data(), std::min(chunk, size - i),
+                [&](std::size_t k, std::size_t f) { return &v[i + k](f * offset); });
+    }
+
+    /** runs the kernel on all the elements of an AoS container, chunk elements per instruction */
+    template <class M>
+    void operator()(cyme::vector<M, AoS> &v) {
+        BOOST_ASSERT_MSG(fields.size() <= M::value_size, "runtime_kernel: more fields than the element");
+        const std::size_t size = v.size();
+        for (std::size_t i = 0; i < size; i += chunk)
+            run(scalar_registers.data(), std::min(chunk, size - i),
+                [&](std::size_t k, std::size_t f) { return &v[i + k](f); });
+    }
+
+  private:
+    /** the interpreter, the register r of the block k is registers[r * chunk + k] */
+    template <class R, class Access>
+    forceinline void run(R *file, std::size_t n, Access at) const {
+        typedef detail::rt_math math;
+        for (std::size_t p = 0; p < code.size(); ++p) {
+            const detail::rt_instruction &i = code[p];
+            R *d = file + i.dst * chunk;
+            R const *a = file + i.a * chunk;
+            R const *b = file + i.b * chunk;
+            R const *c = file + i.c * chunk;
+            switch (i.op) {
+            case detail::rt_load:
+                for (std::size_t k = 0; k < n; ++k)
+                    math::get(d[k], at(k, i.a));
+                break;
+            case detail::rt_store:
+                for (std::size_t k = 0; k < n; ++k)
+                    math::put(a[k], at(k, i.dst));
+                break;
+            case detail::rt_add:
+                for (std::size_t k = 0; k < n; ++k)
+                    d[k] = a[k] + b[k];
+                break;
+            case detail::rt_sub:
+                for (std::size_t k = 0; k < n; ++k)
+                    d[k] = a[k] - b[k];
+                break;
+            case detail::rt_mul:
+                for (std::size_t k = 0; k < n; ++k)
+                    d[k] = a[k] * b[k];
+                break;
+            case detail::rt_div:
+                for (std::size_t k = 0; k < n; ++k)
+                    d[k] = a[k] / b[k];
+                break;
+            default:
+                for (std::size_t k = 0; k < n; ++k)
+                    d[k] = math::apply(static_cast<detail::rt_op>(i.op), a[k], b[k], c[k]);
+            }
+        }
+    }
+
+    std::vector<std::string> fields;
+    std::map<std::string, T> constants;
+    std::vector<detail::rt_instruction> code;
+    std::vector<T> values; // the constants, registers 0 .. values.size()-1
+    std::size_t count;
+    std::vector<simd_type, cyme::Allocator<simd_type>> simd_registers;
+    std::vector<T> scalar_registers;
+};
+
+template <class T>
+const std::size_t runtime_kernel<T>::offset;
+
+template <class T>
+const std::size_t runtime_kernel<T>::chunk;
+
+template <class T>
+void runtime_kernel<T>::compile(std::string const &text) {
+    detail::rt_graph<T> g;
+    const std::vector<int> outputs = detail::rt_parser<T>(text, fields, constants, g).parse();
+    const int size = static_cast<int>(g.nodes.size());
+    const int never = std::numeric_limits<int>::max();
+
+    // dead code, the vertices are in topological order
+    std::vector<bool> live(size, false);
+    std::vector<int> last(size, -1); // last use, the outputs live until the stores
+    for (std::size_t f = 0; f < outputs.size(); ++f)
+        if (outputs[f] >= 0)
+            live[outputs[f]] = true, last[outputs[f]] = never;
+    for (int v = size - 1; v >= 0; --v) {
+        detail::rt_node<T> const &n = g.nodes[v];
+        if (!live[v] || n.op == detail::rt_const || n.op == detail::rt_load)
+            continue;
+        const int operands[3] = {n.a, n.b, n.c};
+        for (int j = 0; j < 3; ++j)
+            if (operands[j] >= 0) {
+                live[operands[j]] = true;
+                last[operands[j]] = std::max(last[operands[j]], v);
+            }
+    }
+
+    // the constants have fixed registers, the others a linear scan
+    std::vector<int> reg(size, -1);
+    std::vector<T> new_values;
+    for (int v = 0; v < size; ++v)
+        if (live[v] && g.nodes[v].op == detail::rt_const) {
+            reg[v] = static_cast<int>(new_values.size());
+            new_values.push_back(g.nodes[v].value);
+        }
+    int used = static_cast<int>(new_values.size());
+    std::vector<int> available;
+    std::vector<detail::rt_instruction> new_code;
+    for (int v = 0; v < size; ++v) {
+        detail::rt_node<T> const &n = g.nodes[v];
+        if (!live[v] || n.op == detail::rt_const)
+            continue;
+        const int operands[3] = {n.a, n.b, n.c};
+        if (n.op != detail::rt_load)
+            for (int j = 0; j < 3; ++j)
+                if (operands[j] >= 0 && last[operands[j]] == v && g.nodes[operands[j]].op != detail::rt_const &&
+                    std::find(available.begin(), available.end(), reg[operands[j]]) == available.end())
+                    available.push_back(reg[operands[j]]); // the destination may be an operand, lane by lane
+        if (available.empty()) {
+            reg[v] = used++;
+        } else {
+            reg[v] = available.back();
+            available.pop_back();
+        }
+        detail::rt_instruction i = {static_cast<unsigned short>(n.op), static_cast<unsigned short>(reg[v]), 0, 0, 0};
+        if (n.op == detail::rt_load) {
+            i.a = static_cast<unsigned short>(n.field);
+        } else {
+            i.a = static_cast<unsigned short>(reg[n.a]);
+            i.b = static_cast<unsigned short>(n.b < 0 ? 0 : reg[n.b]);
+            i.c = static_cast<unsigned short>(n.c < 0 ? 0 : reg[n.c]);
+        }
+        new_code.push_back(i);
+    }
+    for (std::size_t f = 0; f < outputs.size(); ++f)
+        if (outputs[f] >= 0) {
+            detail::rt_instruction i = {static_cast<unsigned short>(detail::rt_store), static_cast<unsigned short>(f),
+                                        static_cast<unsigned short>(reg[outputs[f]]), 0, 0};
+            new_code.push_back(i);
+        }
+    if (used > std::numeric_limits<unsigned short>::max())
+        boost::throw_exception(std::runtime_error("cyme::runtime_kernel: too many registers"));
+
+    code.swap(new_code);
+    values.swap(new_values);
+    count = std::max(used, 1);
+    simd_registers.assign(count * chunk, simd_type(T(0)));
+    scalar_registers.assign(count * chunk, T(0));
+    for (std::size_t r = 0; r < values.size(); ++r)
+        for (std::size_t k = 0; k < chunk; ++k) {
+            simd_registers[r * chunk + k] = simd_type(values[r]);
+            scalar_registers[r * chunk + k] = values[r];
+        }
+}
+
+template <class T>
+void runtime_kernel<T>::print(std::ostream &out) const {
+    for (std::size_t r = 0; r < values.size(); ++r)
+        out << "r" << r << " = const " << values[r] << "\n";
+    for (std::size_t p = 0; p < code.size(); ++p) {
+        const detail::rt_instruction &i = code[p];
+        const detail::rt_op op = static_cast<detail::rt_op>(i.op);
+        if (op == detail::rt_load) {
+            out << "r" << i.dst << " = load " << fields[i.a] << "\n";
+        } else if (op == detail::rt_store) {
+            out << "store " << fields[i.dst] << ", r" << i.a << "\n";
+        } else {
+            out << "r" << i.dst << " = " << detail::rt_name(op) << " r" << i.a;
+            if (op < detail::rt_neg || op > detail::rt_cos) // not unary
+                out << ", r" << i.b;
+            if (op == detail::rt_where)
+                out << ", r" << i.c;
+            out << "\n";
+        }
+    }
+}
+} // namespace cyme
+
+#endif
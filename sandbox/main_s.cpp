@@ -26,8 +26,8 @@
 #include <boost/mpl/for_each.hpp>
 #include <boost/mpl/vector.hpp>
 
-#include "helpers.hpp"
 #include <cyme/cyme.h>
+#include "helpers.hpp"
 
 namespace ProbAMPANMDA_EMS {
 enum properties {
@@ -66,30 +66,35 @@ static inline void cnrn_state(T &W) {
     W[B_NMDA] += (1. - exp(-0.1 / R[tau_d_NMDA])) * (-R[B_NMDA]);
 }
 
+/** the current and its derivative dI/dv in one pass, the voltage is the variable of the dual */
 template <class T>
-static inline cyme::serial<typename T::value_type, T::MemoryOrder> cnrn_current(T &W, typename T::value_type t) {
+static inline cyme::dual<typename T::value_type, T::MemoryOrder> cnrn_current(T &W, typename T::value_type t) {
     T const &R = W;
     typedef typename T::value_type value_type;
-    W[v] = t;
-    cyme::serial<value_type, T::MemoryOrder> gmax(1.1); // my value
-    cyme::serial<value_type, T::MemoryOrder> mggate(1.0 / (1.0 + exp(-0.062 * R[v]) * (R[mg] / 3.57)));
-    W[g_AMPA] = gmax() * (R[B_AMPA] - R[A_AMPA]);
-    W[g_NMDA] = gmax() * (R[B_NMDA] - R[A_NMDA]) * mggate();
+    typedef cyme::dual<value_type, T::MemoryOrder> dual_type;
+    const dual_type x = dual_type::variable(t);
+    W[v] = x.value();
+    const value_type gmax(1.1); // my value
+    const dual_type mggate = 1.0 / (1.0 + exp(-0.062 * x) * (R[mg] / 3.57));
+    W[g_AMPA] = gmax * (R[B_AMPA] - R[A_AMPA]);
+    const dual_type g_nmda = gmax * (R[B_NMDA] - R[A_NMDA]) * mggate;
+    W[g_NMDA] = g_nmda.value();
     W[g] = R[g_AMPA] + R[g_NMDA];
     W[i_AMPA] = R[g_AMPA] * (R[v] - R[e]);
-    W[i_NMDA] = R[g_NMDA] * (R[v] - R[e]);
-    W[i] = R[i_AMPA] + R[i_NMDA];
-    return cyme::serial<value_type, T::MemoryOrder>(R[i]);
+    const dual_type i_nmda = g_nmda * (x - R[e]);
+    W[i_NMDA] = i_nmda.value();
+    const dual_type current = R[g_AMPA] * (x - R[e]) + i_nmda;
+    W[i] = current.value();
+    return current;
 }
 
+/** the conductance is dI/dv, no finite difference: a single evaluation of the current */
 template <class T>
 static inline void cnrn_cur(T &W) {
     typedef typename T::value_type value_type; // basic float or double
     value_type _v = drand48();                 // _v voltage fron a node random number
     value_type _nd_area = 3.1;
-    cyme::serial<value_type, T::MemoryOrder> tmp = cnrn_current<T>(W, _v + 0.001);
-    cyme::serial<value_type, T::MemoryOrder> tmp2 = cnrn_current<T>(W, _v);
-    W[_g] = (tmp() - tmp2()) / 0.001 * (1.e2 / _nd_area);
+    W[_g] = cnrn_current<T>(W, _v).derivative() * (1.e2 / _nd_area);
 }
 
 template <class T>
@@ -103,10 +108,10 @@ struct f_compute_2 {
 };
 } // namespace ProbAMPANMDA_EMS
 
-typedef cyme::vector<ProbAMPANMDA_EMS::synapse<float>, memory::AoS> Vec_f_AoS_ProbAMPANMDA_EMS;
-typedef cyme::vector<ProbAMPANMDA_EMS::synapse<float>, memory::AoSoA> Vec_f_AoSoA_ProbAMPANMDA_EMS;
-typedef cyme::vector<ProbAMPANMDA_EMS::synapse<double>, memory::AoS> Vec_d_AoS_ProbAMPANMDA_EMS;
-typedef cyme::vector<ProbAMPANMDA_EMS::synapse<double>, memory::AoSoA> Vec_d_AoSoA_ProbAMPANMDA_EMS;
+typedef cyme::vector<ProbAMPANMDA_EMS::synapse<float>, cyme::AoS> Vec_f_AoS_ProbAMPANMDA_EMS;
+typedef cyme::vector<ProbAMPANMDA_EMS::synapse<float>, cyme::AoSoA> Vec_f_AoSoA_ProbAMPANMDA_EMS;
+typedef cyme::vector<ProbAMPANMDA_EMS::synapse<double>, cyme::AoS> Vec_d_AoS_ProbAMPANMDA_EMS;
+typedef cyme::vector<ProbAMPANMDA_EMS::synapse<double>, cyme::AoSoA> Vec_d_AoSoA_ProbAMPANMDA_EMS;
 
 typedef boost::mpl::vector<Vec_f_AoS_ProbAMPANMDA_EMS, Vec_f_AoSoA_ProbAMPANMDA_EMS, Vec_d_AoS_ProbAMPANMDA_EMS,
                            Vec_d_AoSoA_ProbAMPANMDA_EMS>
@@ -122,13 +127,13 @@ struct name<ProbAMPANMDA_EMS::synapse<T>> {
     }
 };
 
+/** the fields of the n synapses, element by element: a field of a AoSoA block is a register */
 template <class T>
-struct f_init {
-    void operator()(typename T::storage_type &S) {
-        for (std::size_t i = 0; i < T::size_block(); ++i)
-            S[i] = drand48();
-    }
-};
+void init(T &v, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i)
+        for (std::size_t j = 0; j < T::size_block(); ++j)
+            v(i, j) = drand48();
+}
 
 #ifdef _OPENMP
 template <typename Iterator, typename Functor>
@@ -150,11 +155,7 @@ struct test_case_1 {
         const std::size_t N(0xfffff);
         T v(N, 0);
 
-#ifdef _OPENMP
-        omp_for_each(v.begin(), v.end(), f_init<T>());
-#else
-        std::for_each(v.begin(), v.end(), f_init<T>());
-#endif
+        init(v, N);
 
         std::vector<double> v_time(limit, 0);
 
@@ -180,11 +181,7 @@ struct test_case_2 {
         const std::size_t N(0xfffff);
         T v(N, 0);
 
-#ifdef _OPENMP
-        omp_for_each(v.begin(), v.end(), f_init<T>());
-#else
-        std::for_each(v.begin(), v.end(), f_init<T>());
-#endif
+        init(v, N);
 
         std::vector<double> v_time(limit, 0);
 
@@ -1,70 +1,123 @@
+/*
+ * Cyme - mandelbrot.cpp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
 
-#include <iostream>
 #include <algorithm>
-#include <numeric>
 #include <cmath>
-
-#include <boost/chrono.hpp>
-#include <boost/mpl/for_each.hpp>
-#include <boost/mpl/vector.hpp>
+#include <iostream>
+#include <numeric>
+#include <vector>
 
 #include <cyme/cyme.h>
 #include "helpers.hpp"
 
-struct my_complex {
-    typedef float value_type;
-    static const int value_size = 2; // it means R[0] = x, R[1] = y
-};
+static const int max_iteration = 255;
 
-template <class T>
-static inline void norm(cyme::serial<int, T::MemoryOrder> &n, T &R) {
-    n = R[0] * R[0] * R[1] * R[1];
+/** escape time of every pixel, a pixel after the other */
+static void serial(std::vector<float> const &cx, std::vector<float> const &cy, std::vector<int> &picture) {
+    for (std::size_t i = 0; i < picture.size(); ++i) {
+        float x(0.f), y(0.f);
+        int n(0);
+        while (x * x + y * y < 4.f && n < max_iteration) {
+            const float t = x * x - y * y + cx[i];
+            y = 2.f * x * y + cy[i];
+            x = t;
+            ++n;
+        }
+        picture[i] = n;
+    }
 }
-/*
-     template<class T>
-     static inline void algo(T& R, int max_iteration){
-
-         cyme::serial<int,T::MemoryOrder> iteration(0);
-         cyme::serial<int,T::MemoryOrder> n(0);
-         cyme::serial<float,T::MemoryOrder> norm(0);
-         cyme::serial<float,T::MemoryOrder> tmp(0);
-         bool b(true);
 
-         while(b){
-             n = (iteration < max_iteration) && (norm(R) < 4.f);
-             b = (n == false);
-             tmp = R[0]*R[0] - R[1]*R[1] + x0;
-             R[1] = 2*R[0]*R[1] + y0;
-             R[0] = tmp;
-             iteration += (int)b;
-         }
+/** escape time of every pixel, a pixel per lane, a lane takes the next pixel when its pixel escapes */
+static void simd(std::vector<float> const &cx, std::vector<float> const &cy, std::vector<int> &picture) {
+    const int lanes = cyme::elems_helper<float, cyme::unroll_factor::N>::size;
+    float x[lanes] __attribute__((aligned(64)));
+    float y[lanes] __attribute__((aligned(64)));
+    float x0[lanes] __attribute__((aligned(64)));
+    float y0[lanes] __attribute__((aligned(64)));
+    float n[lanes] __attribute__((aligned(64)));
+    int pixel[lanes];
+    std::size_t next = 0;
 
+    auto load = [&](int l) {
+        x[l] = y[l] = n[l] = 0.f;
+        if (next == picture.size()) { // escaped, the lane is retired
+            x[l] = 2.f;
+            pixel[l] = -1;
+            return false;
+        }
+        x0[l] = cx[next];
+        y0[l] = cy[next];
+        pixel[l] = next++;
+        return true;
+    };
+    for (int l = 0; l < lanes; ++l)
+        load(l);
 
-     }
-*/
-template <class T>
-struct picture {
-    picture(int size_x = 512, int size_y = 512)
-        : _data(size_x * size_y * my_complex::value_size, 0), _size_x(size_x), _size_y(size_y){};
-    const int width() { return _size_x; }
-    const int high() { return _size_y; }
+    const float *cx_ = x, *cy_ = y, *cn_ = n;
+    cyme::simd_while(
+        [&] {
+            cyme::vec<float> vx(cx_), vy(cy_), vn(cn_);
+            return cyme::vec<float>((vx * vx + vy * vy < 4.f) & (vn < float(max_iteration)));
+        },
+        [&](cyme::vec<float> const &active) {
+            cyme::vec<float> vx(x), vy(y), vn(n);
+            const cyme::complex<float> z(vx, vy);
+            const cyme::complex<float> c(cyme::vec<float>(static_cast<const float *>(x0)),
+                                         cyme::vec<float>(static_cast<const float *>(y0)));
+            const cyme::complex<float> next = z * z + c;
+            vy = where(active, next.imag(), vy);
+            vx = where(active, next.real(), vx);
+            vn = where(active, vn + 1.f, vn);
+        },
+        [&](int l) {
+            if (pixel[l] >= 0)
+                picture[pixel[l]] = static_cast<int>(n[l]);
+            return load(l);
+        });
+}
 
-    int _size_x, _size_y;
-};
+int main() {
+    const int size_x = 1024, size_y = 1024;
+    std::vector<float> cx(size_x * size_y), cy(size_x * size_y);
+    for (int i = 0; i < size_y; ++i)
+        for (int j = 0; j < size_x; ++j) {
+            cx[i * size_x + j] = -2.f + 3.f * j / size_x;
+            cy[i * size_x + j] = -1.f + 2.f * i / size_y;
+        }
 
-int main(int argc, char *argv[]) {
+    std::vector<int> picture_serial(size_x * size_y), picture_simd(size_x * size_y);
+    timer t;
 
-    picture<cyme::vector<my_complex, cyme::AoSoA>> p;
+    t.tic();
+    serial(cx, cy, picture_serial);
+    std::cout << " serial " << t.toc() << " [s]" << std::endl;
 
-    const float x0 = -2.f;
-    const float x1 = 1.f;
-    const float y0 = -1.f;
-    const float y1 = 1.f;
+    t.tic();
+    simd(cx, cy, picture_simd);
+    std::cout << " simd_while " << t.toc() << " [s]" << std::endl;
 
-    for (int i = 0; i < p.high(); ++i)
-        for (int j = j; j < p.width(); ++j) {
-        }
-    <Down>
+    // the rounding of the FMA can move a pixel on the border of the set
+    int diff = 0;
+    for (std::size_t i = 0; i < picture_serial.size(); ++i)
+        diff += (picture_serial[i] != picture_simd[i]);
+    std::cout << " pixels different " << diff << " / " << picture_serial.size() << std::endl;
 
-        return 0;
-};
+    return 0;
+}
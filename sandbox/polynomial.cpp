@@ -0,0 +1,140 @@
+/*
+ * Cyme - polynomial.cpp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+
+#include <boost/mpl/for_each.hpp>
+#include <boost/mpl/vector.hpp>
+
+#include <cyme/cyme.h>
+#include "helpers.hpp"
+
+/** Horner, second order Horner and Estrin on the tables of exp, log and sin. The latency: a chain of dependent
+    evaluations on one register, x = x + p(x)*zero, zero unknown to the compiler. The throughput: the evaluations
+    of an array, independent. The time of an evaluation of a register, [ns] */
+
+static const std::size_t chain = 1 << 22;
+static const std::size_t size = 1 << 12;
+static const int repeat = 1 << 10;
+
+/** the polynomial of the table C, or the function of the library (its scheme of cyme::poly_scheme_trait) */
+template <class C, cyme::poly_scheme S>
+struct f_poly {
+    template <class R>
+    static forceinline R f(R const &x) {
+        return cyme::polyval<C, S>(x);
+    }
+};
+
+struct f_exp {
+    static const char *print() { return "exp"; }
+    template <class R>
+    static forceinline R f(R const &x) {
+        return exp(x);
+    }
+};
+
+struct f_log {
+    static const char *print() { return "log"; }
+    template <class R>
+    static forceinline R f(R const &x) {
+        return log(x);
+    }
+};
+
+struct f_sin {
+    static const char *print() { return "sin"; }
+    template <class R>
+    static forceinline R f(R const &x) {
+        return sin(x);
+    }
+};
+
+template <class T, class F>
+double latency() {
+    typedef cyme::vec_simd<T, cyme::__GETSIMD__(), cyme::unroll_factor::N> simd_type;
+    const simd_type zero(static_cast<T>(0 * drand48()));
+    simd_type x(static_cast<T>(0.3));
+    timer t;
+    t.tic();
+    for (std::size_t k = 0; k < chain; ++k)
+        x = x + F::f(x) * zero;
+    const double time = t.toc();
+    T r[cyme::elems_helper<T, cyme::unroll_factor::N>::size] __attribute__((aligned(64)));
+    x.store(r);
+    if (r[0] != static_cast<T>(0.3))
+        std::cout << "wrong chain" << std::endl;
+    return 1e9 * time / chain;
+}
+
+template <class T, class F>
+double throughput() {
+    typedef cyme::vec_simd<T, cyme::__GETSIMD__(), cyme::unroll_factor::N> simd_type;
+    const int n = cyme::elems_helper<T, cyme::unroll_factor::N>::size;
+    T *a = static_cast<T *>(aligned_alloc(64, size * sizeof(T)));
+    T *b = static_cast<T *>(aligned_alloc(64, size * sizeof(T)));
+    for (std::size_t i = 0; i < size; ++i)
+        a[i] = static_cast<T>(0.1 + 0.5 * drand48());
+    timer t;
+    t.tic();
+    for (int k = 0; k < repeat; ++k)
+        for (std::size_t i = 0; i < size; i += n)
+            F::f(simd_type(a + i)).store(b + i);
+    const double time = t.toc();
+    free(a);
+    free(b);
+    return 1e9 * time * n / (static_cast<double>(repeat) * size);
+}
+
+template <class T, template <class, std::size_t> class C, class F>
+void compare() {
+    typedef cyme::poly_table<T, C> table;
+    std::cout << std::fixed << std::setprecision(2) << "\t" << F::print() << "<" << name<T>::print() << ">, order "
+              << table::order << std::endl;
+    std::cout << "\t\tlatency    horner " << latency<T, f_poly<table, cyme::poly_horner>>() << ", horner2 "
+              << latency<T, f_poly<table, cyme::poly_horner2>>() << ", estrin "
+              << latency<T, f_poly<table, cyme::poly_estrin>>() << ", " << F::print() << " "
+              << latency<T, F>() << " [ns]" << std::endl;
+    std::cout << "\t\tthroughput horner " << throughput<T, f_poly<table, cyme::poly_horner>>() << ", horner2 "
+              << throughput<T, f_poly<table, cyme::poly_horner2>>() << ", estrin "
+              << throughput<T, f_poly<table, cyme::poly_estrin>>() << ", " << F::print() << " "
+              << throughput<T, F>() << " [ns]" << std::endl;
+}
+
+typedef boost::mpl::vector<float, double> type_list;
+
+struct test_case {
+    template <class T>
+    void operator()(T const &) {
+        compare<T, cyme::coeff_remez_exp, f_exp>();
+        compare<T, cyme::coeff_remez_log, f_log>();
+        compare<T, cyme::coeff_cephes_sin, f_sin>();
+    }
+};
+
+int main() {
+    std::cout << " unroll " << cyme::unroll_factor::N << std::endl;
+    boost::mpl::for_each<type_list>(test_case());
+}
@@ -0,0 +1,115 @@
+/*
+ * Cyme - runtime_kernel.cpp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <numeric>
+
+#include <boost/mpl/for_each.hpp>
+#include <boost/mpl/vector.hpp>
+
+#include <cyme/cyme.h>
+#include "helpers.hpp"
+
+namespace Na {
+enum properties { v, m, h, mTau, hTau };
+
+template <class T>
+struct channel {
+    typedef T value_type;
+    static const int value_size = 5;
+};
+
+/** the kernel compiled, the expression templates */
+template <class T>
+struct f_compute {
+    void operator()(T &R) {
+        R[mTau] = 1. / ((0.182 * (R[v] + 35.0)) / (1. - exp((-35.0 - R[v]) / 9.0)) +
+                        (-0.124 * (R[v] + 35.0)) / (1. - exp((R[v] + 35.0) / 9.0)));
+        R[hTau] = 1. / ((0.024 * (R[v] + 50.0)) / (1. - exp((-50.0 - R[v]) / 5.0)) +
+                        (-0.0091 * (R[v] + 75.0)) / (1. - exp((R[v] + 75.0) / 5.0)));
+        R[m] += (1. - exp(-0.1 / R[mTau])) * (1. / (1. + exp(-(R[v] + 38.0) / 7.0)) - R[m]);
+        R[h] += (1. - exp(-0.1 / R[hTau])) * (1. / (1. + exp((R[v] + 65.0) / 6.2)) - R[h]);
+    }
+};
+
+/** the same kernel, a text for the runtime compiler */
+static const char *text = "mTau = 1 / ((0.182 * (v + 35)) / (1 - exp((-35 - v) / 9))\n"
+                          "           + (-0.124 * (v + 35)) / (1 - exp((v + 35) / 9)))\n"
+                          "hTau = 1 / ((0.024 * (v + 50)) / (1 - exp((-50 - v) / 5))\n"
+                          "           + (-0.0091 * (v + 75)) / (1 - exp((v + 75) / 5)))\n"
+                          "m = m + (1 - exp(-dt / mTau)) * (1 / (1 + exp(-(v + 38) / 7)) - m)\n"
+                          "h = h + (1 - exp(-dt / hTau)) * (1 / (1 + exp((v + 65) / 6.2)) - h)";
+} // namespace Na
+
+typedef cyme::vector<Na::channel<float>, cyme::AoSoA> Vec_f_AoSoA_Na;
+typedef cyme::vector<Na::channel<double>, cyme::AoSoA> Vec_d_AoSoA_Na;
+
+typedef boost::mpl::vector<Vec_f_AoSoA_Na, Vec_d_AoSoA_Na> vector_list;
+
+template <typename T>
+struct name<Na::channel<T>> {
+    static const std::string print() {
+        std::stringstream s;
+        s << "Na::channel<" << name<T>::print() << " by " << Na::channel<T>::value_size << ">";
+        return s.str();
+    }
+};
+
+struct test_case {
+
+    template <class T>
+    void operator()(T const &) {
+        typedef typename T::value_type value_type;
+        typedef typename T::storage_type storage_type;
+        const int limit = 4;
+        const std::size_t size(0xfffff);
+        T v(size, 0);
+        for (std::size_t i = 0; i < size; ++i) {
+            v(i, Na::v) = -80. + 100. * drand48();
+            v(i, Na::m) = drand48();
+            v(i, Na::h) = drand48();
+        }
+
+        const char *fields[] = {"v", "m", "h", "mTau", "hTau"};
+        cyme::runtime_kernel<value_type> k(std::vector<std::string>(fields, fields + 5));
+        k.constant("dt", value_type(0.1));
+        k.compile(Na::text);
+
+        std::vector<double> compiled(limit, 0), runtime(limit, 0);
+        timer t;
+        for (int i = 0; i < limit; ++i) {
+            t.tic();
+            std::for_each(v.begin(), v.end(), Na::f_compute<storage_type>());
+            compiled[i] = t.toc();
+            t.tic();
+            k(v);
+            runtime[i] = t.toc();
+        }
+        std::cout << " compiled " << std::endl;
+        average<T>(compiled);
+        std::cout << " runtime_kernel, " << k.instructions() << " instructions, " << k.registers() << " registers"
+                  << std::endl;
+        average<T>(runtime);
+    }
+};
+
+int main() { boost::mpl::for_each<vector_list>(test_case()); }
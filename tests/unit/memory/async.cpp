@@ -0,0 +1,85 @@
+/*
+ * Cyme - async.cpp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+#include <tests/unit/test_header.hpp>
+
+using namespace cyme::test;
+
+#define TYPE typename T::value_type
+#define N T::n
+#define ORDER T::order
+
+template <class T, size_t M>
+struct synapse {
+    typedef T value_type;
+    static const size_t value_size = M;
+};
+
+struct kernel {
+    template <class S>
+    void operator()(S &s) const {
+        s[0] = s[1] * s[2] + s[3];
+        s[2] = exp(s[1]) - s[0] / s[3];
+    }
+};
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(async_for_each_chunks, T, floating_point_block_types) {
+    std::size_t chunks[] = {0, 1, 3, 64, 100000};
+    for (std::size_t c = 0; c < sizeof(chunks) / sizeof(std::size_t); ++c) {
+        cyme::vector<synapse<TYPE, N>, cyme::AoS> vector_a(1025);
+        cyme::vector<synapse<TYPE, N>, ORDER> vector_b(1025);
+
+        init(vector_a, vector_b);
+
+        std::for_each(vector_a.begin(), vector_a.end(), kernel());
+        std::future<void> f = cyme::async_for_each(vector_b, kernel(), chunks[c]);
+        f.get();
+
+        check(vector_a, vector_b);
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(async_for_each_range, T, floating_point_block_types) {
+    cyme::vector<synapse<TYPE, N>, cyme::AoS> vector_a(512, 1);
+    cyme::vector<synapse<TYPE, N>, ORDER> vector_b(512, 1);
+
+    // an empty range is ready immediately
+    std::future<void> f = cyme::async_for_each(vector_b.begin(), vector_b.begin(), kernel());
+    BOOST_CHECK(f.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+
+    std::for_each(vector_a.begin(), vector_a.begin() + vector_a.size() / 2, kernel());
+    f = cyme::async_for_each(vector_b.begin(), vector_b.begin() + vector_b.size() / 2, kernel(), 4);
+    f.wait();
+
+    // the first half as the serial reference, the second half is not touched
+    check(vector_a, vector_b);
+    for (std::size_t i = vector_a.size() / 2; i < vector_a.size(); ++i)
+        for (std::size_t j = 0; j < vector_a.size_block(); ++j)
+            BOOST_CHECK_EQUAL(vector_b(i, j), 1);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(async_for_each_exception, T, floating_point_block_types) {
+    typedef cyme::vector<synapse<TYPE, N>, ORDER> vector_type;
+    vector_type vector_b(1024);
+
+    std::future<void> f = cyme::async_for_each(vector_b, [](typename vector_type::storage_type &) {
+        throw std::runtime_error("kernel");
+    }, 4);
+    BOOST_CHECK_THROW(f.get(), std::runtime_error);
+}
@@ -0,0 +1,126 @@
+/*
+ * Cyme - async_coroutine.cpp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+#include <tests/unit/test_header.hpp>
+
+#if __cplusplus < 202002L
+#error "async_coroutine tests cyme::co_for_each, it must be built with -std=c++20"
+#endif
+
+using namespace cyme::test;
+
+#define TYPE typename T::value_type
+#define N T::n
+#define ORDER T::order
+
+template <class T, size_t M>
+struct synapse {
+    typedef T value_type;
+    static const size_t value_size = M;
+};
+
+struct kernel {
+    template <class S>
+    void operator()(S &s) const {
+        s[0] = s[1] * s[2] + s[3];
+        s[2] = exp(s[1]) - s[0] / s[3];
+    }
+};
+
+/** coroutine started at the call, nothing to resume: the end (or the exception) is given to a promise */
+struct detached {
+    struct promise_type {
+        detached get_return_object() { return detached(); }
+        std::suspend_never initial_suspend() noexcept { return std::suspend_never(); }
+        std::suspend_never final_suspend() noexcept { return std::suspend_never(); }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+/** co_await co_for_each, then records the thread resuming the coroutine */
+template <class Awaitable>
+detached await(Awaitable a, std::promise<std::thread::id> &done) {
+    try {
+        co_await a;
+        done.set_value(std::this_thread::get_id());
+    } catch (...) {
+        done.set_exception(std::current_exception());
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(async_coroutine_chunks, T, floating_point_block_types) {
+    std::size_t chunks[] = {0, 1, 3, 64, 100000};
+    for (std::size_t c = 0; c < sizeof(chunks) / sizeof(std::size_t); ++c) {
+        cyme::vector<synapse<TYPE, N>, cyme::AoS> vector_a(1025);
+        cyme::vector<synapse<TYPE, N>, ORDER> vector_b(1025);
+        cyme::vector<synapse<TYPE, N>, ORDER> vector_c(1025);
+
+        init(vector_a, vector_b);
+        for (std::size_t i = 0; i < vector_a.size(); ++i)
+            for (std::size_t j = 0; j < vector_a.size_block(); ++j)
+                vector_c(i, j) = vector_b(i, j);
+
+        std::for_each(vector_a.begin(), vector_a.end(), kernel());
+        std::for_each(vector_c.begin(), vector_c.end(), kernel());
+        std::promise<std::thread::id> done;
+        await(cyme::co_for_each(vector_b, kernel(), chunks[c]), done);
+        done.get_future().get();
+
+        // the same kernel on the same layout as the synchronous path, the results are equal
+        check(vector_a, vector_b);
+        for (std::size_t i = 0; i < vector_a.size(); ++i)
+            for (std::size_t j = 0; j < vector_a.size_block(); ++j)
+                BOOST_CHECK_EQUAL(vector_b(i, j), vector_c(i, j));
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(async_coroutine_range, T, floating_point_block_types) {
+    cyme::vector<synapse<TYPE, N>, cyme::AoS> vector_a(512, 1);
+    cyme::vector<synapse<TYPE, N>, ORDER> vector_b(512, 1);
+
+    // an empty range does not suspend, the coroutine goes on in this thread
+    std::promise<std::thread::id> ready;
+    std::future<std::thread::id> f = ready.get_future();
+    await(cyme::co_for_each(vector_b.begin(), vector_b.begin(), kernel()), ready);
+    BOOST_CHECK(f.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+    BOOST_CHECK(f.get() == std::this_thread::get_id());
+
+    // a range is resumed by the thread of the last chunk
+    std::for_each(vector_a.begin(), vector_a.begin() + vector_a.size() / 2, kernel());
+    std::promise<std::thread::id> done;
+    await(cyme::co_for_each(vector_b.begin(), vector_b.begin() + vector_b.size() / 2, kernel(), 4), done);
+    BOOST_CHECK(done.get_future().get() != std::this_thread::get_id());
+
+    // the first half as the serial reference, the second half is not touched
+    check(vector_a, vector_b);
+    for (std::size_t i = vector_a.size() / 2; i < vector_a.size(); ++i)
+        for (std::size_t j = 0; j < vector_a.size_block(); ++j)
+            BOOST_CHECK_EQUAL(vector_b(i, j), 1);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(async_coroutine_exception, T, floating_point_block_types) {
+    typedef cyme::vector<synapse<TYPE, N>, ORDER> vector_type;
+    vector_type vector_b(1024);
+    std::promise<std::thread::id> done;
+    await(cyme::co_for_each(vector_b, [](typename vector_type::storage_type &) { throw std::runtime_error("kernel"); },
+                            4),
+          done);
+    BOOST_CHECK_THROW(done.get_future().get(), std::runtime_error);
+}
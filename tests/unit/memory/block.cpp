@@ -0,0 +1,103 @@
+/*
+ * Cyme - block.cpp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+#include <tests/unit/test_header.hpp>
+
+using namespace cyme::test;
+
+#define TYPE typename T::value_type
+#define N T::n
+#define ORDER T::order
+
+template <class T, size_t M>
+struct synapse {
+    typedef T value_type;
+    static const size_t value_size = M;
+};
+
+/** write then read, read then write, and update of a field */
+template <class S>
+void kernel(S &W) {
+    S const &R = W;
+    W[0] = R[1] * R[2] + R[0];
+    W[1] = exp(R[0]) - R[1] / R[2];
+    W[2] += R[0] * R[1];
+    W[1] *= R[2];
+    W[2] -= R[1];
+}
+
+struct f_storage {
+    template <class S>
+    void operator()(S &s) const {
+        kernel(s);
+    }
+};
+
+struct f_register_block {
+    template <class S>
+    void operator()(S &s) const {
+        cyme::register_block<S> W(s);
+        kernel(W);
+    }
+};
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(register_block_kernel, T, floating_point_block_types) {
+    cyme::vector<synapse<TYPE, N>, cyme::AoS> vector_a(1031);
+    cyme::vector<synapse<TYPE, N>, ORDER> vector_b(1031);
+
+    std::uniform_real_distribution<TYPE> value(0.5, 2); // exp must not overflow
+    for (std::size_t i = 0; i < vector_a.size(); ++i)
+        for (std::size_t j = 0; j < N; ++j)
+            vector_a(i, j) = vector_b(i, j) = value(rng);
+
+    std::for_each(vector_a.begin(), vector_a.end(), f_storage());
+    std::for_each(vector_b.begin(), vector_b.end(), f_register_block());
+
+    check(vector_a, vector_b);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(register_block_lazy, T, full_test_types) {
+    typedef cyme::vector<synapse<T, 4>, cyme::AoSoA> vector_type;
+    typedef typename vector_type::storage_type storage_type;
+    const std::size_t offset = vector_type::offset;
+    vector_type v(1, 1);
+    storage_type &s = *v.begin();
+
+    {
+        cyme::register_block<storage_type> W(s);
+        cyme::register_block<storage_type> const &R = W;
+
+        s(offset) = 2; // field 1 not read yet, the proxy sees the new value
+        W[0] = R[1] * R[1];
+        s(offset) = 3; // field 1 is into a register now
+        W[2] = R[1] + R[0];
+        BOOST_CHECK_EQUAL(s(0), 1); // nothing stored before the flush
+        BOOST_CHECK_EQUAL(s(2 * offset), 1);
+
+        W.flush();
+        BOOST_CHECK_EQUAL(s(0), 4);
+        BOOST_CHECK_EQUAL(s(offset), 3); // field 1 is clean, not stored
+        BOOST_CHECK_EQUAL(s(2 * offset), 6);
+
+        W[3] += R[3];
+        s(0) = 0; // field 0 is clean, the destructor does not store it
+    }
+    BOOST_CHECK_EQUAL(s(0), 0);
+    BOOST_CHECK_EQUAL(s(3 * offset), 2);
+}
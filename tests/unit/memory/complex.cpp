@@ -0,0 +1,159 @@
+/*
+ * Cyme - complex.cpp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+#include <limits>
+#include <tests/unit/test_header.hpp>
+
+using namespace cyme::test;
+
+template <class T>
+bool close(T a, double b, double tolerance) {
+    return std::fabs(a - b) <= tolerance * (1. + std::fabs(b));
+}
+
+/** the precision of the division of cyme, and of sin, cos and atan (float coefficients) */
+template <class T>
+double tolerance() {
+    return (sizeof(T) == 4) ? 1e-5 : 1e-6;
+}
+
+/** the functions on the registers (AoSoA) and on the basic types (AoS), std::complex<double> the reference */
+BOOST_AUTO_TEST_CASE_TEMPLATE(complex_functions, T, full_test_types) {
+    const int n = cyme::elems_helper<T, cyme::unroll_factor::N>::size;
+    T a[n] __attribute__((aligned(64)));
+    T b[n] __attribute__((aligned(64)));
+    T c[n] __attribute__((aligned(64)));
+    T d[n] __attribute__((aligned(64)));
+    T re[n] __attribute__((aligned(64)));
+    T im[n] __attribute__((aligned(64)));
+    T r[n] __attribute__((aligned(64)));
+    T s[n] __attribute__((aligned(64)));
+    std::uniform_real_distribution<T> random(-3, 3);
+    for (int i = 0; i < n; ++i) {
+        a[i] = random(rng);
+        b[i] = random(rng);
+        c[i] = random(rng);
+        d[i] = random(rng);
+    }
+    a[0] = T(-2);
+    b[0] = T(-0.); // on the branch cut of arg, -pi
+
+    typedef cyme::vec<T, cyme::__GETSIMD__()> vec_type;
+    typedef cyme::complex<T, cyme::AoSoA> complex_simd;
+    const complex_simd z(vec_type(static_cast<T const *>(a)), vec_type(static_cast<T const *>(b)));
+    const complex_simd w(vec_type(static_cast<T const *>(c)), vec_type(static_cast<T const *>(d)));
+    vec_type vre(re), vim(im), vr(r), vs(s);
+    const complex_simd f = (z * w - 2. * z) / (w + std::complex<T>(T(0.5), T(1))) + exp(conj(z) * T(0.5)) - T(1);
+    vre = f.real();
+    vim = f.imag();
+    vr = abs(z) + norm(w);
+    vs = arg(z);
+
+    typedef cyme::complex<T, cyme::AoS> complex_serial;
+    typedef std::complex<double> reference;
+    for (int i = 0; i < n; ++i) {
+        const reference zr(a[i], b[i]), wr(c[i], d[i]);
+        const reference fr = (zr * wr - 2. * zr) / (wr + reference(0.5, 1)) + std::exp(std::conj(zr) * 0.5) - 1.;
+        const complex_serial zs(a[i], b[i]), ws(c[i], d[i]);
+        const complex_serial fs =
+            (zs * ws - 2. * zs) / (ws + std::complex<T>(T(0.5), T(1))) + exp(conj(zs) * T(0.5)) - T(1);
+        const double scale = std::abs(fr) + 1.; // relative to the magnitude, not to a small part
+        BOOST_CHECK(close(re[i] / scale, fr.real() / scale, tolerance<T>()));
+        BOOST_CHECK(close(im[i] / scale, fr.imag() / scale, tolerance<T>()));
+        BOOST_CHECK(close(fs.real() / scale, fr.real() / scale, tolerance<T>()));
+        BOOST_CHECK(close(fs.imag() / scale, fr.imag() / scale, tolerance<T>()));
+        BOOST_CHECK(close(r[i], std::abs(zr) + std::norm(wr), tolerance<T>()));
+        BOOST_CHECK(close(s[i], std::arg(zr), tolerance<T>()));
+        BOOST_CHECK(close(arg(zs), std::arg(zr), tolerance<T>()));
+    }
+}
+
+/** the cancellation of the real part, (1+e)^2 - 1: the FMA keeps e^2, lost by the rounding of (1+e)^2 else */
+BOOST_AUTO_TEST_CASE_TEMPLATE(complex_multiplication, T, full_test_types) {
+    const int n = cyme::elems_helper<T, cyme::unroll_factor::N>::size;
+    const T e = std::ldexp(T(1), -std::numeric_limits<T>::digits / 2 - 1);
+    T a[n] __attribute__((aligned(64)));
+    T re[n] __attribute__((aligned(64)));
+    T im[n] __attribute__((aligned(64)));
+    for (int i = 0; i < n; ++i)
+        a[i] = T(1) + e;
+    typedef cyme::vec<T, cyme::__GETSIMD__()> vec_type;
+    typedef cyme::complex<T, cyme::AoSoA> complex_simd;
+    const complex_simd z(vec_type(static_cast<T const *>(a)), vec_type(T(1)));
+    vec_type vre(re), vim(im);
+    const complex_simd p = z * z;
+    vre = p.real();
+    vim = p.imag();
+    for (int i = 0; i < n; ++i) {
+#ifdef __FMA__
+        BOOST_CHECK_EQUAL(re[i], 2 * e + e * e);
+#else
+        BOOST_CHECK_EQUAL(re[i], 2 * e);
+#endif
+        BOOST_CHECK_EQUAL(im[i], 2 + 2 * e);
+    }
+}
+
+/** the transfer function of a RC low-pass filter, 1/(1 + iwRC), the gain and the phase */
+enum properties { w, r, c, h_re, h_im, gain, phase };
+
+template <class S>
+void transfer(S &W) {
+    typedef typename S::value_type value_type;
+    typedef cyme::complex<value_type, S::MemoryOrder> complex_type;
+    S const &R = W;
+    const std::complex<value_type> i(0, 1);
+    const complex_type h = 1. / (1. + i * complex_type(R[w] * R[r] * R[c]));
+    W[h_re] = h.real();
+    W[h_im] = h.imag();
+    W[gain] = abs(h);
+    W[phase] = arg(h);
+}
+
+template <class T, size_t M>
+struct filter {
+    typedef T value_type;
+    static const size_t value_size = M;
+};
+
+#define TYPE typename T::value_type
+#define N T::n
+#define ORDER T::order
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(complex_filter, T, floating_point_block_types) {
+    const std::size_t size = 1031;
+    cyme::vector<filter<TYPE, N>, ORDER> v(size);
+    std::uniform_real_distribution<TYPE> random(0.1, 10);
+    for (std::size_t k = 0; k < size; ++k) {
+        v(k, w) = random(rng);
+        v(k, r) = random(rng);
+        v(k, c) = random(rng);
+    }
+
+    for (typename cyme::vector<filter<TYPE, N>, ORDER>::iterator it = v.begin(); it != v.end(); ++it)
+        transfer(*it);
+
+    for (std::size_t k = 0; k < size; ++k) {
+        const std::complex<double> h = 1. / (1. + std::complex<double>(0., double(v(k, w)) * v(k, r) * v(k, c)));
+        BOOST_CHECK(close(v(k, h_re), h.real(), tolerance<TYPE>()));
+        BOOST_CHECK(close(v(k, h_im), h.imag(), tolerance<TYPE>()));
+        BOOST_CHECK(close(v(k, gain), std::abs(h), tolerance<TYPE>()));
+        BOOST_CHECK(close(v(k, phase), std::arg(h), tolerance<TYPE>()));
+    }
+}
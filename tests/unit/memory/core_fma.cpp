@@ -0,0 +1,133 @@
+/*
+ * Cyme - core_fma.cpp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+#include <tests/unit/test_header.hpp>
+
+using namespace cyme::test;
+
+/** the vertex types of the chains, before the macros of the block types */
+template <class T>
+void check_trees() {
+#ifdef __FMA__
+    typedef cyme::vec<T, cyme::__GETSIMD__()> vec_type;
+    typedef typename vec_type::base_type simd_type;
+    typedef cyme::vec_scalar<T, cyme::__GETSIMD__(), cyme::unroll_factor::N> scalar_type;
+    typedef cyme::vec_mul_add_mul<T, cyme::__GETSIMD__(), cyme::unroll_factor::N, simd_type, simd_type, simd_type,
+                                  simd_type> mam_type;
+    vec_type a(T(1)), b(T(2)), c(T(3)), d(T(4)), e(T(5));
+
+    BOOST_CHECK((std::is_same<typename decltype(a * b + c * d + e)::base_type,
+                              cyme::vec_mul_add_mul_add<T, cyme::__GETSIMD__(), cyme::unroll_factor::N, simd_type,
+                                                        simd_type, simd_type, simd_type, simd_type>>::value));
+    BOOST_CHECK((std::is_same<typename decltype(2. + (a * b + c * d))::base_type,
+                              cyme::vec_mul_add_mul_add<T, cyme::__GETSIMD__(), cyme::unroll_factor::N, simd_type,
+                                                        simd_type, simd_type, simd_type, scalar_type>>::value));
+    BOOST_CHECK((std::is_same<typename decltype(a * b + c * d + e * a)::base_type,
+                              cyme::vec_muladd<T, cyme::__GETSIMD__(), cyme::unroll_factor::N, simd_type, simd_type,
+                                               mam_type>>::value));
+#endif
+}
+
+#define TYPE typename T::value_type
+#define N T::n
+#define ORDER T::order
+
+template <class T, size_t M>
+struct synapse {
+    typedef T value_type;
+    static const size_t value_size = M;
+};
+
+struct f_chain {
+    template <class S>
+    void operator()(S &W) const {
+        S const &R = W;
+        W[0] = R[1] * R[2] + R[3] * R[4] + R[5];
+        W[1] = 0.5 + (R[2] * R[3] + R[4] * R[5]);
+        W[2] = R[1] * R[3] + R[4] * R[5] + R[2] * R[0];
+        W[3] = (R[1] * R[2] + R[3] * R[4]) + (R[5] * R[0] + R[2] * R[2]);
+        W[4] = R[1] * R[2] - R[3] * R[4];
+    }
+};
+
+/** a polynomial of degree 4, a FMA per level */
+struct f_horner {
+    template <class S>
+    void operator()(S &W) const {
+        S const &R = W;
+        W[0] = (((0.5 * R[1] + 1.5) * R[1] - 2.) * R[1] + 0.25) * R[1] + 3.;
+        W[2] = (R[3] * R[1] + R[4]) * R[1] + R[5];
+    }
+};
+
+struct f_compound {
+    template <class S>
+    void operator()(S &W) const {
+        S const &R = W;
+        W[0] += R[1] * R[2];
+        W[3] -= R[1] * 2.;
+        W[4] += R[5] * R[1] + R[2];
+    }
+};
+
+struct f_compound_block {
+    template <class S>
+    void operator()(S &s) const {
+        cyme::register_block<S> W(s);
+        f_compound()(W);
+    }
+};
+
+BOOST_AUTO_TEST_CASE(core_fma_cost_model) {
+    // Haswell: the two mul in parallel are faster than the mul then the FMA
+    BOOST_CHECK((cyme::fma_contract<cyme::haswell>::muladd));
+    BOOST_CHECK((!cyme::fma_contract<cyme::haswell>::mul_add_mul));
+    BOOST_CHECK((!cyme::fma_contract<cyme::haswell>::mul_add_mul_add));
+    // Skylake: same latency, less instructions
+    BOOST_CHECK((cyme::fma_contract<cyme::skylake>::muladd));
+    BOOST_CHECK((cyme::fma_contract<cyme::skylake>::mul_add_mul));
+    BOOST_CHECK((cyme::fma_contract<cyme::skylake>::mul_add_mul_add));
+    // Zen: the FMA is slower than the add and the mul
+    BOOST_CHECK((cyme::fma_contract<cyme::zen>::muladd));
+    BOOST_CHECK((!cyme::fma_contract<cyme::zen>::mul_add_mul));
+    BOOST_CHECK((!cyme::fma_contract<cyme::zen>::mul_add_mul_add));
+    // generic: no model, the choices before the cost model, a*b+c*d+e is (a*b+c*d)+e
+    BOOST_CHECK((!cyme::fma_contract<cyme::generic>::model));
+    BOOST_CHECK((cyme::fma_contract<cyme::generic>::muladd));
+    BOOST_CHECK((!cyme::fma_contract<cyme::generic>::mul_add_mul));
+    BOOST_CHECK((cyme::fma_contract<cyme::haswell>::model));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(core_fma_chain, T, floating_point_block_types) {
+    run<synapse<TYPE, N>, ORDER>(f_chain());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(core_fma_horner, T, floating_point_block_types) {
+    run<synapse<TYPE, N>, ORDER>(f_horner());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(core_fma_compound, T, floating_point_block_types) {
+    run<synapse<TYPE, N>, ORDER>(f_compound());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(core_fma_compound_block, T, floating_point_block_types) {
+    run<synapse<TYPE, N>, ORDER>(f_compound_block());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(core_fma_trees, T, full_test_types) { check_trees<T>(); }
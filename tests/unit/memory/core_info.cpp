@@ -0,0 +1,99 @@
+/*
+ * Cyme - core_info.cpp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+#include <sstream>
+#include <tests/unit/test_header.hpp>
+
+using namespace cyme::test;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(core_info_counts, T, full_test_types) {
+    typedef cyme::vec<T, cyme::__GETSIMD__()> vec_type;
+    vec_type a(T(1)), b(T(2)), c(T(3)), d(T(4));
+
+    typedef cyme::expression_info<decltype(exp(a - b) / sqrt(c) + log(d))> info;
+    BOOST_CHECK_EQUAL(int(info::add), 2);
+    BOOST_CHECK_EQUAL(int(info::div), 1);
+    BOOST_CHECK_EQUAL(int(info::sqrt), 1);
+    BOOST_CHECK_EQUAL(int(info::exp), 1);
+    BOOST_CHECK_EQUAL(int(info::log), 1);
+    BOOST_CHECK_EQUAL(int(info::loads), 4);
+    BOOST_CHECK_EQUAL(int(info::stores), 1);
+    BOOST_CHECK_EQUAL(int(info::depth), 4); // add(div(exp(sub)))
+
+    // where and max are "other", the mask is evaluated before (a leaf), the scalars are broadcast, not loaded
+    typedef cyme::expression_info<decltype(where(a < b, 2. * c, max(c, d)))> select;
+    BOOST_CHECK_EQUAL(int(select::other), 2);
+    BOOST_CHECK_EQUAL(int(select::mul), 1);
+    BOOST_CHECK_EQUAL(int(select::loads), 4);
+    BOOST_CHECK_EQUAL(int(select::scalars), 1);
+    BOOST_CHECK_EQUAL(int(select::flops), 1);
+
+    // pow(x, M) is one pow, a leaf alone is a copy
+    BOOST_CHECK_EQUAL(int(cyme::expression_info<decltype(pow(a, cyme::exponent<3>()))>::pow), 1);
+    BOOST_CHECK_EQUAL(int(cyme::expression_info<vec_type>::depth), 0);
+    BOOST_CHECK_EQUAL(int(cyme::expression_info<vec_type>::loads), 1);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(core_info_fma, T, full_test_types) {
+    typedef cyme::vec<T, cyme::__GETSIMD__()> vec_type;
+    vec_type a(T(1)), b(T(2)), c(T(3)), d(T(4)), e(T(5));
+
+    // a*b+c*d+e: the flops do not depend on the contraction, a fma is two
+    typedef cyme::expression_info<decltype(a * b + c * d + e)> info;
+    BOOST_CHECK_EQUAL(int(info::add + info::fma), 2);
+    BOOST_CHECK_EQUAL(int(info::mul + info::fma), 2);
+    BOOST_CHECK_EQUAL(int(info::flops), 4);
+    BOOST_CHECK_EQUAL(int(info::loads), 5);
+#ifdef __FMA__
+    // no contraction of the chain without a cost model (generic)
+    BOOST_CHECK_EQUAL(info::fma > 0, bool(cyme::fma_contract<>::model));
+#else
+    BOOST_CHECK_EQUAL(int(info::fma), 0);
+#endif
+    BOOST_CHECK_CLOSE(info::intensity(), 4. / (6 * sizeof(T)), 1e-9);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(core_info_registers, T, full_test_types) {
+    typedef cyme::vec<T, cyme::__GETSIMD__()> vec_type;
+    vec_type a(T(1)), b(T(2)), c(T(3)), d(T(4));
+    const int n = cyme::unroll_factor::N;
+    const int available = cyme::trait_register<T, cyme::__GETSIMD__()>::count;
+
+    typedef cyme::expression_info<decltype((a + b) / (c - d))> info;
+    BOOST_CHECK_EQUAL(int(info::registers), 3 * n);
+    BOOST_CHECK_EQUAL(bool(info::spill), 3 * n > available);
+
+    // a balanced tree of 128 leaves, 8 registers per vec_simd
+    typedef decltype((a + b) * (c + d)) t2;
+    typedef decltype(std::declval<t2>() * std::declval<t2>()) t3;
+    typedef decltype(std::declval<t3>() * std::declval<t3>()) t4;
+    typedef decltype(std::declval<t4>() * std::declval<t4>()) t5;
+    typedef decltype(std::declval<t5>() * std::declval<t5>()) t6;
+    typedef decltype(std::declval<t6>() * std::declval<t6>()) t7;
+    typedef cyme::expression_info<t7> balanced;
+    BOOST_CHECK_EQUAL(int(balanced::registers), 8 * n);
+    BOOST_CHECK_EQUAL(int(balanced::depth), 7);
+    BOOST_CHECK_EQUAL(bool(balanced::spill), 8 * n > available);
+
+    std::ostringstream out;
+    print_info((a + b) / (c - d), out);
+    BOOST_CHECK(out.str().find("div 1") != std::string::npos);
+    BOOST_CHECK(out.str().find("depth 2") != std::string::npos);
+    check_spill(a + b); // no warning
+}
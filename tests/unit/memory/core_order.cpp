@@ -0,0 +1,84 @@
+/*
+ * Cyme - core_order.cpp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+#include <tests/unit/test_header.hpp>
+
+using namespace cyme::test;
+
+/** the Sethi-Ullman numbers of the trees, before the macros of the block types */
+template <class T>
+void check_registers() {
+    typedef cyme::vec<T, cyme::__GETSIMD__()> vec_type;
+    vec_type a(T(1)), b(T(2)), c(T(3)), d(T(4));
+
+    BOOST_CHECK((cyme::vertex_registers<typename vec_type::base_type>::value == 1));
+    BOOST_CHECK((cyme::vertex_registers<typename decltype(a + b)::base_type>::value == 2));
+    // left-deep chain, a register more is never needed
+    BOOST_CHECK((cyme::vertex_registers<typename decltype(((a + b) + c) + d)::base_type>::value == 2));
+    // balanced tree
+    BOOST_CHECK((cyme::vertex_registers<typename decltype((a + b) * (c + d))::base_type>::value == 3));
+    // right-deep chain, the deeper operand first
+    BOOST_CHECK((cyme::vertex_registers<typename decltype(a / (b / (c / d)))::base_type>::value == 2));
+    BOOST_CHECK((cyme::vertex_registers<typename decltype(exp(a + b) - c)::base_type>::value == 2));
+
+    // the right operand first only if the left one is not a leaf and the source order exceeds the registers
+    typedef typename vec_type::base_type leaf;
+    typedef typename decltype(a + b)::base_type pair;
+    typedef typename decltype((a + b) * (c + d))::base_type four;
+    typedef typename decltype(((a + b) * (c + d)) / ((a - b) * (c - d)))::base_type eight;
+    typedef typename decltype((((a + b) * (c + d)) / ((a - b) * (c - d))) -
+                              (((a * b) + (c * d)) * ((a / b) + (c / d))))::base_type sixteen;
+    const int n = cyme::unroll_factor::N;
+    const int available = cyme::trait_register<T, cyme::__GETSIMD__()>::count;
+    BOOST_CHECK((cyme::vertex_registers<sixteen>::value == 5));
+    BOOST_CHECK((!cyme::vertex_order<T, cyme::__GETSIMD__(), n, leaf, sixteen>::swap));
+    BOOST_CHECK((!cyme::vertex_order<T, cyme::__GETSIMD__(), n, pair, pair>::swap));
+    BOOST_CHECK((!cyme::vertex_order<T, cyme::__GETSIMD__(), n, sixteen, pair>::swap));
+    BOOST_CHECK_EQUAL(bool(cyme::vertex_order<T, cyme::__GETSIMD__(), n, pair, four>::swap), 4 * n > available);
+    BOOST_CHECK_EQUAL(bool(cyme::vertex_order<T, cyme::__GETSIMD__(), n, pair, sixteen>::swap), 6 * n > available);
+    BOOST_CHECK_EQUAL(bool(cyme::vertex_order<T, cyme::__GETSIMD__(), n, four, eight>::swap), 5 * n > available);
+}
+
+#define TYPE typename T::value_type
+#define N T::n
+#define ORDER T::order
+
+template <class T, size_t M>
+struct synapse {
+    typedef T value_type;
+    static const size_t value_size = M;
+};
+
+/** deep trees, the right operand is the deeper one */
+struct f_deep {
+    template <class S>
+    void operator()(S &W) const {
+        S const &R = W;
+        W[0] = R[1] / (R[2] / (R[3] / (R[4] / (R[5] + R[1]))));
+        W[2] = R[1] - (R[2] * (R[3] - (R[4] * (R[5] - R[3] * R[4]))));
+        W[3] = (R[1] + R[2]) / ((R[3] + R[4]) * (R[5] - (R[1] * R[2]) / (R[4] + R[5])));
+        W[4] = R[1] * (R[2] + R[3] * R[4]) + exp(R[5] - R[1] * 0.5);
+    }
+};
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(core_order_registers, T, full_test_types) { check_registers<T>(); }
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(core_order_deep_trees, T, floating_point_block_types) {
+    run<synapse<TYPE, N>, ORDER>(f_deep());
+}
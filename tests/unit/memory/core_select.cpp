@@ -0,0 +1,102 @@
+/*
+ * Cyme - core_select.cpp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+#include <tests/unit/test_header.hpp>
+
+using namespace cyme::test;
+
+#define TYPE typename T::value_type
+#define N T::n
+
+template <class T, size_t M>
+struct synapse {
+    typedef T value_type;
+    static const size_t value_size = M;
+};
+
+/** the kernels on the AoSoA layout, the references are the scalar loops */
+struct f_compare {
+    template <class S>
+    void operator()(S &W) const {
+        S const &R = W;
+        W[0] = where(R[1] <= R[2], R[1], R[2]);
+        W[3] = where(R[4] >= 1., R[4], 0.);
+        W[4] = where(R[1] != R[2], 1., R[5]);
+        W[5] = where(R[2] > R[1], R[1] * R[2], 2.);
+    }
+};
+
+struct f_max_clamp {
+    template <class S>
+    void operator()(S &W) const {
+        S const &R = W;
+        W[0] = max(R[1], R[2]) + min(R[3], 1.5);
+        W[3] = clamp(R[4] * 2., 1., 3.);
+        W[4] = clamp(R[5], R[1], R[1] + R[2]);
+        W[5] = max(0.75, R[2]);
+    }
+};
+
+/** the safe division of the rates, v/(1-exp(-v)) is 1 when v tends to 0 */
+struct f_safe_division {
+    template <class S>
+    void operator()(S &W) const {
+        S const &R = W;
+        W[0] = where(fabs(R[1]) < 1e-6, 1., R[1] / (1. - exp(-R[1])));
+    }
+};
+
+/** the reference g(v, i) computes the element i of the AoS vector, where, max, clamp are SIMD only */
+template <class T, class F, class G>
+void run_select(F f, G g) {
+    typedef synapse<TYPE, N> S;
+    run<S, cyme::AoSoA>(f,
+                        [g](cyme::vector<S, cyme::AoS> &v) {
+                            for (std::size_t i = 0; i < v.size(); ++i)
+                                g(v, i);
+                        },
+                        [](cyme::vector<S, cyme::AoS> &a, cyme::vector<S, cyme::AoSoA> &b) {
+                            for (std::size_t i = 0; i < a.size(); i += 7) // equal fields and zeros
+                                a(i, 2) = b(i, 2) = a(i, 1) = b(i, 1) = (i % 2) ? TYPE(0) : TYPE(1);
+                        });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(core_select_compare, T, floating_point_block_types) {
+    run_select<T>(f_compare(), [](cyme::vector<synapse<TYPE, N>, cyme::AoS> &v, std::size_t i) {
+        v(i, 0) = (v(i, 1) <= v(i, 2)) ? v(i, 1) : v(i, 2);
+        v(i, 3) = (v(i, 4) >= 1.) ? v(i, 4) : 0.;
+        v(i, 4) = (v(i, 1) != v(i, 2)) ? 1. : v(i, 5);
+        v(i, 5) = (v(i, 2) > v(i, 1)) ? v(i, 1) * v(i, 2) : 2.;
+    });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(core_select_max_clamp, T, floating_point_block_types) {
+    run_select<T>(f_max_clamp(), [](cyme::vector<synapse<TYPE, N>, cyme::AoS> &v, std::size_t i) {
+        v(i, 0) = std::max(v(i, 1), v(i, 2)) + std::min<TYPE>(v(i, 3), 1.5);
+        v(i, 3) = std::min<TYPE>(std::max<TYPE>(v(i, 4) * 2., 1.), 3.);
+        v(i, 4) = std::min(std::max(v(i, 5), v(i, 1)), v(i, 1) + v(i, 2));
+        v(i, 5) = std::max<TYPE>(0.75, v(i, 2));
+    });
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(core_select_safe_division, T, floating_point_block_types) {
+    run_select<T>(f_safe_division(), [](cyme::vector<synapse<TYPE, N>, cyme::AoS> &v, std::size_t i) {
+        v(i, 0) = (std::fabs(v(i, 1)) < 1e-6) ? 1. : v(i, 1) / (1. - std::exp(-v(i, 1)));
+    });
+}
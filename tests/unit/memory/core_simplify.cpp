@@ -0,0 +1,135 @@
+/*
+ * Cyme - core_simplify.cpp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+#include <tests/unit/test_header.hpp>
+
+using namespace cyme::test;
+
+/** the simplified vertex types, before the macros of the block types */
+template <class T>
+void check_trees() {
+    typedef cyme::vec<T, cyme::__GETSIMD__()> vec_type;
+    typedef typename vec_type::base_type simd_type;
+    typedef cyme::vec_scalar<T, cyme::__GETSIMD__(), cyme::unroll_factor::N> scalar_type;
+    vec_type a(T(1)), b(T(2));
+
+    // one scalar vertex for a chain of scalars
+    BOOST_CHECK((std::is_same<typename decltype(2. * (3. * (a * 0.5)) / 4.)::base_type,
+                              cyme::vec_mul<T, cyme::__GETSIMD__(), cyme::unroll_factor::N, scalar_type,
+                                            simd_type>>::value));
+    BOOST_CHECK((std::is_same<typename decltype(1. + (a + 2.) - 0.5)::base_type,
+                              cyme::vec_add<T, cyme::__GETSIMD__(), cyme::unroll_factor::N, scalar_type,
+                                            simd_type>>::value));
+    // no vertex for the compile time identities
+    static_assert(std::is_same<decltype(a * cyme::one), vec_type>::value, "a*1 must be a");
+    static_assert(std::is_same<decltype(cyme::one * (a + b)), decltype(a + b)>::value, "1*(a+b) must be a+b");
+    static_assert(std::is_same<decltype((a * b) / cyme::one), decltype(a * b)>::value, "(a*b)/1 must be a*b");
+    static_assert(std::is_same<decltype(a + cyme::zero), vec_type>::value, "a+0 must be a");
+    static_assert(std::is_same<decltype(cyme::zero + exp(a)), decltype(exp(a))>::value, "0+exp(a) must be exp(a)");
+    static_assert(std::is_same<decltype((a - b) - cyme::zero), decltype(a - b)>::value, "(a-b)-0 must be a-b");
+    // no negate vertex
+    BOOST_CHECK((std::is_same<typename decltype(-(-a))::base_type, simd_type>::value));
+    BOOST_CHECK((std::is_same<typename decltype(-(2. * a))::base_type,
+                              cyme::vec_mul<T, cyme::__GETSIMD__(), cyme::unroll_factor::N, scalar_type,
+                                            simd_type>>::value));
+    // one exp vertex
+    BOOST_CHECK((std::is_same<typename decltype(exp(a) * exp(b))::base_type,
+                              cyme::vec_exp_add<T, cyme::__GETSIMD__(), cyme::unroll_factor::N, simd_type,
+                                                simd_type>>::value));
+}
+
+#define TYPE typename T::value_type
+#define N T::n
+#define ORDER T::order
+
+template <class T, size_t M>
+struct synapse {
+    typedef T value_type;
+    static const size_t value_size = M;
+};
+
+struct f_chain {
+    template <class S>
+    void operator()(S &W) const {
+        S const &R = W;
+        W[0] = 2. * (3. * (R[1] * 0.5)) / 4.;
+        W[2] = 1. + (R[1] + 2.) - 0.5;
+        W[3] = 5. - (R[2] - 1.);
+    }
+};
+
+struct f_identity {
+    template <class S>
+    void operator()(S &W) const {
+        S const &R = W;
+        W[0] = cyme::one * R[1];
+        W[2] = R[1] + cyme::zero;
+        W[3] = (cyme::zero + R[3] - cyme::zero) * cyme::one / cyme::one;
+    }
+};
+
+struct f_negate {
+    template <class S>
+    void operator()(S &W) const {
+        S const &R = W;
+        W[0] = -(-R[1]);
+        W[2] = -(2. * R[1]) + R[2];
+        W[3] = -(-(3. * R[3]));
+    }
+};
+
+struct f_exp {
+    template <class S>
+    void operator()(S &W) const {
+        S const &R = W;
+        W[0] = exp(R[1]) * exp(R[2]);
+        W[3] = exp(R[1] * 0.5) * exp(-R[3]) + R[2];
+    }
+};
+
+/** rate of the Na channel */
+struct f_rate {
+    template <class S>
+    void operator()(S &W) const {
+        S const &R = W;
+        W[0] = (0.182 * (R[1] + 35.0)) / (1. - (exp((-35.0 - R[1]) / 9.0)));
+    }
+};
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(core_simplify_scalar_chain, T, floating_point_block_types) {
+    run<synapse<TYPE, N>, ORDER>(f_chain());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(core_simplify_identity, T, floating_point_block_types) {
+    run<synapse<TYPE, N>, ORDER>(f_identity());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(core_simplify_negate, T, floating_point_block_types) {
+    run<synapse<TYPE, N>, ORDER>(f_negate());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(core_simplify_exp, T, floating_point_block_types) {
+    run<synapse<TYPE, N>, ORDER>(f_exp());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(core_simplify_rate, T, floating_point_block_types) {
+    run<synapse<TYPE, N>, ORDER>(f_rate());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(core_simplify_trees, T, full_test_types) { check_trees<T>(); }
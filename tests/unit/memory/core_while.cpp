@@ -0,0 +1,121 @@
+/*
+ * Cyme - core_while.cpp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+#include <vector>
+#include <tests/unit/test_header.hpp>
+
+using namespace cyme::test;
+
+/** the iterations of x += step until x >= limit, exact in floating point, a count per item */
+template <class T>
+int steps(T x, T step) {
+    int n = 0;
+    for (; x < T(1000); x += step)
+        ++n;
+    return n;
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(core_while_lanes, T, full_test_types) {
+    const int n = cyme::elems_helper<T, cyme::unroll_factor::N>::size;
+    T a[n] __attribute__((aligned(64)));
+    T b[n] __attribute__((aligned(64)));
+    T r[n] __attribute__((aligned(64)));
+    std::uniform_int_distribution<int> value(1, 100);
+    for (int i = 0; i < n; ++i) {
+        a[i] = T(value(rng));
+        b[i] = T(value(rng));
+    }
+    a[n / 2] = T(2000); // a lane inactive from the start
+
+    cyme::vec<T> x(static_cast<T const *>(a)), step(static_cast<T const *>(b)), count(T(0)); // no store to a, b
+    int iterations = 0;
+    cyme::simd_while([&] { return cyme::vec<T>(x < T(1000)); },
+                     [&](cyme::vec<T> const &active) {
+                         x = where(active, x + step, x);
+                         count = where(active, count + T(1), count);
+                         ++iterations;
+                     });
+    count.rep().store(r);
+
+    int longest = 0;
+    for (int i = 0; i < n; ++i) {
+        BOOST_CHECK_EQUAL(r[i], T(steps(a[i], b[i])));
+        longest = std::max(longest, steps(a[i], b[i]));
+    }
+    BOOST_CHECK_EQUAL(iterations, longest); // stops when the last lane is done
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(core_while_empty, T, full_test_types) {
+    cyme::vec<T> x(T(2000));
+    int iterations = 0;
+    cyme::simd_while([&] { return cyme::vec<T>(x < T(1000)); }, [&](cyme::vec<T> const &) { ++iterations; });
+    BOOST_CHECK_EQUAL(iterations, 0);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(core_while_refill, T, full_test_types) {
+    const int n = cyme::elems_helper<T, cyme::unroll_factor::N>::size;
+    const int size = 1031;
+    std::vector<T> a(size), b(size);
+    std::vector<int> res(size, -1);
+    std::uniform_int_distribution<int> value(1, 100);
+    for (int i = 0; i < size; ++i) {
+        a[i] = T(value(rng));
+        b[i] = T(value(rng));
+    }
+
+    // the state of the lanes, in memory
+    T x[n] __attribute__((aligned(64)));
+    T step[n] __attribute__((aligned(64)));
+    T count[n] __attribute__((aligned(64)));
+    int item[n];
+    int next = 0;
+    auto load = [&](int l) {
+        if (next == size)
+            return false;
+        x[l] = a[next];
+        step[l] = b[next];
+        count[l] = T(0);
+        item[l] = next++;
+        return true;
+    };
+    for (int l = 0; l < n; ++l)
+        load(l);
+
+    int iterations = 0;
+    cyme::simd_while([&] { return cyme::vec<T>(cyme::vec<T>(static_cast<T const *>(x)) < T(1000)); },
+                     [&](cyme::vec<T> const &active) {
+                         cyme::vec<T> vx(x), vcount(count);
+                         vx = where(active, vx + cyme::vec<T>(static_cast<T const *>(step)), vx);
+                         vcount = where(active, vcount + T(1), vcount);
+                         ++iterations;
+                     },
+                     [&](int l) {
+                         res[item[l]] = static_cast<int>(count[l]);
+                         return load(l);
+                     });
+
+    int total = 0, longest = 0;
+    for (int i = 0; i < size; ++i) {
+        BOOST_CHECK_EQUAL(res[i], steps(a[i], b[i]));
+        total += steps(a[i], b[i]);
+        longest = std::max(longest, steps(a[i], b[i]));
+    }
+    // the lanes are full until the queue is empty, then the longest item at most
+    BOOST_CHECK(iterations <= (total + n - 1) / n + longest);
+}
@@ -0,0 +1,195 @@
+/*
+ * Cyme - dual.cpp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+#include <tests/unit/test_header.hpp>
+
+using namespace cyme::test;
+
+/** the functions, for a dual or a double (the reference) */
+struct f_exp_log {
+    template <class D>
+    static D f(D const &x) {
+        using std::exp;
+        using std::log;
+        return exp(-0.062 * x) * log(x + 2.) - x;
+    }
+};
+
+struct f_div {
+    template <class D>
+    static D f(D const &x) {
+        using std::exp;
+        return (x - 3.) / (1. + exp(x / 5.)) + 1. / x;
+    }
+};
+
+struct f_pow_sqrt {
+    template <class D>
+    static D f(D const &x) {
+        using std::pow;
+        using std::sqrt;
+        return pow(x, D(1.7)) + 2. * sqrt(x) * x;
+    }
+};
+
+struct f_sin_cos {
+    template <class D>
+    static D f(D const &x) {
+        using std::sin;
+        using std::cos;
+        D y = sin(x);
+        y *= cos(2. * x);
+        y -= x * x;
+        return y;
+    }
+};
+
+struct f_min_max_fabs {
+    template <class D>
+    static D f(D const &x) {
+        using std::max;
+        using std::min;
+        using std::fabs;
+        return max(x * x, D(2.)) + min(x, D(1.)) * 3. + fabs(x - 1.5);
+    }
+};
+
+/** the derivative of the reference, central difference in double */
+template <class F>
+double derivative(double x) {
+    const double h = 1e-5;
+    return (F::f(x + h) - F::f(x - h)) / (2. * h);
+}
+
+template <class T>
+bool close(T a, double b) {
+    const double tolerance = (sizeof(T) == 4) ? 1e-4 : 1e-6; // the SIMD sin and cos in double
+    return std::fabs(a - b) <= tolerance * (1. + std::fabs(b));
+}
+
+/** the functions on the registers (AoSoA) and on the basic types (AoS) */
+template <class T, class F>
+void check_function() {
+    const int n = cyme::elems_helper<T, cyme::unroll_factor::N>::size;
+    T a[n] __attribute__((aligned(64)));
+    T value[n] __attribute__((aligned(64)));
+    T slope[n] __attribute__((aligned(64)));
+    std::uniform_real_distribution<T> x(0.5, 2.5);
+    for (int i = 0; i < n; ++i)
+        a[i] = x(rng);
+    a[0] = T(1.25); // not on a kink of min, max or fabs
+
+    typedef cyme::dual<T, cyme::AoSoA> dual_simd;
+    const dual_simd y = F::f(dual_simd::variable(cyme::vec<T>(static_cast<T const *>(a))));
+    cyme::vec<T> v(value), s(slope);
+    v = y.value();
+    s = y.derivative();
+
+    typedef cyme::dual<T, cyme::AoS> dual_serial;
+    for (int i = 0; i < n; ++i) {
+        const dual_serial z = F::f(dual_serial::variable(a[i]));
+        BOOST_CHECK(close(value[i], F::f(double(a[i]))));
+        BOOST_CHECK(close(slope[i], derivative<F>(a[i])));
+        BOOST_CHECK(close(z.value(), F::f(double(a[i]))));
+        BOOST_CHECK(close(z.derivative(), derivative<F>(a[i])));
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(dual_functions, T, full_test_types) {
+    check_function<T, f_exp_log>();
+    check_function<T, f_div>();
+    check_function<T, f_pow_sqrt>();
+    check_function<T, f_sin_cos>();
+    check_function<T, f_min_max_fabs>();
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(dual_where, T, full_test_types) {
+    const int n = cyme::elems_helper<T, cyme::unroll_factor::N>::size;
+    T a[n] __attribute__((aligned(64)));
+    T slope[n] __attribute__((aligned(64)));
+    for (int i = 0; i < n; ++i)
+        a[i] = T(i % 2 ? 2 : -2);
+
+    typedef cyme::dual<T, cyme::AoSoA> dual_simd;
+    const dual_simd x = dual_simd::variable(cyme::vec<T>(static_cast<T const *>(a)));
+    cyme::vec<T> s(slope);
+    s = where(x.value() < T(0), x * x, 3. * x).derivative();
+
+    typedef cyme::dual<T, cyme::AoS> dual_serial;
+    for (int i = 0; i < n; ++i) {
+        const dual_serial z = dual_serial::variable(a[i]);
+        BOOST_CHECK_EQUAL(slope[i], (a[i] < 0) ? 2 * a[i] : T(3));
+        BOOST_CHECK_EQUAL(where(z.value() < T(0), z * z, 3. * z).derivative(), slope[i]);
+    }
+}
+
+/** the current of an AMPA/NMDA synapse (sandbox/main_s.cpp) and its conductance dI/dv in one pass */
+enum properties { A_AMPA, B_AMPA, A_NMDA, B_NMDA, e, mg, i, v, _g };
+
+template <class S>
+void synapse_current(S &W) {
+    typedef typename S::value_type value_type;
+    typedef cyme::dual<value_type, S::MemoryOrder> dual_type;
+    S const &R = W;
+    const dual_type x = dual_type::variable(R[v]);
+    const dual_type mggate = 1. / (1. + exp(-0.062 * x) * (R[mg] / 3.57));
+    const dual_type current = 1.1 * (R[B_AMPA] - R[A_AMPA]) * (x - R[e]) +
+                              1.1 * (R[B_NMDA] - R[A_NMDA]) * mggate * (x - R[e]);
+    W[i] = current.value();
+    W[_g] = current.derivative();
+}
+
+double synapse_reference(double const *p, double x) {
+    const double mggate = 1. / (1. + std::exp(-0.062 * x) * (p[mg] / 3.57));
+    return 1.1 * (p[B_AMPA] - p[A_AMPA]) * (x - p[e]) + 1.1 * (p[B_NMDA] - p[A_NMDA]) * mggate * (x - p[e]);
+}
+
+template <class T, size_t M>
+struct synapse {
+    typedef T value_type;
+    static const size_t value_size = M;
+};
+
+#define TYPE typename T::value_type
+#define N T::n
+#define ORDER T::order
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(dual_synapse, T, floating_point_block_types) {
+    const std::size_t size = 1031;
+    cyme::vector<synapse<TYPE, N>, ORDER> c(size);
+    std::uniform_real_distribution<TYPE> random(0, 1), potential(-80, 40);
+    for (std::size_t k = 0; k < size; ++k) {
+        for (std::size_t j = 0; j < N; ++j)
+            c(k, j) = random(rng);
+        c(k, v) = potential(rng);
+    }
+
+    for (typename cyme::vector<synapse<TYPE, N>, ORDER>::iterator it = c.begin(); it != c.end(); ++it)
+        synapse_current(*it);
+
+    for (std::size_t k = 0; k < size; ++k) {
+        double p[_g + 1];
+        for (std::size_t j = 0; j <= _g; ++j)
+            p[j] = c(k, j);
+        const double h = 1e-4;
+        const double slope = (synapse_reference(p, p[v] + h) - synapse_reference(p, p[v] - h)) / (2. * h);
+        BOOST_CHECK(close(c(k, i), synapse_reference(p, p[v])));
+        BOOST_CHECK(close(c(k, _g), slope));
+    }
+}
@@ -126,3 +126,62 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(simd_gather_scatter_comparison_reverse_div, T, flo
     for (size_t i = 0; i < NN; ++i)
         BOOST_REQUIRE_CLOSE(c[i], b[i], 0.001);
 }
+
+template <class T>
+void parallel_scatter_test(std::size_t range, std::size_t size, cyme::scatter_strategy strategy, std::size_t threads) {
+    std::vector<T> src(range);
+    std::vector<T> dst(size);
+    std::vector<T> ref(size);
+    std::vector<int> ind(range);
+    std::uniform_int_distribution<int> node(0, size - 1);
+    std::uniform_real_distribution<T> current(0, 1); // no cancellation, the tolerance stays relative
+
+    for (std::size_t i = 0; i < range; ++i) {
+        src[i] = current(rng);
+        ind[i] = node(rng); // overlapping indices
+    }
+    for (std::size_t k = 0; k < size; ++k)
+        dst[k] = ref[k] = current(rng);
+
+    for (std::size_t i = 0; i < range; ++i)
+        ref[ind[i]] += src[i];
+
+    cyme::parallel_scatter<T, cyme::add>(&src[0], &dst[0], &ind[0], range, size, threads, strategy);
+
+    for (std::size_t k = 0; k < size; ++k) {
+        if (strategy == cyme::scatter_owner)
+            BOOST_REQUIRE_EQUAL(ref[k], dst[k]); // serial order
+        else
+            BOOST_REQUIRE_CLOSE(ref[k], dst[k], 0.01);
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(parallel_scatter_private, T, full_test_types) {
+    parallel_scatter_test<T>(100000, 1001, cyme::scatter_private, 4);
+    parallel_scatter_test<T>(100000, 3, cyme::scatter_private, 7);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(parallel_scatter_owner, T, full_test_types) {
+    parallel_scatter_test<T>(1000, 100003, cyme::scatter_owner, 4);
+    parallel_scatter_test<T>(1000, 3, cyme::scatter_owner, 7);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(parallel_scatter_auto, T, full_test_types) {
+    parallel_scatter_test<T>(50000, 999, cyme::scatter_auto, 0);
+    parallel_scatter_test<T>(999, 50000, cyme::scatter_auto, 0);
+    parallel_scatter_test<T>(999, 50000, cyme::scatter_auto, 1);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(parallel_scatter_sub, T, full_test_types) {
+    T src[4] = {1, 2, 3, 4};
+    T dst[2] = {10, 10};
+    int ind[4] = {0, 1, 0, 1};
+
+    cyme::parallel_scatter<T, cyme::sub>(src, dst, ind, 4, 2, 2, cyme::scatter_private);
+    BOOST_CHECK_EQUAL(dst[0], 6);
+    BOOST_CHECK_EQUAL(dst[1], 4);
+
+    cyme::parallel_scatter<T, cyme::sub>(src, dst, ind, 4, 2, 2, cyme::scatter_owner);
+    BOOST_CHECK_EQUAL(dst[0], 2);
+    BOOST_CHECK_EQUAL(dst[1], -2);
+}
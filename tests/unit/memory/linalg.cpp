@@ -0,0 +1,165 @@
+/*
+ * Cyme - linalg.cpp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+#include <tests/unit/test_header.hpp>
+
+using namespace cyme::test;
+
+template <class T>
+bool close(T a, double b) {
+    const double tolerance = (sizeof(T) == 4) ? 1e-4 : 1e-10;
+    return std::fabs(a - b) <= tolerance * (1. + std::fabs(b));
+}
+
+/** a block of the fields a (M x M), c (M x M), b (M) and the results r (M x M), random diagonally dominant a */
+template <class T, std::size_t M>
+struct fields_block {
+    static const int n = cyme::elems_helper<T, cyme::unroll_factor::N>::size;
+    static const std::size_t a = 0, c = M * M, b = 2 * M * M, r = 2 * M * M + M, fields = 3 * M * M + M;
+    T data[fields * n] __attribute__((aligned(64)));
+
+    fields_block() {
+        std::uniform_real_distribution<T> random(-1, 1);
+        for (std::size_t k = 0; k < fields * n; ++k)
+            data[k] = random(rng);
+        for (int l = 0; l < n; ++l)
+            for (std::size_t i = 0; i < M; ++i)
+                (*this)(a + i * M + i, l) += T(M) * (i % 2 ? 1 : -1);
+    }
+
+    /** the field i of the lane l */
+    T &operator()(std::size_t i, int l) { return data[i * n + l]; }
+
+    /** the fields, as a AoSoA block */
+    cyme::vec<T, cyme::__GETSIMD__()> operator[](std::size_t i) {
+        return cyme::vec<T, cyme::__GETSIMD__()>(&data[i * n]);
+    }
+
+    const cyme::vec<T, cyme::__GETSIMD__()> operator[](std::size_t i) const {
+        return cyme::vec<T, cyme::__GETSIMD__()>(static_cast<T const *>(&data[i * n]));
+    }
+};
+
+/** a x = b, a x, a c and the triangular solves of the factors, against double on the lanes */
+template <class T, std::size_t M>
+void check_system() {
+    typedef fields_block<T, M> S;
+    typedef cyme::small_matrix<T, M> matrix_type;
+    typedef cyme::small_vector<T, M> vector_type;
+    S s;
+    const matrix_type a(s, S::a), c(s, S::c);
+    const vector_type b(s, S::b);
+
+    cyme::small_lu<T, M>(a).solve(b).store(s, S::r);
+    for (int l = 0; l < S::n; ++l)
+        for (std::size_t i = 0; i < M; ++i) { // the residual a x - b
+            double residual = -double(s(S::b + i, l));
+            for (std::size_t j = 0; j < M; ++j)
+                residual += double(s(S::a + i * M + j, l)) * s(S::r + j, l);
+            BOOST_CHECK(close(T(residual), 0.));
+        }
+
+    (a * b).store(s, S::r);
+    for (int l = 0; l < S::n; ++l)
+        for (std::size_t i = 0; i < M; ++i) {
+            double y = 0;
+            for (std::size_t j = 0; j < M; ++j)
+                y += double(s(S::a + i * M + j, l)) * s(S::b + j, l);
+            BOOST_CHECK(close(s(S::r + i, l), y));
+        }
+
+    (a * c).store(s, S::r);
+    for (int l = 0; l < S::n; ++l)
+        for (std::size_t i = 0; i < M; ++i)
+            for (std::size_t j = 0; j < M; ++j) {
+                double y = 0;
+                for (std::size_t k = 0; k < M; ++k)
+                    y += double(s(S::a + i * M + k, l)) * s(S::c + k * M + j, l);
+                BOOST_CHECK(close(s(S::r + i * M + j, l), y));
+            }
+
+    // L y = b then U x = y with the factors, the same x as solve
+    const cyme::small_lu<T, M> lu(a);
+    matrix_type lower(T(1));
+    for (std::size_t i = 0; i < M; ++i)
+        for (std::size_t j = 0; j < i; ++j)
+            lower(i, j) = lu.factors()(i, j);
+    upper_solve(lu.factors(), lower_solve(lower, b)).store(s, S::r);
+    lu.solve(b).store(s, S::r + M);
+    for (int l = 0; l < S::n; ++l)
+        for (std::size_t i = 0; i < M; ++i)
+            BOOST_CHECK(close(s(S::r + i, l), s(S::r + M + i, l)));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(small_system, T, full_test_types) {
+    check_system<T, 3>();
+    check_system<T, 5>();
+    check_system<T, 10>();
+}
+
+/** the implicit step of a kinetic scheme of 3 states, (I - dt Q) x = x0, a solve per instance */
+enum properties { q01, q10, q12, q21, a00, a01, a02, a10, a11, a12, a20, a21, a22, x0, x1, x2 };
+
+template <class S>
+void kinetic(S &W) {
+    typedef typename S::value_type value_type;
+    S const &R = W;
+    W[a00] = 1. + 0.1 * R[q01];
+    W[a01] = -0.1 * R[q10];
+    W[a02] = 0. * R[q01]; // the zeros of the tridiagonal matrix
+    W[a10] = -0.1 * R[q01];
+    W[a11] = 1. + 0.1 * (R[q10] + R[q12]);
+    W[a12] = -0.1 * R[q21];
+    W[a20] = 0. * R[q01];
+    W[a21] = -0.1 * R[q12];
+    W[a22] = 1. + 0.1 * R[q21];
+    const cyme::small_matrix<value_type, 3, S::MemoryOrder> a(R, a00);
+    const cyme::small_vector<value_type, 3, S::MemoryOrder> x(R, x0);
+    cyme::small_lu<value_type, 3, S::MemoryOrder>(a).solve(x).store(W, x0);
+}
+
+template <class T, size_t M>
+struct channel {
+    typedef T value_type;
+    static const size_t value_size = M;
+};
+
+#define TYPE typename T::value_type
+#define ORDER T::order
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(small_system_kinetic, T, floating_point_block_types) {
+    const std::size_t size = 1031;
+    cyme::vector<channel<TYPE, x2 + 1>, ORDER> c(size), v(size);
+    std::uniform_real_distribution<TYPE> random(0, 1);
+    for (std::size_t k = 0; k < size; ++k)
+        for (std::size_t j = 0; j <= x2; ++j)
+            v(k, j) = c(k, j) = random(rng);
+
+    for (typename cyme::vector<channel<TYPE, x2 + 1>, ORDER>::iterator it = c.begin(); it != c.end(); ++it)
+        kinetic(*it);
+
+    for (std::size_t k = 0; k < size; ++k) {
+        const double dt = 0.1;
+        const double a[3][3] = {{1 + dt * v(k, q01), -dt * v(k, q10), 0},
+                                {-dt * v(k, q01), 1 + dt * (v(k, q10) + v(k, q12)), -dt * v(k, q21)},
+                                {0, -dt * v(k, q12), 1 + dt * v(k, q21)}};
+        for (std::size_t i = 0; i < 3; ++i) // the residual
+            BOOST_CHECK(close(TYPE(a[i][0] * c(k, x0) + a[i][1] * c(k, x1) + a[i][2] * c(k, x2) - v(k, x0 + i)), 0.));
+    }
+}
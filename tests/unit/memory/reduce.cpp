@@ -0,0 +1,87 @@
+/*
+ * Cyme - reduce.cpp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+#include <tests/unit/test_header.hpp>
+
+using namespace cyme::test;
+
+#define TYPE typename T::value_type
+#define N T::n
+#define ORDER T::order
+
+template <class T, size_t M>
+struct synapse {
+    typedef T value_type;
+    static const size_t value_size = M;
+};
+
+/** serial references, double accumulation */
+template <class V>
+void serial_reduce(V &v, std::size_t size, std::size_t f, double &sum, double &mn, double &mx, double &dot) {
+    sum = 0;
+    dot = 0;
+    mn = v(0, f);
+    mx = v(0, f);
+    for (std::size_t i = 0; i < size; ++i) {
+        sum += v(i, f);
+        dot += v(i, f) * v(i, 1);
+        mn = std::min<double>(mn, v(i, f));
+        mx = std::max<double>(mx, v(i, f));
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(reduce_serial_comparison, T, floating_point_block_types) {
+    const std::size_t sizes[] = {1, 7, 1031, 100003};
+    std::uniform_real_distribution<TYPE> current(-2, -1); // negative, the padding (0) must be ignored by max
+
+    for (std::size_t s = 0; s < sizeof(sizes) / sizeof(std::size_t); ++s) {
+        cyme::vector<synapse<TYPE, N>, ORDER> v(sizes[s]);
+        for (std::size_t i = 0; i < sizes[s]; ++i)
+            for (std::size_t j = 0; j < N; ++j)
+                v(i, j) = current(rng);
+
+        double sum, mn, mx, dot;
+        serial_reduce(v, sizes[s], 2, sum, mn, mx, dot);
+
+        BOOST_CHECK_CLOSE(cyme::reduce_sum(v, 2), sum, 0.01);
+        BOOST_CHECK_CLOSE(cyme::reduce_dot(v, 2, 1), dot, 0.01);
+        BOOST_CHECK_CLOSE(cyme::reduce_dot(v, 2, v, 1), dot, 0.01);
+        BOOST_CHECK_CLOSE(cyme::reduce_norm2(v, 1), std::sqrt(cyme::reduce_dot(v, 1, 1)), 0.0001);
+        BOOST_CHECK_EQUAL(cyme::reduce_min(v, 2), mn);
+        BOOST_CHECK_EQUAL(cyme::reduce_max(v, 2), mx);
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(reduce_bitwise_reproducible, T, floating_point_block_types) {
+    cyme::vector<synapse<TYPE, N>, ORDER> v(200001);
+    for (std::size_t i = 0; i < 200001; ++i)
+        for (std::size_t j = 0; j < N; ++j)
+            v(i, j) = GetRandom<TYPE>();
+
+    const TYPE sum = cyme::reduce_sum(v, 3, 1);
+    const TYPE dot = cyme::reduce_dot(v, 3, 4, 1);
+    const TYPE norm = cyme::reduce_norm2(v, 3, 1);
+
+    const std::size_t threads[] = {2, 3, 4, 7, 16, 0};
+    for (std::size_t t = 0; t < sizeof(threads) / sizeof(std::size_t); ++t) {
+        BOOST_CHECK_EQUAL(cyme::reduce_sum(v, 3, threads[t]), sum);
+        BOOST_CHECK_EQUAL(cyme::reduce_dot(v, 3, 4, threads[t]), dot);
+        BOOST_CHECK_EQUAL(cyme::reduce_norm2(v, 3, threads[t]), norm);
+    }
+}
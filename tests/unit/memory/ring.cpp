@@ -0,0 +1,105 @@
+/*
+ * Cyme - ring.cpp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+#include <tests/unit/test_header.hpp>
+#include <memory>
+#include <thread>
+
+using namespace cyme::test;
+
+#define TYPE typename T::value_type
+#define N T::n
+
+template <class T, size_t M>
+struct synapse {
+    typedef T value_type;
+    static const size_t value_size = M;
+};
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(ring_alignment, T, floating_point_block_types) {
+    typedef cyme::ring<synapse<TYPE, N>, 4, 3> ring_type;
+    std::unique_ptr<ring_type> r(new ring_type);
+
+    BOOST_CHECK(r->empty());
+    for (std::size_t i = 0; i < ring_type::capacity; ++i) {
+        typename ring_type::iterator it = r->write_acquire();
+        BOOST_CHECK_EQUAL(reinterpret_cast<std::size_t>(it) % ring_type::cache_line, 0);
+        r->write_commit();
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(ring_full_empty, T, floating_point_block_types) {
+    typedef cyme::ring<synapse<TYPE, N>, 4, 2> ring_type;
+    typedef typename ring_type::iterator iterator;
+    std::unique_ptr<ring_type> r(new ring_type);
+
+    BOOST_CHECK(!r->pop([](iterator, iterator) {}));
+
+    for (std::size_t i = 0; i < ring_type::capacity; ++i)
+        BOOST_CHECK(r->push([i](iterator first, iterator last) {
+            for (; first != last; ++first)
+                (*first)(0) = i;
+        }));
+
+    BOOST_CHECK(!r->push([](iterator, iterator) {}));
+    BOOST_CHECK_EQUAL(r->size(), ring_type::capacity);
+
+    for (std::size_t i = 0; i < ring_type::capacity; ++i) { // FIFO
+        TYPE value = -1;
+        BOOST_CHECK(r->pop([&value](iterator first, iterator) { value = (*first)(0); }));
+        BOOST_CHECK_EQUAL(value, i);
+    }
+    BOOST_CHECK(r->empty());
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(ring_producer_consumer, T, floating_point_block_types) {
+    typedef cyme::ring<synapse<TYPE, N>, 8, 4> ring_type;
+    typedef typename ring_type::iterator iterator;
+    const std::size_t steps = 1000;
+    std::unique_ptr<ring_type> r(new ring_type);
+
+    std::thread producer([&r, steps]() {
+        for (std::size_t s = 0; s < steps; ++s)
+            while (!r->push([s](iterator first, iterator last) {
+                for (; first != last; ++first)
+                    for (std::size_t j = 0; j < ring_type::size_block() * ring_type::offset; ++j)
+                        (*first)(j) = s + j % ring_type::offset;
+            }))
+                std::this_thread::yield();
+    });
+
+    // the consumer runs a cyme kernel on the slot and checks it against serial
+    std::size_t errors = 0;
+    for (std::size_t s = 0; s < steps; ++s)
+        while (!r->pop([s, &errors](iterator first, iterator last) {
+            for (iterator it = first; it != last; ++it)
+                (*it)[0] = (*it)[1] * (*it)[2] + (*it)[3];
+            for (; first != last; ++first)
+                for (std::size_t k = 0; k < ring_type::offset; ++k) {
+                    TYPE x = s + k;
+                    if ((*first)(k) != x * x + x)
+                        ++errors;
+                }
+        }))
+            std::this_thread::yield();
+
+    producer.join();
+    BOOST_CHECK_EQUAL(errors, 0);
+    BOOST_CHECK(r->empty());
+}
@@ -0,0 +1,177 @@
+/*
+ * Cyme - runtime.cpp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+#include <sstream>
+#include <tests/unit/test_header.hpp>
+
+using namespace cyme::test;
+
+template <class T, size_t M>
+struct channel {
+    typedef T value_type;
+    static const size_t value_size = M;
+};
+
+/** the fields of the kernels, the first fields of the element */
+static std::vector<std::string> names() {
+    std::vector<std::string> f;
+    f.push_back("v");
+    f.push_back("m");
+    f.push_back("h");
+    f.push_back("g");
+    return f;
+}
+
+/** a Na channel, the rates of Hodgkin-Huxley and an Euler step */
+static const char *na_channel = "# rates\n"
+                                "am = 0.1 * (v + 40) / (1 - exp(-(v + 40) / 10))\n"
+                                "bm = 4 * exp(-(v + 65) / 18)\n"
+                                "ah = 0.07 * exp(-(v + 65) / 20); bh = 1 / (1 + exp(-(v + 35) / 10))\n"
+                                "m = m + dt * (am * (1 - m) - bm * m)\n"
+                                "h = h + dt * (ah * (1 - h) - bh * h)\n"
+                                "g = gbar * m * m * m * h * where(v > 0, 1, sqrt(fabs(v) + 1) / (1 + 0 * v))";
+
+/** the same kernel, compiled */
+template <class T>
+void na_serial(T &v, T &m, T &h, T &g, T dt, T gbar) {
+    const T am = T(0.1) * (v + 40) / (1 - std::exp(-(v + 40) / 10));
+    const T bm = 4 * std::exp(-(v + 65) / 18);
+    const T ah = T(0.07) * std::exp(-(v + 65) / 20);
+    const T bh = 1 / (1 + std::exp(-(v + 35) / 10));
+    m = m + dt * (am * (1 - m) - bm * m);
+    h = h + dt * (ah * (1 - h) - bh * h);
+    g = gbar * m * m * m * h * ((v > 0) ? T(1) : std::sqrt(std::fabs(v) + 1));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(runtime_block, T, full_test_types) {
+    const std::size_t lanes = cyme::elems_helper<T, cyme::unroll_factor::N>::size;
+    cyme::storage<T, 4 * lanes, cyme::AoSoA> b;
+    cyme::storage<T, 4, cyme::AoS> s;
+    for (std::size_t i = 0; i < 4 * lanes; ++i)
+        b(i) = T(i + 1);
+    for (std::size_t i = 0; i < 4; ++i)
+        s(i) = T(i + 1);
+
+    cyme::runtime_kernel<T> k(names());
+    k.compile("g = v * m - h / 2");
+    k(b);
+    k(s);
+    for (std::size_t l = 0; l < lanes; ++l)
+        BOOST_CHECK_CLOSE(b(3 * lanes + l), b(l) * b(lanes + l) - b(2 * lanes + l) / 2, 0.001); // division with rcp
+    BOOST_CHECK_EQUAL(s(3), T(1 * 2 - 3 / 2.));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(runtime_folding_cse, T, full_test_types) {
+    cyme::runtime_kernel<T> k(names());
+    k.constant("c", T(3));
+
+    // 2 * c + 1 is a constant, (v + m) is computed once, the + 0 and the * 1 are removed, h is dead
+    k.compile("t = (v + m) * (2 * c + 1) + 0\n"
+              "h = exp(v)\n"
+              "g = t * 1 + exp(v) / (m + v)\n"
+              "h = h");
+    // load v, load m, add, mul, exp, div, add, store g, store h
+    BOOST_CHECK_EQUAL(k.instructions(), 9u);
+    BOOST_CHECK(k.registers() <= 5u); // the constant 7 and at most 4 registers live together
+
+    std::ostringstream out;
+    k.print(out);
+    BOOST_CHECK(out.str().find("const 7") != std::string::npos);
+
+    // a field assigned with its value is not stored
+    k.compile("v = v\nm = (m)");
+    BOOST_CHECK_EQUAL(k.instructions(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(runtime_sequential, T, full_test_types) {
+    cyme::storage<T, 4, cyme::AoS> s;
+    s(0) = T(1);
+    s(1) = T(2);
+    s(2) = T(-3);
+    s(3) = T(0);
+
+    cyme::runtime_kernel<T> k(names());
+    // the statements are in order, a field read after its assignment has its new value, the stores are at the end
+    k.compile("t = v; v = m; m = t\n"
+              "g = v + m    # 2 + 1\n"
+              "h = max(h, min(v, (m\n"
+              "                   + 10)))");
+    k(s);
+    BOOST_CHECK_EQUAL(s(0), T(2));
+    BOOST_CHECK_EQUAL(s(1), T(1));
+    BOOST_CHECK_EQUAL(s(2), T(2));
+    BOOST_CHECK_EQUAL(s(3), T(3));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(runtime_errors, T, full_test_types) {
+    cyme::runtime_kernel<T> k(names());
+    k.constant("c", T(3));
+    BOOST_CHECK_THROW(k.compile("v = w + 1"), std::runtime_error);           // unknown name
+    BOOST_CHECK_THROW(k.compile("v = tanh(v)"), std::runtime_error);         // unknown function
+    BOOST_CHECK_THROW(k.compile("v = pow(v)"), std::runtime_error);          // arity
+    BOOST_CHECK_THROW(k.compile("v = (v + 1"), std::runtime_error);          // syntax
+    BOOST_CHECK_THROW(k.compile("v = v +"), std::runtime_error);             // syntax
+    BOOST_CHECK_THROW(k.compile("c = v"), std::runtime_error);               // a constant is not assigned
+    BOOST_CHECK_THROW(k.compile("v = v < m"), std::runtime_error);           // a mask is not a value
+    BOOST_CHECK_THROW(k.compile("v = (v < m) + 1"), std::runtime_error);     // a mask is not a value
+    BOOST_CHECK_THROW(k.compile("v = where(v, m, h)"), std::runtime_error);  // the condition is a comparison
+    BOOST_CHECK_THROW(k.compile("v = v m"), std::runtime_error);             // end of the statement
+
+    bool thrown = false; // the line of the error in the message
+    try {
+        k.compile("v = v\nm = 2 * $");
+    } catch (std::runtime_error &e) {
+        thrown = true;
+        BOOST_CHECK(std::string(e.what()).find("line 2") != std::string::npos);
+    }
+    BOOST_CHECK(thrown);
+}
+
+#define TYPE typename T::value_type
+#define N T::n
+#define ORDER T::order
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(runtime_na_channel, T, floating_point_block_types) {
+    const std::size_t size = 1031; // an incomplete AoSoA block, more blocks than a chunk
+    cyme::vector<channel<TYPE, N>, ORDER> c(size);
+    std::vector<TYPE> v(size), m(size), h(size), g(size), other(size);
+    std::uniform_real_distribution<TYPE> potential(-80, 40), gate(0, 1);
+    for (std::size_t i = 0; i < size; ++i) {
+        c(i, 0) = v[i] = potential(rng);
+        c(i, 1) = m[i] = gate(rng);
+        c(i, 2) = h[i] = gate(rng);
+        c(i, 3) = g[i] = TYPE(0);
+        c(i, 4) = other[i] = gate(rng);
+        na_serial(v[i], m[i], h[i], g[i], TYPE(0.025), TYPE(120));
+    }
+
+    cyme::runtime_kernel<TYPE> k(names());
+    k.constant("dt", TYPE(0.025));
+    k.constant("gbar", TYPE(120));
+    k.compile(na_channel);
+    k(c);
+
+    for (std::size_t i = 0; i < size; ++i) {
+        BOOST_CHECK_EQUAL(c(i, 0), v[i]); // not assigned, not stored
+        BOOST_CHECK_CLOSE(c(i, 1), m[i], 0.001);
+        BOOST_CHECK_CLOSE(c(i, 2), h[i], 0.001);
+        BOOST_CHECK_CLOSE(c(i, 3), g[i], 0.001);
+        BOOST_CHECK_EQUAL(c(i, 4), other[i]); // not a field of the kernel
+    }
+}
@@ -0,0 +1,165 @@
+/*
+ * Cyme - shared.cpp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+#include <tests/unit/test_header.hpp>
+#include <vector>
+#include <sys/wait.h>
+
+using namespace cyme::test;
+
+#define TYPE typename T::value_type
+#define N T::n
+
+template <class T, size_t M>
+struct synapse {
+    typedef T value_type;
+    static const size_t value_size = M;
+};
+
+std::string segment_name() { return "/cyme_test_" + boost::lexical_cast<std::string>(getpid()); }
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(shared_create_attach, T, floating_point_block_types) {
+    std::string name = segment_name();
+    cyme::vector<synapse<TYPE, N>, cyme::AoS> vector_a(1024);
+    cyme::shared_vector<synapse<TYPE, N>> vector_b = cyme::shared_vector<synapse<TYPE, N>>::create(name, 1024);
+    cyme::shared_vector<synapse<TYPE, N>> vector_c = cyme::shared_vector<synapse<TYPE, N>>::attach(name);
+
+    BOOST_CHECK(vector_c.attached());
+    BOOST_CHECK_EQUAL(vector_b.size(), vector_c.size());
+    BOOST_CHECK_EQUAL(vector_c.cyme_size(), 1024);
+
+    init(vector_a, vector_b);
+    check(vector_a, vector_c);
+
+    vector_c.detach();
+    BOOST_CHECK(!vector_c.attached());
+    cyme::shared_vector<synapse<TYPE, N>>::unlink(name);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(shared_attach_failure, T, floating_point_block_types) {
+    typedef cyme::shared_vector<synapse<TYPE, N>> shared_type;
+    typedef cyme::shared_vector<synapse<TYPE, N + 1>> other_type;
+    std::string name = segment_name();
+    BOOST_CHECK_THROW(shared_type::attach(name), std::runtime_error);
+
+    // different number of fields
+    other_type vector_a = other_type::create(name, 16);
+    BOOST_CHECK_THROW(shared_type::attach(name), std::runtime_error);
+    shared_type::unlink(name);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(shared_operator_equal, T, floating_point_block_types) {
+    std::string name = segment_name();
+    cyme::vector<synapse<TYPE, N>, cyme::AoS> vector_a(1024);
+    cyme::shared_vector<synapse<TYPE, N>> vector_b = cyme::shared_vector<synapse<TYPE, N>>::create(name, 1024);
+    cyme::shared_vector<synapse<TYPE, N>> vector_c = cyme::shared_vector<synapse<TYPE, N>>::attach(name);
+
+    init(vector_a, vector_b);
+
+    typename cyme::vector<synapse<TYPE, N>, cyme::AoS>::iterator it_AoS = vector_a.begin();
+    for (; it_AoS != vector_a.end(); ++it_AoS)
+        (*it_AoS)[0] = (*it_AoS)[1] * (*it_AoS)[2] + (*it_AoS)[3];
+
+    typename cyme::shared_vector<synapse<TYPE, N>>::iterator it_AoSoA = vector_b.begin();
+    for (; it_AoSoA != vector_b.end(); ++it_AoSoA)
+        (*it_AoSoA)[0] = (*it_AoSoA)[1] * (*it_AoSoA)[2] + (*it_AoSoA)[3];
+
+    check(vector_a, vector_c);
+    cyme::shared_vector<synapse<TYPE, N>>::unlink(name);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(shared_seqlock_snapshot, T, floating_point_block_types) {
+    typedef cyme::shared_vector<synapse<TYPE, N>> shared_type;
+    std::string name = segment_name();
+    shared_type vector_a = shared_type::create(name, 1024, 1);
+    typename shared_type::vector_type vector_b(1024);
+
+    typename shared_type::version_type v = vector_a.read_begin();
+    BOOST_CHECK_EQUAL(v % 2, 0);
+    BOOST_CHECK(!vector_a.read_retry(v));
+
+    BOOST_CHECK_EQUAL(vector_a.write_begin() % 2, 1);
+    for (std::size_t i = 0; i < 1024; ++i)
+        vector_a(i, 0) = i;
+    vector_a.write_end();
+
+    BOOST_CHECK(vector_a.read_retry(v)); // a write occurs
+    BOOST_CHECK_EQUAL(vector_a.version(), v + 2);
+
+    vector_a.snapshot(vector_b);
+    for (std::size_t i = 0; i < 1024; ++i)
+        for (std::size_t j = 0; j < N; ++j)
+            BOOST_CHECK_EQUAL(vector_b(i, j), vector_a(i, j));
+
+    vector_a.write([](shared_type &s) { s(7, 1) = 3; });
+    BOOST_CHECK_EQUAL(vector_a.version(), v + 4);
+
+    TYPE value = 0;
+    vector_a.read([&value](shared_type const &s) { value = s(7, 1); });
+    BOOST_CHECK_EQUAL(value, 3);
+    shared_type::unlink(name);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(shared_multi_process, T, floating_point_block_types) {
+    typedef cyme::shared_vector<synapse<TYPE, N>> shared_type;
+    std::string name = segment_name();
+    shared_type vector_a = shared_type::create(name, 1024);
+
+    pid_t pid = fork();
+    if (pid == 0) { // the child maps the segment by name, writes and leaves, never back into the test runner
+        try {
+            shared_type vector_b = shared_type::attach(name);
+            vector_b.write_begin();
+            for (typename shared_type::iterator it = vector_b.begin(); it != vector_b.end(); ++it)
+                (*it)[1] = (*it)[0] + 2.5;
+            vector_b.write_end();
+        } catch (...) {
+            _exit(1);
+        }
+        _exit(0);
+    }
+
+    int status = -1;
+    waitpid(pid, &status, 0);
+    BOOST_CHECK_EQUAL(status, 0);
+    BOOST_CHECK_EQUAL(vector_a.version(), 4);
+    for (std::size_t i = 0; i < 1024; ++i)
+        BOOST_CHECK_EQUAL(vector_a(i, 1), 2.5);
+    shared_type::unlink(name);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(shared_allocator_policy, T, floating_point_block_types) {
+    typedef cyme::Allocator<TYPE, cyme::Shm_POSIX<TYPE, cyme::__GETSIMD__()>> allocator_type;
+    const std::size_t alignment = cyme::trait_register<TYPE, cyme::__GETSIMD__()>::a;
+    std::vector<TYPE, allocator_type> a(1024, 0);
+
+    BOOST_CHECK_EQUAL(reinterpret_cast<std::size_t>(&a[0]) % alignment, 0);
+
+    pid_t pid = fork();
+    if (pid == 0) { // anonymous shared pages are inherited by the child
+        for (std::size_t i = 0; i < a.size(); ++i)
+            a[i] = i;
+        _exit(0);
+    }
+
+    int status = -1;
+    waitpid(pid, &status, 0);
+    for (std::size_t i = 0; i < a.size(); ++i)
+        BOOST_CHECK_EQUAL(a[i], i);
+}
@@ -0,0 +1,222 @@
+/*
+ * Cyme - tie.cpp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+#include <tests/unit/test_header.hpp>
+
+using namespace cyme::test;
+
+#define TYPE typename T::value_type
+#define N T::n
+#define ORDER T::order
+
+template <class T, size_t M>
+struct synapse {
+    typedef T value_type;
+    static const size_t value_size = M;
+};
+
+/** rates like kernel, W[0] = a/(a+b), W[1] = 1/(a+b), W[2] = exp(a)*(a+b) */
+template <class S>
+void kernel(S &W) {
+    S const &R = W;
+    W[0] = R[3] / (R[3] + R[4]);
+    W[1] = 1. / (R[3] + R[4]);
+    W[2] = exp(R[3]) * (R[3] + R[4]) + exp(R[3]);
+}
+
+template <class S>
+void kernel_tie(S &W) {
+    S const &R = W;
+    cyme::tie(W[0], W[1], W[2]) = cyme::make_tuple(R[3] / (R[3] + R[4]), 1. / (R[3] + R[4]),
+                                                   exp(R[3]) * (R[3] + R[4]) + exp(R[3]));
+}
+
+struct f_kernel {
+    template <class S>
+    void operator()(S &s) const {
+        kernel(s);
+    }
+};
+
+struct f_kernel_tie {
+    template <class S>
+    void operator()(S &s) const {
+        kernel_tie(s);
+    }
+};
+
+struct f_kernel_tie_block {
+    template <class S>
+    void operator()(S &s) const {
+        cyme::register_block<S> W(s);
+        kernel_tie(W);
+    }
+};
+
+struct f_swap {
+    template <class S>
+    void operator()(S &s) const {
+        cyme::register_block<S> W(s);
+        cyme::register_block<S> const &R = W;
+        cyme::tie(W[0], W[1]) = cyme::make_tuple(R[1], R[0]);
+    }
+};
+
+template <class V>
+void fill(V &v) {
+    std::uniform_real_distribution<typename V::value_type> value(0.5, 2); // exp must not overflow
+    for (std::size_t i = 0; i < v.size(); ++i)
+        for (std::size_t j = 0; j < v.size_block(); ++j)
+            v(i, j) = value(rng);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(tie_kernel, T, floating_point_block_types) {
+    cyme::vector<synapse<TYPE, N>, cyme::AoS> vector_a(1031);
+    cyme::vector<synapse<TYPE, N>, ORDER> vector_b(1031);
+    cyme::vector<synapse<TYPE, N>, ORDER> vector_c(1031);
+
+    fill(vector_a);
+    for (std::size_t i = 0; i < vector_a.size(); ++i)
+        for (std::size_t j = 0; j < N; ++j)
+            vector_b(i, j) = vector_c(i, j) = vector_a(i, j);
+
+    std::for_each(vector_a.begin(), vector_a.end(), f_kernel());
+    std::for_each(vector_b.begin(), vector_b.end(), f_kernel_tie());
+    std::for_each(vector_c.begin(), vector_c.end(), f_kernel_tie_block());
+
+    check(vector_a, vector_b);
+    check(vector_a, vector_c);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(tie_evaluate_before_store, T, floating_point_block_types) {
+    cyme::vector<synapse<TYPE, N>, ORDER> v(1031);
+    fill(v);
+    cyme::vector<synapse<TYPE, N>, ORDER> w(v);
+
+    std::for_each(w.begin(), w.end(), f_swap());
+
+    for (std::size_t i = 0; i < v.size(); ++i) {
+        BOOST_CHECK_EQUAL(w(i, 0), v(i, 1));
+        BOOST_CHECK_EQUAL(w(i, 1), v(i, 0));
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(tie_shared_subtrees, T, full_test_types) {
+    typedef cyme::vec<T, cyme::__GETSIMD__()> vec_type;
+    const std::size_t size = sizeof(typename vec_type::base_type) / sizeof(T); // lanes x unroll
+    vec_type a(T(1)), b(T(2)), c, d;
+
+    // a+b is the only vertex type present twice
+    typedef typename cyme::detail::tie_rhs_subtrees<decltype(a / (a + b)), decltype(T(1) / (a + b))>::type subtrees;
+    typedef typename cyme::detail::type_list_shared<subtrees, subtrees>::type shared;
+    typedef cyme::detail::type_list<typename decltype(a + b)::base_type> expected;
+    BOOST_CHECK((std::is_same<shared, expected>::value));
+
+    cyme::tie(c, d) = cyme::make_tuple(a / (a + b), T(1) / (a + b));
+
+    T res_c[size] __attribute__((aligned(64)));
+    T res_d[size] __attribute__((aligned(64)));
+    c.rep().store(res_c);
+    d.rep().store(res_d);
+    for (std::size_t i = 0; i < size; ++i) {
+        BOOST_CHECK_CLOSE(res_c[i], T(1) / T(3), relative_error<T>());
+        BOOST_CHECK_CLOSE(res_d[i], T(1) / T(3), relative_error<T>());
+    }
+}
+
+/** a coefficient table counting its reads, every evaluation of polyval reads all the coefficients */
+struct counted {
+    static const std::size_t order = 2;
+    static std::size_t reads;
+    static double coeff(std::size_t n) {
+        ++reads;
+        return 1. / double(n + 1);
+    }
+};
+
+std::size_t counted::reads = 0;
+
+struct f_polyval {
+    template <class S>
+    void operator()(S &W) const {
+        S const &R = W;
+        W[0] = cyme::polyval<counted>(R[2] + R[3]);
+    }
+};
+
+struct f_polyval_tie {
+    template <class S>
+    void operator()(S &W) const {
+        S const &R = W;
+        cyme::tie(W[0], W[1]) =
+            cyme::make_tuple(cyme::polyval<counted>(R[2] + R[3]) * 2., cyme::polyval<counted>(R[2] + R[3]) + 1.);
+    }
+};
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(tie_shared_fields, T, full_test_types) {
+    cyme::vector<synapse<T, 5>, cyme::AoSoA> v(1031);
+    std::uniform_real_distribution<T> value(-1, 1);
+    for (std::size_t i = 0; i < v.cyme_size(); ++i)
+        for (std::size_t j = 0; j < v.size_block(); ++j)
+            v(i, j) = value(rng);
+
+    // the subtree of the fields R[2], R[3] of a storage is evaluated once
+    counted::reads = 0;
+    std::for_each(v.begin(), v.end(), f_polyval());
+    const std::size_t once = counted::reads;
+    counted::reads = 0;
+    std::for_each(v.begin(), v.end(), f_polyval_tie());
+    BOOST_CHECK_EQUAL(counted::reads, once);
+
+    for (std::size_t i = 0; i < v.cyme_size(); ++i) {
+        const double x = double(v(i, 2)) + double(v(i, 3));
+        const double p = 1. + x / 2. + x * x / 3.;
+        BOOST_CHECK_CLOSE(double(v(i, 0)), 2. * p, relative_error<T>());
+        BOOST_CHECK_CLOSE(double(v(i, 1)), p + 1., relative_error<T>());
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(tie_field_leaves, T, full_test_types) {
+    typedef cyme::vec<T, cyme::__GETSIMD__()> vec_type;
+    cyme::vector<synapse<T, 5>, cyme::AoSoA> v(1031);
+    fill(v);
+    typedef typename cyme::vector<synapse<T, 5>, cyme::AoSoA>::storage_type storage_type;
+    storage_type const &R = *v.begin();
+
+    // a register leaf is a temporary of its own, two reads of a field are never the same leaf
+    const vec_type a(R[2]), b(R[2]);
+    BOOST_CHECK(!cyme::detail::vertex_shape<typename vec_type::base_type>::same(a.rep(), b.rep()));
+
+    // a field leaf keeps its address, two reads of a field are the same leaf, the reads of two fields are not
+    typedef typename decltype(R[2])::base_type field_type;
+    BOOST_CHECK(cyme::detail::vertex_shape<field_type>::same(R[2].rep(), R[2].rep()));
+    BOOST_CHECK(!cyme::detail::vertex_shape<field_type>::same(R[2].rep(), R[3].rep()));
+
+    // a field is still a register vec
+    const vec_type c = R[3];
+    const std::size_t size = sizeof(typename vec_type::base_type) / sizeof(T); // lanes x unroll
+    T res_a[size] __attribute__((aligned(64)));
+    T res_c[size] __attribute__((aligned(64)));
+    a.rep().store(res_a);
+    c.rep().store(res_c);
+    for (std::size_t i = 0; i < size; ++i) {
+        BOOST_CHECK_EQUAL(res_a[i], v(i, 2));
+        BOOST_CHECK_EQUAL(res_c[i], v(i, 3));
+    }
+}
@@ -0,0 +1,70 @@
+/*
+ * Cyme - atan.cpp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+#include <limits>
+#include <tests/unit/test_header.hpp>
+
+using namespace cyme::test;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(std_atan_comparison, T, full_test_types) {
+    typedef cyme::vec_simd<T, cyme::__GETSIMD__(), cyme::unroll_factor::N> simd_type;
+    const int n = cyme::elems_helper<T, cyme::unroll_factor::N>::size;
+    T a[n] __attribute__((aligned(64)));
+    T b[n] __attribute__((aligned(64)));
+    T r[n] __attribute__((aligned(64)));
+    T s[n] __attribute__((aligned(64)));
+    std::uniform_real_distribution<T> mantissa(-1, 1);
+    std::uniform_int_distribution<int> exponent(-20, 20);
+    for (int k = 0; k < 1000; ++k) {
+        for (int i = 0; i < n; ++i) {
+            a[i] = std::ldexp(mantissa(rng), exponent(rng));
+            b[i] = std::ldexp(mantissa(rng), exponent(rng));
+        }
+        cyme::atan(simd_type(a)).store(r);
+        cyme::atan2(simd_type(a), simd_type(b)).store(s);
+        for (int i = 0; i < n; ++i) { // the precision of atanf of cephes, in float and double
+            BOOST_CHECK_CLOSE(r[i], std::atan(a[i]), 1e-4);
+            BOOST_CHECK_CLOSE(s[i], std::atan2(a[i], b[i]), 1e-4);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(std_atan2_special_values, T, full_test_types) {
+    typedef cyme::vec_simd<T, cyme::__GETSIMD__(), cyme::unroll_factor::N> simd_type;
+    typedef std::numeric_limits<T> limits;
+    const int n = cyme::elems_helper<T, cyme::unroll_factor::N>::size;
+    T a[n] __attribute__((aligned(64)));
+    T b[n] __attribute__((aligned(64)));
+    T r[n] __attribute__((aligned(64)));
+    const T special[] = {T(0), T(-0.), T(1), T(-1), limits::infinity(), -limits::infinity(), limits::quiet_NaN()};
+    for (int k = 0; k < 7 * 7; ++k) {
+        for (int i = 0; i < n; ++i) {
+            a[i] = special[k / 7];
+            b[i] = special[k % 7];
+        }
+        cyme::atan2(simd_type(a), simd_type(b)).store(r);
+        const T reference = std::atan2(a[0], b[0]);
+        for (int i = 0; i < n; ++i) {
+            if (std::isnan(reference))
+                BOOST_CHECK(std::isnan(r[i]));
+            else
+                BOOST_CHECK(r[i] == reference && std::signbit(r[i]) == std::signbit(reference));
+        }
+    }
+}
@@ -0,0 +1,84 @@
+/*
+ * Cyme - horizontal.cpp, Copyright (c), 2018,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+
+#include <algorithm>
+#include <tests/unit/test_header.hpp>
+
+using namespace cyme::test;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(vec_simd_hsum, T, full_test_types) {
+    int n = cyme::unroll_factor::N * cyme::trait_register<T, cyme::__GETSIMD__()>::size / sizeof(T);
+    T a[n] __attribute__((aligned(64)));
+    for (int i = 0; i < n; ++i)
+        a[i] = T(i + 1); // exact, no rounding
+    cyme::vec_simd<T, cyme::__GETSIMD__(), cyme::unroll_factor::N> va(a);
+    BOOST_CHECK_EQUAL(hsum(va), T(n * (n + 1) / 2));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(vec_simd_hmin_hmax, T, full_test_types) {
+    int n = cyme::unroll_factor::N * cyme::trait_register<T, cyme::__GETSIMD__()>::size / sizeof(T);
+    T a[n] __attribute__((aligned(64)));
+    for (int k = 0; k < n; ++k) { // the extrema in every lane
+        for (int i = 0; i < n; ++i)
+            a[i] = T((i * 7) % n) - T(n / 2);
+        a[k] = T(-100);
+        a[(k + 1) % n] = T(100);
+        cyme::vec_simd<T, cyme::__GETSIMD__(), cyme::unroll_factor::N> va(a);
+        BOOST_CHECK_EQUAL(hmin(va), T(-100));
+        BOOST_CHECK_EQUAL(hmax(va), T(100));
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(vec_simd_any_all_popcount, T, full_test_types) {
+    int n = cyme::unroll_factor::N * cyme::trait_register<T, cyme::__GETSIMD__()>::size / sizeof(T);
+    T a[n] __attribute__((aligned(64)));
+    cyme::vec_simd<T, cyme::__GETSIMD__(), cyme::unroll_factor::N> vb(T(0));
+    for (int k = 0; k <= n; ++k) { // k lanes true
+        for (int i = 0; i < n; ++i)
+            a[i] = (i < k) ? T(-1) : T(1);
+        cyme::vec_simd<T, cyme::__GETSIMD__(), cyme::unroll_factor::N> va(a);
+        BOOST_CHECK_EQUAL(any(va < vb), k > 0);
+        BOOST_CHECK_EQUAL(all(va < vb), k == n);
+        BOOST_CHECK_EQUAL(popcount(va < vb), k);
+    }
+    for (int k = 0; k < n; ++k) { // a single lane
+        for (int i = 0; i < n; ++i)
+            a[i] = (i == k) ? T(-1) : T(1);
+        cyme::vec_simd<T, cyme::__GETSIMD__(), cyme::unroll_factor::N> va(a);
+        BOOST_CHECK(any(va < vb));
+        BOOST_CHECK_EQUAL(popcount(va < vb), 1);
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(vec_horizontal, T, full_test_types) {
+    int n = cyme::unroll_factor::N * cyme::trait_register<T, cyme::__GETSIMD__()>::size / sizeof(T);
+    T a[n] __attribute__((aligned(64)));
+    T b[n] __attribute__((aligned(64)));
+    for (int i = 0; i < n; ++i) {
+        a[i] = T(i);
+        b[i] = T(n - i);
+    }
+    cyme::vec<T, cyme::__GETSIMD__()> va(a), vb(b);
+    BOOST_CHECK_EQUAL(hsum(va + vb), T(n * n));
+    BOOST_CHECK_EQUAL(hmin(va * 2. - vb), T(-n));
+    BOOST_CHECK_EQUAL(hmax(va * 2. - vb), T(2 * n - 3));
+    BOOST_CHECK_EQUAL(popcount(va < vb), (n + 1) / 2);
+    BOOST_CHECK(any(va >= vb) && !all(va >= vb));
+}
@@ -170,3 +170,48 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(vec_simd_gte, T, full_test_inequality_types) {
         }
     }
 }
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(vec_simd_ne, T, full_test_types) {
+    union helper {
+        T d;
+        typename trait_integer<T>::value_type n;
+    };
+    helper u;
+
+    cyme::vec_simd<T, cyme::__GETSIMD__(), cyme::unroll_factor::N> va(T(0));
+    cyme::vec_simd<T, cyme::__GETSIMD__(), cyme::unroll_factor::N> vb(T(1));
+    int n = cyme::unroll_factor::N * cyme::trait_register<T, cyme::__GETSIMD__()>::size / sizeof(T);
+    T r[n] __attribute__((aligned(64)));
+    T s[n] __attribute__((aligned(64)));
+    (va != vb).store(r);
+    (va != va).store(s);
+
+    for (int i = 0; i < n; ++i) {
+        u.d = r[i];
+        BOOST_CHECK(u.n == -1);
+        u.d = s[i];
+        BOOST_CHECK(u.n == 0);
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(vec_simd_max_where, T, full_test_types) {
+    int n = cyme::unroll_factor::N * cyme::trait_register<T, cyme::__GETSIMD__()>::size / sizeof(T);
+    T a[n] __attribute__((aligned(64)));
+    T b[n] __attribute__((aligned(64)));
+    T r[n] __attribute__((aligned(64)));
+    T s[n] __attribute__((aligned(64)));
+    for (int i = 0; i < n; ++i) {
+        a[i] = T(i % 3);
+        b[i] = T(1);
+    }
+
+    cyme::vec_simd<T, cyme::__GETSIMD__(), cyme::unroll_factor::N> va(a);
+    cyme::vec_simd<T, cyme::__GETSIMD__(), cyme::unroll_factor::N> vb(b);
+    max(va, vb).store(r);
+    where(va < vb, vb, va + vb).store(s);
+
+    for (int i = 0; i < n; ++i) {
+        BOOST_CHECK_EQUAL(r[i], std::max(a[i], b[i]));
+        BOOST_CHECK_EQUAL(s[i], (a[i] < b[i]) ? b[i] : a[i] + b[i]);
+    }
+}
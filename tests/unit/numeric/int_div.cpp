@@ -0,0 +1,106 @@
+/*
+ * Cyme - int_div.cpp, Copyright (c), 2018,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+#include <limits>
+#include <tests/unit/test_header.hpp>
+
+using namespace cyme::test;
+
+#ifdef __x86_64__
+
+// the magic numbers of Hacker's Delight, computed at compile time
+static_assert(cyme::divisor<7>().magic == -1840700269 && cyme::divisor<7>().shift == 2, "magic of 7");
+static_assert(cyme::divisor<-7>().magic == 1840700269 && cyme::divisor<-7>().sign == -1, "magic of -7");
+static_assert(cyme::divisor<5>().magic == 1717986919 && cyme::divisor<5>().shift == 1 && !cyme::divisor<5>().add,
+              "magic of 5");
+static_assert(cyme::divisor<16>().magic == 0 && cyme::divisor<16>().shift == 4, "a power of two is a shift");
+
+/** the numerators of the test, the extrema and the neighbours of the multiples */
+static std::vector<int> numerators(int d) {
+    std::vector<int> v;
+    const int extrema[] = {0, 1, -1, 2, -2, std::numeric_limits<int>::max(), std::numeric_limits<int>::min(),
+                           std::numeric_limits<int>::max() - 1, std::numeric_limits<int>::min() + 1};
+    v.insert(v.end(), extrema, extrema + 9);
+    for (int k = -3; k <= 3; ++k)
+        for (int e = -1; e <= 1; ++e)
+            v.push_back(static_cast<int>(static_cast<long long>(k) * (d % 100000) + e));
+    std::uniform_int_distribution<int> random(std::numeric_limits<int>::min(), std::numeric_limits<int>::max());
+    for (int k = 0; k < 1000; ++k)
+        v.push_back(random(rng));
+    return v;
+}
+
+static void check_divisor(cyme::int_divisor const &d) {
+    typedef cyme::vec_simd<int, cyme::__GETSIMD__(), cyme::unroll_factor::N> simd_type;
+    const int n = cyme::unroll_factor::N * cyme::trait_register<int, cyme::__GETSIMD__()>::size / sizeof(int);
+    int a[n] __attribute__((aligned(64)));
+    int q[n] __attribute__((aligned(64)));
+    int r[n] __attribute__((aligned(64)));
+    std::vector<int> v = numerators(d.value);
+    for (std::size_t k = 0; k < v.size(); k += n) {
+        for (int i = 0; i < n; ++i)
+            a[i] = v[(k + i) % v.size()];
+        if (d.value == -1) // the overflow of min / -1
+            for (int i = 0; i < n; ++i)
+                a[i] = std::max(a[i], std::numeric_limits<int>::min() + 1);
+        const simd_type va(a);
+        (va / d).store(q);
+        (va % d).store(r);
+        for (int i = 0; i < n; ++i) {
+            BOOST_CHECK_EQUAL(q[i], a[i] / d.value);
+            BOOST_CHECK_EQUAL(r[i], a[i] % d.value);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(vec_simd_int_div_runtime) {
+    const int divisors[] = {1,   -1,   2,    -2,        3,   -3,         5,          7,       -7,
+                            10,  16,   -32,  641,       1000, 6700417,    1 << 30,    -(1 << 30),
+                            std::numeric_limits<int>::max(), std::numeric_limits<int>::min()};
+    for (std::size_t k = 0; k < sizeof(divisors) / sizeof(int); ++k)
+        check_divisor(cyme::int_divisor(divisors[k]));
+    std::uniform_int_distribution<int> random(2, std::numeric_limits<int>::max());
+    for (int k = 0; k < 200; ++k) {
+        const int d = random(rng);
+        check_divisor(cyme::int_divisor(d));
+        check_divisor(cyme::int_divisor(-d));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(vec_simd_int_div_constant) {
+    check_divisor(cyme::divisor<7>());
+    check_divisor(cyme::divisor<-12>());
+    check_divisor(cyme::divisor<64>());
+
+    // the block and the lane of an AoSoA index
+    typedef cyme::vec_simd<int, cyme::__GETSIMD__(), cyme::unroll_factor::N> simd_type;
+    const int n = cyme::unroll_factor::N * cyme::trait_register<int, cyme::__GETSIMD__()>::size / sizeof(int);
+    int a[n] __attribute__((aligned(64)));
+    int b[n] __attribute__((aligned(64)));
+    int l[n] __attribute__((aligned(64)));
+    for (int i = 0; i < n; ++i)
+        a[i] = 1031 * i + 5;
+    const simd_type index(a);
+    (index / cyme::divisor<12>()).store(b);
+    (index % cyme::divisor<12>()).store(l);
+    for (int i = 0; i < n; ++i)
+        BOOST_CHECK_EQUAL(b[i] * 12 + l[i], a[i]);
+}
+
+#endif
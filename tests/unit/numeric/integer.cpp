@@ -0,0 +1,173 @@
+/*
+ * Cyme - integer.cpp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+#include <limits>
+#include <tests/unit/test_header.hpp>
+
+using namespace cyme::test;
+
+#ifdef __x86_64__
+
+typedef boost::mpl::list<std::int64_t, std::uint32_t, std::uint64_t> integer_test_types;
+
+/** the floating point type of the conversion, the same number of lanes */
+template <class T>
+struct floating_point {
+    typedef double type;
+};
+
+template <>
+struct floating_point<std::uint32_t> {
+    typedef float type;
+};
+
+/** the extrema, the neighbours of 2^32 and 2^53 (the rounding of the conversion) and random numbers */
+template <class T>
+std::vector<T> numbers() {
+    typedef std::numeric_limits<T> limits;
+    std::vector<T> v;
+    const T extrema[] = {T(0),         T(1),         T(2), T(-1), limits::max(), limits::min(),
+                         T(limits::max() - 1), T(limits::min() + 1)};
+    v.insert(v.end(), extrema, extrema + 8);
+    if (sizeof(T) == 8) {
+        for (int e = -2; e <= 2; ++e) {
+            v.push_back(T((1ull << 32) + e));
+            v.push_back(T((1ull << 53) + e));
+            v.push_back(T(-(1ll << 53) + e));
+        }
+        v.push_back(T(0x8000000000000401ull)); // rounded up to double
+    } else {
+        v.push_back(T(0x01000001u)); // a tie of the rounding to float
+        v.push_back(T(0xffffff7fu));
+    }
+    std::uniform_int_distribution<T> random(limits::min(), limits::max());
+    for (int k = 0; k < 1000; ++k)
+        v.push_back(random(rng));
+    return v;
+}
+
+/** the mask of the comparisons */
+template <class T>
+T mask(bool b) {
+    return b ? T(~T(0)) : T(0);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(vec_simd_integer_arithmetic, T, integer_test_types) {
+    typedef cyme::vec_simd<T, cyme::__GETSIMD__(), cyme::unroll_factor::N> simd_type;
+    typedef typename std::make_unsigned<T>::type U; // the wrap around of + - *, no undefined behaviour
+    const int n = cyme::elems_helper<T, cyme::unroll_factor::N>::size;
+    T a[n] __attribute__((aligned(64)));
+    T b[n] __attribute__((aligned(64)));
+    T r[n] __attribute__((aligned(64)));
+    const std::vector<T> v = numbers<T>();
+    for (std::size_t k = 0; k < v.size(); k += n) {
+        for (int i = 0; i < n; ++i) {
+            a[i] = v[(k + i) % v.size()];
+            b[i] = v[(k + 7 * i + 3) % v.size()];
+        }
+        b[0] = a[0]; // equal lanes
+        const simd_type va(a), vb(b);
+        (va + vb).store(r);
+        for (int i = 0; i < n; ++i)
+            BOOST_CHECK_EQUAL(r[i], T(U(a[i]) + U(b[i])));
+        (va - vb).store(r);
+        for (int i = 0; i < n; ++i)
+            BOOST_CHECK_EQUAL(r[i], T(U(a[i]) - U(b[i])));
+        (va * vb).store(r);
+        for (int i = 0; i < n; ++i)
+            BOOST_CHECK_EQUAL(r[i], T(U(a[i]) * U(b[i])));
+        (va ^ ((vb & ~va) | va)).store(r);
+        for (int i = 0; i < n; ++i)
+            BOOST_CHECK_EQUAL(r[i], T(a[i] ^ ((b[i] & ~a[i]) | a[i])));
+
+        (va == vb).store(r);
+        for (int i = 0; i < n; ++i)
+            BOOST_CHECK_EQUAL(r[i], mask<T>(a[i] == b[i]));
+        (va != vb).store(r);
+        for (int i = 0; i < n; ++i)
+            BOOST_CHECK_EQUAL(r[i], mask<T>(a[i] != b[i]));
+        (va < vb).store(r);
+        for (int i = 0; i < n; ++i)
+            BOOST_CHECK_EQUAL(r[i], mask<T>(a[i] < b[i]));
+        (va <= vb).store(r);
+        for (int i = 0; i < n; ++i)
+            BOOST_CHECK_EQUAL(r[i], mask<T>(a[i] <= b[i]));
+        (va > vb).store(r);
+        for (int i = 0; i < n; ++i)
+            BOOST_CHECK_EQUAL(r[i], mask<T>(a[i] > b[i]));
+        (va >= vb).store(r);
+        for (int i = 0; i < n; ++i)
+            BOOST_CHECK_EQUAL(r[i], mask<T>(a[i] >= b[i]));
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(vec_simd_integer_shift, T, integer_test_types) {
+    typedef cyme::vec_simd<T, cyme::__GETSIMD__(), cyme::unroll_factor::N> simd_type;
+    typedef typename std::make_unsigned<T>::type U;
+    const int n = cyme::elems_helper<T, cyme::unroll_factor::N>::size;
+    const int bits = 8 * sizeof(T);
+    T a[n] __attribute__((aligned(64)));
+    T r[n] __attribute__((aligned(64)));
+    const std::vector<T> v = numbers<T>();
+    const int shifts[] = {0, 1, 7, 16, bits / 2 + 1, bits - 1};
+    for (int s = 0; s < 6; ++s) {
+        const simd_type count(T(shifts[s]));
+        for (std::size_t k = 0; k < v.size(); k += n) {
+            for (int i = 0; i < n; ++i)
+                a[i] = v[(k + i) % v.size()];
+            const simd_type va(a);
+            (va << count).store(r);
+            for (int i = 0; i < n; ++i)
+                BOOST_CHECK_EQUAL(r[i], T(U(a[i]) << shifts[s]));
+            (va >> count).store(r);
+            for (int i = 0; i < n; ++i)
+                BOOST_CHECK_EQUAL(r[i], T(a[i] >> shifts[s])); // arithmetic for the signed integers
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(vec_simd_integer_convert, T, integer_test_types) {
+    typedef typename floating_point<T>::type F;
+    typedef cyme::vec_simd<T, cyme::__GETSIMD__(), cyme::unroll_factor::N> simd_type;
+    const int n = cyme::elems_helper<T, cyme::unroll_factor::N>::size;
+    T a[n] __attribute__((aligned(64)));
+    F f[n] __attribute__((aligned(64)));
+    const std::vector<T> v = numbers<T>();
+    for (std::size_t k = 0; k < v.size(); k += n) {
+        for (int i = 0; i < n; ++i)
+            a[i] = v[(k + i) % v.size()];
+        cyme::convert<F>(simd_type(a)).store(f);
+        for (int i = 0; i < n; ++i)
+            BOOST_CHECK_EQUAL(f[i], static_cast<F>(a[i])); // rounded to the nearest, as the compiler
+    }
+}
+
+BOOST_AUTO_TEST_CASE(vec_simd_int_left_shift) {
+    typedef cyme::vec_simd<int, cyme::__GETSIMD__(), cyme::unroll_factor::N> simd_type;
+    const int n = cyme::elems_helper<int, cyme::unroll_factor::N>::size;
+    int a[n] __attribute__((aligned(64)));
+    int r[n] __attribute__((aligned(64)));
+    for (int i = 0; i < n; ++i)
+        a[i] = 1031 * i - 77;
+    (simd_type(a) << simd_type(5)).store(r);
+    for (int i = 0; i < n; ++i)
+        BOOST_CHECK_EQUAL(r[i], int(unsigned(a[i]) << 5));
+}
+
+#endif
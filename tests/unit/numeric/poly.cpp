@@ -0,0 +1,221 @@
+/*
+ * Cyme - poly.cpp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+#include <tests/unit/test_header.hpp>
+
+using namespace cyme::test;
+
+/** the table of the order M, (-1)^n/(n+1) */
+template <std::size_t M>
+struct alternating {
+    static const std::size_t order = M;
+    static double coeff(std::size_t n) { return (n % 2 ? -1. : 1.) / double(n + 1); }
+};
+
+/** the rate of a channel, 0.1 (v + 40) / (1 - exp(-(v + 40)/10)) fitted on [-100, 50] by a rational function */
+struct rate_p {
+    static const std::size_t order = 3;
+    static double coeff(std::size_t n) {
+        static const double c[] = {1.0, 4.1e-2, 6.3e-4, 3.6e-6};
+        return c[n];
+    }
+};
+
+struct rate_q {
+    static const std::size_t order = 2;
+    static double coeff(std::size_t n) {
+        static const double c[] = {1.0, -1.2e-2, 8.0e-5};
+        return c[n];
+    }
+};
+
+/** the reference, the sum of the terms in double */
+template <class C>
+double reference(double x) {
+    double p = 0, xn = 1;
+    for (std::size_t n = 0; n <= C::order; ++n, xn *= x)
+        p += C::coeff(n) * xn;
+    return p;
+}
+
+template <class T>
+bool close(T a, double b) {
+    const double tolerance = (sizeof(T) == 4) ? 1e-5 : 1e-13;
+    return std::fabs(a - b) <= tolerance * (1. + std::fabs(b));
+}
+
+template <class T, class C, cyme::poly_scheme S>
+void check_polyval() {
+    typedef cyme::vec_simd<T, cyme::__GETSIMD__(), cyme::unroll_factor::N> simd_type;
+    const int n = cyme::elems_helper<T, cyme::unroll_factor::N>::size;
+    T a[n] __attribute__((aligned(64)));
+    T r[n] __attribute__((aligned(64)));
+    std::uniform_real_distribution<T> random(-1, 1);
+    for (int k = 0; k < 100; ++k) {
+        for (int i = 0; i < n; ++i)
+            a[i] = random(rng);
+        cyme::polyval<C, S>(simd_type(a)).store(r);
+        for (int i = 0; i < n; ++i) {
+            BOOST_CHECK(close(r[i], reference<C>(a[i])));
+            BOOST_CHECK(close(cyme::polyval<C, S>(a[i]), reference<C>(a[i])));
+        }
+    }
+}
+
+template <class T, cyme::poly_scheme S>
+void check_polyval_orders() {
+    check_polyval<T, alternating<0>, S>();
+    check_polyval<T, alternating<1>, S>();
+    check_polyval<T, alternating<2>, S>();
+    check_polyval<T, alternating<3>, S>();
+    check_polyval<T, alternating<4>, S>();
+    check_polyval<T, alternating<7>, S>();
+    check_polyval<T, alternating<8>, S>();
+    check_polyval<T, alternating<12>, S>();
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(vec_simd_polyval, T, full_test_types) {
+    check_polyval_orders<T, cyme::poly_horner>();
+    check_polyval_orders<T, cyme::poly_estrin>();
+    check_polyval_orders<T, cyme::poly_horner2>();
+}
+
+/** the table C of the library, a scheme against helper_horner on [low, high] */
+template <class T, template <class, std::size_t> class C, cyme::poly_scheme S>
+void check_table(T low, T high) {
+    typedef cyme::vec_simd<T, cyme::__GETSIMD__(), cyme::unroll_factor::N> simd_type;
+    const int n = cyme::elems_helper<T, cyme::unroll_factor::N>::size;
+    T a[n] __attribute__((aligned(64)));
+    T r[n] __attribute__((aligned(64)));
+    T h[n] __attribute__((aligned(64)));
+    std::uniform_real_distribution<T> random(low, high);
+    for (int k = 0; k < 100; ++k) {
+        for (int i = 0; i < n; ++i)
+            a[i] = random(rng);
+        const simd_type x(a);
+        cyme::polyval<cyme::poly_table<T, C>, S>(x).store(r);
+        cyme::helper_horner<T, cyme::__GETSIMD__(), cyme::unroll_factor::N, C, cyme::poly_order<T, C>::value>::horner(
+            x).store(h);
+        for (int i = 0; i < n; ++i)
+            BOOST_CHECK(close(r[i], double(h[i])));
+    }
+}
+
+template <class T, cyme::poly_scheme S>
+void check_tables() {
+    check_table<T, cyme::coeff_remez_exp, S>(0, 1);
+    check_table<T, cyme::coeff_remez_log, S>(0, 1);
+    check_table<T, cyme::coeff_cephes_sin, S>(0, 0.7);
+    check_table<T, cyme::coeff_cephes_cos, S>(0, 0.7);
+    check_table<T, cyme::coeff_cephes_atan, S>(0, 0.2);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(vec_simd_poly_schemes, T, full_test_types) {
+    check_tables<T, cyme::poly_horner>();
+    check_tables<T, cyme::poly_horner2>();
+    check_tables<T, cyme::poly_estrin>();
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(vec_simd_ratval, T, full_test_types) {
+    typedef cyme::vec_simd<T, cyme::__GETSIMD__(), cyme::unroll_factor::N> simd_type;
+    const int n = cyme::elems_helper<T, cyme::unroll_factor::N>::size;
+    T a[n] __attribute__((aligned(64)));
+    T r[n] __attribute__((aligned(64)));
+    T s[n] __attribute__((aligned(64)));
+    std::uniform_real_distribution<T> random(-100, 50);
+    for (int k = 0; k < 100; ++k) {
+        for (int i = 0; i < n; ++i)
+            a[i] = random(rng);
+        cyme::ratval<rate_p, rate_q>(simd_type(a)).store(r);
+        cyme::ratval<rate_p, rate_q, cyme::poly_estrin>(simd_type(a)).store(s);
+        for (int i = 0; i < n; ++i) {
+            const double f = reference<rate_p>(a[i]) / reference<rate_q>(a[i]);
+            BOOST_CHECK(close(r[i], f));
+            BOOST_CHECK(close(s[i], f));
+            BOOST_CHECK(close(cyme::ratval<rate_p, rate_q>(a[i]), f));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(vec_polyval, T, full_test_types) {
+    const int n = cyme::elems_helper<T, cyme::unroll_factor::N>::size;
+    T a[n] __attribute__((aligned(64)));
+    T b[n] __attribute__((aligned(64)));
+    T c[n] __attribute__((aligned(64)));
+    std::uniform_real_distribution<T> random(-1, 1);
+    for (int i = 0; i < n; ++i)
+        a[i] = random(rng);
+    cyme::vec<T, cyme::__GETSIMD__()> va(a), vb(b), vc(c);
+    // the vertices in the trees, and a subtree shared by tie
+    vb = 2. * cyme::polyval<alternating<5>>(va * 0.5) + cyme::ratval<rate_p, rate_q, cyme::poly_estrin>(va);
+    for (int i = 0; i < n; ++i)
+        BOOST_CHECK(close(b[i], 2. * reference<alternating<5>>(a[i] * T(0.5)) +
+                                    reference<rate_p>(a[i]) / reference<rate_q>(a[i])));
+    cyme::tie(vc, vb) =
+        cyme::make_tuple(cyme::polyval<alternating<3>>(va) * 3., cyme::polyval<alternating<3>>(va) + 1.);
+    for (int i = 0; i < n; ++i) {
+        const double p = reference<alternating<3>>(a[i]);
+        BOOST_CHECK(close(c[i], 3. * p));
+        BOOST_CHECK(close(b[i], p + 1.));
+    }
+
+    typedef cyme::expression_info<decltype(cyme::polyval<alternating<4>>(va))> horner;
+    typedef cyme::expression_info<decltype(cyme::polyval<alternating<4>, cyme::poly_estrin>(va))> estrin;
+    typedef cyme::expression_info<decltype(cyme::polyval<alternating<4>, cyme::poly_horner2>(va))> horner2;
+    BOOST_CHECK_EQUAL(horner::fma + horner::add, 4);
+    BOOST_CHECK_EQUAL(horner2::fma + horner2::add, 4);
+    BOOST_CHECK_EQUAL(estrin::mul - horner::mul, 2); // x^2 and x^4
+    BOOST_CHECK_EQUAL(horner2::mul - horner::mul, 1); // x^2
+}
+
+/** the rates of a channel, the rational fit against the exp and the division */
+enum properties { v, alpha, beta };
+
+template <class S>
+void rates(S &W) {
+    S const &R = W;
+    W[alpha] = cyme::ratval<rate_p, rate_q>(R[v]);
+    W[beta] = 4. * cyme::polyval<alternating<6>, cyme::poly_estrin>(R[v] * 0.01);
+}
+
+template <class T, size_t M>
+struct channel {
+    typedef T value_type;
+    static const size_t value_size = M;
+};
+
+#define TYPE typename T::value_type
+#define N T::n
+#define ORDER T::order
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(vec_polyval_rates, T, floating_point_block_types) {
+    const std::size_t size = 1031;
+    cyme::vector<channel<TYPE, N>, ORDER> c(size);
+    std::uniform_real_distribution<TYPE> random(-100, 50);
+    for (std::size_t k = 0; k < size; ++k)
+        c(k, v) = random(rng);
+
+    for (typename cyme::vector<channel<TYPE, N>, ORDER>::iterator it = c.begin(); it != c.end(); ++it)
+        rates(*it);
+
+    for (std::size_t k = 0; k < size; ++k) {
+        BOOST_CHECK(close(c(k, alpha), reference<rate_p>(c(k, v)) / reference<rate_q>(c(k, v))));
+        BOOST_CHECK(close(c(k, beta), 4. * reference<alternating<6>>(TYPE(c(k, v) * TYPE(0.01)))));
+    }
+}
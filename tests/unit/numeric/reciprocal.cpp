@@ -0,0 +1,83 @@
+/*
+ * Cyme - reciprocal.cpp, Copyright (c), 2018,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+#include <cmath>
+#include <tests/unit/test_header.hpp>
+
+using namespace cyme::test;
+
+/** relative error after K Newton-Raphson steps, the hardware approximation has 12 bits at least (x86) */
+template <class T, int K>
+double tolerance() {
+    const double epsilon = (sizeof(T) == 4) ? 1e-6 : 1e-13; // rounding of the steps
+    return (K == 0) ? 1e-3 : ((K == 1) ? std::max(1e-6, epsilon) : epsilon);
+}
+
+template <class T, int K>
+void check_steps() {
+    const int n = cyme::unroll_factor::N * cyme::trait_register<T, cyme::__GETSIMD__()>::size / sizeof(T);
+    T a[n] __attribute__((aligned(64)));
+    T b[n] __attribute__((aligned(64)));
+    T r[n] __attribute__((aligned(64)));
+    T s[n] __attribute__((aligned(64)));
+    T q[n] __attribute__((aligned(64)));
+    const double bound = tolerance<T, K>();
+    std::uniform_real_distribution<T> value(0.01, 1000);
+    for (int k = 0; k < 100; ++k) {
+        for (int i = 0; i < n; ++i) {
+            a[i] = value(rng);
+            b[i] = value(rng);
+        }
+        typedef cyme::vec_simd<T, cyme::__GETSIMD__(), cyme::unroll_factor::N> simd_type;
+        const simd_type va(a), vb(b);
+        cyme::rcp<K>(vb).store(r);
+        cyme::rsqrt<K>(vb).store(s);
+        cyme::fast_div<K>(va, vb).store(q);
+        for (int i = 0; i < n; ++i) {
+            BOOST_CHECK_SMALL(r[i] * double(b[i]) - 1., bound);
+            BOOST_CHECK_SMALL(s[i] * std::sqrt(double(b[i])) - 1., bound);
+            BOOST_CHECK_SMALL(q[i] / (double(a[i]) / b[i]) - 1., bound);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(vec_simd_rcp_rsqrt_fast_div, T, full_test_types) {
+    check_steps<T, 0>();
+    check_steps<T, 1>();
+    check_steps<T, 2>();
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(vec_rcp_rsqrt_fast_div, T, full_test_types) {
+    const int n = cyme::unroll_factor::N * cyme::trait_register<T, cyme::__GETSIMD__()>::size / sizeof(T);
+    T a[n] __attribute__((aligned(64)));
+    T b[n] __attribute__((aligned(64)));
+    T c[n] __attribute__((aligned(64)));
+    for (int i = 0; i < n; ++i) {
+        a[i] = T(i + 1);
+        b[i] = T(2 * i + 3);
+    }
+    cyme::vec<T, cyme::__GETSIMD__()> va(a), vb(b), vc(c);
+    // the vertices in the trees, the precision of the caller
+    vc = cyme::fast_div<1>(va + 1., vb) + cyme::rcp<1>(vb * vb) - 2. * cyme::rsqrt<1>(va);
+    for (int i = 0; i < n; ++i)
+        BOOST_CHECK_CLOSE(c[i], (a[i] + 1) / b[i] + 1 / (b[i] * b[i]) - 2 / std::sqrt(a[i]), 0.001);
+    vc = cyme::fast_div<2>(1., va);
+    for (int i = 0; i < n; ++i)
+        BOOST_CHECK_CLOSE(c[i], 1 / a[i], 0.0001);
+}
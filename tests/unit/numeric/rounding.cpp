@@ -0,0 +1,200 @@
+/*
+ * Cyme - rounding.cpp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+#include <limits>
+#include <tests/unit/test_header.hpp>
+
+using namespace cyme::test;
+
+/** the halfway cases, the neighbours of 0.5, the integers of the mantissa, the subnormal numbers, the infinities
+    and nan, then random numbers */
+template <class T>
+std::vector<T> numbers() {
+    typedef std::numeric_limits<T> limits;
+    const T big = std::ldexp(T(1), limits::digits - 2); // the last halfway cases
+    const T half = std::nextafter(T(0.5), T(0));
+    const T special[] = {T(0),          T(-0.),        T(0.5),           T(-0.5),
+                         T(1.5),        T(2.5),        T(-2.5),          half,
+                         -half,         big + T(0.5),  big,              -big - T(1.5),
+                         limits::min(), limits::min() / T(3), -limits::denorm_min(), T(1e30),
+                         limits::max(), limits::infinity(), -limits::infinity(), limits::quiet_NaN()};
+    std::vector<T> v(special, special + 20);
+    std::uniform_real_distribution<T> random(-1000, 1000);
+    for (int k = 0; k < 1000; ++k)
+        v.push_back(random(rng));
+    return v;
+}
+
+/** the same value, the sign of the zeros and nan included */
+template <class T>
+bool same(T a, T b) {
+    if (std::isnan(a) || std::isnan(b))
+        return std::isnan(a) && std::isnan(b);
+    return a == b && std::signbit(a) == std::signbit(b);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(vec_simd_rounding, T, full_test_types) {
+    typedef cyme::vec_simd<T, cyme::__GETSIMD__(), cyme::unroll_factor::N> simd_type;
+    const int n = cyme::elems_helper<T, cyme::unroll_factor::N>::size;
+    T a[n] __attribute__((aligned(64)));
+    T b[n] __attribute__((aligned(64)));
+    T r[n] __attribute__((aligned(64)));
+    const std::vector<T> v = numbers<T>();
+    for (std::size_t k = 0; k < v.size(); k += n) {
+        for (int i = 0; i < n; ++i) {
+            a[i] = v[(k + i) % v.size()];
+            b[i] = v[(k + 7 * i + 3) % v.size()];
+        }
+        const simd_type va(a), vb(b);
+        cyme::rounding<cyme::round_down>(va).store(r);
+        for (int i = 0; i < n; ++i)
+            BOOST_CHECK(same(r[i], std::floor(a[i])));
+        cyme::rounding<cyme::round_up>(va).store(r);
+        for (int i = 0; i < n; ++i)
+            BOOST_CHECK(same(r[i], std::ceil(a[i])));
+        cyme::rounding<cyme::round_zero>(va).store(r);
+        for (int i = 0; i < n; ++i)
+            BOOST_CHECK(same(r[i], std::trunc(a[i])));
+        cyme::rounding<cyme::round_even>(va).store(r);
+        for (int i = 0; i < n; ++i)
+            BOOST_CHECK(same(r[i], std::rint(a[i])));
+        cyme::round(va).store(r);
+        for (int i = 0; i < n; ++i)
+            BOOST_CHECK(same(r[i], std::round(a[i])));
+        cyme::copysign(va, vb).store(r);
+        for (int i = 0; i < n; ++i)
+            BOOST_CHECK(same(r[i], std::copysign(a[i], b[i])));
+        cyme::frexp(va).store(r);
+        for (int i = 0; i < n; ++i) {
+            int e;
+            BOOST_CHECK(same(r[i], std::frexp(a[i], &e)));
+        }
+        cyme::logb(va).store(r);
+        for (int i = 0; i < n; ++i)
+            BOOST_CHECK(same(r[i], std::logb(a[i])));
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(vec_simd_ldexp_fmod, T, full_test_types) {
+    typedef cyme::vec_simd<T, cyme::__GETSIMD__(), cyme::unroll_factor::N> simd_type;
+    typedef std::numeric_limits<T> limits;
+    const int n = cyme::elems_helper<T, cyme::unroll_factor::N>::size;
+    T a[n] __attribute__((aligned(64)));
+    T b[n] __attribute__((aligned(64)));
+    T r[n] __attribute__((aligned(64)));
+    const std::vector<T> v = numbers<T>();
+    const int range = limits::max_exponent - limits::min_exponent + limits::digits + 8; // up to inf and 0
+    std::uniform_int_distribution<int> exponent(-range, range);
+    for (std::size_t k = 0; k < v.size(); k += n) {
+        for (int i = 0; i < n; ++i) {
+            a[i] = v[(k + i) % v.size()];
+            b[i] = T(exponent(rng));
+        }
+        cyme::ldexp(simd_type(a), simd_type(b)).store(r);
+        for (int i = 0; i < n; ++i)
+            BOOST_CHECK(same(r[i], std::ldexp(a[i], int(b[i]))));
+    }
+
+    std::uniform_real_distribution<T> numerator(-1e4, 1e4), divisor(0.01, 10);
+    for (int k = 0; k < 1000; ++k) {
+        for (int i = 0; i < n; ++i) {
+            a[i] = numerator(rng);
+            b[i] = (i % 2) ? divisor(rng) : -divisor(rng);
+        }
+        a[0] = T(7.5);
+        b[0] = T(2.5); // exact quotient, a zero remainder
+        cyme::fmod(simd_type(a), simd_type(b)).store(r);
+        for (int i = 0; i < n; ++i) // exact, with or without the FMA
+            BOOST_CHECK_EQUAL(r[i], std::fmod(a[i], b[i]));
+    }
+
+    // the multiples of b and their neighbours, a remainder of 0, close to 0 or close to |b|
+    std::uniform_int_distribution<int> multiple(1, 1 << 12);
+    for (int k = 0; k < 1000; ++k) {
+        for (int i = 0; i < n; ++i) {
+            b[i] = (i % 2) ? divisor(rng) : -divisor(rng);
+            a[i] = T(multiple(rng)) * b[i];
+            if (i % 3 == 1)
+                a[i] = std::nextafter(a[i], limits::infinity());
+            else if (i % 3 == 2)
+                a[i] = std::nextafter(a[i], -limits::infinity());
+            a[i] = (k % 2) ? -a[i] : a[i];
+        }
+        cyme::fmod(simd_type(a), simd_type(b)).store(r);
+        for (int i = 0; i < n; ++i)
+            BOOST_CHECK_EQUAL(r[i], std::fmod(a[i], b[i]));
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(vec_rounding, T, full_test_types) {
+    const int n = cyme::elems_helper<T, cyme::unroll_factor::N>::size;
+    T a[n] __attribute__((aligned(64)));
+    T c[n] __attribute__((aligned(64)));
+    T d[n] __attribute__((aligned(64)));
+    std::uniform_real_distribution<T> random(-100, 100);
+    for (int i = 0; i < n; ++i)
+        a[i] = random(rng);
+    cyme::vec<T, cyme::__GETSIMD__()> va(a), vc(c), vd(d);
+    // the vertices in the trees with the scalars
+    vc = floor(va * 0.25) + ceil(va) - 2. * trunc(va) + round(va - 0.5) + rint(va) + copysign(3., va);
+    vd = ldexp(frexp(va), logb(va) + 1.) - va + fmod(va, 7.) + fmod(10., va + 200.) + ldexp(va, 3.);
+    for (int i = 0; i < n; ++i) {
+        BOOST_CHECK_EQUAL(c[i], std::floor(a[i] * T(0.25)) + std::ceil(a[i]) - 2 * std::trunc(a[i]) +
+                                    std::round(a[i] - T(0.5)) + std::rint(a[i]) + std::copysign(T(3), a[i]));
+        BOOST_CHECK_SMALL(d[i] - (std::fmod(a[i], T(7)) + std::fmod(T(10), a[i] + T(200)) + std::ldexp(a[i], 3)),
+                          T(1e-3));
+    }
+}
+
+/** binning of a periodic input: the bin of the phase |x| mod 360, the lower bound of the bin with the sign of x */
+enum properties { x, bin, lower };
+
+template <class S>
+void binning(S &W) {
+    S const &R = W;
+    W[bin] = floor(fmod(fabs(R[x]), 360.) / 16.);
+    W[lower] = copysign(W[bin] * 16., R[x]);
+}
+
+template <class T, size_t M>
+struct angle {
+    typedef T value_type;
+    static const size_t value_size = M;
+};
+
+#define TYPE typename T::value_type
+#define N T::n
+#define ORDER T::order
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(vec_rounding_binning, T, floating_point_block_types) {
+    const std::size_t size = 1031;
+    cyme::vector<angle<TYPE, N>, ORDER> c(size);
+    std::uniform_real_distribution<TYPE> random(-2000, 2000);
+    for (std::size_t k = 0; k < size; ++k)
+        c(k, x) = random(rng);
+
+    for (typename cyme::vector<angle<TYPE, N>, ORDER>::iterator it = c.begin(); it != c.end(); ++it)
+        binning(*it);
+
+    for (std::size_t k = 0; k < size; ++k) {
+        const TYPE b = std::floor(std::fmod(std::fabs(c(k, x)), TYPE(360)) / TYPE(16));
+        BOOST_CHECK_EQUAL(c(k, bin), b);
+        BOOST_CHECK_EQUAL(c(k, lower), std::copysign(b * TYPE(16), c(k, x)));
+    }
+}
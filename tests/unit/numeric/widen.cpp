@@ -0,0 +1,156 @@
+/*
+ * Cyme - widen.cpp, Copyright (c), 2014,
+ * Timothee Ewart - Swiss Federal Institute of technology in Lausanne,
+ * timothee.ewart@epfl.ch,
+ * All rights reserved.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3.0 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library.
+ */
+#include <limits>
+#include <tests/unit/test_header.hpp>
+
+using namespace cyme::test;
+
+typedef boost::mpl::list<float, int> narrow_test_types;
+
+/** random numbers of the narrow type, the extrema included */
+template <class T>
+std::vector<T> numbers() {
+    typedef std::numeric_limits<T> limits;
+    std::vector<T> v;
+    v.push_back(limits::max());
+    v.push_back(limits::lowest());
+    v.push_back(limits::min());
+    v.push_back(T(0));
+    v.push_back(T(-1));
+    std::uniform_real_distribution<double> random(-1e6, 1e6);
+    for (int k = 0; k < 1000; ++k)
+        v.push_back(T(random(rng)));
+    return v;
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(vec_simd_widen_narrow, T, narrow_test_types) {
+    typedef cyme::vec_simd<T, cyme::__GETSIMD__(), cyme::unroll_factor::N> simd_type;
+    typedef cyme::vec_simd<double, cyme::__GETSIMD__(), cyme::unroll_factor::N> simd_double;
+    const int n = cyme::elems_helper<T, cyme::unroll_factor::N>::size;
+    const int m = cyme::elems_helper<double, cyme::unroll_factor::N>::size;
+    BOOST_CHECK_EQUAL(n, 2 * m);
+    T a[n] __attribute__((aligned(64)));
+    T r[n] __attribute__((aligned(64)));
+    double d[n] __attribute__((aligned(64)));
+    const std::vector<T> v = numbers<T>();
+    for (std::size_t k = 0; k < v.size(); k += n) {
+        for (int i = 0; i < n; ++i)
+            a[i] = v[(k + i) % v.size()];
+        const std::pair<simd_double, simd_double> w = cyme::widen(simd_type(a));
+        w.first.store(d);
+        w.second.store(d + m);
+        for (int i = 0; i < n; ++i) // every lane, in the memory order
+            BOOST_CHECK_EQUAL(d[i], static_cast<double>(a[i]));
+        cyme::narrow<T>(w.first, w.second).store(r);
+        for (int i = 0; i < n; ++i)
+            BOOST_CHECK_EQUAL(r[i], a[i]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(vec_simd_widen_uint32) {
+    typedef cyme::vec_simd<std::uint32_t, cyme::__GETSIMD__(), cyme::unroll_factor::N> simd_type;
+    typedef cyme::vec_simd<double, cyme::__GETSIMD__(), cyme::unroll_factor::N> simd_double;
+    const int n = cyme::elems_helper<std::uint32_t, cyme::unroll_factor::N>::size;
+    const int m = cyme::elems_helper<double, cyme::unroll_factor::N>::size;
+    std::uint32_t a[n] __attribute__((aligned(64)));
+    double d[n] __attribute__((aligned(64)));
+    // around 2^31, the values of the sign bit of an int
+    const std::uint32_t edges[] = {0u, 1u, 0x7fffffffu, 0x80000000u, 0x80000001u, 0xfffffffeu, 0xffffffffu};
+    std::uniform_int_distribution<std::uint32_t> random(0, 0xffffffffu);
+    for (int j = 0; j < 100; ++j) {
+        for (int i = 0; i < n; ++i)
+            a[i] = (i + j < 7) ? edges[i + j] : random(rng);
+        const std::pair<simd_double, simd_double> w = cyme::widen(simd_type(a));
+        w.first.store(d);
+        w.second.store(d + m);
+        for (int i = 0; i < n; ++i) // every lane, in the memory order
+            BOOST_CHECK_EQUAL(d[i], static_cast<double>(a[i]));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(vec_simd_narrow_rounding) {
+    typedef cyme::vec_simd<double, cyme::__GETSIMD__(), cyme::unroll_factor::N> simd_double;
+    const int m = cyme::elems_helper<double, cyme::unroll_factor::N>::size;
+    double d[2 * m] __attribute__((aligned(64)));
+    float f[2 * m] __attribute__((aligned(64)));
+    int k[2 * m] __attribute__((aligned(64)));
+    std::uniform_real_distribution<double> random(-1e6, 1e6);
+    for (int j = 0; j < 100; ++j) {
+        for (int i = 0; i < 2 * m; ++i)
+            d[i] = random(rng);
+        const simd_double lo(d), hi(d + m);
+        cyme::narrow<float>(lo, hi).store(f);
+        cyme::narrow<int>(lo, hi).store(k);
+        for (int i = 0; i < 2 * m; ++i) {
+            BOOST_CHECK_EQUAL(f[i], static_cast<float>(d[i])); // rounded to the nearest
+            BOOST_CHECK_EQUAL(k[i], static_cast<int>(d[i]));   // truncated
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(vec_simd_convert_float_int) {
+    typedef cyme::vec_simd<float, cyme::__GETSIMD__(), cyme::unroll_factor::N> simd_type;
+    const int n = cyme::elems_helper<float, cyme::unroll_factor::N>::size;
+    float a[n] __attribute__((aligned(64)));
+    int r[n] __attribute__((aligned(64)));
+    std::uniform_real_distribution<float> random(-1e6, 1e6);
+    for (int j = 0; j < 100; ++j) {
+        for (int i = 0; i < n; ++i)
+            a[i] = random(rng);
+        a[0] = -2.5f;
+        cyme::convert<int>(simd_type(a)).store(r);
+        for (int i = 0; i < n; ++i)
+            BOOST_CHECK_EQUAL(r[i], static_cast<int>(a[i]));
+    }
+}
+
+/** a mixed precision kernel: float storage, the sum of squares accumulated in double, then stored in float */
+BOOST_AUTO_TEST_CASE(vec_widen_accumulation) {
+    const int n = cyme::elems_helper<float, cyme::unroll_factor::N>::size;
+    const int m = cyme::elems_helper<double, cyme::unroll_factor::N>::size;
+    const int size = 1000;
+    std::vector<float> data(size * n);
+    std::uniform_real_distribution<float> random(0, 1000);
+    for (std::size_t k = 0; k < data.size(); ++k)
+        data[k] = random(rng);
+
+    double acc[2 * m] __attribute__((aligned(64))) = {};
+    float sum[n] __attribute__((aligned(64)));
+    float a[n] __attribute__((aligned(64)));
+    cyme::vec<double, cyme::__GETSIMD__()> lo(acc), hi(acc + m);
+    for (int j = 0; j < size; ++j) {
+        std::copy(&data[j * n], &data[j * n] + n, a);
+        const cyme::vec<float, cyme::__GETSIMD__()> x(static_cast<float const *>(a));
+        const std::pair<cyme::vec<double, cyme::__GETSIMD__()>, cyme::vec<double, cyme::__GETSIMD__()>> w =
+            cyme::widen(x * 2.f);
+        lo += w.first * w.first;
+        hi += w.second * w.second;
+    }
+    cyme::vec<float, cyme::__GETSIMD__()> s(sum);
+    s = cyme::narrow<float>(lo, hi);
+
+    for (int i = 0; i < n; ++i) {
+        double reference = 0;
+        for (int j = 0; j < size; ++j)
+            reference += 4. * double(data[j * n + i]) * double(data[j * n + i]);
+        BOOST_CHECK_CLOSE(acc[i], reference, 1e-12); // a float accumulation would lose ~1e-4
+        BOOST_CHECK_CLOSE(sum[i], static_cast<float>(reference), 1e-4);
+    }
+}
@@ -131,6 +131,33 @@ void check_int(Ba &block_a, Bb &block_b) {
         }
 }
 
+/** kernel test against AoS: an AoS vector and an O vector of 1031 elements S filled alike from uniform (0.5, 2), exp
+    must not overflow. prepare(block_a, block_b) edits both, reference(block_a) computes the AoS vector, f is applied
+    to the blocks of the O vector */
+template <class S, cyme::order O, class F, class R, class P>
+void run(F f, R reference, P prepare) {
+    cyme::vector<S, cyme::AoS> block_a(1031);
+    cyme::vector<S, O> block_b(1031);
+
+    std::uniform_real_distribution<typename S::value_type> value(0.5, 2);
+    for (std::size_t i = 0; i < block_a.size(); ++i)
+        for (std::size_t j = 0; j < S::value_size; ++j)
+            block_a(i, j) = block_b(i, j) = value(rng);
+    prepare(block_a, block_b);
+
+    reference(block_a);
+    std::for_each(block_b.begin(), block_b.end(), f);
+
+    check(block_a, block_b);
+}
+
+/** kernel test against AoS, f is applied to the blocks of both vectors */
+template <class S, cyme::order O, class F>
+void run(F f) {
+    run<S, O>(f, [f](cyme::vector<S, cyme::AoS> &v) { std::for_each(v.begin(), v.end(), f); },
+              [](cyme::vector<S, cyme::AoS> &, cyme::vector<S, O> &) {});
+}
+
 template <class T, std::size_t m, cyme::order o>
 struct data {
     typedef T value_type;
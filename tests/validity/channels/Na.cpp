@@ -67,6 +67,14 @@ template <class T>
 struct f_compute {
     void operator()(T &S) { cnrn_states(S); }
 };
+
+template <class T>
+struct f_compute_block {
+    void operator()(T &S) {
+        cyme::register_block<T> W(S); // every field is loaded/stored once
+        cnrn_states(W);
+    }
+};
 } // namespace Na
 
 typedef cyme::vector<Na::channel<float>, cyme::AoSoA> Vec_f_AoSoA_Na;
@@ -114,6 +122,7 @@ Functor omp_for_each(Iterator first, Iterator last, Functor f) {
 }
 #endif
 
+template <template <class> class F>
 struct test_case {
 
     template <class T>
@@ -124,12 +133,14 @@ struct test_case {
         T Vec_AoSoA_Na(N, 0);                                              // vector AoSoA from the boost mpl
         cyme::vector<Na::channel<value_type>, cyme::AoS> Vec_AoS_Na(N, 0); // AoS - serial version
         f_init(Vec_AoSoA_Na, Vec_AoS_Na);
-        std::for_each(Vec_AoSoA_Na.begin(), Vec_AoSoA_Na.end(), Na::f_compute<storage_type>()); // AoSoS compute
+        std::for_each(Vec_AoSoA_Na.begin(), Vec_AoSoA_Na.end(), F<storage_type>()); // AoSoS compute
         std::for_each(
             Vec_AoS_Na.begin(), Vec_AoS_Na.end(),
-            Na::f_compute<typename cyme::vector<Na::channel<value_type>, cyme::AoS>::storage_type>()); // AoS compute
+            F<typename cyme::vector<Na::channel<value_type>, cyme::AoS>::storage_type>()); // AoS compute
         f_check(Vec_AoSoA_Na, Vec_AoS_Na); // check with an epsilon
     }
 };
 
-BOOST_AUTO_TEST_CASE(Na_test) { boost::mpl::for_each<vector_list>(test_case()); }
+BOOST_AUTO_TEST_CASE(Na_test) { boost::mpl::for_each<vector_list>(test_case<Na::f_compute>()); }
+
+BOOST_AUTO_TEST_CASE(Na_register_block_test) { boost::mpl::for_each<vector_list>(test_case<Na::f_compute_block>()); }